@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <memory>
+#include "domain/range.hpp"
+#include "eos/tChem.hpp"
+#include "representativeStates.hpp"
+#include "stateDomain.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablate::benchmarks {
+
+/**
+ * Integrate the chemistry over a single flow time step in each cell.  The number of cells is the benchmark argument and the items processed are the number of cells.
+ */
+static void BM_TChemComputeSource(benchmark::State& state, PetscReal dt) {
+    auto eos = std::make_shared<ablate::eos::TChem>(gri30MechanismFile);
+    const auto conservedState = Gri30State();
+    StateDomain stateDomain(eos, (PetscInt)state.range(0), conservedState.euler, conservedState.densityYi);
+
+    ablate::domain::Range cellRange;
+    stateDomain.GetCellRange(cellRange);
+    auto sourceCalculator = eos->CreateSourceCalculator(stateDomain.GetDomainFields(), cellRange);
+
+    for (auto _ : state) {
+        sourceCalculator->ComputeSource(cellRange, 0.0, dt, stateDomain.GetSolutionVector());
+    }
+    state.SetItemsProcessed(state.iterations() * (cellRange.end - cellRange.start));
+    ablate::domain::RestoreRange(cellRange);
+}
+
+/**
+ * Add the precomputed chemistry source to the rhs in each cell.  The number of cells is the benchmark argument and the items processed are the number of cells.
+ */
+static void BM_TChemAddSource(benchmark::State& state, PetscReal dt) {
+    auto eos = std::make_shared<ablate::eos::TChem>(gri30MechanismFile);
+    const auto conservedState = Gri30State();
+    StateDomain stateDomain(eos, (PetscInt)state.range(0), conservedState.euler, conservedState.densityYi);
+
+    ablate::domain::Range cellRange;
+    stateDomain.GetCellRange(cellRange);
+    auto sourceCalculator = eos->CreateSourceCalculator(stateDomain.GetDomainFields(), cellRange);
+    sourceCalculator->ComputeSource(cellRange, 0.0, dt, stateDomain.GetSolutionVector());
+
+    Vec sourceVec;
+    VecDuplicate(stateDomain.GetSolutionVector(), &sourceVec) >> utilities::PetscUtilities::checkError;
+    for (auto _ : state) {
+        VecZeroEntries(sourceVec) >> utilities::PetscUtilities::checkError;
+        sourceCalculator->AddSource(cellRange, stateDomain.GetSolutionVector(), sourceVec);
+    }
+    state.SetItemsProcessed(state.iterations() * (cellRange.end - cellRange.start));
+
+    VecDestroy(&sourceVec) >> utilities::PetscUtilities::checkError;
+    ablate::domain::RestoreRange(cellRange);
+}
+
+BENCHMARK_CAPTURE(BM_TChemComputeSource, Gri30, 1.0E-6)->ArgName("cells")->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TChemAddSource, Gri30, 1.0E-6)->ArgName("cells")->Arg(16)->Arg(64);
+
+}  // namespace ablate::benchmarks
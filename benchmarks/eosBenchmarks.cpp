@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "eos/perfectGas.hpp"
+#include "eos/stiffenedGas.hpp"
+#include "eos/tChem.hpp"
+#include "parameters/mapParameters.hpp"
+#include "representativeStates.hpp"
+#include "stateDomain.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablate::benchmarks {
+
+//! the number of states evaluated in each iteration
+static constexpr PetscInt numberEosStates = 1024;
+
+using EosFactory = std::function<std::shared_ptr<ablate::eos::EOS>()>;
+
+static std::shared_ptr<ablate::eos::EOS> CreatePerfectGas() {
+    return std::make_shared<ablate::eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287"}}));
+}
+
+static std::shared_ptr<ablate::eos::EOS> CreateStiffenedGas() { return std::make_shared<ablate::eos::StiffenedGas>(std::make_shared<parameters::MapParameters>()); }
+
+static std::shared_ptr<ablate::eos::EOS> CreateTChem() { return std::make_shared<ablate::eos::TChem>(gri30MechanismFile); }
+
+/**
+ * Compute the property at each state using the point function.  The items processed are the number of states.
+ */
+static void BM_ThermodynamicFunction(benchmark::State& state, const EosFactory& createEos, const ConservedState& conservedState, ablate::eos::ThermodynamicProperty property) {
+    auto eos = createEos();
+    StateDomain stateDomain(eos, numberEosStates, conservedState.euler, conservedState.densityYi);
+    auto function = eos->GetThermodynamicFunction(property, stateDomain.GetFields());
+
+    const auto& conserved = stateDomain.GetConserved();
+    std::vector<PetscReal> values(numberEosStates * function.propertySize);
+    for (auto _ : state) {
+        for (PetscInt c = 0; c < numberEosStates; ++c) {
+            function.function(conserved.data() + c * stateDomain.GetStride(), values.data() + c * function.propertySize, function.context.get()) >>
+                utilities::PetscUtilities::checkError;
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numberEosStates);
+}
+
+/**
+ * Compute the property at each state using the point function with a known temperature.  The items processed are the number of states.
+ */
+static void BM_ThermodynamicTemperatureFunction(benchmark::State& state, const EosFactory& createEos, const ConservedState& conservedState, ablate::eos::ThermodynamicProperty property) {
+    auto eos = createEos();
+    StateDomain stateDomain(eos, numberEosStates, conservedState.euler, conservedState.densityYi);
+    auto temperatureFunction = eos->GetThermodynamicFunction(ablate::eos::ThermodynamicProperty::Temperature, stateDomain.GetFields());
+    auto function = eos->GetThermodynamicTemperatureFunction(property, stateDomain.GetFields());
+
+    // compute the known temperature once
+    const auto& conserved = stateDomain.GetConserved();
+    std::vector<PetscReal> temperature(numberEosStates);
+    for (PetscInt c = 0; c < numberEosStates; ++c) {
+        temperatureFunction.function(conserved.data() + c * stateDomain.GetStride(), temperature.data() + c, temperatureFunction.context.get()) >> utilities::PetscUtilities::checkError;
+    }
+
+    std::vector<PetscReal> values(numberEosStates * function.propertySize);
+    for (auto _ : state) {
+        for (PetscInt c = 0; c < numberEosStates; ++c) {
+            function.function(conserved.data() + c * stateDomain.GetStride(), temperature[c], values.data() + c * function.propertySize, function.context.get()) >>
+                utilities::PetscUtilities::checkError;
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numberEosStates);
+}
+
+/**
+ * Compute the property over all states using the batch function.  The items processed are the number of states.
+ */
+static void BM_ThermodynamicBatchFunction(benchmark::State& state, const EosFactory& createEos, const ConservedState& conservedState, ablate::eos::ThermodynamicProperty property) {
+    auto eos = createEos();
+    StateDomain stateDomain(eos, numberEosStates, conservedState.euler, conservedState.densityYi);
+    auto function = eos->GetThermodynamicBatchFunction(property, stateDomain.GetFields());
+
+    const auto& conserved = stateDomain.GetConserved();
+    std::vector<PetscReal> values(numberEosStates * function.propertySize);
+    for (auto _ : state) {
+        function.function(numberEosStates, conserved.data(), stateDomain.GetStride(), nullptr, values.data(), function.context.get()) >> utilities::PetscUtilities::checkError;
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numberEosStates);
+}
+
+// perfect gas
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, PerfectGas/Pressure, CreatePerfectGas, AirState(), ablate::eos::ThermodynamicProperty::Pressure);
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, PerfectGas/Temperature, CreatePerfectGas, AirState(), ablate::eos::ThermodynamicProperty::Temperature);
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, PerfectGas/SpeedOfSound, CreatePerfectGas, AirState(), ablate::eos::ThermodynamicProperty::SpeedOfSound);
+BENCHMARK_CAPTURE(BM_ThermodynamicTemperatureFunction, PerfectGas/SpeedOfSound, CreatePerfectGas, AirState(), ablate::eos::ThermodynamicProperty::SpeedOfSound);
+BENCHMARK_CAPTURE(BM_ThermodynamicBatchFunction, PerfectGas/Pressure, CreatePerfectGas, AirState(), ablate::eos::ThermodynamicProperty::Pressure);
+
+// stiffened gas
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, StiffenedGas/Pressure, CreateStiffenedGas, WaterState(), ablate::eos::ThermodynamicProperty::Pressure);
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, StiffenedGas/Temperature, CreateStiffenedGas, WaterState(), ablate::eos::ThermodynamicProperty::Temperature);
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, StiffenedGas/SpeedOfSound, CreateStiffenedGas, WaterState(), ablate::eos::ThermodynamicProperty::SpeedOfSound);
+BENCHMARK_CAPTURE(BM_ThermodynamicTemperatureFunction, StiffenedGas/SpeedOfSound, CreateStiffenedGas, WaterState(), ablate::eos::ThermodynamicProperty::SpeedOfSound);
+BENCHMARK_CAPTURE(BM_ThermodynamicBatchFunction, StiffenedGas/Pressure, CreateStiffenedGas, WaterState(), ablate::eos::ThermodynamicProperty::Pressure);
+
+// tChem, where the temperature is decoded from the internal energy
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, TChem/Pressure, CreateTChem, Gri30State(), ablate::eos::ThermodynamicProperty::Pressure);
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, TChem/Temperature, CreateTChem, Gri30State(), ablate::eos::ThermodynamicProperty::Temperature);
+BENCHMARK_CAPTURE(BM_ThermodynamicFunction, TChem/SpeedOfSound, CreateTChem, Gri30State(), ablate::eos::ThermodynamicProperty::SpeedOfSound);
+BENCHMARK_CAPTURE(BM_ThermodynamicTemperatureFunction, TChem/SpeedOfSound, CreateTChem, Gri30State(), ablate::eos::ThermodynamicProperty::SpeedOfSound);
+BENCHMARK_CAPTURE(BM_ThermodynamicTemperatureFunction, TChem/SpecificHeatConstantPressure, CreateTChem, Gri30State(), ablate::eos::ThermodynamicProperty::SpecificHeatConstantPressure);
+BENCHMARK_CAPTURE(BM_ThermodynamicBatchFunction, TChem/Temperature, CreateTChem, Gri30State(), ablate::eos::ThermodynamicProperty::Temperature);
+
+}  // namespace ablate::benchmarks
@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/initializer.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "eos/perfectGas.hpp"
+#include "finiteVolume/boundaryConditions/essentialGhost.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/compressibleFlowSolver.hpp"
+#include "finiteVolume/fluxCalculator/ausm.hpp"
+#include "mathFunctions/fieldFunction.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablate::benchmarks {
+
+/**
+ * Sets up a compressible flow solver for a perfect gas on a square box mesh with ghost boundary cells.  The number of cells in each direction is the benchmark argument.
+ * The initial condition is a density wave at constant pressure so that the gradients and limiters are active.
+ */
+class CompressibleFlowRhsFixture : public benchmark::Fixture {
+   protected:
+    std::shared_ptr<domain::BoxMesh> mesh;
+    std::shared_ptr<solver::TimeStepper> timeStepper;
+    std::shared_ptr<finiteVolume::CompressibleFlowSolver> flowSolver;
+    PetscInt numberCells = 0;
+
+   public:
+    void SetUp(const benchmark::State& state) override {
+        const auto nx = (int)state.range(0);
+        numberCells = (PetscInt)nx * nx;
+
+        auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287"}}));
+
+        mesh = std::make_shared<domain::BoxMesh>(
+            "benchmarkMesh",
+            std::vector<std::shared_ptr<domain::FieldDescriptor>>{std::make_shared<finiteVolume::CompressibleFlowFields>(eos)},
+            std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(), std::make_shared<domain::modifiers::GhostBoundaryCells>()},
+            std::vector<int>{nx, nx},
+            std::vector<double>{0.0, 0.0},
+            std::vector<double>{1.0, 1.0},
+            std::vector<std::string>{} /*boundary*/,
+            false /*simplex*/);
+
+        // rho = 1.1 + 0.1 sin(2 pi x), u = 100, p = 101325
+        auto eulerField = std::make_shared<mathFunctions::FieldFunction>(
+            finiteVolume::CompressibleFlowFields::EULER_FIELD,
+            mathFunctions::Create("1.1 + 0.1*sin(2*_pi*x), 253312.5 + 5000*(1.1 + 0.1*sin(2*_pi*x)), 100*(1.1 + 0.1*sin(2*_pi*x)), 0.0"));
+
+        timeStepper = std::make_shared<solver::TimeStepper>(mesh, nullptr, nullptr, std::make_shared<domain::Initializer>(eulerField));
+
+        auto boundaryConditions = std::vector<std::shared_ptr<finiteVolume::boundaryConditions::BoundaryCondition>>{
+            std::make_shared<finiteVolume::boundaryConditions::EssentialGhost>("walls", std::vector<int>{1}, eulerField)};
+
+        flowSolver = std::make_shared<finiteVolume::CompressibleFlowSolver>("benchmarkFlow",
+                                                                            domain::Region::ENTIREDOMAIN,
+                                                                            nullptr /*options*/,
+                                                                            eos,
+                                                                            std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"cfl", "0.5"}}),
+                                                                            nullptr /*transportModel*/,
+                                                                            std::make_shared<finiteVolume::fluxCalculator::Ausm>(),
+                                                                            boundaryConditions);
+        timeStepper->Register(flowSolver);
+        timeStepper->Initialize();
+    }
+
+    void TearDown(const benchmark::State&) override {
+        flowSolver.reset();
+        timeStepper.reset();
+        mesh.reset();
+    }
+};
+
+/**
+ * Compute only the finite volume solver rhs (the CellInterpolant gradients, face fluxes, and point sources) with the boundary and aux fields already updated.  The
+ * items processed are the number of cells.
+ */
+BENCHMARK_DEFINE_F(CompressibleFlowRhsFixture, ComputeRHSFunction)(benchmark::State& state) {
+    DM dm = mesh->GetDM();
+    Vec locX, locF;
+    DMGetLocalVector(dm, &locX) >> utilities::PetscUtilities::checkError;
+    DMGetLocalVector(dm, &locF) >> utilities::PetscUtilities::checkError;
+    VecZeroEntries(locX) >> utilities::PetscUtilities::checkError;
+    DMGlobalToLocal(dm, timeStepper->GetSolutionVector(), INSERT_VALUES, locX) >> utilities::PetscUtilities::checkError;
+    flowSolver->ComputeBoundary(0.0, locX, nullptr) >> utilities::PetscUtilities::checkError;
+    flowSolver->PreRHSFunction(timeStepper->GetTS(), 0.0, true, locX) >> utilities::PetscUtilities::checkError;
+
+    for (auto _ : state) {
+        VecZeroEntries(locF) >> utilities::PetscUtilities::checkError;
+        flowSolver->ComputeRHSFunction(0.0, locX, locF) >> utilities::PetscUtilities::checkError;
+    }
+    state.SetItemsProcessed(state.iterations() * numberCells);
+
+    DMRestoreLocalVector(dm, &locX) >> utilities::PetscUtilities::checkError;
+    DMRestoreLocalVector(dm, &locF) >> utilities::PetscUtilities::checkError;
+}
+
+/**
+ * Compute the full ts rhs, including the halo exchange, boundary update, and aux field update.  The items processed are the number of cells.
+ */
+BENCHMARK_DEFINE_F(CompressibleFlowRhsFixture, TSComputeRHSFunction)(benchmark::State& state) {
+    Vec rhs;
+    VecDuplicate(timeStepper->GetSolutionVector(), &rhs) >> utilities::PetscUtilities::checkError;
+
+    for (auto _ : state) {
+        TSComputeRHSFunction(timeStepper->GetTS(), 0.0, timeStepper->GetSolutionVector(), rhs) >> utilities::PetscUtilities::checkError;
+    }
+    state.SetItemsProcessed(state.iterations() * numberCells);
+
+    VecDestroy(&rhs) >> utilities::PetscUtilities::checkError;
+}
+
+BENCHMARK_REGISTER_F(CompressibleFlowRhsFixture, ComputeRHSFunction)->ArgName("nx")->Arg(32)->Arg(64)->Arg(128)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(CompressibleFlowRhsFixture, TSComputeRHSFunction)->ArgName("nx")->Arg(32)->Arg(64)->Arg(128)->Unit(benchmark::kMicrosecond);
+
+}  // namespace ablate::benchmarks
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "eos/perfectGas.hpp"
+#include "eos/stiffenedGas.hpp"
+#include "finiteVolume/fluxCalculator/ausm.hpp"
+#include "finiteVolume/fluxCalculator/ausmpUp.hpp"
+#include "finiteVolume/fluxCalculator/riemann.hpp"
+#include "finiteVolume/fluxCalculator/riemann2Gas.hpp"
+#include "finiteVolume/fluxCalculator/riemannStiff.hpp"
+#include "parameters/mapParameters.hpp"
+
+namespace ablate::benchmarks {
+
+/**
+ * The left and right states passed to the flux calculator function
+ */
+struct FluxStates {
+    PetscReal uL;
+    PetscReal aL;
+    PetscReal rhoL;
+    PetscReal pL;
+    PetscReal uR;
+    PetscReal aR;
+    PetscReal rhoR;
+    PetscReal pR;
+};
+
+/**
+ * Build the flux states from the primitive values (u, rho, p) using the speed of sound for a stiffened gas
+ */
+static FluxStates CreateFluxStates(PetscReal gamma, PetscReal p0, PetscReal uL, PetscReal rhoL, PetscReal pL, PetscReal uR, PetscReal rhoR, PetscReal pR) {
+    return FluxStates{.uL = uL,
+                      .aL = PetscSqrtReal(gamma * (pL + p0) / rhoL),
+                      .rhoL = rhoL,
+                      .pL = pL,
+                      .uR = uR,
+                      .aR = PetscSqrtReal(gamma * (pR + p0) / rhoR),
+                      .rhoR = rhoR,
+                      .pR = pR};
+}
+
+/**
+ * Representative face states for air (gamma = 1.4): quiescent, subsonic, a shock tube, supersonic, and reversed flow
+ */
+static const std::vector<FluxStates>& GasFluxStates() {
+    static const std::vector<FluxStates> states = {CreateFluxStates(1.4, 0.0, 0.0, 1.2, 101325.0, 0.0, 1.2, 101325.0),
+                                                   CreateFluxStates(1.4, 0.0, 50.0, 1.2, 100000.0, 30.0, 1.1, 90000.0),
+                                                   CreateFluxStates(1.4, 0.0, 0.0, 1.0, 100000.0, 0.0, 0.125, 10000.0),
+                                                   CreateFluxStates(1.4, 0.0, 800.0, 1.2, 101325.0, 780.0, 1.0, 90000.0),
+                                                   CreateFluxStates(1.4, 0.0, -300.0, 0.9, 80000.0, -320.0, 1.3, 120000.0)};
+    return states;
+}
+
+/**
+ * Representative face states for water using the default stiffened gas parameters
+ */
+static const std::vector<FluxStates>& LiquidFluxStates() {
+    static const std::vector<FluxStates> states = {CreateFluxStates(1.932, 1.1645e9, 0.0, 998.0, 101325.0, 0.0, 998.0, 101325.0),
+                                                   CreateFluxStates(1.932, 1.1645e9, 10.0, 1000.0, 1.0e7, 0.0, 998.0, 101325.0),
+                                                   CreateFluxStates(1.932, 1.1645e9, -5.0, 997.0, 101325.0, 5.0, 999.0, 2.0e5)};
+    return states;
+}
+
+/**
+ * March over each of the face states calling the flux calculator function.  The items processed are the number of flux calls.
+ */
+static void BM_FluxCalculator(benchmark::State& state, const std::function<std::shared_ptr<finiteVolume::fluxCalculator::FluxCalculator>()>& createFluxCalculator,
+                              const std::vector<FluxStates>& fluxStates) {
+    auto fluxCalculator = createFluxCalculator();
+    auto function = fluxCalculator->GetFluxCalculatorFunction();
+    auto context = fluxCalculator->GetFluxCalculatorContext();
+
+    for (auto _ : state) {
+        for (const auto& s : fluxStates) {
+            PetscReal massFlux, p12;
+            auto direction = function(context, s.uL, s.aL, s.rhoL, s.pL, s.uR, s.aR, s.rhoR, s.pR, &massFlux, &p12);
+            benchmark::DoNotOptimize(direction);
+            benchmark::DoNotOptimize(massFlux);
+            benchmark::DoNotOptimize(p12);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)fluxStates.size());
+}
+
+static std::shared_ptr<ablate::eos::EOS> CreateAir() {
+    return std::make_shared<ablate::eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+}
+
+static std::shared_ptr<ablate::eos::EOS> CreateWater() { return std::make_shared<ablate::eos::StiffenedGas>(std::make_shared<parameters::MapParameters>()); }
+
+BENCHMARK_CAPTURE(BM_FluxCalculator, Ausm, []() { return std::make_shared<finiteVolume::fluxCalculator::Ausm>(); }, GasFluxStates());
+BENCHMARK_CAPTURE(BM_FluxCalculator, AusmpUp, []() { return std::make_shared<finiteVolume::fluxCalculator::AusmpUp>(0.1); }, GasFluxStates());
+BENCHMARK_CAPTURE(BM_FluxCalculator, Riemann, []() { return std::make_shared<finiteVolume::fluxCalculator::Riemann>(CreateAir()); }, GasFluxStates());
+BENCHMARK_CAPTURE(BM_FluxCalculator, Riemann2Gas, []() { return std::make_shared<finiteVolume::fluxCalculator::Riemann2Gas>(CreateAir(), CreateAir()); }, GasFluxStates());
+BENCHMARK_CAPTURE(BM_FluxCalculator, RiemannStiff, []() { return std::make_shared<finiteVolume::fluxCalculator::RiemannStiff>(CreateWater(), CreateWater()); }, LiquidFluxStates());
+
+}  // namespace ablate::benchmarks
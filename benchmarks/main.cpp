@@ -0,0 +1,18 @@
+#include <benchmark/benchmark.h>
+#include "environment/runEnvironment.hpp"
+#include "utilities/petscUtilities.hpp"
+
+int main(int argc, char** argv) {
+    // strip the benchmark arguments before handing the remaining arguments to petsc
+    ::benchmark::Initialize(&argc, argv);
+
+    // initialize petsc and mpi
+    ablate::environment::RunEnvironment::Initialize(&argc, &argv);
+    ablate::utilities::PetscUtilities::Initialize();
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+
+    ablate::environment::RunEnvironment::Finalize();
+    return 0;
+}
@@ -0,0 +1,62 @@
+#ifndef ABLATELIBRARY_REPRESENTATIVESTATES_HPP
+#define ABLATELIBRARY_REPRESENTATIVESTATES_HPP
+
+#include <petsc.h>
+#include <filesystem>
+#include <vector>
+
+namespace ablate::benchmarks {
+
+/**
+ * The conserved state for a one dimensional cell
+ */
+struct ConservedState {
+    //! the conserved euler values (rho, rhoE, rhoU)
+    std::vector<PetscReal> euler;
+    //! the optional conserved species values
+    std::vector<PetscReal> densityYi;
+};
+
+/**
+ * Compute the conserved euler values for a stiffened gas (p0 = 0 for a perfect gas)
+ * @param gamma
+ * @param p0
+ * @param rho
+ * @param u
+ * @param p
+ * @return
+ */
+inline ConservedState StiffenedGasState(PetscReal gamma, PetscReal p0, PetscReal rho, PetscReal u, PetscReal p) {
+    return ConservedState{.euler = {rho, (p + gamma * p0) / (gamma - 1.0) + 0.5 * rho * u * u, rho * u}};
+}
+
+/**
+ * Air at atmospheric conditions moving at 100 m/s
+ * @return
+ */
+inline ConservedState AirState() { return StiffenedGasState(1.4, 0.0, 1.1, 100.0, 101325.0); }
+
+/**
+ * Water at atmospheric conditions moving at 1 m/s using the default stiffened gas parameters
+ * @return
+ */
+inline ConservedState WaterState() { return StiffenedGasState(1.932, 1.1645e9, 998.0, 1.0, 101325.0); }
+
+//! the mechanism file used for the reacting states, relative to the benchmark working directory
+inline const std::filesystem::path gri30MechanismFile = "inputs/eos/gri30.yaml";
+
+/**
+ * A partially burned methane/air mixture for the gri30 mechanism
+ * @return
+ */
+inline ConservedState Gri30State() {
+    return ConservedState{.euler = {0.280629, 214342., 0.},
+                          .densityYi = {2.70155e-06, 2.42588e-10, 1.75298e-09, 0.0615735,   5.91967e-09, 0.00013291,  1.42223e-06, 2.69273e-07, 1.17659e-25,  2.62694e-19, 1.04261e-12,
+                                        1.55473e-13, 3.29875e-06, 0.0153352,   3.5785e-05,  2.61125e-07, 2.32785e-10, 0.000118819, 2.02248e-12, 3.19032e-09,  1.6112e-06,  3.70467e-18,
+                                        1.90909e-09, 1.00394e-12, 3.84067e-06, 1.46041e-09, 5.52161e-05, 1.51027e-14, 3.77118e-08, 8.45969e-14, 1.76002e-20,  3.66826e-19, 2.92689e-20,
+                                        3.18488e-20, 4.77626e-15, 1.73259e-15, 1.22235e-15, 1.81966e-10, 7.66494e-19, 1.00758e-26, 1.13374e-17, 2.26247e-22,  3.89214e-21, 2.08805e-21,
+                                        1.82355e-22, 2.25953e-19, 1.26537e-19, 0.0,         6.78129e-13, 1.13467e-08, 8.23985e-12, 1.12011e-10, 0.203364}};
+}
+
+}  // namespace ablate::benchmarks
+#endif  // ABLATELIBRARY_REPRESENTATIVESTATES_HPP
@@ -0,0 +1,60 @@
+#include "stateDomain.hpp"
+#include <algorithm>
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "utilities/petscUtilities.hpp"
+
+ablate::benchmarks::StateDomain::StateDomain(const std::shared_ptr<ablate::eos::EOS>& eos, PetscInt numberCells, const std::vector<PetscReal>& euler, const std::vector<PetscReal>& densityYi)
+    : mesh(std::make_shared<ablate::domain::BoxMesh>("stateDomain",
+                                                     std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                     std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                     std::vector<int>{(int)numberCells},
+                                                     std::vector<double>{0.0},
+                                                     std::vector<double>{1.0})) {
+    mesh->InitializeSubDomains();
+
+    // size the conserved array based upon the solution fields in the subDomain
+    const auto& fields = GetFields();
+    for (const auto& field : fields) {
+        stride += field.numberComponents;
+    }
+    conserved.resize(numberCells * stride, 0.0);
+
+    // set the state in each cell of the solution vector and the conserved array
+    const auto& eulerField = mesh->GetField(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD);
+    const auto& subEulerField = *std::find_if(fields.begin(), fields.end(), [](const auto& field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+
+    ablate::domain::Range cellRange;
+    GetCellRange(cellRange);
+    PetscScalar* solution;
+    VecGetArray(mesh->GetSolutionVector(), &solution) >> utilities::PetscUtilities::checkError;
+    for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+        const PetscInt cell = cellRange.GetPoint(i);
+        const PetscInt index = i - cellRange.start;
+
+        PetscScalar* eulerValues = nullptr;
+        DMPlexPointGlobalFieldRef(mesh->GetDM(), cell, eulerField.id, solution, &eulerValues) >> utilities::PetscUtilities::checkError;
+        for (std::size_t e = 0; e < euler.size(); ++e) {
+            eulerValues[e] = euler[e];
+            conserved[index * stride + subEulerField.offset + e] = euler[e];
+        }
+
+        if (!densityYi.empty()) {
+            const auto& densityYiField = mesh->GetField(ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD);
+            const auto& subDensityYiField =
+                *std::find_if(fields.begin(), fields.end(), [](const auto& field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD; });
+
+            PetscScalar* densityYiValues = nullptr;
+            DMPlexPointGlobalFieldRef(mesh->GetDM(), cell, densityYiField.id, solution, &densityYiValues) >> utilities::PetscUtilities::checkError;
+            for (std::size_t s = 0; s < densityYi.size(); ++s) {
+                densityYiValues[s] = densityYi[s];
+                conserved[index * stride + subDensityYiField.offset + s] = densityYi[s];
+            }
+        }
+    }
+    VecRestoreArray(mesh->GetSolutionVector(), &solution) >> utilities::PetscUtilities::checkError;
+    ablate::domain::RestoreRange(cellRange);
+}
+
+const std::vector<ablate::domain::Field>& ablate::benchmarks::StateDomain::GetFields() const { return mesh->GetSubDomain(ablate::domain::Region::ENTIREDOMAIN)->GetFields(); }
+
+void ablate::benchmarks::StateDomain::GetCellRange(ablate::domain::Range& cellRange) const { ablate::domain::GetCellRange(mesh->GetDM(), ablate::domain::Region::ENTIREDOMAIN, cellRange); }
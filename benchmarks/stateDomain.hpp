@@ -0,0 +1,83 @@
+#ifndef ABLATELIBRARY_STATEDOMAIN_HPP
+#define ABLATELIBRARY_STATEDOMAIN_HPP
+
+#include <petsc.h>
+#include <memory>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/field.hpp"
+#include "domain/range.hpp"
+#include "eos/eos.hpp"
+
+namespace ablate::benchmarks {
+
+/**
+ * A one dimensional box mesh holding the compressible flow fields for an equation of state where every cell is set to the same conserved state.  The cells provide a
+ * representative batch of states for the eos, transport, and chemistry benchmarks.
+ */
+class StateDomain {
+   private:
+    //! the mesh holding the states
+    std::shared_ptr<ablate::domain::BoxMesh> mesh;
+
+    //! the conserved values for each cell separated by the stride
+    std::vector<PetscReal> conserved;
+
+    //! the number of conserved values for each cell
+    PetscInt stride = 0;
+
+   public:
+    /**
+     * Create the domain and set the state in each cell
+     * @param eos
+     * @param numberCells
+     * @param euler the conserved euler values (rho, rhoE, rhoU)
+     * @param densityYi the optional conserved species values
+     */
+    StateDomain(const std::shared_ptr<ablate::eos::EOS>& eos, PetscInt numberCells, const std::vector<PetscReal>& euler, const std::vector<PetscReal>& densityYi = {});
+
+    /**
+     * The solution fields with offsets in the conserved array
+     * @return
+     */
+    [[nodiscard]] const std::vector<ablate::domain::Field>& GetFields() const;
+
+    /**
+     * The domain fields used to create source calculators
+     * @return
+     */
+    [[nodiscard]] const std::vector<ablate::domain::Field>& GetDomainFields() const { return mesh->GetFields(); }
+
+    /**
+     * The global solution vector holding the states
+     * @return
+     */
+    [[nodiscard]] Vec GetSolutionVector() const { return mesh->GetSolutionVector(); }
+
+    /**
+     * Get the range of cells holding the states
+     * @param cellRange
+     */
+    void GetCellRange(ablate::domain::Range& cellRange) const;
+
+    /**
+     * The conserved values for each cell separated by the stride
+     * @return
+     */
+    [[nodiscard]] const std::vector<PetscReal>& GetConserved() const { return conserved; }
+
+    /**
+     * The number of conserved values for each cell
+     * @return
+     */
+    [[nodiscard]] PetscInt GetStride() const { return stride; }
+
+    /**
+     * The number of cells/states in the domain
+     * @return
+     */
+    [[nodiscard]] PetscInt GetNumberCells() const { return stride ? (PetscInt)conserved.size() / stride : 0; }
+};
+
+}  // namespace ablate::benchmarks
+#endif  // ABLATELIBRARY_STATEDOMAIN_HPP
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "eos/perfectGas.hpp"
+#include "eos/tChem.hpp"
+#include "eos/transport/sutherland.hpp"
+#include "parameters/mapParameters.hpp"
+#include "representativeStates.hpp"
+#include "stateDomain.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablate::benchmarks {
+
+//! the number of states evaluated in each iteration
+static constexpr PetscInt numberTransportStates = 1024;
+
+using TransportEosFactory = std::function<std::shared_ptr<ablate::eos::EOS>()>;
+
+static std::shared_ptr<ablate::eos::EOS> CreateTransportPerfectGas() {
+    return std::make_shared<ablate::eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287"}}));
+}
+
+static std::shared_ptr<ablate::eos::EOS> CreateTransportTChem() { return std::make_shared<ablate::eos::TChem>(gri30MechanismFile); }
+
+/**
+ * Compute the sutherland transport property at each state, including the temperature decode from the eos.  The items processed are the number of states.
+ */
+static void BM_SutherlandFunction(benchmark::State& state, const TransportEosFactory& createEos, const ConservedState& conservedState, ablate::eos::transport::TransportProperty property) {
+    auto eos = createEos();
+    StateDomain stateDomain(eos, numberTransportStates, conservedState.euler, conservedState.densityYi);
+    ablate::eos::transport::Sutherland sutherland(eos);
+    auto function = sutherland.GetTransportFunction(property, stateDomain.GetFields());
+
+    const auto& conserved = stateDomain.GetConserved();
+    std::vector<PetscReal> values(numberTransportStates * function.propertySize);
+    for (auto _ : state) {
+        for (PetscInt c = 0; c < numberTransportStates; ++c) {
+            function.function(conserved.data() + c * stateDomain.GetStride(), values.data() + c * function.propertySize, function.context.get()) >>
+                utilities::PetscUtilities::checkError;
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numberTransportStates);
+}
+
+/**
+ * Compute the sutherland transport property at each state with a known temperature.  The items processed are the number of states.
+ */
+static void BM_SutherlandTemperatureFunction(benchmark::State& state, const TransportEosFactory& createEos, const ConservedState& conservedState,
+                                             ablate::eos::transport::TransportProperty property) {
+    auto eos = createEos();
+    StateDomain stateDomain(eos, numberTransportStates, conservedState.euler, conservedState.densityYi);
+    ablate::eos::transport::Sutherland sutherland(eos);
+    auto temperatureFunction = eos->GetThermodynamicFunction(ablate::eos::ThermodynamicProperty::Temperature, stateDomain.GetFields());
+    auto function = sutherland.GetTransportTemperatureFunction(property, stateDomain.GetFields());
+
+    // compute the known temperature once
+    const auto& conserved = stateDomain.GetConserved();
+    std::vector<PetscReal> temperature(numberTransportStates);
+    for (PetscInt c = 0; c < numberTransportStates; ++c) {
+        temperatureFunction.function(conserved.data() + c * stateDomain.GetStride(), temperature.data() + c, temperatureFunction.context.get()) >> utilities::PetscUtilities::checkError;
+    }
+
+    std::vector<PetscReal> values(numberTransportStates * function.propertySize);
+    for (auto _ : state) {
+        for (PetscInt c = 0; c < numberTransportStates; ++c) {
+            function.function(conserved.data() + c * stateDomain.GetStride(), temperature[c], values.data() + c * function.propertySize, function.context.get()) >>
+                utilities::PetscUtilities::checkError;
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numberTransportStates);
+}
+
+BENCHMARK_CAPTURE(BM_SutherlandFunction, PerfectGas/Conductivity, CreateTransportPerfectGas, AirState(), ablate::eos::transport::TransportProperty::Conductivity);
+BENCHMARK_CAPTURE(BM_SutherlandFunction, PerfectGas/Viscosity, CreateTransportPerfectGas, AirState(), ablate::eos::transport::TransportProperty::Viscosity);
+BENCHMARK_CAPTURE(BM_SutherlandFunction, PerfectGas/Diffusivity, CreateTransportPerfectGas, AirState(), ablate::eos::transport::TransportProperty::Diffusivity);
+BENCHMARK_CAPTURE(BM_SutherlandTemperatureFunction, PerfectGas/Conductivity, CreateTransportPerfectGas, AirState(), ablate::eos::transport::TransportProperty::Conductivity);
+BENCHMARK_CAPTURE(BM_SutherlandFunction, TChem/Conductivity, CreateTransportTChem, Gri30State(), ablate::eos::transport::TransportProperty::Conductivity);
+BENCHMARK_CAPTURE(BM_SutherlandFunction, TChem/Viscosity, CreateTransportTChem, Gri30State(), ablate::eos::transport::TransportProperty::Viscosity);
+BENCHMARK_CAPTURE(BM_SutherlandTemperatureFunction, TChem/Conductivity, CreateTransportTChem, Gri30State(), ablate::eos::transport::TransportProperty::Conductivity);
+
+}  // namespace ablate::benchmarks
@@ -408,7 +408,7 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
     // Get the size of the field
     PetscInt scratchSize;
     PetscCall(PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &scratchSize));
-    std::vector<PetscScalar> distributedSourceScratch(scratchSize);
+    distributedSourceScratch.resize(scratchSize);
 
     // Get the region to march over
     if (!gradientStencils.empty()) {
@@ -422,35 +422,44 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
         PetscCall(VecGetArray(locFVec, &locFArray));
 
         // Store pointers to the stencil variables
-        std::vector<const PetscScalar*> inputStencilValues(maximumStencilSize);
-        std::vector<const PetscScalar*> auxStencilValues(maximumStencilSize);
+        inputStencilValues.resize(maximumStencilSize);
+        auxStencilValues.resize(maximumStencilSize);
 
-        // March over each boundary function
-        for (const auto& function : activeBoundarySourceFunctions) {
-            auto sourceOffsetsPointer = function.sourceFieldsOffset.data();
-            auto inputOffsetsPointer = function.inputFieldsOffset.data();
-            auto auxOffsetsPointer = function.auxFieldsOffset.data();
+        // Get the vec DM from the locFArray, used for face based functions
+        DM vecDm;
+        PetscCall(VecGetDM(locFVec, &vecDm));
 
-            // March over each cell in this region
-            for (const auto& stencilInfo : gradientStencils) {
-                // Get the cell geom
-                const PetscFVCellGeom* cg;
-                PetscCall(DMPlexPointLocalRead(dmCell, stencilInfo.cellId, cellGeomArray, &cg));
+        // March over each cell in this region, gathering the stencil once for every boundary function
+        for (const auto& stencilInfo : gradientStencils) {
+            const PetscInt* stencil = boundaryStencils.stencil.data() + stencilInfo.stencilOffset;
+            const PetscScalar* gradientWeights = GetGradientWeights(stencilInfo);
+            const PetscScalar* distributionWeights = boundaryStencils.distributionWeights.data() + stencilInfo.stencilOffset;
+            const PetscScalar* volumes = boundaryStencils.volumes.data() + stencilInfo.stencilOffset;
 
-                // Get pointers to the area of interest
-                const PetscScalar *solPt, *auxPt = nullptr;
-                PetscCall(DMPlexPointLocalRead(dm, stencilInfo.cellId, locXArray, &solPt));
+            // Get the cell geom
+            const PetscFVCellGeom* cg;
+            PetscCall(DMPlexPointLocalRead(dmCell, stencilInfo.cellId, cellGeomArray, &cg));
+
+            // Get pointers to the area of interest
+            const PetscScalar *solPt, *auxPt = nullptr;
+            PetscCall(DMPlexPointLocalRead(dm, stencilInfo.cellId, locXArray, &solPt));
+            if (auxDM) {
+                PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.cellId, locAuxArray, &auxPt));
+            }
+
+            // Get each of the stencil pts
+            for (PetscInt p = 0; p < stencilInfo.stencilSize; p++) {
+                PetscCall(DMPlexPointLocalRead(dm, stencil[p], locXArray, &inputStencilValues[p]));
                 if (auxDM) {
-                    PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.cellId, locAuxArray, &auxPt));
+                    PetscCall(DMPlexPointLocalRead(auxDM, stencil[p], locAuxArray, &auxStencilValues[p]));
                 }
+            }
 
-                // Get each of the stencil pts
-                for (PetscInt p = 0; p < stencilInfo.stencilSize; p++) {
-                    PetscCall(DMPlexPointLocalRead(dm, stencilInfo.stencil[p], locXArray, &inputStencilValues[p]));
-                    if (auxDM) {
-                        PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.stencil[p], locAuxArray, &auxStencilValues[p]));
-                    }
-                }
+            // March over each boundary function
+            for (const auto& function : activeBoundarySourceFunctions) {
+                auto sourceOffsetsPointer = function.sourceFieldsOffset.data();
+                auto inputOffsetsPointer = function.inputFieldsOffset.data();
+                auto auxOffsetsPointer = function.auxFieldsOffset.data();
 
                 // Get the pointer to the rhs
                 switch (function.type) {
@@ -472,8 +481,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxPt,
                                                     auxStencilValues.data(),
                                                     stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencil,
+                                                    gradientWeights,
                                                     sourceOffsetsPointer,
                                                     rhs,
                                                     function.context));
@@ -498,8 +507,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxPt,
                                                     auxStencilValues.data(),
                                                     stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencil,
+                                                    gradientWeights,
                                                     sourceOffsetsPointer,
                                                     distributedSourceScratch.data(),
                                                     function.context));
@@ -507,11 +516,11 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                         // Now distribute to each stencil point
                         for (PetscInt s = 0; s < stencilInfo.stencilSize; ++s) {
                             // Get the point in the rhs for this point.  It might be ghost but that is ok, the values are added together later
-                            PetscCall(DMPlexPointLocalRef(dm, stencilInfo.stencil[s], locFArray, &rhs));
+                            PetscCall(DMPlexPointLocalRef(dm, stencil[s], locFArray, &rhs));
 
                             // Now over the entire rhs, the function should have added the values correctly using the sourceOffsetsPointer
                             for (PetscInt sc = 0; sc < scratchSize; sc++) {
-                                rhs[sc] += (distributedSourceScratch[sc] * stencilInfo.distributionWeights[s]) / stencilInfo.volumes[s];
+                                rhs[sc] += (distributedSourceScratch[sc] * distributionWeights[s]) / volumes[s];
                             }
                         }
 
@@ -530,28 +539,24 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxPt,
                                                     auxStencilValues.data(),
                                                     stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencil,
+                                                    gradientWeights,
                                                     sourceOffsetsPointer,
                                                     distributedSourceScratch.data(),
                                                     function.context));
 
                         // the first cell in the stencil is always the neighbor cell
                         // Get the point in the rhs for this point.  It might be ghost but that is ok, the values are added together later
-                        PetscCall(DMPlexPointLocalRef(dm, stencilInfo.stencil.front(), locFArray, &rhs));
+                        PetscCall(DMPlexPointLocalRef(dm, stencil[0], locFArray, &rhs));
 
                         // Now over the entire rhs, the function should have added the values correctly using the sourceOffsetsPointer
                         for (PetscInt sc = 0; sc < scratchSize; sc++) {
-                            rhs[sc] += distributedSourceScratch[sc] / stencilInfo.volumes.front();
+                            rhs[sc] += distributedSourceScratch[sc] / volumes[0];
                         }
 
                         break;
 
                     case BoundarySourceType::Face:
-                        // Get the vec DM from the locFArray
-                        DM vecDm;
-                        PetscCall(VecGetDM(locFVec, &vecDm));
-
                         // Assume that the right hand side vector is for face information
                         PetscScalar* faceRhs;
                         PetscCall(DMPlexPointLocalRef(vecDm, stencilInfo.geometry.faceId, locFArray, &faceRhs));
@@ -570,8 +575,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
                                                     auxPt,
                                                     auxStencilValues.data(),
                                                     stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
+                                                    stencil,
+                                                    gradientWeights,
                                                     sourceOffsetsPointer,
                                                     faceRhs,
                                                     function.context));
@@ -674,15 +679,19 @@ std::vector<ablate::boundarySolver::BoundarySolver::GradientStencil> ablate::bou
 
 void ablate::boundarySolver::BoundarySolver::CreateGradientStencil(PetscInt cellId, const ablate::boundarySolver::BoundarySolver::BoundaryFVFaceGeom& geometry, const std::vector<PetscInt>& stencil,
                                                                    DM cellDM, const PetscScalar* cellGeomArray) {
-    // Compute the weights for the stencil
-    auto newStencil = GradientStencil{.cellId = cellId, .geometry = geometry, .stencil = stencil, .stencilSize = (PetscInt)stencil.size()};
+    // Append the stencil to the end of the flattened arrays
+    auto newStencil = GradientStencil{.cellId = cellId, .geometry = geometry, .stencilOffset = (PetscInt)boundaryStencils.stencil.size(), .stencilSize = (PetscInt)stencil.size()};
+    boundaryStencils.stencil.insert(boundaryStencils.stencil.end(), stencil.begin(), stencil.end());
 
     // resize stencil weights
     auto dim = subDomain->GetDimensions();
-    newStencil.gradientWeights.resize(newStencil.stencilSize * dim, 0.0);
+    boundaryStencils.gradientWeights.resize((newStencil.stencilOffset + newStencil.stencilSize) * dim, 0.0);
     // Use a Reciprocal distance interpolate for the distribution weights.  This can be abstracted away in the future.
-    newStencil.distributionWeights.resize(newStencil.stencilSize * dim, 0.0);
-    newStencil.volumes.resize(newStencil.stencilSize, 0.0);
+    boundaryStencils.distributionWeights.resize(newStencil.stencilOffset + newStencil.stencilSize, 0.0);
+    boundaryStencils.volumes.resize(newStencil.stencilOffset + newStencil.stencilSize, 0.0);
+    PetscScalar* gradientWeights = boundaryStencils.gradientWeights.data() + newStencil.stencilOffset * dim;
+    PetscScalar* distributionWeights = boundaryStencils.distributionWeights.data() + newStencil.stencilOffset;
+    PetscScalar* volumes = boundaryStencils.volumes.data() + newStencil.stencilOffset;
 
     // Size up the dx for scratch space
     std::vector<PetscScalar> dx(newStencil.stencilSize * dim);
@@ -694,27 +703,27 @@ void ablate::boundarySolver::BoundarySolver::CreateGradientStencil(PetscInt cell
         DMPlexPointLocalRead(cellDM, stencil[n], cellGeomArray, &cg);
         for (PetscInt d = 0; d < dim; ++d) {
             dx[n * dim + d] = cg->centroid[d] - newStencil.geometry.centroid[d];
-            newStencil.distributionWeights[n] += PetscSqr(cg->centroid[d] - newStencil.geometry.centroid[d]);
+            distributionWeights[n] += PetscSqr(cg->centroid[d] - newStencil.geometry.centroid[d]);
         }
-        newStencil.distributionWeights[n] = 1.0 / PetscSqrtScalar(newStencil.distributionWeights[n]);
-        distributionWeightSum += newStencil.distributionWeights[n];
+        distributionWeights[n] = 1.0 / PetscSqrtScalar(distributionWeights[n]);
+        distributionWeightSum += distributionWeights[n];
 
         // store the volume
-        newStencil.volumes[n] = cg->volume;
+        volumes[n] = cg->volume;
     }
 
     // normalize the distributionWeights
-    utilities::MathUtilities::ScaleVector(newStencil.distributionWeights.size(), newStencil.distributionWeights.data(), 1.0 / distributionWeightSum);
+    utilities::MathUtilities::ScaleVector(newStencil.stencilSize, distributionWeights, 1.0 / distributionWeightSum);
 
     // Reset the least squares calculator if needed
     if ((PetscInt)stencil.size() > maximumStencilSize) {
         maximumStencilSize = (PetscInt)stencil.size();
         PetscFVLeastSquaresSetMaxFaces(gradientCalculator, maximumStencilSize) >> utilities::PetscUtilities::checkError;
     }
-    PetscFVComputeGradient(gradientCalculator, (PetscInt)stencil.size(), dx.data(), newStencil.gradientWeights.data()) >> utilities::PetscUtilities::checkError;
+    PetscFVComputeGradient(gradientCalculator, (PetscInt)stencil.size(), dx.data(), gradientWeights) >> utilities::PetscUtilities::checkError;
 
     // Store the stencil
-    gradientStencils.push_back(std::move(newStencil));
+    gradientStencils.push_back(newStencil);
 }
 
 void ablate::boundarySolver::BoundarySolver::UpdateVariablesPreStep(TS, ablate::solver::Solver&) {
@@ -799,9 +808,10 @@ void ablate::boundarySolver::BoundarySolver::UpdateVariablesPreStep(TS, ablate::
 
                 // Get each of the stencil pts
                 const PetscScalar *solStencilPt, *auxStencilPt = nullptr;
-                DMPlexPointLocalRead(dm, stencilInfo.stencil.front(), localXArray, &solStencilPt) >> utilities::PetscUtilities::checkError;
+                const PetscInt neighborCell = boundaryStencils.stencil[stencilInfo.stencilOffset];
+                DMPlexPointLocalRead(dm, neighborCell, localXArray, &solStencilPt) >> utilities::PetscUtilities::checkError;
                 if (auxDM) {
-                    DMPlexPointLocalRead(auxDM, stencilInfo.stencil.front(), locAuxArray, &auxStencilPt) >> utilities::PetscUtilities::checkError;
+                    DMPlexPointLocalRead(auxDM, neighborCell, locAuxArray, &auxStencilPt) >> utilities::PetscUtilities::checkError;
                 }
 
                 // update
@@ -867,11 +877,6 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
         PetscCall(PetscDSGetComponentOffsets(auxDS, &auxOffTotal));
     }
 
-    // Get the size of the field
-    PetscInt scratchSize;
-    PetscCall(PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &scratchSize));
-    std::vector<PetscScalar> distributedSourceScratch(scratchSize);
-
     // Get the region to march over
     if (!gradientStencils.empty()) {
         // Get pointers to sol, aux, and f vectors
@@ -882,8 +887,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
         }
 
         // Store pointers to the stencil variables
-        std::vector<const PetscScalar*> inputStencilValues(maximumStencilSize);
-        std::vector<const PetscScalar*> auxStencilValues(maximumStencilSize);
+        inputStencilValues.resize(maximumStencilSize);
+        auxStencilValues.resize(maximumStencilSize);
 
         // March over each boundary function
         auto inputOffsetsPointer = boundaryPreRhsPointFunction.inputFieldsOffset.data();
@@ -891,6 +896,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
 
         // March over each cell in this region
         for (const auto& stencilInfo : gradientStencils) {
+            const PetscInt* stencil = boundaryStencils.stencil.data() + stencilInfo.stencilOffset;
+
             // Get the cell geom
             const PetscFVCellGeom* cg;
             PetscCall(DMPlexPointLocalRead(dmCell, stencilInfo.cellId, cellGeomArray, &cg));
@@ -904,9 +911,9 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
 
             // Get each of the stencil pts
             for (PetscInt p = 0; p < stencilInfo.stencilSize; p++) {
-                PetscCall(DMPlexPointLocalRead(dm, stencilInfo.stencil[p], locXArray, &inputStencilValues[p]));
+                PetscCall(DMPlexPointLocalRead(dm, stencil[p], locXArray, &inputStencilValues[p]));
                 if (auxDM) {
-                    PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.stencil[p], locAuxArray, &auxStencilValues[p]));
+                    PetscCall(DMPlexPointLocalRead(auxDM, stencil[p], locAuxArray, &auxStencilValues[p]));
                 }
             }
 
@@ -922,8 +929,8 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeBoundaryPreRHSPoin
                                                            auxPt,
                                                            auxStencilValues.data(),
                                                            stencilInfo.stencilSize,
-                                                           stencilInfo.stencil.data(),
-                                                           stencilInfo.gradientWeights.data(),
+                                                           stencil,
+                                                           GetGradientWeights(stencilInfo),
                                                            boundaryPreRhsPointFunction.context));
         }
 
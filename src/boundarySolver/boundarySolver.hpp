@@ -98,17 +98,25 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
 
    private:
     /**
-     * struct to hold the gradient stencil for the boundary
+     * struct to hold the gradient stencil for the boundary.  The stencil points, weights, and volumes are stored in the flattened BoundaryStencils arrays
      */
     struct GradientStencil {
         /** the boundary cell for this stencil **/
         PetscInt cellId;
         /** the boundary geom for this stencil **/
         BoundaryFVFaceGeom geometry;
-        /** The points in the stencil*/
-        std::vector<PetscInt> stencil;
+        /** the offset of this stencil in the flattened stencil arrays */
+        PetscInt stencilOffset;
         /** store the stencil size for easy access */
         PetscInt stencilSize;
+    };
+
+    /**
+     * The stencil of every boundary face stored contiguously (CSR) so that the faces can be marched over without chasing per face allocations
+     */
+    struct BoundaryStencils {
+        /** The points in each stencil */
+        std::vector<PetscInt> stencil;
         /** The weights in [point*dim + dir] order */
         std::vector<PetscScalar> gradientWeights;
         /** The distribution weights in order */
@@ -166,10 +174,18 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
     // Hold a list of GradientStencils, this order corresponds to the face order
     std::vector<GradientStencil> gradientStencils;
 
+    // Hold the flattened stencil values for every GradientStencil
+    BoundaryStencils boundaryStencils;
+
    private:
     // keep track of maximumStencilSize
     PetscInt maximumStencilSize = 0;
 
+    // pre-sized scratch space used to gather the stencil values for each face
+    std::vector<const PetscScalar*> inputStencilValues;
+    std::vector<const PetscScalar*> auxStencilValues;
+    std::vector<PetscScalar> distributedSourceScratch;
+
     // The PetscFV (usually the least squares method) is used to compute the gradient weights
     PetscFV gradientCalculator = nullptr;
 
@@ -264,6 +280,18 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     const std::vector<GradientStencil>& GetBoundaryGeometry() const { return gradientStencils; }
 
+    /**
+     * Return the points in the stencil
+     */
+    inline const PetscInt* GetStencil(const GradientStencil& gradientStencil) const { return boundaryStencils.stencil.data() + gradientStencil.stencilOffset; }
+
+    /**
+     * Return the gradient weights in [point*dim + dir] order for the stencil
+     */
+    inline const PetscScalar* GetGradientWeights(const GradientStencil& gradientStencil) const {
+        return boundaryStencils.gradientWeights.data() + gradientStencil.stencilOffset * subDomain->GetDimensions();
+    }
+
     /**
      * Get access to the output fields
      */
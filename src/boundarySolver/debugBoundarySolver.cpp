@@ -67,8 +67,9 @@ void ablate::boundarySolver::DebugBoundarySolver::Setup() {
         stencilFile << std::endl;
 
         // now output each stencil point
+        const PetscInt* stencilPoints = GetStencil(stencil);
         for (PetscInt sp = 0; sp < stencil.stencilSize; sp++) {
-            OutputStencilCellLocation(stencilFile, stencil.stencil[sp]);
+            OutputStencilCellLocation(stencilFile, stencilPoints[sp]);
             stencilFile << std::endl;
         }
 
@@ -171,19 +172,20 @@ PetscErrorCode ablate::boundarySolver::DebugBoundarySolver::ComputeRHSFunction(P
         stencilFile << std::endl;
 
         // Now output each stencil location
+        const PetscInt* stencil = GetStencil(stencilInfo);
         for (PetscInt s = 0; s < stencilInfo.stencilSize; s++) {
-            OutputStencilCellLocation(stencilFile, stencilInfo.stencil[s]);
+            OutputStencilCellLocation(stencilFile, stencil[s]);
 
             // get each of the fields
             for (const auto& field : GetSubDomain().GetFields()) {
                 const PetscScalar* localXValues;
-                PetscCall(DMPlexPointLocalFieldRead(GetSubDomain().GetDM(), stencilInfo.stencil[s], field.id, locXArray, &localXValues));
+                PetscCall(DMPlexPointLocalFieldRead(GetSubDomain().GetDM(), stencil[s], field.id, locXArray, &localXValues));
                 for (PetscInt c = 0; c < field.numberComponents; ++c) {
                     stencilFile << " " << std::setprecision(16) << localXValues[c];
                 }
 
                 const PetscScalar* localFValues;
-                PetscCall(DMPlexPointLocalFieldRead(GetSubDomain().GetDM(), stencilInfo.stencil[s], field.id, locFArray, &localFValues));
+                PetscCall(DMPlexPointLocalFieldRead(GetSubDomain().GetDM(), stencil[s], field.id, locFArray, &localFValues));
                 for (PetscInt c = 0; c < field.numberComponents; ++c) {
                     stencilFile << " " << std::setprecision(16) << localFValues[c];
                 }
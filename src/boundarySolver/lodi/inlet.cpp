@@ -48,9 +48,6 @@ PetscErrorCode ablate::boundarySolver::lodi::Inlet::InletFunction(PetscInt dim,
     PetscReal boundarySpeedOfSound;
     PetscReal boundaryPressure;
 
-    // Get the densityYi pointer if available
-    const PetscScalar *boundaryDensityYi = inletBoundary->nSpecEqs > 0 ? boundaryValues + uOff[inletBoundary->speciesId] : nullptr;
-
     // Get the velocity and pressure on the surface
     {
         boundaryDensity = boundaryValues[uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHO];
@@ -67,32 +64,30 @@ PetscErrorCode ablate::boundarySolver::lodi::Inlet::InletFunction(PetscInt dim,
     PetscReal boundaryVelNormCord[3];
     utilities::MathUtilities::Multiply(dim, transformationMatrix, boundaryVel, boundaryVelNormCord);
 
-    // Compute each stencil point
-    std::vector<PetscReal> stencilDensity(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilVel(stencilSize, std::vector<PetscReal>(dim));
-    std::vector<PetscReal> stencilNormalVelocity(stencilSize);
-    std::vector<PetscReal> stencilPressure(stencilSize);
+    // Compute each stencil point, the lambda and scriptL are also stored in the scratch space
+    PetscReal *stencilDensity = inletBoundary->GetScratch(3 * stencilSize + 2 * inletBoundary->nEqs);
+    PetscReal *stencilNormalVelocity = stencilDensity + stencilSize;
+    PetscReal *stencilPressure = stencilNormalVelocity + stencilSize;
+    PetscReal *lambda = stencilPressure + stencilSize;
+    PetscReal *scriptL = lambda + inletBoundary->nEqs;
 
     for (PetscInt s = 0; s < stencilSize; s++) {
         stencilDensity[s] = stencilValues[s][uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHO];
+        stencilNormalVelocity[s] = 0.0;
         for (PetscInt d = 0; d < dim; d++) {
-            stencilVel[s][d] = stencilValues[s][uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
-            stencilNormalVelocity[s] += stencilVel[s][d] * fg->normal[d];
+            PetscReal stencilVel = stencilValues[s][uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
+            stencilNormalVelocity[s] += stencilVel * fg->normal[d];
         }
         PetscCall(inletBoundary->computePressure.function(stencilValues[s], &stencilPressure[s], inletBoundary->computePressure.context.get()));
     }
 
     // Interpolate the normal velocity gradient to the surface
     PetscScalar dVeldNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, &stencilNormalVelocity[0], stencilWeights, dVeldNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, stencilNormalVelocity, stencilWeights, dVeldNorm);
     PetscScalar dPdNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, &stencilPressure[0], stencilWeights, dPdNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, stencilPressure, stencilWeights, dPdNorm);
 
     // Compute the cp, cv from the eos
-    std::vector<PetscReal> boundaryYi(inletBoundary->nSpecEqs);
-    for (PetscInt i = 0; i < inletBoundary->nSpecEqs; i++) {
-        boundaryYi[i] = boundaryDensityYi[i] / boundaryDensity;
-    }
     PetscReal boundaryCp, boundaryCv;
     inletBoundary->computeSpecificHeatConstantPressure.function(boundaryValues, boundaryTemperature, &boundaryCp, inletBoundary->computeSpecificHeatConstantPressure.context.get());
     inletBoundary->computeSpecificHeatConstantVolume.function(boundaryValues, boundaryTemperature, &boundaryCv, inletBoundary->computeSpecificHeatConstantVolume.context.get());
@@ -106,14 +101,13 @@ PetscErrorCode ablate::boundarySolver::lodi::Inlet::InletFunction(PetscInt dim,
     inletBoundary->GetVelAndCPrims(boundaryNormalVelocity, boundarySpeedOfSound, boundaryCp, boundaryCv, velNormPrim, speedOfSoundPrim);
 
     // get_eigenvalues
-    std::vector<PetscReal> lambda(inletBoundary->nEqs);
-    inletBoundary->GetEigenValues(boundaryNormalVelocity, boundarySpeedOfSound, velNormPrim, speedOfSoundPrim, &lambda[0]);
+    inletBoundary->GetEigenValues(boundaryNormalVelocity, boundarySpeedOfSound, velNormPrim, speedOfSoundPrim, lambda);
 
     // Get alpha
     PetscReal pgsAlpha = inletBoundary->pressureGradientScaling ? inletBoundary->pressureGradientScaling->GetAlpha() : 1.0;
 
     // Get scriptL
-    std::vector<PetscReal> scriptL(inletBoundary->nEqs);
+    PetscArrayzero(scriptL, inletBoundary->nEqs);
     // Outgoing acoustic wave
     scriptL[1 + dim] = lambda[1 + dim] * (dPdNorm - boundaryDensity * PetscSqr(pgsAlpha) * dVeldNorm * (velNormPrim - boundaryNormalVelocity - speedOfSoundPrim));
 
@@ -150,7 +144,7 @@ PetscErrorCode ablate::boundarySolver::lodi::Inlet::InletFunction(PetscInt dim,
                             speedOfSoundPrim,
                             boundaryValues,
                             uOff,
-                            scriptL.data(),
+                            scriptL,
                             transformationMatrix,
                             source);
 
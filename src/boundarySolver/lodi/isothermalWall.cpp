@@ -53,26 +53,28 @@ PetscErrorCode ablate::boundarySolver::lodi::IsothermalWall::IsothermalWallFunct
     PetscReal boundaryVelNormCord[3];
     utilities::MathUtilities::Multiply(dim, transformationMatrix, boundaryVel, boundaryVelNormCord);
 
-    // Compute each stencil point
-    std::vector<PetscReal> stencilDensity(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilVel(stencilSize, std::vector<PetscReal>(dim));
-    std::vector<PetscReal> stencilNormalVelocity(stencilSize);
-    std::vector<PetscReal> stencilPressure(stencilSize);
+    // Compute each stencil point, the lambda and scriptL are also stored in the scratch space
+    PetscReal *stencilDensity = isothermalWall->GetScratch(3 * stencilSize + 2 * isothermalWall->nEqs);
+    PetscReal *stencilNormalVelocity = stencilDensity + stencilSize;
+    PetscReal *stencilPressure = stencilNormalVelocity + stencilSize;
+    PetscReal *lambda = stencilPressure + stencilSize;
+    PetscReal *scriptL = lambda + isothermalWall->nEqs;
 
     for (PetscInt s = 0; s < stencilSize; s++) {
         stencilDensity[s] = stencilValues[s][uOff[isothermalWall->eulerId] + finiteVolume::CompressibleFlowFields::RHO];
+        stencilNormalVelocity[s] = 0.0;
         for (PetscInt d = 0; d < dim; d++) {
-            stencilVel[s][d] = stencilValues[s][uOff[isothermalWall->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
-            stencilNormalVelocity[s] += stencilVel[s][d] * fg->normal[d];
+            PetscReal stencilVel = stencilValues[s][uOff[isothermalWall->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
+            stencilNormalVelocity[s] += stencilVel * fg->normal[d];
         }
         PetscCall(isothermalWall->computePressure.function(stencilValues[s], &stencilPressure[s], isothermalWall->computePressure.context.get()));
     }
 
     // Interpolate the normal velocity gradient to the surface
     PetscScalar dVeldNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, &stencilNormalVelocity[0], stencilWeights, dVeldNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, stencilNormalVelocity, stencilWeights, dVeldNorm);
     PetscScalar dPdNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, &stencilPressure[0], stencilWeights, dPdNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, stencilPressure, stencilWeights, dPdNorm);
 
     PetscReal boundaryCp, boundaryCv;
     isothermalWall->computeSpecificHeatConstantPressure.function(boundaryValues, boundaryTemperature, &boundaryCp, isothermalWall->computeSpecificHeatConstantPressure.context.get());
@@ -87,8 +89,7 @@ PetscErrorCode ablate::boundarySolver::lodi::IsothermalWall::IsothermalWallFunct
     isothermalWall->GetVelAndCPrims(boundaryNormalVelocity, boundarySpeedOfSound, boundaryCp, boundaryCv, velNormPrim, speedOfSoundPrim);
 
     // get_eigenvalues
-    std::vector<PetscReal> lambda(isothermalWall->nEqs);
-    isothermalWall->GetEigenValues(boundaryNormalVelocity, boundarySpeedOfSound, velNormPrim, speedOfSoundPrim, &lambda[0]);
+    isothermalWall->GetEigenValues(boundaryNormalVelocity, boundarySpeedOfSound, velNormPrim, speedOfSoundPrim, lambda);
 
     // Compute alpha2
     PetscReal alpha2 = 1.0;
@@ -97,7 +98,7 @@ PetscErrorCode ablate::boundarySolver::lodi::IsothermalWall::IsothermalWallFunct
     }
 
     // Get scriptL
-    std::vector<PetscReal> scriptL(isothermalWall->nEqs);
+    PetscArrayzero(scriptL, isothermalWall->nEqs);
     scriptL[1 + dim] = lambda[1 + dim] * (dPdNorm - boundaryDensity * dVeldNorm * alpha2 * (velNormPrim - boundaryNormalVelocity - speedOfSoundPrim));  // Outgoing
     // acoustic
     // wave
@@ -132,7 +133,7 @@ PetscErrorCode ablate::boundarySolver::lodi::IsothermalWall::IsothermalWallFunct
                              speedOfSoundPrim,
                              boundaryValues,
                              uOff,
-                             scriptL.data(),
+                             scriptL,
                              transformationMatrix,
                              source);
 
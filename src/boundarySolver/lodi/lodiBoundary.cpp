@@ -32,6 +32,13 @@ void ablate::boundarySolver::lodi::LODIBoundary::GetVelAndCPrims(PetscReal velNo
     speedOfSoundPrim = 0.5e+0 * (speedOfSound * PetscSqrtReal(gamm12 * tmp * M2 + fourralpha2));
 }
 
+PetscReal *ablate::boundarySolver::lodi::LODIBoundary::GetScratch(std::size_t size) {
+    if (scratch.size() < size) {
+        scratch.resize(size);
+    }
+    return scratch.data();
+}
+
 void ablate::boundarySolver::lodi::LODIBoundary::GetEigenValues(PetscReal veln, PetscReal c, PetscReal velnprm, PetscReal cprm, PetscReal *lamda) const {
     lamda[0] = velnprm - cprm;
     lamda[1] = veln;
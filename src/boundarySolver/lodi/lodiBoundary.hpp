@@ -51,6 +51,13 @@ class LODIBoundary : public BoundaryProcess {
     eos::ThermodynamicTemperatureFunction computeSensibleEnthalpyFunction;
     eos::ThermodynamicFunction computePressure;
 
+    /**
+     * Get a scratch buffer with at least size values.  The buffer is reused for every boundary face so gathering the stencil values does not allocate
+     * @param size
+     * @return
+     */
+    PetscReal* GetScratch(std::size_t size);
+
    public:
     explicit LODIBoundary(std::shared_ptr<eos::EOS> eos, std::shared_ptr<finiteVolume::processes::PressureGradientScaling> pressureGradientScaling = {});
 
@@ -67,6 +74,9 @@ class LODIBoundary : public BoundaryProcess {
 
    private:
     eos::ThermodynamicTemperatureFunction computeTemperatureFunction;
+
+    //! the scratch space used to gather the stencil values for each face
+    std::vector<PetscReal> scratch;
 };
 
 }  // namespace ablate::boundarySolver::lodi
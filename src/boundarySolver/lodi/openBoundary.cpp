@@ -57,60 +57,60 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
     PetscReal boundaryVelNormCord[3];
     utilities::MathUtilities::Multiply(dim, transformationMatrix, boundaryVel, boundaryVelNormCord);
 
-    // Compute each stencil point
-    std::vector<PetscReal> stencilDensity(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilVel(stencilSize, std::vector<PetscReal>(dim));
-    std::vector<std::vector<PetscReal>> stencilNormalCoordsVel(dim, std::vector<PetscReal>(stencilSize));  // NOTE this is [dim][stencil]
-    std::vector<PetscReal> stencilNormalVelocity(stencilSize, 0.0);
-    std::vector<PetscReal> stencilPressure(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilYi(boundary->nSpecEqs, std::vector<PetscReal>(stencilSize));  // NOTE this is [sp][stencil]
-    std::vector<std::vector<PetscReal>> stencilEv(boundary->nEvEqs, std::vector<PetscReal>(stencilSize));    // NOTE this is [sp][stencil]
+    // Compute each stencil point, the boundary yi/ev, lambda, and scriptL are also stored in the scratch space
+    PetscReal *stencilDensity = boundary->GetScratch((2 + dim + boundary->nSpecEqs + boundary->nEvEqs) * stencilSize + boundary->nSpecEqs + boundary->nEvEqs + 2 * boundary->nEqs);
+    PetscReal *stencilNormalCoordsVel = stencilDensity + stencilSize;  // NOTE this is [dim][stencil]
+    PetscReal *stencilPressure = stencilNormalCoordsVel + dim * stencilSize;
+    PetscReal *stencilYi = stencilPressure + stencilSize;                 // NOTE this is [sp][stencil]
+    PetscReal *stencilEv = stencilYi + boundary->nSpecEqs * stencilSize;  // NOTE this is [ev][stencil]
+    PetscReal *boundaryYi = stencilEv + boundary->nEvEqs * stencilSize;
+    PetscReal *boundaryEv = boundaryYi + boundary->nSpecEqs;
+    PetscReal *lambda = boundaryEv + boundary->nEvEqs;
+    PetscReal *scriptL = lambda + boundary->nEqs;
 
     for (PetscInt s = 0; s < stencilSize; s++) {
         stencilDensity[s] = stencilValues[s][uOff[boundary->eulerId] + finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal stencilVel[3];
         for (PetscInt d = 0; d < dim; d++) {
-            stencilVel[s][d] = stencilValues[s][uOff[boundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
-            stencilNormalVelocity[s] += stencilVel[s][d] * fg->normal[d];
+            stencilVel[d] = stencilValues[s][uOff[boundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
         }
         PetscCall(boundary->computePressure.function(stencilValues[s], &stencilPressure[s], boundary->computePressure.context.get()));
 
         // Map the stencil velocity to a normal velocity
         PetscReal normalCoordsVel[3];
-        utilities::MathUtilities::Multiply(dim, transformationMatrix, &stencilVel[s][0], normalCoordsVel);
+        utilities::MathUtilities::Multiply(dim, transformationMatrix, stencilVel, normalCoordsVel);
 
         for (PetscInt d = 0; d < dim; d++) {
-            stencilNormalCoordsVel[d][s] = normalCoordsVel[d];
+            stencilNormalCoordsVel[d * stencilSize + s] = normalCoordsVel[d];
         }
 
         // Compute each of the species and ev
         for (PetscInt sp = 0; sp < boundary->nSpecEqs; sp++) {
-            stencilYi[sp][s] = stencilValues[s][uOff[boundary->speciesId] + sp] / stencilDensity[s];
+            stencilYi[sp * stencilSize + s] = stencilValues[s][uOff[boundary->speciesId] + sp] / stencilDensity[s];
         }
         int ne = 0;
         for (std::size_t ev = 0; ev < boundary->evIds.size(); ++ev) {
             for (PetscInt ec = 0; ec < boundary->nEvComps[ev]; ++ec) {
-                stencilEv[ne++][s] = stencilValues[s][uOff[boundary->evIds[ev]] + ec] / stencilDensity[s];
+                stencilEv[(ne++) * stencilSize + s] = stencilValues[s][uOff[boundary->evIds[ev]] + ec] / stencilDensity[s];
             }
         }
     }
 
     // Interpolate the normal velocity gradient to the surface
     PetscScalar dVeldNorm[3];
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryVelNormCord[0], stencilSize, &stencilNormalCoordsVel[0][0], stencilWeights, dVeldNorm[0]);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryVelNormCord[0], stencilSize, stencilNormalCoordsVel, stencilWeights, dVeldNorm[0]);
     for (PetscInt d = 1; d < dim; d++) {
-        BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryVelNormCord[d], stencilSize, &stencilNormalCoordsVel[d][0], stencilWeights, dVeldNorm[d]);
+        BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryVelNormCord[d], stencilSize, stencilNormalCoordsVel + d * stencilSize, stencilWeights, dVeldNorm[d]);
     }
     PetscScalar dRhodNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryDensity, stencilSize, &stencilDensity[0], stencilWeights, dRhodNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryDensity, stencilSize, stencilDensity, stencilWeights, dRhodNorm);
     PetscScalar dPdNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, &stencilPressure[0], stencilWeights, dPdNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, stencilPressure, stencilWeights, dPdNorm);
 
     // compute boundary ev, yi
-    std::vector<PetscReal> boundaryYi(boundary->nSpecEqs);
     for (PetscInt i = 0; i < boundary->nSpecEqs; i++) {
         boundaryYi[i] = boundaryDensityYi[i] / boundaryDensity;
     }
-    std::vector<PetscReal> boundaryEv(boundary->nEvEqs);
     int i = 0;
     for (std::size_t ev = 0; ev < boundary->evIds.size(); ++ev) {
         const PetscReal *rhoEV = boundaryValues + uOff[boundary->evIds[ev]];
@@ -134,8 +134,7 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
     boundary->GetVelAndCPrims(boundaryNormalVelocity, boundarySpeedOfSound, boundaryCp, boundaryCv, velNormPrim, speedOfSoundPrim);
 
     // get_eigenvalues
-    std::vector<PetscReal> lambda(boundary->nEqs);
-    boundary->GetEigenValues(boundaryNormalVelocity, boundarySpeedOfSound, velNormPrim, speedOfSoundPrim, &lambda[0]);
+    boundary->GetEigenValues(boundaryNormalVelocity, boundarySpeedOfSound, velNormPrim, speedOfSoundPrim, lambda);
 
     // compute the relaxation timescale
     // L2 = (p - pref)/tau = (p - pref)*kFac*a
@@ -149,7 +148,7 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
     }
 
     // Compute scriptL
-    std::vector<PetscReal> scriptL(boundary->nEqs);
+    PetscArrayzero(scriptL, boundary->nEqs);
     {
         if (boundaryMach < 1.0) {
             // Subsonic
@@ -166,12 +165,12 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
                 };
                 for (int ns = 0; ns < boundary->nSpecEqs; ns++) {
                     PetscScalar dYidn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi[ns].data(), stencilWeights, dYidn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi + ns * stencilSize, stencilWeights, dYidn);
                     scriptL[2 + dim + ns] = lambda[2 + dim + ns] * dYidn;  // Species
                 }
                 for (int ne = 0; ne < boundary->nEvEqs; ne++) {
                     PetscScalar dEvdn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv[ne].data(), stencilWeights, dEvdn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv + ne * stencilSize, stencilWeights, dEvdn);
 
                     scriptL[2 + dim + boundary->nSpecEqs + ne] = lambda[2 + dim + boundary->nSpecEqs + ne] * dEvdn;  // Scalars
                 }
@@ -201,13 +200,13 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
                 scriptL[1 + dim] = lambda[1 + dim] * (dPdNorm - boundaryDensity * alpha2 * dVeldNorm[0] * (velNormPrim - boundaryNormalVelocity - speedOfSoundPrim));
                 for (int ns = 0; ns < boundary->nSpecEqs; ns++) {
                     PetscScalar dYidn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi[ns].data(), stencilWeights, dYidn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi + ns * stencilSize, stencilWeights, dYidn);
 
                     scriptL[2 + dim + ns] = lambda[2 + dim + ns] * dYidn;  // Species
                 }
                 for (int ne = 0; ne < boundary->nEvEqs; ne++) {
                     PetscScalar dEvdn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv[ne].data(), stencilWeights, dEvdn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv + ne * stencilSize, stencilWeights, dEvdn);
 
                     scriptL[2 + dim + boundary->nSpecEqs + ne] = lambda[2 + dim + boundary->nSpecEqs + ne] * dEvdn;  // Scalars
                 }
@@ -241,7 +240,7 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
                        speedOfSoundPrim,
                        boundaryValues,
                        uOff,
-                       scriptL.data(),
+                       scriptL,
                        transformationMatrix,
                        source);
 
@@ -1,6 +1,6 @@
 #include "arrheniusSublimation.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
-#include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
 
 ablate::boundarySolver::physics::subModels::ArrheniusSublimation::ArrheniusSublimation(const std::shared_ptr<ablate::parameters::Parameters>& properties,
                                                                                        const std::shared_ptr<ablate::mathFunctions::MathFunction>& initialization,
@@ -17,10 +17,6 @@ ablate::boundarySolver::physics::subModels::ArrheniusSublimation::ArrheniusSubli
 void ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Initialize(ablate::boundarySolver::BoundarySolver& bSolver) {
     SublimationModel::Initialize(bSolver);
 
-    // Get the rank
-    PetscMPIInt rank;
-    MPI_Comm_rank(bSolver.GetSubDomain().GetComm(), &rank) >> utilities::MpiUtilities::checkError;
-
     // Get the temperature field from the solver to set the init value
     auto temperatureField = bSolver.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD);
     auto temperatureVec = bSolver.GetSubDomain().GetVec(temperatureField);
@@ -30,17 +26,18 @@ void ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Initializ
     PetscScalar* temperatureArray;
     VecGetArray(temperatureVec, &temperatureArray) >> utilities::PetscUtilities::checkError;
 
-    /** Initialize the solid boundary heat transfer model */
+    /** Initialize the solid boundary heat transfer model with a profile for each face */
+    faceProfiles.clear();
     for (const auto& geom : bSolver.GetBoundaryGeometry()) {
-        // Create a unique name for this model based pon the faceId and rank
-        auto uniqueId = std::to_string(rank) + "-" + std::to_string(geom.geometry.faceId);
+        faceProfiles.emplace(geom.geometry.faceId, (PetscInt)faceProfiles.size());
+    }
 
-        // by not having a maximum temperature we allow this to heat up as much as described
-        oneDimensionHeatTransfer[geom.geometry.faceId] = std::make_shared<OneDimensionHeatTransfer>(uniqueId, properties, initialization, options);
+    // by not having a maximum temperature we allow this to heat up as much as described
+    solidHeatTransfer = std::make_unique<BatchedOneDimensionHeatTransfer>((PetscInt)faceProfiles.size(), properties, initialization, options);
 
+    for (const auto& geom : bSolver.GetBoundaryGeometry()) {
         // Get the current surface temperature
-        PetscReal currentSurfaceTemp;
-        oneDimensionHeatTransfer[geom.geometry.faceId]->GetSurfaceTemperature(currentSurfaceTemp) >> utilities::PetscUtilities::checkError;
+        PetscReal currentSurfaceTemp = solidHeatTransfer->GetSurfaceTemperature(faceProfiles[geom.geometry.faceId]);
 
         // Get and set the temperature value
         PetscScalar* temperature;
@@ -56,7 +53,8 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation:
     PetscFunctionBegin;
 
     // compute the current mass flux used by arrhenius rat
-    oneDimensionHeatTransfer[faceId]->GetSurfaceTemperature(temperature) >> utilities::PetscUtilities::checkError;
+    const auto profile = faceProfiles.at(faceId);
+    temperature = solidHeatTransfer->GetSurfaceTemperature(profile);
     PetscReal massFluxRate = ComputeMassFluxRate(temperature);        // kg/(m2-s)
     PetscReal energyMeltingRate = massFluxRate * latentHeatOfFusion;  // kg/(m2-s) * J/kg = J/(m2-s)
 
@@ -65,15 +63,14 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation:
 
     // Step the time stepper in time
     PetscReal dummyVariable;
-    PetscCall(oneDimensionHeatTransfer[faceId]->Solve(heatFluxToSurface, dt, temperature, dummyVariable));
+    PetscCall(solidHeatTransfer->Solve(profile, heatFluxToSurface, dt, temperature, dummyVariable));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Compute(PetscInt faceId, PetscReal heatFluxToSurface,
                                                                                          ablate::boundarySolver::physics::subModels::SublimationModel::SurfaceState& surfaceState) {
     PetscFunctionBeginHot;
-    PetscReal temperature;
-    oneDimensionHeatTransfer[faceId]->GetSurfaceTemperature(temperature) >> utilities::PetscUtilities::checkError;
+    PetscReal temperature = solidHeatTransfer->GetSurfaceTemperature(faceProfiles.at(faceId));
 
     // Compute the massFlux (we can only remove mass)
     surfaceState.massFlux = ComputeMassFluxRate(temperature);  // kg/(m2-s)
@@ -83,16 +80,16 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation:
 }
 PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Save(viewer, sequenceNumber, time);
+    if (solidHeatTransfer) {
+        PetscCall(solidHeatTransfer->Save(viewer, "solidHeatTransfer", sequenceNumber, time));
     }
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode ablate::boundarySolver::physics::subModels::ArrheniusSublimation::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Restore(viewer, sequenceNumber, time);
+    if (solidHeatTransfer) {
+        PetscCall(solidHeatTransfer->Restore(viewer, "solidHeatTransfer", sequenceNumber, time));
     }
     PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -108,4 +105,4 @@ REGISTER(ablate::boundarySolver::physics::subModels::SublimationModel, ablate::b
          "Sublimation occurs at the specified temperature.  Extra heatFlux is used to heat the solid boundary",
          ARG(ablate::parameters::Parameters, "properties", "the heat transfer properties (specificHeat, conductivity, density, latentHeatOfFusion"),
          ARG(ablate::mathFunctions::MathFunction, "initialization", " math function to initialize the temperature"),
-         OPT(ablate::parameters::Parameters, "options", "the petsc options for the solver/ts"));
+         OPT(ablate::parameters::Parameters, "options", "the options for the 1D solid model (dm_plex_box_faces, dm_plex_box_upper, ts_dt)"));
@@ -0,0 +1,184 @@
+#include "batchedOneDimensionHeatTransfer.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::BatchedOneDimensionHeatTransfer(PetscInt numberProfiles, const std::shared_ptr<ablate::parameters::Parameters>& properties,
+                                                                                                             const std::shared_ptr<ablate::mathFunctions::MathFunction>& initialization,
+                                                                                                             const std::shared_ptr<ablate::parameters::Parameters>& options,
+                                                                                                             PetscReal maxSurfaceTemperature)
+    : numberProfiles(numberProfiles),
+      numberNodes((options ? options->Get<PetscInt>("dm_plex_box_faces", 15) : 15) + 1),
+      length(options ? options->Get<PetscReal>("dm_plex_box_upper", 0.1) : 0.1),
+      nodeSpacing(length / (PetscReal)(numberNodes - 1)),
+      specificHeat(properties->GetExpect<PetscReal>("specificHeat")),
+      conductivity(properties->GetExpect<PetscReal>("conductivity")),
+      density(properties->GetExpect<PetscReal>("density")),
+      maximumSurfaceTemperature(maxSurfaceTemperature),
+      maximumTimeStep(options ? options->Get<PetscReal>("ts_dt", PETSC_MAX_REAL) : PETSC_MAX_REAL),
+      initialization(initialization),
+      temperature(numberProfiles * numberNodes),
+      profileTime(numberProfiles, 0.0),
+      essentialSurface(numberProfiles, false),
+      rhs(numberNodes) {
+    if (numberNodes < 2) {
+        throw std::invalid_argument("The ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer requires at least one face (dm_plex_box_faces).");
+    }
+    if (length <= 0.0 || maximumTimeStep <= 0.0) {
+        throw std::invalid_argument("The ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer dm_plex_box_upper and ts_dt must be positive.");
+    }
+
+    // Set the initial conditions at each node using the math function
+    for (PetscInt n = 0; n < numberNodes; ++n) {
+        const PetscReal x[3] = {GetNodeLocation(n), 0.0, 0.0};
+        const PetscReal nodeTemperature = initialization->Eval(x, 1, 0.0);
+        for (PetscInt p = 0; p < numberProfiles; ++p) {
+            temperature[p * numberNodes + n] = nodeTemperature;
+        }
+    }
+}
+
+const ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Factorization& ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::GetFactorization(
+    PetscReal dt, bool essential) {
+    auto& factorization = essential ? essentialFactorization : naturalFactorization;
+    if (factorization.dt == dt) {
+        return factorization;
+    }
+    factorization.dt = dt;
+    factorization.upper.resize(numberNodes);
+    factorization.inverseDiagonal.resize(numberNodes);
+
+    // The linear finite element mass (h/6 [1 4 1]) and stiffness (k/h [-1 2 -1]) matrices
+    const PetscReal mass = density * specificHeat * nodeSpacing / dt;
+    const PetscReal stiffness = conductivity / nodeSpacing;
+    const PetscReal offDiagonal = mass / 6.0 - stiffness;
+
+    // The surface row is either the natural (half cell) row or the essential boundary
+    PetscReal diagonal = essential ? 1.0 : mass / 3.0 + stiffness;
+    factorization.inverseDiagonal[0] = 1.0 / diagonal;
+    factorization.upper[0] = (essential ? 0.0 : offDiagonal) * factorization.inverseDiagonal[0];
+
+    // Forward elimination of the interior rows
+    for (PetscInt n = 1; n < numberNodes - 1; ++n) {
+        diagonal = 2.0 * mass / 3.0 + 2.0 * stiffness - offDiagonal * factorization.upper[n - 1];
+        factorization.inverseDiagonal[n] = 1.0 / diagonal;
+        factorization.upper[n] = offDiagonal * factorization.inverseDiagonal[n];
+    }
+
+    // The far field is an essential boundary
+    factorization.inverseDiagonal[numberNodes - 1] = 1.0;
+    factorization.upper[numberNodes - 1] = 0.0;
+
+    return factorization;
+}
+
+void ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Step(PetscInt profile, PetscReal heatFluxToSurface, PetscReal dt) {
+    PetscReal* profileTemperature = temperature.data() + profile * numberNodes;
+
+    // Determine what kind of surface boundary is needed
+    if (maximumSurfaceTemperature >= 0) {
+        bool essential = profileTemperature[0] >= maximumSurfaceTemperature;
+
+        // Check if the heatflux into the surface is greater than what is being applied
+        if (heatFluxToSurface < GetSurfaceHeatFlux(profile)) {
+            essential = false;
+        }
+        essentialSurface[profile] = essential;
+    }
+    const bool essential = essentialSurface[profile];
+    const auto& factorization = GetFactorization(dt, essential);
+
+    // Build the right hand side from the mass matrix and boundary conditions
+    const PetscReal mass = density * specificHeat * nodeSpacing / dt;
+    const PetscReal offDiagonal = mass / 6.0 - conductivity / nodeSpacing;
+    rhs[0] = essential ? maximumSurfaceTemperature : mass * (2.0 * profileTemperature[0] + profileTemperature[1]) / 6.0 + heatFluxToSurface;
+    for (PetscInt n = 1; n < numberNodes - 1; ++n) {
+        rhs[n] = mass * (profileTemperature[n - 1] + 4.0 * profileTemperature[n] + profileTemperature[n + 1]) / 6.0;
+    }
+    const PetscReal farField[3] = {length, 0.0, 0.0};
+    rhs[numberNodes - 1] = initialization->Eval(farField, 1, profileTime[profile] + dt);
+
+    // Forward substitution using the shared factorization
+    rhs[0] *= factorization.inverseDiagonal[0];
+    for (PetscInt n = 1; n < numberNodes - 1; ++n) {
+        rhs[n] = (rhs[n] - offDiagonal * rhs[n - 1]) * factorization.inverseDiagonal[n];
+    }
+
+    // Back substitution into the profile
+    profileTemperature[numberNodes - 1] = rhs[numberNodes - 1];
+    for (PetscInt n = numberNodes - 2; n >= 0; --n) {
+        profileTemperature[n] = rhs[n] - factorization.upper[n] * profileTemperature[n + 1];
+    }
+
+    profileTime[profile] += dt;
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Solve(PetscInt profile, PetscReal heatFluxToSurface, PetscReal dt, PetscReal& surfaceTemperature,
+                                                                                                  PetscReal& heatFlux) {
+    PetscFunctionBeginHot;
+    PetscCheck(profile >= 0 && profile < numberProfiles, PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Profile %" PetscInt_FMT " is out of range", profile);
+
+    // Split the step into equal sub steps no larger than the maximum time step
+    const auto numberSteps = (PetscInt)PetscMax(1.0, PetscCeilReal(dt / maximumTimeStep - PETSC_SMALL));
+    const PetscReal subDt = dt / (PetscReal)numberSteps;
+    for (PetscInt s = 0; s < numberSteps; ++s) {
+        Step(profile, heatFluxToSurface, subDt);
+    }
+
+    // compute the current surface state
+    surfaceTemperature = GetSurfaceTemperature(profile);
+    heatFlux = GetSurfaceHeatFlux(profile);
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Save(PetscViewer viewer, const std::string& name, PetscInt sequenceNumber, PetscReal time) {
+    PetscFunctionBeginUser;
+    // Wrap all profiles in a single vector
+    Vec profiles;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, numberNodes, (PetscInt)temperature.size(), temperature.data(), &profiles));
+    PetscCall(PetscObjectSetName((PetscObject)profiles, name.c_str()));
+
+    // Set the output sequence
+    PetscBool ishdf5;
+    PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5));
+    if (ishdf5) {
+        PetscBool isInTimestepping;
+        PetscCall(PetscViewerHDF5IsTimestepping(viewer, &isInTimestepping));
+        if (!isInTimestepping) {
+            PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+        }
+        PetscCall(PetscViewerHDF5SetTimestep(viewer, sequenceNumber));
+    }
+
+    // Write to the file
+    PetscCall(VecView(profiles, viewer));
+    PetscCall(VecDestroy(&profiles));
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Restore(PetscViewer viewer, const std::string& name, PetscInt sequenceNumber, PetscReal time) {
+    PetscFunctionBeginUser;
+    // Wrap all profiles in a single vector
+    Vec profiles;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, numberNodes, (PetscInt)temperature.size(), temperature.data(), &profiles));
+    PetscCall(PetscObjectSetName((PetscObject)profiles, name.c_str()));
+
+    // Set the output sequence
+    PetscBool ishdf5;
+    PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5));
+    if (ishdf5) {
+        PetscBool isInTimestepping;
+        PetscCall(PetscViewerHDF5IsTimestepping(viewer, &isInTimestepping));
+        if (!isInTimestepping) {
+            PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+        }
+        PetscCall(PetscViewerHDF5SetTimestep(viewer, sequenceNumber));
+    }
+
+    // Read from the file
+    PetscCall(VecLoad(profiles, viewer));
+    PetscCall(VecDestroy(&profiles));
+
+    // The restored profiles are at the restart time
+    std::fill(profileTime.begin(), profileTime.end(), time);
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -0,0 +1,178 @@
+#ifndef ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
+#define ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
+
+#include <petsc.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mathFunctions/mathFunction.hpp"
+#include "parameters/parameters.hpp"
+
+namespace ablate::boundarySolver::physics::subModels {
+
+/**
+ * Holds the 1D solid temperature profiles for many boundary faces in a single contiguous array.  Each profile uses a linear finite element
+ * discretization (surface at x = 0, far field at x = length) and is advanced with backward Euler in fixed sub steps of at most ts_dt.  Because every profile
+ * shares the mesh, properties, and time step, the tridiagonal (Thomas) factorization is computed once per time step and reused for every face.
+ *
+ * The surface boundary is either the applied heat flux (natural) or the maximum surface temperature (essential).  The far field uses the initialization function.
+ */
+class BatchedOneDimensionHeatTransfer {
+   private:
+    //! the number of profiles stored
+    const PetscInt numberProfiles;
+
+    //! the number of nodes in each profile
+    const PetscInt numberNodes;
+
+    //! the length of the solid domain and node spacing
+    const PetscReal length;
+    const PetscReal nodeSpacing;
+
+    //! the solid properties
+    const PetscReal specificHeat;
+    const PetscReal conductivity;
+    const PetscReal density;
+
+    //! the maximum surface temperature, a negative value disables the essential boundary
+    const PetscReal maximumSurfaceTemperature;
+
+    //! the maximum time step used inside each Solve, each solve is split into equal sub steps of no more than this
+    const PetscReal maximumTimeStep;
+
+    //! store the initialization as it is also used for the far field boundary condition
+    const std::shared_ptr<ablate::mathFunctions::MathFunction> initialization;
+
+    //! the temperature for every profile, stored [profile][node]
+    std::vector<PetscReal> temperature;
+
+    //! the current time for each profile
+    std::vector<PetscReal> profileTime;
+
+    //! track if the surface of each profile is held at the maximum surface temperature
+    std::vector<bool> essentialSurface;
+
+    /**
+     * The forward elimination coefficients for the tridiagonal system shared by all profiles
+     */
+    struct Factorization {
+        //! the time step used to compute the factorization
+        PetscReal dt = -1.0;
+        //! the modified upper diagonal
+        std::vector<PetscReal> upper;
+        //! the inverse of the modified diagonal
+        std::vector<PetscReal> inverseDiagonal;
+    };
+
+    //! the factorization for each surface boundary type
+    Factorization naturalFactorization;
+    Factorization essentialFactorization;
+
+    //! scratch space for the right hand side of a single profile
+    std::vector<PetscReal> rhs;
+
+    /**
+     * Compute (if needed) the factorization for this time step and surface boundary type
+     * @param dt
+     * @param essential
+     * @return
+     */
+    const Factorization& GetFactorization(PetscReal dt, bool essential);
+
+    /**
+     * Take a single backward euler step for a single profile
+     * @param profile
+     * @param heatFluxToSurface
+     * @param dt
+     */
+    void Step(PetscInt profile, PetscReal heatFluxToSurface, PetscReal dt);
+
+   public:
+    /**
+     * Create the batch of 1D solid models
+     * @param numberProfiles the number of (face) profiles
+     * @param properties the heat transfer properties (specificHeat, conductivity, density)
+     * @param initialization math function to initialize the temperature and used for the far field
+     * @param options the mesh and time step options (dm_plex_box_faces, dm_plex_box_upper, ts_dt)
+     * @param maxSurfaceTemperature optional maximum surface temperature
+     */
+    BatchedOneDimensionHeatTransfer(PetscInt numberProfiles, const std::shared_ptr<ablate::parameters::Parameters>& properties,
+                                    const std::shared_ptr<ablate::mathFunctions::MathFunction>& initialization, const std::shared_ptr<ablate::parameters::Parameters>& options = {},
+                                    PetscReal maxSurfaceTemperature = PETSC_DEFAULT);
+
+    /**
+     * Advances a single profile in time and returns the computed surface state
+     * @param profile
+     * @param heatFluxToSurface
+     * @param dt
+     * @param surfaceTemperature
+     * @param heatFlux the heat flux conducted into the solid
+     * @return
+     */
+    PetscErrorCode Solve(PetscInt profile, PetscReal heatFluxToSurface, PetscReal dt, PetscReal& surfaceTemperature, PetscReal& heatFlux);
+
+    /**
+     * return the current surface temperature for this profile
+     * @param profile
+     * @return
+     */
+    [[nodiscard]] inline PetscReal GetSurfaceTemperature(PetscInt profile) const { return temperature[profile * numberNodes]; }
+
+    /**
+     * return the heat flux conducted from the surface into the solid for this profile
+     * @param profile
+     * @return
+     */
+    [[nodiscard]] inline PetscReal GetSurfaceHeatFlux(PetscInt profile) const {
+        const PetscReal* profileTemperature = temperature.data() + profile * numberNodes;
+        return -conductivity * (profileTemperature[1] - profileTemperature[0]) / nodeSpacing;
+    }
+
+    /**
+     * return the temperature profile, ordered from the surface to the far field
+     * @param profile
+     * @return
+     */
+    [[nodiscard]] inline const PetscReal* GetProfile(PetscInt profile) const { return temperature.data() + profile * numberNodes; }
+
+    /**
+     * return the current time for this profile
+     * @param profile
+     * @return
+     */
+    [[nodiscard]] inline PetscReal GetTime(PetscInt profile) const { return profileTime[profile]; }
+
+    /**
+     * the number of nodes in each profile
+     * @return
+     */
+    [[nodiscard]] inline PetscInt GetNumberNodes() const { return numberNodes; }
+
+    /**
+     * the distance from the surface for each node
+     * @param node
+     * @return
+     */
+    [[nodiscard]] inline PetscReal GetNodeLocation(PetscInt node) const { return node * nodeSpacing; }
+
+    /**
+     * Save all profiles to the PetscViewer in a single vector
+     * @param viewer
+     * @param name
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Save(PetscViewer viewer, const std::string& name, PetscInt sequenceNumber, PetscReal time);
+
+    /**
+     * Restore all profiles from the PetscViewer
+     * @param viewer
+     * @param name
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Restore(PetscViewer viewer, const std::string& name, PetscInt sequenceNumber, PetscReal time);
+};
+
+}  // namespace ablate::boundarySolver::physics::subModels
+#endif  // ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
@@ -1,6 +1,6 @@
 #include "temperatureSublimation.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
-#include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
 ablate::boundarySolver::physics::subModels::TemperatureSublimation::TemperatureSublimation(const std::shared_ptr<ablate::parameters::Parameters>& properties,
                                                                                            const std::shared_ptr<ablate::mathFunctions::MathFunction>& initialization,
                                                                                            const std::shared_ptr<ablate::parameters::Parameters>& options)
@@ -18,10 +18,6 @@ void ablate::boundarySolver::physics::subModels::TemperatureSublimation::Initial
     // Get the surface temperature from the properties
     auto sublimationTemperature = properties->GetExpect<double>("sublimationTemperature");
 
-    // Get the rank
-    PetscMPIInt rank;
-    MPI_Comm_rank(bSolver.GetSubDomain().GetComm(), &rank) >> utilities::MpiUtilities::checkError;
-
     // Get the temperature field from the solver to set the init value
     auto temperatureField = bSolver.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD);
     auto temperatureVec = bSolver.GetSubDomain().GetVec(temperatureField);
@@ -31,17 +27,17 @@ void ablate::boundarySolver::physics::subModels::TemperatureSublimation::Initial
     PetscScalar* temperatureArray;
     VecGetArray(temperatureVec, &temperatureArray) >> utilities::PetscUtilities::checkError;
 
-    /** Initialize the solid boundary heat transfer model */
+    /** Initialize the solid boundary heat transfer model with a profile for each face */
+    faceProfiles.clear();
     for (const auto& geom : bSolver.GetBoundaryGeometry()) {
-        // Create a unique name for this model based pon the faceId and rank
-        auto uniqueId = std::to_string(rank) + "-" + std::to_string(geom.geometry.faceId);
-
-        oneDimensionHeatTransfer[geom.geometry.faceId] = std::make_shared<OneDimensionHeatTransfer>(uniqueId, properties, initialization, options, sublimationTemperature);
-        heatFluxIntoSolid[geom.geometry.faceId] = 0.0;
+        faceProfiles.emplace(geom.geometry.faceId, (PetscInt)faceProfiles.size());
+    }
+    solidHeatTransfer = std::make_unique<BatchedOneDimensionHeatTransfer>((PetscInt)faceProfiles.size(), properties, initialization, options, sublimationTemperature);
+    heatFluxIntoSolid.assign(faceProfiles.size(), 0.0);
 
+    for (const auto& geom : bSolver.GetBoundaryGeometry()) {
         // Get the current surface temperature
-        PetscReal currentSurfaceTemp;
-        oneDimensionHeatTransfer[geom.geometry.faceId]->GetSurfaceTemperature(currentSurfaceTemp) >> utilities::PetscUtilities::checkError;
+        PetscReal currentSurfaceTemp = solidHeatTransfer->GetSurfaceTemperature(faceProfiles[geom.geometry.faceId]);
 
         // Get and set the temperature value
         PetscScalar* temperature;
@@ -56,7 +52,8 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimatio
     PetscFunctionBegin;
 
     // Step the time stepper in time
-    PetscCall(oneDimensionHeatTransfer[faceId]->Solve(heatFluxToSurface, dt, temperature, heatFluxIntoSolid[faceId]));
+    const auto profile = faceProfiles.at(faceId);
+    PetscCall(solidHeatTransfer->Solve(profile, heatFluxToSurface, dt, temperature, heatFluxIntoSolid[profile]));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -64,7 +61,7 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimatio
                                                                                            ablate::boundarySolver::physics::subModels::SublimationModel::SurfaceState& surfaceState) {
     PetscFunctionBeginHot;
     // compute the heat flux. Add the radiation heat flux for this face intensity if the radiation solver exists
-    PetscReal sublimationHeatFlux = heatFluxToSurface - heatFluxIntoSolid[faceId];
+    PetscReal sublimationHeatFlux = heatFluxToSurface - heatFluxIntoSolid[faceProfiles.at(faceId)];
 
     // We can only use positive heat flux
     sublimationHeatFlux = PetscMax(0.0, sublimationHeatFlux);
@@ -77,16 +74,16 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimatio
 }
 PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimation::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Save(viewer, sequenceNumber, time);
+    if (solidHeatTransfer) {
+        PetscCall(solidHeatTransfer->Save(viewer, "solidHeatTransfer", sequenceNumber, time));
     }
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimation::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Restore(viewer, sequenceNumber, time);
+    if (solidHeatTransfer) {
+        PetscCall(solidHeatTransfer->Restore(viewer, "solidHeatTransfer", sequenceNumber, time));
     }
     PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -96,4 +93,4 @@ REGISTER(ablate::boundarySolver::physics::subModels::SublimationModel, ablate::b
          "Sublimation occurs at the specified temperature.  Extra heatFlux is used to heat the solid boundary",
          ARG(ablate::parameters::Parameters, "properties", "the heat transfer properties (specificHeat, conductivity, density, sublimationTemperature, latentHeatOfFusion"),
          ARG(ablate::mathFunctions::MathFunction, "initialization", " math function to initialize the temperature"),
-         OPT(ablate::parameters::Parameters, "options", "the petsc options for the solver/ts"));
+         OPT(ablate::parameters::Parameters, "options", "the options for the 1D solid model (dm_plex_box_faces, dm_plex_box_upper, ts_dt)"));
@@ -3,7 +3,8 @@
 
 #include <map>
 #include <memory>
-#include "oneDimensionHeatTransfer.hpp"
+#include <vector>
+#include "batchedOneDimensionHeatTransfer.hpp"
 #include "solver/cellSolver.hpp"
 #include "solver/timeStepper.hpp"
 #include "sublimationModel.hpp"
@@ -12,11 +13,14 @@ namespace ablate::boundarySolver::physics::subModels {
 
 class TemperatureSublimation : public SublimationModel {
    private:
-    //! hold onto a map of solid heat transfer
-    std::map<PetscInt, std::shared_ptr<OneDimensionHeatTransfer>> oneDimensionHeatTransfer;
+    //! the 1D solid heat transfer profiles for every boundary face
+    std::unique_ptr<BatchedOneDimensionHeatTransfer> solidHeatTransfer;
 
-    //! hold onto a map of solid heat transfer flux, updated each time
-    std::map<PetscInt, PetscReal> heatFluxIntoSolid;
+    //! map from the boundary face id to the profile in the solidHeatTransfer
+    std::map<PetscInt, PetscInt> faceProfiles;
+
+    //! hold onto the solid heat transfer flux for each profile, updated each time
+    std::vector<PetscReal> heatFluxIntoSolid;
 
     //! the material properties
     const std::shared_ptr<ablate::parameters::Parameters> properties;
@@ -24,7 +28,7 @@ class TemperatureSublimation : public SublimationModel {
     //! the math function used to initialize the domain
     const std::shared_ptr<ablate::mathFunctions::MathFunction> initialization;
 
-    //! the petsc options used to setup each oneDimensionHeatTransfer
+    //! the options used to setup the solidHeatTransfer (dm_plex_box_faces, dm_plex_box_upper, ts_dt)
     const std::shared_ptr<ablate::parameters::Parameters> options;
 
     //! the latent heat of fusion [J/kg]"
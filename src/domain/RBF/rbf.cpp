@@ -1,5 +1,7 @@
 #include "rbf.hpp"
 #include <petsc/private/dmpleximpl.h>
+#include <algorithm>
+#include <vector>
 #include "utilities/petscSupport.hpp"
 
 using namespace ablate::domain::rbf;
@@ -446,6 +448,93 @@ PetscReal RBF::EvalDer(DM dm, Vec vec, const PetscInt fid, PetscInt c, PetscInt
 
     return val;
 }
+
+Mat RBF::GetDerivativeMatrix(DM dm, const PetscInt fid, PetscInt dx, PetscInt dy, PetscInt dz) {
+    PetscBool hasKey;
+    PetscInt derID = -1, numDer = RBF::nDer;
+    PetscInt derKey = RBF::derivativeKey(dx, dy, dz);
+    PetscHMapIHas(RBF::hash, derKey, &hasKey);
+    if (!hasKey) throw std::invalid_argument("RBF: Derivative of (" + std::to_string(dx) + ", " + std::to_string(dy) + ", " + std::to_string(dz) + ") is not setup.");
+    PetscHMapIGet(RBF::hash, derKey, &derID);
+
+    // Reuse the operator if it has already been assembled
+    Mat &D = RBF::derivativeMatrices[std::make_tuple(dm, fid, derID)];
+    if (D) {
+        return D;
+    }
+
+    PetscSection section;
+    PetscInt storageSize;
+    DMGetLocalSection(dm, &section) >> utilities::PetscUtilities::checkError;
+    PetscSectionGetStorageSize(section, &storageSize) >> utilities::PetscUtilities::checkError;
+
+    // Setup any stencil that hasn't been setup yet so that the non-zeros are known
+    PetscInt *nnz;
+    PetscMalloc1(RBF::cEnd - RBF::cStart, &nnz) >> utilities::PetscUtilities::checkError;
+    for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
+        if (RBF::stencilWeights[c] == nullptr) {
+            RBF::SetupDerivativeStencils(c);
+        }
+        nnz[c - RBF::cStart] = RBF::nStencil[c];
+    }
+
+    MatCreateSeqAIJ(PETSC_COMM_SELF, RBF::cEnd - RBF::cStart, storageSize, 0, nnz, &D) >> utilities::PetscUtilities::checkError;
+    PetscObjectSetName((PetscObject)D, "ablate::domain::rbf::RBF::derivative") >> utilities::PetscUtilities::checkError;
+    PetscFree(nnz) >> utilities::PetscUtilities::checkError;
+
+    // Each row holds the stencil weights of a cell, with the columns at the location of the field in the local vector
+    PetscInt *cols;
+    PetscScalar *wts;
+    PetscInt maxStencil = 0;
+    for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
+        maxStencil = PetscMax(maxStencil, RBF::nStencil[c]);
+    }
+    PetscMalloc2(maxStencil, &cols, maxStencil, &wts) >> utilities::PetscUtilities::checkError;
+    for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
+        const PetscInt nCells = RBF::nStencil[c], *lst = RBF::stencilList[c];
+        const PetscReal *wt = RBF::stencilWeights[c];
+        const PetscInt row = c - RBF::cStart;
+
+        for (PetscInt i = 0; i < nCells; ++i) {
+            if (fid >= 0) {
+                PetscSectionGetFieldOffset(section, lst[i], fid, &cols[i]) >> utilities::PetscUtilities::checkError;
+            } else {
+                PetscSectionGetOffset(section, lst[i], &cols[i]) >> utilities::PetscUtilities::checkError;
+            }
+            wts[i] = wt[i * numDer + derID];
+        }
+        MatSetValues(D, 1, &row, nCells, cols, wts, ADD_VALUES) >> utilities::PetscUtilities::checkError;
+    }
+    PetscFree2(cols, wts) >> utilities::PetscUtilities::checkError;
+
+    MatAssemblyBegin(D, MAT_FINAL_ASSEMBLY) >> utilities::PetscUtilities::checkError;
+    MatAssemblyEnd(D, MAT_FINAL_ASSEMBLY) >> utilities::PetscUtilities::checkError;
+    MatViewFromOptions(D, NULL, "-ablate::domain::rbf::RBF::derivative_view") >> utilities::PetscUtilities::checkError;
+
+    return D;
+}
+
+Mat RBF::GetDerivativeMatrix(const ablate::domain::Field *field, PetscInt dx, PetscInt dy, PetscInt dz) {
+    RBF::CheckField(field);
+
+    return RBF::GetDerivativeMatrix(RBF::subDomain->GetFieldDM(*field), field->id, dx, dy, dz);
+}
+
+void RBF::EvalDer(const ablate::domain::Field *field, Vec der, PetscInt dx, PetscInt dy, PetscInt dz) {
+    // The operator columns are local section offsets, so this also works on SOL fields in parallel once they are scattered to a local vector
+    DM dm = RBF::subDomain->GetFieldDM(*field);
+    Mat D = RBF::GetDerivativeMatrix(dm, field->id, dx, dy, dz);
+
+    if (field->location == FieldLocation::SOL) {
+        Vec localVec;
+        DMGetLocalVector(dm, &localVec) >> utilities::PetscUtilities::checkError;
+        DMGlobalToLocal(dm, RBF::subDomain->GetVec(*field), INSERT_VALUES, localVec) >> utilities::PetscUtilities::checkError;
+        MatMult(D, localVec, der) >> utilities::PetscUtilities::checkError;
+        DMRestoreLocalVector(dm, &localVec) >> utilities::PetscUtilities::checkError;
+    } else {
+        MatMult(D, RBF::subDomain->GetVec(*field), der) >> utilities::PetscUtilities::checkError;
+    }
+}
 /************ End Derivative Code **********************/
 
 /************ Begin Interpolation Code **********************/
@@ -462,36 +551,24 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, PetscReal
     return RBF::Interpolate(field, f, c, xEval);
 }
 
-PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, const PetscInt c, PetscReal xEval[3]) {
+// Solve for the weights of the interpolant over the stencil of cell c
+void RBF::InterpolationWeights(DM dm, const PetscInt fid, const PetscScalar *fvals, const PetscInt c, Vec weights) {
     PetscInt i, nCells, *lst;
     PetscScalar *vals, *v;
-    const PetscScalar *fvals;
-    PetscReal *x, x0[3];
-    Mat A;
-    Vec weights, rhs;
-    DM dm = RBF::subDomain->GetFieldDM(*field);
-    const PetscInt fid = field->id;
-
-    RBF::CheckField(field);
+    Vec rhs;
 
     if (RBF::RBFMatrix[c] == nullptr) {
         RBF::Matrix(c);
     }
 
-    A = RBF::RBFMatrix[c];
-    x = RBF::stencilXLocs[c];
-
     nCells = RBF::nStencil[c];
     lst = RBF::stencilList[c];
 
-    MatCreateVecs(A, &weights, &rhs) >> utilities::PetscUtilities::checkError;
-    VecZeroEntries(weights) >> utilities::PetscUtilities::checkError;
+    VecDuplicate(weights, &rhs) >> utilities::PetscUtilities::checkError;
     VecZeroEntries(rhs) >> utilities::PetscUtilities::checkError;
 
     // The function values
-    VecGetArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
     VecGetArray(rhs, &vals) >> utilities::PetscUtilities::checkError;
-
     for (i = 0; i < nCells; ++i) {
         if (fid >= 0) {
             DMPlexPointLocalFieldRead(dm, lst[i], fid, fvals, &v) >> utilities::PetscUtilities::checkError;
@@ -501,51 +578,47 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, const Pets
 
         vals[i] = *v;
     }
-
-    VecRestoreArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
     VecRestoreArray(rhs, &vals) >> utilities::PetscUtilities::checkError;
 
-    MatSolve(A, rhs, weights) >> utilities::PetscUtilities::checkError;
+    MatSolve(RBF::RBFMatrix[c], rhs, weights) >> utilities::PetscUtilities::checkError;
 
     VecDestroy(&rhs) >> utilities::PetscUtilities::checkError;
+}
 
-    // Now do the actual interpolation
-
-    // Get the cell center
-    DMPlexComputeCellGeometryFVM(dm, c, NULL, x0, NULL) >> utilities::PetscUtilities::checkError;
-
-    PetscInt p1 = PetscMax(RBF::polyOrder + 1, 1), dim = subDomain->GetDimensions();
-    PetscInt px, py, pz;
-    PetscReal *xp;
-    PetscMalloc1(dim * p1, &xp) >> utilities::PetscUtilities::checkError;
+// Evaluate the interpolant of cell c, centered at x0, at xEval. xp is a work array of length dim*(polyOrder + 1)
+PetscReal RBF::EvalInterpolant(const PetscInt c, const PetscReal x0[], const PetscScalar weights[], const PetscReal xEval[], PetscReal xp[]) {
+    const PetscInt p1 = PetscMax(RBF::polyOrder + 1, 1), dim = subDomain->GetDimensions();
+    const PetscInt nCells = RBF::nStencil[c];
+    PetscReal *x = RBF::stencilXLocs[c];
+    PetscInt i, px, py, pz;
+    PetscReal xShift[3];
 
     for (PetscInt d = 0; d < dim; ++d) {
-        x0[d] = xEval[d] - x0[d];  // Shifted center
+        xShift[d] = xEval[d] - x0[d];  // Shifted center
 
         // precompute powers
         xp[d * p1 + 0] = 1.0;
         for (px = 1; px < p1; ++px) {
-            xp[d * p1 + px] = xp[d * p1 + (px - 1)] * x0[d];
+            xp[d * p1 + px] = xp[d * p1 + (px - 1)] * xShift[d];
         }
     }
 
     PetscReal interpVal = 0.0;
-    VecGetArray(weights, &vals) >> utilities::PetscUtilities::checkError;
     for (i = 0; i < nCells; ++i) {
-        interpVal += vals[i] * RBFVal(dim, x0, &x[i * dim]);
+        interpVal += weights[i] * RBFVal(dim, xShift, &x[i * dim]);
     }
 
     // Augmented polynomial contributions
     switch (dim) {
         case 1:
             for (px = 0; px < p1; ++px) {
-                interpVal += vals[i++] * xp[0 * p1 + px];
+                interpVal += weights[i++] * xp[0 * p1 + px];
             }
             break;
         case 2:
             for (py = 0; py < p1; ++py) {
                 for (px = 0; px < p1 - py; ++px) {
-                    interpVal += vals[i++] * xp[0 * p1 + px] * xp[1 * p1 + py];
+                    interpVal += weights[i++] * xp[0 * p1 + px] * xp[1 * p1 + py];
                 }
             }
             break;
@@ -553,7 +626,7 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, const Pets
             for (pz = 0; pz < p1; ++pz) {
                 for (py = 0; py < p1 - pz; ++py) {
                     for (px = 0; px < p1 - py - pz; ++px) {
-                        interpVal += vals[i++] * xp[0 * p1 + px] * xp[1 * p1 + py] * xp[2 * p1 + pz];
+                        interpVal += weights[i++] * xp[0 * p1 + px] * xp[1 * p1 + py] * xp[2 * p1 + pz];
                     }
                 }
             }
@@ -562,13 +635,115 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, const Pets
             throw std::runtime_error("ablate::domain::RBF::Interpolate encountered an unknown dimension.");
     }
 
-    VecRestoreArray(weights, &vals) >> utilities::PetscUtilities::checkError;
+    return interpVal;
+}
+
+PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, const PetscInt c, PetscReal xEval[3]) {
+    const PetscScalar *fvals, *vals;
+    PetscReal x0[3], *xp;
+    Vec weights;
+    DM dm = RBF::subDomain->GetFieldDM(*field);
+
+    RBF::CheckField(field);
+
+    if (RBF::RBFMatrix[c] == nullptr) {
+        RBF::Matrix(c);
+    }
+
+    MatCreateVecs(RBF::RBFMatrix[c], &weights, nullptr) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
+    RBF::InterpolationWeights(dm, field->id, fvals, c, weights);
+    VecRestoreArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
+
+    // Now do the actual interpolation about the cell center
+    DMPlexComputeCellGeometryFVM(dm, c, NULL, x0, NULL) >> utilities::PetscUtilities::checkError;
+    PetscMalloc1(subDomain->GetDimensions() * PetscMax(RBF::polyOrder + 1, 1), &xp) >> utilities::PetscUtilities::checkError;
+
+    VecGetArrayRead(weights, &vals) >> utilities::PetscUtilities::checkError;
+    PetscReal interpVal = RBF::EvalInterpolant(c, x0, vals, xEval, xp);
+    VecRestoreArrayRead(weights, &vals) >> utilities::PetscUtilities::checkError;
+
     VecDestroy(&weights) >> utilities::PetscUtilities::checkError;
     PetscFree(xp) >> utilities::PetscUtilities::checkError;
 
     return interpVal;
 }
 
+void RBF::Interpolate(const ablate::domain::Field *field, Vec f, const PetscInt nPoints, const PetscReal xEval[], PetscReal vals[]) {
+    DM dm = RBF::subDomain->GetFieldDM(*field);
+    const PetscInt dim = subDomain->GetDimensions();
+
+    RBF::CheckField(field);
+
+    // Locate all of the points at once
+    std::vector<PetscScalar> coordinates(nPoints * dim);
+    for (PetscInt p = 0; p < nPoints; ++p) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            coordinates[p * dim + d] = xEval[p * 3 + d];
+        }
+    }
+
+    Vec pointVec;
+    PetscSF cellSF = nullptr;
+    PetscInt numFound;
+    const PetscInt *foundPoints;
+    const PetscSFNode *foundCells;
+    VecCreateSeqWithArray(PETSC_COMM_SELF, dim, nPoints * dim, coordinates.data(), &pointVec) >> utilities::PetscUtilities::checkError;
+    DMLocatePoints(dm, pointVec, DM_POINTLOCATION_NONE, &cellSF) >> utilities::PetscUtilities::checkError;
+    PetscSFGetGraph(cellSF, nullptr, &numFound, &foundPoints, &foundCells) >> utilities::PetscUtilities::checkError;
+
+    // Order the points by cell so that the weights of each cell are only computed once
+    std::vector<std::pair<PetscInt, PetscInt>> pointCells(nPoints, {-1, -1});
+    for (PetscInt p = 0; p < nPoints; ++p) {
+        pointCells[p].second = p;
+    }
+    for (PetscInt l = 0; l < numFound; ++l) {
+        pointCells[foundPoints ? foundPoints[l] : l].first = foundCells[l].index;
+    }
+    PetscSFDestroy(&cellSF) >> utilities::PetscUtilities::checkError;
+    VecDestroy(&pointVec) >> utilities::PetscUtilities::checkError;
+
+    std::sort(pointCells.begin(), pointCells.end());
+    if (nPoints > 0 && pointCells.front().first < 0) {
+        const PetscReal *x = &xEval[pointCells.front().second * 3];
+        throw std::runtime_error("ablate::domain::RBF::Interpolate could not determine the location of (" + std::to_string(x[0]) + ", " + std::to_string(x[1]) + ", " + std::to_string(x[2]) +
+                                 ").");
+    }
+
+    const PetscScalar *fvals, *weightVals;
+    PetscReal x0[3], *xp;
+    PetscMalloc1(dim * PetscMax(RBF::polyOrder + 1, 1), &xp) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
+
+    for (std::size_t start = 0; start < pointCells.size();) {
+        const PetscInt c = pointCells[start].first;
+
+        if (RBF::RBFMatrix[c] == nullptr) {
+            RBF::Matrix(c);
+        }
+
+        Vec weights;
+        MatCreateVecs(RBF::RBFMatrix[c], &weights, nullptr) >> utilities::PetscUtilities::checkError;
+        RBF::InterpolationWeights(dm, field->id, fvals, c, weights);
+        DMPlexComputeCellGeometryFVM(dm, c, NULL, x0, NULL) >> utilities::PetscUtilities::checkError;
+
+        // Evaluate every point in this cell with the same weights
+        VecGetArrayRead(weights, &weightVals) >> utilities::PetscUtilities::checkError;
+        std::size_t end = start;
+        for (; end < pointCells.size() && pointCells[end].first == c; ++end) {
+            const PetscInt p = pointCells[end].second;
+            vals[p] = RBF::EvalInterpolant(c, x0, weightVals, &xEval[p * 3], xp);
+        }
+        VecRestoreArrayRead(weights, &weightVals) >> utilities::PetscUtilities::checkError;
+        VecDestroy(&weights) >> utilities::PetscUtilities::checkError;
+
+        start = end;
+    }
+
+    VecRestoreArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
+    PetscFree(xp) >> utilities::PetscUtilities::checkError;
+}
+
 /************ End Interpolation Code **********************/
 
 /************ Constructor, Setup, and Initialization Code **********************/
@@ -594,6 +769,10 @@ void RBF::FreeStencilData() {
             PetscFree(RBF::stencilWeights[c]);
             PetscFree(RBF::stencilXLocs[c]);
         }
+        for (auto &derivativeMatrix : RBF::derivativeMatrices) {
+            MatDestroy(&derivativeMatrix.second);
+        }
+        RBF::derivativeMatrices.clear();
         RBF::cellList += cStart;
         RBF::nStencil += cStart;
         RBF::stencilList += cStart;
@@ -2,6 +2,8 @@
 #define ABLATELIBRARY_RBF_HPP
 #include <petsc.h>
 #include <petsc/private/hashmapi.h>
+#include <map>
+#include <tuple>
 #include "domain/range.hpp"  // For domain::Range
 #include "domain/subDomain.hpp"
 
@@ -44,9 +46,18 @@ class RBF {
     const bool hasInterpolation;
     Mat *RBFMatrix = nullptr;
 
+    // The assembled derivative operators for each (dm, field id, derivative id)
+    std::map<std::tuple<DM, PetscInt, PetscInt>, Mat> derivativeMatrices;
+
     // Compute the LU-decomposition of the augmented RBF matrix given a cell list.
     void Matrix(const PetscInt c);
 
+    // Solve for the interpolation weights of a field over the stencil of cell c
+    void InterpolationWeights(DM dm, const PetscInt fid, const PetscScalar *fvals, const PetscInt c, Vec weights);
+
+    // Evaluate the interpolant of cell c, centered at x0, at xEval using the work array xp
+    PetscReal EvalInterpolant(const PetscInt c, const PetscReal x0[], const PetscScalar weights[], const PetscReal xEval[], PetscReal xp[]);
+
     void CheckField(const ablate::domain::Field *field);  // Checks whether the field is SOL or AUX
 
     void FreeStencilData();
@@ -104,6 +115,30 @@ class RBF {
      */
     PetscReal EvalDer(DM dm, Vec vec, const PetscInt fid, PetscInt c, PetscInt dx, PetscInt dy, PetscInt dz);  // Evaluate a derivative
 
+    /**
+     * Return the operator which evaluates a derivative of a field at every cell in the range. The operator maps the local vector
+     * containing the field to a sequential vector with one entry per cell, ordered as ablate::domain::Range. The operator is owned by the RBF.
+     * @param dm - The mesh
+     * @param fid - Field id.
+     * @param dx, dy, dz - The derivative
+     */
+    Mat GetDerivativeMatrix(DM dm, const PetscInt fid, PetscInt dx, PetscInt dy, PetscInt dz);
+
+    /**
+     * Return the operator which evaluates a derivative of a field at every cell in the range
+     * @param field - The field to take the derivative of
+     * @param dx, dy, dz - The derivative
+     */
+    Mat GetDerivativeMatrix(const ablate::domain::Field *field, PetscInt dx, PetscInt dy, PetscInt dz);
+
+    /**
+     * Compute the derivative of a field at every cell in the range. SOL fields are scattered to a local vector first, so they are supported in parallel.
+     * @param field - The field to take the derivative of
+     * @param der - A sequential vector of length cEnd - cStart, ordered as ablate::domain::Range
+     * @param dx, dy, dz - The derivative
+     */
+    void EvalDer(const ablate::domain::Field *field, Vec der, PetscInt dx, PetscInt dy, PetscInt dz);
+
     // Interpolation stuff
 
     /**
@@ -123,6 +158,16 @@ class RBF {
      */
     PetscReal Interpolate(const ablate::domain::Field *field, Vec f, PetscReal xEval[3]);
 
+    /**
+     * Interpolate a field at a list of locations. Points that share a cell share the interpolation weights.
+     * @param field - The field to interpolate
+     * @param f - The local vector containing the data
+     * @param nPoints - The number of locations
+     * @param xEval - The locations where to perform the interpolation, length 3*nPoints
+     * @param vals - The interpolated values, length nPoints
+     */
+    void Interpolate(const ablate::domain::Field *field, Vec f, const PetscInt nPoints, const PetscReal xEval[], PetscReal vals[]);
+
     /**
      * Return the interpolation of a field at a given location
      * @param field - The field to interpolate
@@ -77,11 +77,10 @@ PetscObject ablate::domain::FieldDescription::CreatePetscField(DM dm) const {
             PetscFVSetFromOptions(fvm) >> utilities::PetscUtilities::checkError;
             PetscFVSetNumComponents(fvm, (PetscInt)components.size()) >> utilities::PetscUtilities::checkError;
 
-            // Get the limiter
+            // Get the limiter, the limiter type is set from these options by the finite volume solver
             PetscLimiter limiter;
             PetscFVGetLimiter(fvm, &limiter) >> utilities::PetscUtilities::checkError;
             PetscObjectSetOptions((PetscObject)limiter, petscOptions) >> utilities::PetscUtilities::checkError;
-            PetscLimiterSetFromOptions(limiter) >> utilities::PetscUtilities::checkError;
 
             // Determine the number of dims
             PetscInt dim;
@@ -0,0 +1,282 @@
+#include "reorderMesh.hpp"
+#include <algorithm>
+#include <numeric>
+#include "utilities/petscUtilities.hpp"
+#include "utilities/stringUtilities.hpp"
+
+ablate::domain::modifiers::ReorderMesh::ReorderMesh(Ordering ordering) : ordering(ordering) {}
+
+std::string ablate::domain::modifiers::ReorderMesh::ToString() const {
+    switch (ordering) {
+        case Ordering::Hilbert:
+            return "ablate::domain::modifiers::ReorderMesh hilbert";
+        case Ordering::Morton:
+            return "ablate::domain::modifiers::ReorderMesh morton";
+        default:
+            return "ablate::domain::modifiers::ReorderMesh rcm";
+    }
+}
+
+void ablate::domain::modifiers::ReorderMesh::Modify(DM &dm) {
+    PetscInt pStart, pEnd, cStart, cEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> utilities::PetscUtilities::checkError;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+
+    // Cells of each type are kept together, in the order the types first appear, so that cell type strata (such as ghost cells) stay contiguous
+    std::vector<PetscInt> typeBlocks(pEnd - pStart);
+    {
+        std::vector<PetscInt> blockOfType(DM_NUM_POLYTOPES, -1);
+        std::vector<PetscInt> blocksPerDepth;
+        for (PetscInt p = pStart; p < pEnd; ++p) {
+            DMPolytopeType type;
+            PetscInt depth;
+            DMPlexGetCellType(dm, p, &type) >> utilities::PetscUtilities::checkError;
+            DMPlexGetPointDepth(dm, p, &depth) >> utilities::PetscUtilities::checkError;
+            if ((PetscInt)blocksPerDepth.size() <= depth) {
+                blocksPerDepth.resize(depth + 1, 0);
+            }
+            if (blockOfType[type] < 0) {
+                blockOfType[type] = blocksPerDepth[depth]++;
+            }
+            typeBlocks[p - pStart] = blockOfType[type];
+        }
+    }
+
+    // Order the cells by block and then by the requested ordering
+    std::vector<uint64_t> cellKeys;
+    ComputeCellKeys(dm, cStart, cEnd, cellKeys);
+    std::vector<PetscInt> cellOrder(cEnd - cStart);
+    std::iota(cellOrder.begin(), cellOrder.end(), cStart);
+    std::stable_sort(cellOrder.begin(), cellOrder.end(), [&](PetscInt a, PetscInt b) {
+        if (typeBlocks[a - pStart] != typeBlocks[b - pStart]) {
+            return typeBlocks[a - pStart] < typeBlocks[b - pStart];
+        }
+        return cellKeys[a - cStart] < cellKeys[b - cStart];
+    });
+
+    // Every other point is numbered in the order that it is first reached by the closure of the ordered cells
+    PetscInt maxDepth;
+    DMPlexGetDepth(dm, &maxDepth) >> utilities::PetscUtilities::checkError;
+    std::vector<std::vector<PetscInt>> depthOrder(maxDepth + 1);
+    std::vector<bool> visited(pEnd - pStart, false);
+    for (const auto &cell : cellOrder) {
+        PetscInt closureSize;
+        PetscInt *closure = nullptr;
+        DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure) >> utilities::PetscUtilities::checkError;
+        for (PetscInt cl = 0; cl < closureSize; ++cl) {
+            const PetscInt point = closure[2 * cl];
+            if (!visited[point - pStart]) {
+                PetscInt depth;
+                DMPlexGetPointDepth(dm, point, &depth) >> utilities::PetscUtilities::checkError;
+                depthOrder[depth].push_back(point);
+                visited[point - pStart] = true;
+            }
+        }
+        DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure) >> utilities::PetscUtilities::checkError;
+    }
+
+    // Assign the new numbers within each depth stratum, appending any point that is not in the closure of a cell. The cells are numbered first so that the faces can be sorted by their left cell.
+    PetscInt fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> utilities::PetscUtilities::checkError;
+    std::vector<PetscInt> newPoints(pEnd - pStart, -1);
+    for (PetscInt depth = maxDepth; depth >= 0; --depth) {
+        PetscInt dStart, dEnd;
+        DMPlexGetDepthStratum(dm, depth, &dStart, &dEnd) >> utilities::PetscUtilities::checkError;
+        auto &order = depthOrder[depth];
+        for (PetscInt p = dStart; p < dEnd; ++p) {
+            if (!visited[p - pStart]) {
+                order.push_back(p);
+            }
+        }
+
+        if (depth != maxDepth && dStart == fStart && dEnd == fEnd) {
+            // sort the faces by the new number of their left cell
+            std::vector<PetscInt> leftCells(dEnd - dStart, PETSC_MAX_INT);
+            for (PetscInt f = dStart; f < dEnd; ++f) {
+                PetscInt supportSize;
+                const PetscInt *support;
+                DMPlexGetSupportSize(dm, f, &supportSize) >> utilities::PetscUtilities::checkError;
+                DMPlexGetSupport(dm, f, &support) >> utilities::PetscUtilities::checkError;
+                if (supportSize > 0) {
+                    leftCells[f - dStart] = newPoints[support[0] - pStart];
+                }
+            }
+            std::stable_sort(order.begin(), order.end(), [&](PetscInt a, PetscInt b) {
+                if (typeBlocks[a - pStart] != typeBlocks[b - pStart]) {
+                    return typeBlocks[a - pStart] < typeBlocks[b - pStart];
+                }
+                return leftCells[a - dStart] < leftCells[b - dStart];
+            });
+        } else {
+            std::stable_sort(order.begin(), order.end(), [&](PetscInt a, PetscInt b) { return typeBlocks[a - pStart] < typeBlocks[b - pStart]; });
+        }
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            newPoints[order[i] - pStart] = dStart + (PetscInt)i;
+        }
+    }
+
+    // Apply the permutation
+    IS permutation;
+    DM permutedDm;
+    ISCreateGeneral(PETSC_COMM_SELF, pEnd - pStart, newPoints.data(), PETSC_USE_POINTER, &permutation) >> utilities::PetscUtilities::checkError;
+    DMPlexPermute(dm, permutation, &permutedDm) >> utilities::PetscUtilities::checkError;
+    ISDestroy(&permutation) >> utilities::PetscUtilities::checkError;
+
+    // Copy over the distribution information that is not permuted
+    PermutePointSF(dm, newPoints, permutedDm) >> utilities::PetscUtilities::checkError;
+    PetscBool useCone, useClosure;
+    DMGetBasicAdjacency(dm, &useCone, &useClosure) >> utilities::PetscUtilities::checkError;
+    DMSetBasicAdjacency(permutedDm, useCone, useClosure) >> utilities::PetscUtilities::checkError;
+
+    ReplaceDm(dm, permutedDm);
+}
+
+void ablate::domain::modifiers::ReorderMesh::ComputeCellKeys(DM dm, PetscInt cStart, PetscInt cEnd, std::vector<uint64_t> &cellKeys) const {
+    cellKeys.resize(cEnd - cStart);
+
+    if (ordering == Ordering::RCM) {
+        // Use the petsc ordering of the cell adjacency graph
+        IS rcm;
+        const PetscInt *rcmPoints;
+        DMPlexGetOrdering(dm, MATORDERINGRCM, nullptr, &rcm) >> utilities::PetscUtilities::checkError;
+        ISGetIndices(rcm, &rcmPoints) >> utilities::PetscUtilities::checkError;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            cellKeys[c - cStart] = (uint64_t)rcmPoints[c];
+        }
+        ISRestoreIndices(rcm, &rcmPoints) >> utilities::PetscUtilities::checkError;
+        ISDestroy(&rcm) >> utilities::PetscUtilities::checkError;
+        return;
+    }
+
+    // Scale the cell centroids to the bounding box of the local cells
+    PetscInt dim;
+    DMGetCoordinateDim(dm, &dim) >> utilities::PetscUtilities::checkError;
+    std::vector<PetscReal> centroids((cEnd - cStart) * dim);
+    PetscReal lower[3] = {PETSC_MAX_REAL, PETSC_MAX_REAL, PETSC_MAX_REAL};
+    PetscReal upper[3] = {PETSC_MIN_REAL, PETSC_MIN_REAL, PETSC_MIN_REAL};
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> utilities::PetscUtilities::checkError;
+        for (PetscInt d = 0; d < dim; ++d) {
+            centroids[(c - cStart) * dim + d] = centroid[d];
+            lower[d] = PetscMin(lower[d], centroid[d]);
+            upper[d] = PetscMax(upper[d], centroid[d]);
+        }
+    }
+
+    const PetscReal maxCoordinate = (PetscReal)((1u << curveBits) - 1);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        uint32_t coordinates[3] = {0, 0, 0};
+        for (PetscInt d = 0; d < dim; ++d) {
+            const PetscReal range = upper[d] - lower[d];
+            const PetscReal scaled = range > 0 ? (centroids[(c - cStart) * dim + d] - lower[d]) / range : 0.0;
+            coordinates[d] = (uint32_t)PetscMin(PetscMax(scaled * maxCoordinate, 0.0), maxCoordinate);
+        }
+        cellKeys[c - cStart] = CurveKey(dim, coordinates);
+    }
+}
+
+uint64_t ablate::domain::modifiers::ReorderMesh::CurveKey(PetscInt dim, uint32_t coordinates[3]) const {
+    if (ordering == Ordering::Hilbert) {
+        // Convert the coordinates to the transposed Hilbert index (J. Skilling, Programming the Hilbert curve, 2004)
+        const uint32_t m = 1u << (curveBits - 1);
+        for (uint32_t q = m; q > 1; q >>= 1) {
+            const uint32_t p = q - 1;
+            for (PetscInt d = 0; d < dim; ++d) {
+                if (coordinates[d] & q) {
+                    coordinates[0] ^= p;
+                } else {
+                    const uint32_t t = (coordinates[0] ^ coordinates[d]) & p;
+                    coordinates[0] ^= t;
+                    coordinates[d] ^= t;
+                }
+            }
+        }
+        for (PetscInt d = 1; d < dim; ++d) {
+            coordinates[d] ^= coordinates[d - 1];
+        }
+        uint32_t t = 0;
+        for (uint32_t q = m; q > 1; q >>= 1) {
+            if (coordinates[dim - 1] & q) {
+                t ^= q - 1;
+            }
+        }
+        for (PetscInt d = 0; d < dim; ++d) {
+            coordinates[d] ^= t;
+        }
+    }
+
+    // Interleave the bits, starting with the most significant
+    uint64_t key = 0;
+    for (int bit = curveBits - 1; bit >= 0; --bit) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            key = (key << 1) | ((coordinates[d] >> bit) & 1u);
+        }
+    }
+    return key;
+}
+
+PetscErrorCode ablate::domain::modifiers::ReorderMesh::PermutePointSF(DM dm, const std::vector<PetscInt> &newPoints, DM permutedDm) {
+    PetscSF pointSF, permutedSF;
+    PetscInt numberRoots, numberLeaves;
+    const PetscInt *leaves;
+    const PetscSFNode *remotePoints;
+
+    PetscFunctionBegin;
+    PetscCall(DMGetPointSF(dm, &pointSF));
+    PetscCall(PetscSFGetGraph(pointSF, &numberRoots, &numberLeaves, &leaves, &remotePoints));
+    if (numberRoots < 0) {
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    // Each rank renumbered its own points, so push the new root numbers out to the leaves
+    std::vector<PetscInt> remoteNewPoints(newPoints.size(), -1);
+    PetscCall(PetscSFBcastBegin(pointSF, MPIU_INT, newPoints.data(), remoteNewPoints.data(), MPI_REPLACE));
+    PetscCall(PetscSFBcastEnd(pointSF, MPIU_INT, newPoints.data(), remoteNewPoints.data(), MPI_REPLACE));
+
+    // Build the new graph with the leaves in ascending order
+    std::vector<std::pair<PetscInt, PetscSFNode>> newLeaves(numberLeaves);
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        const PetscInt leaf = leaves ? leaves[l] : l;
+        newLeaves[l].first = newPoints[leaf];
+        newLeaves[l].second.rank = remotePoints[l].rank;
+        newLeaves[l].second.index = remoteNewPoints[leaf];
+    }
+    std::sort(newLeaves.begin(), newLeaves.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    PetscInt *permutedLeaves;
+    PetscSFNode *permutedRemotePoints;
+    PetscCall(PetscMalloc1(numberLeaves, &permutedLeaves));
+    PetscCall(PetscMalloc1(numberLeaves, &permutedRemotePoints));
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        permutedLeaves[l] = newLeaves[l].first;
+        permutedRemotePoints[l] = newLeaves[l].second;
+    }
+
+    PetscCall(PetscSFCreate(PetscObjectComm((PetscObject)dm), &permutedSF));
+    PetscCall(PetscSFSetGraph(permutedSF, numberRoots, numberLeaves, permutedLeaves, PETSC_OWN_POINTER, permutedRemotePoints, PETSC_OWN_POINTER));
+    PetscCall(DMSetPointSF(permutedDm, permutedSF));
+    PetscCall(PetscSFDestroy(&permutedSF));
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+std::istream &ablate::domain::modifiers::operator>>(std::istream &is, ablate::domain::modifiers::ReorderMesh::Ordering &v) {
+    std::string orderingString;
+    is >> orderingString;
+    ablate::utilities::StringUtilities::ToLower(orderingString);
+
+    if (orderingString == "rcm") {
+        v = ReorderMesh::Ordering::RCM;
+    } else if (orderingString == "hilbert") {
+        v = ReorderMesh::Ordering::Hilbert;
+    } else if (orderingString == "morton") {
+        v = ReorderMesh::Ordering::Morton;
+    } else {
+        throw std::invalid_argument("Unknown mesh ordering " + orderingString);
+    }
+    return is;
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::ReorderMesh, "Reorders the mesh cells for cache locality and sorts the faces by their left cell",
+         OPT(EnumWrapper<ablate::domain::modifiers::ReorderMesh::Ordering>, "ordering", "the cell ordering: rcm (default), hilbert, or morton"));
@@ -0,0 +1,71 @@
+#ifndef ABLATELIBRARY_REORDERMESH_HPP
+#define ABLATELIBRARY_REORDERMESH_HPP
+
+#include <cstdint>
+#include <istream>
+#include <vector>
+#include "modifier.hpp"
+
+namespace ablate::domain::modifiers {
+
+/**
+ * Renumbers the mesh points to improve the cache locality of the cell and face loops. The cells are ordered using either a reverse Cuthill-McKee or a space-filling
+ * curve ordering. All other points are numbered in the order they are reached by the closures of the ordered cells, so faces are sorted by their left cell.
+ * Cells of different types (such as boundary ghost cells) are kept in contiguous blocks. The modifier can be applied both before and after distribution.
+ */
+class ReorderMesh : public Modifier {
+   public:
+    //! the ordering used for the cells
+    enum class Ordering { RCM, Hilbert, Morton };
+
+   private:
+    //! the ordering used for the cells
+    const Ordering ordering;
+
+    //! the number of bits used for each coordinate in the space-filling curve key
+    inline static constexpr int curveBits = 21;
+
+    /**
+     * Compute the key used to order each cell in [cStart, cEnd)
+     * @param dm
+     * @param cStart
+     * @param cEnd
+     * @param cellKeys
+     */
+    void ComputeCellKeys(DM dm, PetscInt cStart, PetscInt cEnd, std::vector<uint64_t>& cellKeys) const;
+
+    /**
+     * Compute the position of a point along the space-filling curve
+     * @param dim
+     * @param coordinates the coordinates of the point scaled to [0, 2^curveBits)
+     * @return
+     */
+    uint64_t CurveKey(PetscInt dim, uint32_t coordinates[3]) const;
+
+    /**
+     * Copy the point sf to the permuted dm, renumbering both the local and remote points
+     * @param dm the original dm
+     * @param newPoints the new point number for each original point
+     * @param permutedDm
+     * @return
+     */
+    static PetscErrorCode PermutePointSF(DM dm, const std::vector<PetscInt>& newPoints, DM permutedDm);
+
+   public:
+    explicit ReorderMesh(Ordering ordering = Ordering::RCM);
+
+    void Modify(DM&) override;
+
+    std::string ToString() const override;
+};
+
+/**
+ * Support function to read the ordering from the input
+ * @param is
+ * @param v
+ * @return
+ */
+std::istream& operator>>(std::istream& is, ReorderMesh::Ordering& v);
+
+}  // namespace ablate::domain::modifiers
+#endif  // ABLATELIBRARY_REORDERMESH_HPP
@@ -11,9 +11,7 @@
 #include <utility>
 #include "finiteVolume/compressibleFlowFields.hpp"
 
-static void NoOpDeallocator(void *, size_t, void *) {}
-
-ablate::eos::ChemTab::ChemTab(const std::filesystem::path &path) : ChemistryModel("ablate::chemistry::ChemTab") {
+ablate::eos::ChemTab::ChemTab(const std::filesystem::path &path, int batchSize) : ChemistryModel("ablate::chemistry::ChemTab"), batchSize(batchSize > 0 ? batchSize : defaultBatchSize) {
     const char *tags = "serve";  // default model serving tag; can change in future
     int ntags = 1;
 
@@ -52,6 +50,15 @@ ablate::eos::ChemTab::ChemTab(const std::filesystem::path &path) : ChemistryMode
     sessionOpts = TF_NewSessionOptions();
     runOpts = nullptr;
     session = TF_LoadSessionFromSavedModel(sessionOpts, runOpts, rpath.c_str(), &tags, ntags, graph, nullptr, status);
+    if (TF_GetCode(status) != TF_OK) throw std::runtime_error(TF_Message(status));
+
+    // look up the input and output operations once
+    inputOperation = {TF_GraphOperationByName(graph, "serving_default_input_1"), 0};
+    if (inputOperation.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName serving_default_input_1");
+    sourceEnergyOperation = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 0};
+    sourceTermsOperation = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 1};
+    if (sourceEnergyOperation.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:0");
+    if (sourceTermsOperation.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:1");
 
     std::fstream inputFileStream;
     // load the meta data from the weights.csv file
@@ -86,6 +93,12 @@ ablate::eos::ChemTab::ChemTab(const std::filesystem::path &path) : ChemistryMode
 }
 
 ablate::eos::ChemTab::~ChemTab() {
+    if (batchInputTensor) {
+        TF_DeleteTensor(batchInputTensor);
+    }
+    if (tailInputTensor) {
+        TF_DeleteTensor(tailInputTensor);
+    }
     TF_DeleteGraph(graph);
     TF_DeleteSession(session, status);
     TF_DeleteSessionOptions(sessionOpts);
@@ -155,80 +168,106 @@ void ablate::eos::ChemTab::LoadBasisVectors(std::istream &inputStream, std::size
 
 void ablate::eos::ChemTab::ChemTabModelComputeFunction(PetscReal density, const PetscReal densityProgressVariable[], PetscReal *predictedSourceEnergy, PetscReal *progressVariableSource,
                                                        PetscReal *densityMassFractions) const {
-    //********* Get Input tensor
-    const std::size_t numInputs = 1;
-
-    TF_Output t0 = {TF_GraphOperationByName(graph, "serving_default_input_1"), 0};
-
-    if (t0.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName serving_default_input_1");
-    std::array<TF_Output, numInputs> input = {t0};
+    // a single point is a batch of one
+    ChemTabModelComputeFunction(1, &density, &densityProgressVariable, &predictedSourceEnergy, &progressVariableSource, &densityMassFractions);
+}
 
-    //********* Get Output tensor
+void ablate::eos::ChemTab::ChemTabModelComputeFunction(PetscInt numberPoints, const PetscReal density[], const PetscReal *const densityProgressVariable[], PetscReal *const predictedSourceEnergy[],
+                                                       PetscReal *const progressVariableSource[], PetscReal *const densityMassFractions[]) const {
+    const std::size_t numInputs = 1;
     const std::size_t numOutputs = 2;
+    const std::array<TF_Output, numInputs> input = {inputOperation};
+    const std::array<TF_Output, numOutputs> output = {sourceEnergyOperation, sourceTermsOperation};
 
-    TF_Output t_sourceenergy = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 0};
-    TF_Output t_sourceterms = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 1};
+    // according to Varun this should work for including Zmix
+    const auto ninputs = progressVariablesNames.size();
+    // the input tensors are reused, so only one evaluation can fill them at a time
+    std::lock_guard<std::mutex> lock(inputTensorMutex);
+
+    // evaluate the model once for each chunk of points
+    for (PetscInt chunkStart = 0; chunkStart < numberPoints; chunkStart += batchSize) {
+        const PetscInt numberChunkPoints = PetscMin(batchSize, numberPoints - chunkStart);
+
+        //********* Fill the input tensor with a row for each point
+        std::array<TF_Tensor *, numInputs> inputValues = {GetInputTensor(numberChunkPoints)};
+        auto inputData = (float *)TF_TensorData(inputValues[0]);
+        for (PetscInt p = 0; p < numberChunkPoints; ++p) {
+            const PetscInt point = chunkStart + p;
+            for (std::size_t i = 0; i < ninputs; i++) {
+                inputData[p * ninputs + i] = (float)(densityProgressVariable[point][i] / density[point]);
+            }
+        }
 
-    if (t_sourceenergy.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:0");
-    if (t_sourceterms.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:1");
-    std::array<TF_Output, numOutputs> output = {t_sourceenergy, t_sourceterms};
+        std::array<TF_Tensor *, numOutputs> outputValues = {nullptr, nullptr};
+        TF_SessionRun(session, nullptr, input.data(), inputValues.data(), (int)numInputs, output.data(), outputValues.data(), (int)numOutputs, nullptr, 0, nullptr, status);
+        if (TF_GetCode(status) != TF_OK) throw std::runtime_error(TF_Message(status));
 
-    //********* Allocate data for inputs & outputs
-    std::array<TF_Tensor *, numInputs> inputValues = {nullptr};
-    std::array<TF_Tensor *, numOutputs> outputValues = {nullptr, nullptr};
+        //********** Extract source predictions, each output holds a row for each point
+        // store physical variables (e.g. souener & mass fractions)
+        auto sourceTermsArray = (float *)TF_TensorData(outputValues[1]);  // Dwyer: as counter intuitive as it may be static dependents come second, it did pass its tests!
+        const auto sourceTermsSize = TF_TensorElementCount(outputValues[1]) / numberChunkPoints;
 
-    std::size_t ndims = 2;
+        // store CPV sources
+        auto progressSourceArray = (float *)TF_TensorData(outputValues[0]);
+        const auto progressSourceSize = TF_TensorElementCount(outputValues[0]) / numberChunkPoints;
 
-    // according to Varun this should work for including Zmix
-    auto ninputs = progressVariablesNames.size();
-    int64_t dims[] = {1, (int)ninputs};
-    float data[ninputs];
+        for (PetscInt p = 0; p < numberChunkPoints; ++p) {
+            const PetscInt point = chunkStart + p;
+            const float *sourceTermsAtPoint = sourceTermsArray + p * sourceTermsSize;
+            const float *progressSourceAtPoint = progressSourceArray + p * progressSourceSize;
 
-    for (std::size_t i = 0; i < ninputs; i++) {
-        data[i] = (float)(densityProgressVariable[i] / density);
-    }
+            if (predictedSourceEnergy && predictedSourceEnergy[point]) {
+                *predictedSourceEnergy[point] += (PetscReal)sourceTermsAtPoint[0] * density[point];
+            }
 
-    std::size_t ndata = ninputs * sizeof(float);
-    TF_Tensor *input_tensor = TF_NewTensor(TF_FLOAT, dims, (int)ndims, data, ndata, &NoOpDeallocator, nullptr);
-    if (input_tensor == nullptr) throw std::runtime_error("ERROR: Failed TF_NewTensor");
+            // store inverted mass fractions
+            if (densityMassFractions && densityMassFractions[point]) {
+                for (size_t i = 0; i < speciesNames.size(); i++) {
+                    densityMassFractions[point][i] = (PetscReal)sourceTermsAtPoint[i + 1] * density[point];  // i+1 b/c i==0 is souener!
+                }
+            }
 
-    inputValues[0] = input_tensor;
+            if (progressVariableSource && progressVariableSource[point]) {
+                // -1 b/c we don't want to go out of bounds with the +1 below, also int is to prevent integer overflow
+                for (size_t i = 0; i < (progressVariablesNames.size() - 1); ++i) {
+                    progressVariableSource[point][i + 1] += (PetscReal)progressSourceAtPoint[i] * density[point];  // +1 b/c we are manually filling in Zmix source value (to 0)
+                }
+            }
+        }
 
-    TF_SessionRun(session, nullptr, input.data(), inputValues.data(), (int)numInputs, output.data(), outputValues.data(), (int)numOutputs, nullptr, 0, nullptr, status);
-    if (TF_GetCode(status) != TF_OK) throw std::runtime_error(TF_Message(status));
-    //********** Extract source predictions
-
-    // store physical variables (e.g. souener & mass fractions)
-    float *outputArray;  // Dwyer: as counter intuitive as it may be static dependents come second, it did pass its tests!
-    outputArray = (float *)TF_TensorData(outputValues[1]);
-    auto p = (PetscReal)outputArray[0];
-    if (predictedSourceEnergy != nullptr) *predictedSourceEnergy += p * density;
-
-    // store inverted mass fractions
-    if (densityMassFractions) {
-        for (size_t i = 0; i < speciesNames.size(); i++) {
-            densityMassFractions[i] = (PetscReal)outputArray[i + 1] * density;  // i+1 b/c i==0 is souener!
+        // the output tensors are allocated by the session, the input tensor is reused
+        for (auto &t : outputValues) {
+            TF_DeleteTensor(t);
         }
     }
+}
 
-    // store CPV sources
-    outputArray = (float *)TF_TensorData(outputValues[0]);
-    if (progressVariableSource != nullptr) {
-        // progressVariableSource[0] = 0;  // Zmix source is always 0!  We
-
-        // -1 b/c we don't want to go out of bounds with the +1 below, also int is to prevent integer overflow
-        for (size_t i = 0; i < (progressVariablesNames.size() - 1); ++i) {
-            progressVariableSource[i + 1] += (PetscReal)outputArray[i] * density;  // +1 b/c we are manually filling in Zmix source value (to 0)
+TF_Tensor *ablate::eos::ChemTab::GetInputTensor(PetscInt numberPoints) const {
+    const auto allocateInputTensor = [this](PetscInt rows) {
+        const auto ninputs = progressVariablesNames.size();
+        int64_t dims[] = {(int64_t)rows, (int64_t)ninputs};
+        auto inputTensor = TF_AllocateTensor(TF_FLOAT, dims, 2, rows * ninputs * sizeof(float));
+        if (inputTensor == nullptr) throw std::runtime_error("ERROR: Failed TF_AllocateTensor");
+        return inputTensor;
+    };
+
+    // every full batch uses the same tensor
+    if (numberPoints == batchSize) {
+        if (batchInputTensor == nullptr) {
+            batchInputTensor = allocateInputTensor(batchSize);
         }
+        return batchInputTensor;
     }
 
-    // free allocated vectors
-    for (auto &t : outputValues) {
-        TF_DeleteTensor(t);
-    }
-    for (auto &t : inputValues) {
-        TF_DeleteTensor(t);
+    // any partial batch uses the tail tensor, which is only reallocated when the number of points changes
+    if (tailInputTensor == nullptr || tailInputTensorSize != numberPoints) {
+        if (tailInputTensor) {
+            TF_DeleteTensor(tailInputTensor);
+        }
+        tailInputTensor = allocateInputTensor(numberPoints);
+        tailInputTensorSize = numberPoints;
     }
+    return tailInputTensor;
 }
 
 void ablate::eos::ChemTab::ComputeMassFractions(const PetscReal *progressVariables, PetscReal *densityMassFractions, PetscReal density) const {
@@ -432,9 +471,41 @@ PetscErrorCode ablate::eos::ChemTab::ComputeMassFractions(PetscReal time, PetscI
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::eos::ChemTab::ComputeMassFractionsBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, PetscScalar *u, void *ctx) {
+    PetscFunctionBeginUser;
+    auto chemTab = (ablate::eos::ChemTab *)ctx;
+
+    // hard code the field offsets
+    const PetscInt EULER = 0;
+    const PetscInt DENSITY_PROGRESS = 1;
+    const PetscInt DENSITY_YI = 2;
+
+    // collect the density and pointers for each cell
+    std::vector<PetscReal> density(numberCells);
+    std::vector<const PetscReal *> densityProgress(numberCells);
+    std::vector<PetscReal *> densityYi(numberCells);
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        PetscScalar *uAtCell = u + c * uStride;
+        density[c] = uAtCell[uOff[EULER] + finiteVolume::CompressibleFlowFields::RHO];
+        densityProgress[c] = uAtCell + uOff[DENSITY_PROGRESS];
+        densityYi[c] = uAtCell + uOff[DENSITY_YI];
+    }
+
+    // compute the mass fractions for every cell at once
+    chemTab->ChemTabModelComputeFunction(numberCells, density.data(), densityProgress.data(), nullptr, nullptr, densityYi.data());
+
+    PetscFunctionReturn(0);
+}
+
 std::vector<std::tuple<ablate::solver::CellSolver::SolutionFieldUpdateFunction, void *, std::vector<std::string>>> ablate::eos::ChemTab::GetSolutionFieldUpdates() {
     return {{ComputeMassFractions, this, {ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD, ablate::finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD, DENSITY_YI_DECODE_FIELD}}};
 }
+
+std::vector<std::tuple<ablate::solver::CellSolver::SolutionFieldUpdateBatchFunction, void *, std::vector<std::string>>> ablate::eos::ChemTab::GetSolutionFieldBatchUpdates() {
+    return {{ComputeMassFractionsBatch,
+             this,
+             {ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD, ablate::finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD, DENSITY_YI_DECODE_FIELD}}};
+}
 std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> ablate::eos::ChemTab::GetAdditionalFields() const {
     return {
         std::make_shared<ablate::domain::FieldDescription>(DENSITY_YI_DECODE_FIELD, DENSITY_YI_DECODE_FIELD, GetSpeciesNames(), ablate::domain::FieldLocation::SOL, ablate::domain::FieldType::FVM)};
@@ -455,9 +526,15 @@ void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::doma
     DM dm;
     VecGetDM(locFVec, &dm) >> utilities::PetscUtilities::checkError;
 
-    // March over each cell in the range
+    // collect the state and source locations for each cell in the range
+    const PetscInt numberCells = cellRange.end - cellRange.start;
+    density.resize(numberCells);
+    densityProgressVariable.resize(numberCells);
+    densityEnergySource.resize(numberCells);
+    progressVariableSource.resize(numberCells);
     for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
         const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
+        const PetscInt i = c - cellRange.start;
 
         // Get the current state variables for this cell
         PetscScalar *sourceAtCell = nullptr;
@@ -467,8 +544,15 @@ void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::doma
         const PetscScalar *solutionAtCell = nullptr;
         DMPlexPointLocalRead(dm, iCell, xArray, &solutionAtCell) >> utilities::PetscUtilities::checkError;
 
-        chemTabModel->ChemistrySource(solutionAtCell[densityOffset], solutionAtCell + densityProgressVariableOffset, sourceAtCell + densityEnergyOffset, sourceAtCell + densityProgressVariableOffset);
+        density[i] = solutionAtCell[densityOffset];
+        densityProgressVariable[i] = solutionAtCell + densityProgressVariableOffset;
+        densityEnergySource[i] = sourceAtCell + densityEnergyOffset;
+        progressVariableSource[i] = sourceAtCell + densityProgressVariableOffset;
     }
+
+    // evaluate the model over the entire range in batches
+    chemTabModel->ChemTabModelComputeFunction(numberCells, density.data(), densityProgressVariable.data(), densityEnergySource.data(), progressVariableSource.data(), nullptr);
+
     // cleanup
     VecRestoreArray(locFVec, &fArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(locX, &xArray) >> utilities::PetscUtilities::checkError;
@@ -477,4 +561,5 @@ void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::doma
 #endif
 
 #include "registrar.hpp"
-REGISTER(ablate::eos::ChemistryModel, ablate::eos::ChemTab, "Uses a tensorflow model developed by ChemTab", ARG(std::filesystem::path, "path", "the path to the model"));
+REGISTER(ablate::eos::ChemistryModel, ablate::eos::ChemTab, "Uses a tensorflow model developed by ChemTab", ARG(std::filesystem::path, "path", "the path to the model"),
+         OPT(int, "batchSize", "the maximum number of cells evaluated in a single tensorflow session run (default is 1024)"));
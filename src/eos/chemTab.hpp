@@ -4,6 +4,8 @@
 #include <petscmat.h>
 #include <filesystem>
 #include <istream>
+#include <map>
+#include <mutex>
 #include "chemistryModel.hpp"
 #include "eos/tChem.hpp"
 #ifdef WITH_TENSORFLOW
@@ -29,6 +31,28 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
     TF_SessionOptions* sessionOpts = nullptr;
     TF_Buffer* runOpts = nullptr;
     TF_Session* session = nullptr;
+
+    //! the model input and output operations, looked up once from the graph
+    TF_Output inputOperation{};
+    TF_Output sourceEnergyOperation{};
+    TF_Output sourceTermsOperation{};
+
+    //! the default maximum number of points evaluated in a single session run
+    inline static const PetscInt defaultBatchSize = 1024;
+
+    //! the maximum number of points evaluated in a single session run
+    const PetscInt batchSize;
+
+    //! the input tensor for a full batch (batchSize rows), allocated on first use
+    mutable TF_Tensor* batchInputTensor = nullptr;
+
+    //! the input tensor for a partial batch, reallocated only when the number of points in the partial batch changes
+    mutable TF_Tensor* tailInputTensor = nullptr;
+    mutable PetscInt tailInputTensorSize = 0;
+
+    //! the input tensors are shared, so only one evaluation can use them at a time
+    mutable std::mutex inputTensorMutex;
+
     std::vector<std::string> speciesNames = std::vector<std::string>(0);
     std::vector<std::string> progressVariablesNames = std::vector<std::string>(0);
 
@@ -55,12 +79,31 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
     void ChemTabModelComputeFunction(PetscReal density, const PetscReal densityProgressVariable[], PetscReal* predictedSourceEnergy, PetscReal* progressVariableSource,
                                      PetscReal* densityMassFractions) const;
 
+    /**
+     * Private function to compute predictedSourceEnergy, progressVariableSource, and massFractions for a batch of points.  The points are evaluated
+     * with a single session run for each chunk of up to batchSize points.
+     * @param numberPoints
+     * @param density, the density for each point
+     * @param densityProgressVariable, a pointer to the densityProgressVariable for each point
+     * @param predictedSourceEnergy , a pointer for each point, if null (array or pointer), wont' be set
+     * @param progressVariableSource , a pointer for each point, if null (array or pointer), won't be set
+     * @param densityMassFractions , a pointer for each point, if null (array or pointer), won't be set
+     */
+    void ChemTabModelComputeFunction(PetscInt numberPoints, const PetscReal density[], const PetscReal* const densityProgressVariable[], PetscReal* const predictedSourceEnergy[],
+                                     PetscReal* const progressVariableSource[], PetscReal* const densityMassFractions[]) const;
+
+    /**
+     * Get (or allocate) the reusable input tensor for this number of points.  The inputTensorMutex must be held by the caller.
+     * @param numberPoints the number of points, at most batchSize
+     * @return
+     */
+    TF_Tensor* GetInputTensor(PetscInt numberPoints) const;
+
     //! Tell the compressible flow fields what tags to use with this field
     [[nodiscard]] std::vector<std::string> GetFieldTags() const override { return std::vector<std::string>{ablate::finiteVolume::CompressibleFlowFields::MinusOneToOneRange}; }
 
     /**
-     * The source calculator is used to do batch processing for chemistry model.  This is a bad implementation
-     * that calls each node one at a time.
+     * The source calculator is used to do batch processing for chemistry model.  The entire cell range is evaluated together.
      */
     class ChemTabSourceCalculator : public ChemistryModel::SourceCalculator {
        private:
@@ -71,6 +114,12 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
         //! hold a pointer to the chemTabModel to compute the source terms
         const std::shared_ptr<ChemTab> chemTabModel;
 
+        //! the density and state/source locations for each cell, reused across steps
+        std::vector<PetscReal> density;
+        std::vector<const PetscReal*> densityProgressVariable;
+        std::vector<PetscReal*> densityEnergySource;
+        std::vector<PetscReal*> progressVariableSource;
+
        public:
         ChemTabSourceCalculator(PetscInt densityOffset, PetscInt densityEnergyOffset, PetscInt densityProgressVariableOffset, std::shared_ptr<ChemTab> chemTabModel);
 
@@ -106,8 +155,26 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
      */
     static PetscErrorCode ComputeMassFractions(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], PetscScalar* u, void* ctx);
 
+    /**
+     * private function to compute the mass fractions for a batch of cells assuming euler[0] and densityProgressVariable[1] and densityYi[2] is provided
+     * @param time
+     * @param dim
+     * @param numberCells
+     * @param uOff
+     * @param uStride
+     * @param u
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode ComputeMassFractionsBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, PetscScalar* u, void* ctx);
+
    public:
-    explicit ChemTab(const std::filesystem::path& path);
+    /**
+     * Create the ChemTab model
+     * @param path the path to the model folder
+     * @param batchSize the maximum number of cells evaluated in a single session run (<= 0 uses the default of 1024)
+     */
+    explicit ChemTab(const std::filesystem::path& path, int batchSize = 0);
     ~ChemTab() override;
 
     /**
@@ -228,6 +295,12 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
      * @return
      */
     [[nodiscard]] std::vector<std::tuple<ablate::solver::CellSolver::SolutionFieldUpdateFunction, void*, std::vector<std::string>>> GetSolutionFieldUpdates() override;
+
+    /**
+     * Return a function to update the densityYi based upon the current progress variable for every cell at once
+     * @return
+     */
+    [[nodiscard]] std::vector<std::tuple<ablate::solver::CellSolver::SolutionFieldUpdateBatchFunction, void*, std::vector<std::string>>> GetSolutionFieldBatchUpdates() override;
 };
 
 #else
@@ -235,7 +308,7 @@ class ChemTab : public ChemistryModel {
    public:
     inline const static std::string DENSITY_YI_DECODE_FIELD = "DENSITY_YI_DECODE";
     static inline const std::string errorMessage = "Using the ChemTab requires Tensorflow to be compile with ABLATE.";
-    ChemTab(std::filesystem::path path) : ChemistryModel("ablate::chemistry::ChemTabModel") { throw std::runtime_error(errorMessage); }
+    ChemTab(std::filesystem::path path, int batchSize = 0) : ChemistryModel("ablate::chemistry::ChemTabModel") { throw std::runtime_error(errorMessage); }
 
     [[nodiscard]] const std::vector<std::string>& GetSpeciesVariables() const override { throw std::runtime_error(errorMessage); }
 
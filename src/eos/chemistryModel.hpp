@@ -52,6 +52,11 @@ class ChemistryModel : public eos::EOS {
      * Optional function to get a solution update
      */
     virtual std::vector<std::tuple<ablate::solver::CellSolver::SolutionFieldUpdateFunction, void*, std::vector<std::string>>> GetSolutionFieldUpdates() { return {}; }
+
+    /**
+     * Optional batch version of the solution updates.  When registered after GetSolutionFieldUpdates it replaces the point update with the same input fields.
+     */
+    virtual std::vector<std::tuple<ablate::solver::CellSolver::SolutionFieldUpdateBatchFunction, void*, std::vector<std::string>>> GetSolutionFieldBatchUpdates() { return {}; }
 };
 }  // namespace ablate::eos
 
@@ -0,0 +1,33 @@
+#include "eos.hpp"
+
+ablate::eos::ThermodynamicBatchFunction ablate::eos::EOS::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field>& fields) const {
+    auto pointFunction = GetThermodynamicFunction(property, fields);
+    auto pointTemperatureFunction = GetThermodynamicTemperatureFunction(property, fields);
+    auto propertySize = pointFunction.propertySize;
+
+    return ThermodynamicBatchFunction{
+        .function = PointBatchFunction,
+        .context = std::make_shared<PointBatchContext>(PointBatchContext{.pointFunction = std::move(pointFunction), .pointTemperatureFunction = std::move(pointTemperatureFunction)}),
+        .propertySize = propertySize};
+}
+
+PetscErrorCode ablate::eos::EOS::PointBatchFunction(PetscInt numberPoints, const PetscReal* conserved, PetscInt stride, const PetscReal* temperature, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto batchContext = (PointBatchContext*)ctx;
+    const auto propertySize = batchContext->pointFunction.propertySize;
+
+    if (temperature) {
+        auto function = batchContext->pointTemperatureFunction.function;
+        auto context = batchContext->pointTemperatureFunction.context.get();
+        for (PetscInt p = 0; p < numberPoints; ++p) {
+            PetscCall(function(conserved + p * stride, temperature[p], property + p * propertySize, context));
+        }
+    } else {
+        auto function = batchContext->pointFunction.function;
+        auto context = batchContext->pointFunction.context.get();
+        for (PetscInt p = 0; p < numberPoints; ++p) {
+            PetscCall(function(conserved + p * stride, property + p * propertySize, context));
+        }
+    }
+    PetscFunctionReturn(0);
+}
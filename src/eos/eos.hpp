@@ -48,6 +48,40 @@ struct ThermodynamicTemperatureFunction {
     PetscInt propertySize = 1;
 };
 
+/**
+ * Simple struct representing the context and function for computing any thermodynamic value over a batch of points.  The conserved values for each point are separated by
+ * the stride. When the optional temperature array is provided it is used as the known temperature for each point, or as the initial guess when computing temperature.
+ */
+struct ThermodynamicBatchFunction {
+    //! function to be called, the property array is sized numberPoints*propertySize
+    PetscErrorCode (*function)(PetscInt numberPoints, const PetscReal conserved[], PetscInt stride, const PetscReal temperature[], PetscReal property[], void* ctx) = nullptr;
+    //! optional context to pass into the function
+    std::shared_ptr<void> context = nullptr;
+    //! the property size being set for each point
+    PetscInt propertySize = 1;
+};
+
+/**
+ * Support function to march over a batch of points using static point functions.  The point functions are template arguments so that they can be inlined into the loop.
+ * Only valid for properties of size one.
+ * @tparam PointFunction the function used when temperature is not available
+ * @tparam PointTemperatureFunction the function used when temperature is available
+ */
+template <PetscErrorCode (*PointFunction)(const PetscReal[], PetscReal*, void*), PetscErrorCode (*PointTemperatureFunction)(const PetscReal[], PetscReal, PetscReal*, void*)>
+PetscErrorCode ThermodynamicBatchLoop(PetscInt numberPoints, const PetscReal conserved[], PetscInt stride, const PetscReal temperature[], PetscReal property[], void* ctx) {
+    PetscFunctionBeginUser;
+    if (temperature) {
+        for (PetscInt p = 0; p < numberPoints; ++p) {
+            PetscCall(PointTemperatureFunction(conserved + p * stride, temperature[p], property + p, ctx));
+        }
+    } else {
+        for (PetscInt p = 0; p < numberPoints; ++p) {
+            PetscCall(PointFunction(conserved + p * stride, property + p, ctx));
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
 /**
  * Simple function representing the context and function for computing a field from two specified properties, velocity, and other properties as specified
  */
@@ -93,6 +127,15 @@ class EOS {
      */
     [[nodiscard]] virtual ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const = 0;
 
+    /**
+     * Single function to produce a batched thermodynamic function for any property based upon the available fields.  The default implementation marches over the points
+     * calling the point functions. Equations of state should override this when a batch can be computed more efficiently.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const;
+
     /**
      * Single function to produce fieldFunction function for any two properties, velocity, and species mass fractions.  These calls can be slower and should be used for init/output only
      * @param field
@@ -134,6 +177,28 @@ class EOS {
      */
     [[nodiscard]] virtual const std::vector<std::string>& GetFieldFunctionProperties() const { return GetSpeciesVariables(); }
 
+    /**
+     * True if the thermodynamic functions (each with their own context) can be called concurrently from the host threads.  Equations of state that launch
+     * their own Kokkos kernels (such as TChem) must not be called from inside a host parallel region.
+     * @return
+     */
+    [[nodiscard]] virtual bool IsThreadSafe() const { return false; }
+
+   private:
+    /**
+     * The context used for the default batch function
+     */
+    struct PointBatchContext {
+        ThermodynamicFunction pointFunction;
+        ThermodynamicTemperatureFunction pointTemperatureFunction;
+    };
+
+    /**
+     * The default batch function that calls the point function for each point
+     */
+    static PetscErrorCode PointBatchFunction(PetscInt numberPoints, const PetscReal conserved[], PetscInt stride, const PetscReal temperature[], PetscReal property[], void* ctx);
+
+   public:
     /**
      * Support function for printing any eos
      * @param out
@@ -46,6 +46,25 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::PerfectGas::GetThermo
         .propertySize = std::get<2>(thermodynamicFunctions.at(property)) == SPECIES_SIZE ? (PetscInt)species.size() : PetscInt(std::get<2>(thermodynamicFunctions.at(property)))};
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::PerfectGas::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    // species sized properties use the default batch function
+    auto batchFunction = std::get<3>(thermodynamicFunctions.at(property));
+    if (!batchFunction) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+
+    // Look for the euler field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::PerfectGas requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    return ThermodynamicBatchFunction{
+        .function = batchFunction,
+        .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters}),
+        .propertySize = 1};
+}
+
 PetscErrorCode ablate::eos::PerfectGas::PressureFunction(const PetscReal *conserved, PetscReal *pressure, void *ctx) {
     PetscFunctionBeginUser;
     auto functionContext = (FunctionContext *)ctx;
@@ -68,24 +68,41 @@ class PerfectGas : public EOS {
     /** @} */
 
     /**
-     * Store a map of functions functions for quick lookup
+     * Store a map of functions functions for quick lookup.  Properties without a batch function use the default EOS batch function.
      */
     using ThermodynamicStaticFunction = PetscErrorCode (*)(const PetscReal conserved[], PetscReal* property, void* ctx);
     using ThermodynamicTemperatureStaticFunction = PetscErrorCode (*)(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
-    std::map<ThermodynamicProperty, std::tuple<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction, int>> thermodynamicFunctions = {
-        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction, 1}},
-        {ThermodynamicProperty::Pressure, {PressureFunction, PressureTemperatureFunction, 1}},
-        {ThermodynamicProperty::Temperature, {TemperatureFunction, TemperatureTemperatureFunction, 1}},
-        {ThermodynamicProperty::InternalSensibleEnergy, {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction, 1}},
-        {ThermodynamicProperty::SensibleEnthalpy, {SensibleEnthalpyFunction, SensibleEnthalpyTemperatureFunction, 1}},
-        {ThermodynamicProperty::SpecificHeatConstantVolume, {SpecificHeatConstantVolumeFunction, SpecificHeatConstantVolumeTemperatureFunction, 1}},
-        {ThermodynamicProperty::SpecificHeatConstantPressure, {SpecificHeatConstantPressureFunction, SpecificHeatConstantPressureTemperatureFunction, 1}},
-        {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundFunction, SpeedOfSoundTemperatureFunction, 1}},
-        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction, SPECIES_SIZE}}};
+    using ThermodynamicBatchStaticFunction = PetscErrorCode (*)(PetscInt numberPoints, const PetscReal conserved[], PetscInt stride, const PetscReal temperature[], PetscReal property[], void* ctx);
+    std::map<ThermodynamicProperty, std::tuple<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction, int, ThermodynamicBatchStaticFunction>> thermodynamicFunctions = {
+        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction, 1, ThermodynamicBatchLoop<DensityFunction, DensityTemperatureFunction>}},
+        {ThermodynamicProperty::Pressure, {PressureFunction, PressureTemperatureFunction, 1, ThermodynamicBatchLoop<PressureFunction, PressureTemperatureFunction>}},
+        {ThermodynamicProperty::Temperature, {TemperatureFunction, TemperatureTemperatureFunction, 1, ThermodynamicBatchLoop<TemperatureFunction, TemperatureTemperatureFunction>}},
+        {ThermodynamicProperty::InternalSensibleEnergy,
+         {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction, 1, ThermodynamicBatchLoop<InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction>}},
+        {ThermodynamicProperty::SensibleEnthalpy,
+         {SensibleEnthalpyFunction, SensibleEnthalpyTemperatureFunction, 1, ThermodynamicBatchLoop<SensibleEnthalpyFunction, SensibleEnthalpyTemperatureFunction>}},
+        {ThermodynamicProperty::SpecificHeatConstantVolume,
+         {SpecificHeatConstantVolumeFunction,
+          SpecificHeatConstantVolumeTemperatureFunction,
+          1,
+          ThermodynamicBatchLoop<SpecificHeatConstantVolumeFunction, SpecificHeatConstantVolumeTemperatureFunction>}},
+        {ThermodynamicProperty::SpecificHeatConstantPressure,
+         {SpecificHeatConstantPressureFunction,
+          SpecificHeatConstantPressureTemperatureFunction,
+          1,
+          ThermodynamicBatchLoop<SpecificHeatConstantPressureFunction, SpecificHeatConstantPressureTemperatureFunction>}},
+        {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundFunction, SpeedOfSoundTemperatureFunction, 1, ThermodynamicBatchLoop<SpeedOfSoundFunction, SpeedOfSoundTemperatureFunction>}},
+        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction, SPECIES_SIZE, nullptr}}};
 
    public:
     explicit PerfectGas(const std::shared_ptr<ablate::parameters::Parameters>&, std::vector<std::string> species = {});
     void View(std::ostream& stream) const override;
+
+    /**
+     * The perfect gas functions only read their context
+     * @return
+     */
+    [[nodiscard]] bool IsThreadSafe() const override { return true; }
     /**
      * Get constant specific heat ratio for a perfect gas.
      * @return
@@ -114,6 +131,14 @@ class PerfectGas : public EOS {
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Single function to produce a batched thermodynamic function for any property based upon the available fields
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
     /**
      * Single function to produce fieldFunction function for any two properties, velocity, and species mass fractions.  These calls can be slower and should be used for init/output only
      * @param field
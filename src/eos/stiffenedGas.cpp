@@ -48,6 +48,25 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::StiffenedGas::GetTher
         .propertySize = std::get<2>(thermodynamicFunctions.at(property)) == SPECIES_SIZE ? (PetscInt)species.size() : PetscInt(std::get<2>(thermodynamicFunctions.at(property)))};
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::StiffenedGas::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    // species sized properties use the default batch function
+    auto batchFunction = std::get<3>(thermodynamicFunctions.at(property));
+    if (!batchFunction) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+
+    // Look for the euler field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::StiffenedGas requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    return ThermodynamicBatchFunction{
+        .function = batchFunction,
+        .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters}),
+        .propertySize = 1};
+}
+
 ablate::eos::EOSFunction ablate::eos::StiffenedGas::GetFieldFunctionFunction(const std::string &field, ablate::eos::ThermodynamicProperty property1, ablate::eos::ThermodynamicProperty property2,
                                                                              std::vector<std::string> otherProperties) const {
     if (finiteVolume::CompressibleFlowFields::EULER_FIELD == field) {
@@ -61,7 +61,11 @@ std::shared_ptr<ablate::eos::TChem::FunctionContext> ablate::eos::TChem::BuildFu
                                                              .policy = policy,
 
                                                              // kinetics data
-                                                             .kineticsModelDataHost = kineticsModelDataHost});
+                                                             .kineticsModelDataHost = kineticsModelDataHost,
+
+                                                             // temperature solve statistics
+                                                             .iterationsHost = tChem::Temperature::ordinal_type_1d_view_host_type(propertyName + " iterations", batchSize),
+                                                             .temperatureSolveStatistics = CreateTemperatureSolveStatistics()});
 }
 
 ablate::eos::ThermodynamicFunction ablate::eos::TChem::GetThermodynamicFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
@@ -90,6 +94,126 @@ ablate::eos::TChem::ThermodynamicTemperatureMassFractionFunction ablate::eos::TC
                                                         .propertySize = speciesSizedProperties.count(property) ? (PetscInt)species.size() : 1};
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::TChem::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    // the batch may need to solve for temperature before computing the property
+    const auto nSpec = kineticsModelDataHost->nSpec;
+    const auto workSpaceSize = std::max(ablate::eos::tChem::Temperature::getWorkSpaceSize(nSpec), std::get<2>(thermodynamicFunctions.at(property))(nSpec));
+
+    return ThermodynamicBatchFunction{.function = BatchFunction,
+                                      .context = std::make_shared<BatchFunctionContext>(BatchFunctionContext{.property = property,
+                                                                                                             .functionContext = *BuildFunctionContext(property, fields),
+                                                                                                             .perTeamScratch = tChemLib::Scratch<real_type_1d_view_host>::shmem_size(workSpaceSize)}),
+                                      .propertySize = speciesSizedProperties.count(property) ? (PetscInt)species.size() : 1};
+}
+
+PetscErrorCode ablate::eos::TChem::BatchFunction(PetscInt numberPoints, const PetscReal *conserved, PetscInt stride, const PetscReal *temperature, PetscReal *property, void *ctx) {
+    PetscFunctionBeginUser;
+    auto batchContext = (BatchFunctionContext *)ctx;
+    auto &functionContext = batchContext->functionContext;
+    const auto nSpec = functionContext.kineticsModelDataHost->nSpec;
+
+    // density and the internal energy (without temperature) are computed directly from the conserved values
+    if (batchContext->property == ThermodynamicProperty::Density || (batchContext->property == ThermodynamicProperty::InternalSensibleEnergy && !temperature)) {
+        auto pointFunction = batchContext->property == ThermodynamicProperty::Density ? DensityFunction : InternalSensibleEnergyFunction;
+        for (PetscInt p = 0; p < numberPoints; ++p) {
+            PetscCall(pointFunction(conserved + p * stride, property + p, &functionContext));
+        }
+        PetscFunctionReturn(0);
+    }
+
+    // grow the working views if needed
+    if ((PetscInt)functionContext.stateHost.extent(0) < numberPoints) {
+        Kokkos::realloc(functionContext.stateHost, numberPoints, functionContext.stateHost.extent(1));
+        Kokkos::realloc(functionContext.perSpeciesHost, numberPoints, nSpec);
+        Kokkos::realloc(functionContext.mixtureHost, numberPoints);
+        Kokkos::realloc(functionContext.iterationsHost, numberPoints);
+    }
+
+    // the policy is sized for this batch
+    auto policy = tChemLib::UseThisTeamPolicy<tChemLib::host_exec_space>::type(numberPoints, Kokkos::AUTO());
+    policy.set_scratch_size(1, Kokkos::PerTeam((int)batchContext->perTeamScratch));
+
+    // Fill the working array for each point, the mixture holds the internal energy used to solve for temperature
+    const bool solveTemperature = batchContext->property == ThermodynamicProperty::Temperature || !temperature;
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        const PetscReal *pointConserved = conserved + p * stride;
+        PetscReal density = pointConserved[functionContext.eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
+
+        auto stateHost = Impl::StateVector<real_type_1d_view_host>(nSpec, Kokkos::subview(functionContext.stateHost, p, Kokkos::ALL()));
+        FillWorkingVectorFromDensityMassFractions(density, temperature ? temperature[p] : 300.0, pointConserved + functionContext.densityYiOffset, stateHost);
+
+        if (solveTemperature) {
+            PetscReal speedSquare = 0.0;
+            for (PetscInt d = 0; d < functionContext.dim; d++) {
+                speedSquare += PetscSqr(pointConserved[functionContext.eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+            }
+            functionContext.mixtureHost(p) = pointConserved[functionContext.eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
+        }
+    }
+
+    // compute the temperature for every point in the batch, this updates the temperature in the state
+    if (solveTemperature) {
+        ablate::eos::tChem::Temperature::runHostBatch(policy,
+                                                      functionContext.stateHost,
+                                                      functionContext.mixtureHost,
+                                                      functionContext.perSpeciesHost,
+                                                      functionContext.enthalpyReferenceHost,
+                                                      *functionContext.kineticsModelDataHost,
+                                                      functionContext.iterationsHost);
+        functionContext.RecordTemperatureSolves(numberPoints);
+    }
+
+    switch (batchContext->property) {
+        case ThermodynamicProperty::Temperature:
+            for (PetscInt p = 0; p < numberPoints; ++p) {
+                property[p] = Impl::StateVector<real_type_1d_view_host>(nSpec, Kokkos::subview(functionContext.stateHost, p, Kokkos::ALL())).Temperature();
+            }
+            break;
+        case ThermodynamicProperty::Pressure:
+            ablate::eos::tChem::Pressure::runHostBatch(policy, functionContext.stateHost, *functionContext.kineticsModelDataHost);
+            for (PetscInt p = 0; p < numberPoints; ++p) {
+                property[p] = Impl::StateVector<real_type_1d_view_host>(nSpec, Kokkos::subview(functionContext.stateHost, p, Kokkos::ALL())).Pressure();
+            }
+            break;
+        case ThermodynamicProperty::InternalSensibleEnergy:
+            ablate::eos::tChem::SensibleInternalEnergy::runHostBatch(
+                policy, functionContext.stateHost, functionContext.mixtureHost, functionContext.perSpeciesHost, functionContext.enthalpyReferenceHost, *functionContext.kineticsModelDataHost);
+            break;
+        case ThermodynamicProperty::SensibleEnthalpy:
+        case ThermodynamicProperty::SpeciesSensibleEnthalpy:
+            ablate::eos::tChem::SensibleEnthalpy::runHostBatch(
+                policy, functionContext.stateHost, functionContext.mixtureHost, functionContext.perSpeciesHost, functionContext.enthalpyReferenceHost, *functionContext.kineticsModelDataHost);
+            break;
+        case ThermodynamicProperty::SpecificHeatConstantVolume:
+            tChemLib::SpecificHeatCapacityConsVolumePerMass::runHostBatch(policy, functionContext.stateHost, functionContext.mixtureHost, *functionContext.kineticsModelDataHost);
+            break;
+        case ThermodynamicProperty::SpecificHeatConstantPressure:
+            tChemLib::SpecificHeatCapacityPerMass::runHostBatch(
+                policy, functionContext.stateHost, functionContext.perSpeciesHost, functionContext.mixtureHost, *functionContext.kineticsModelDataHost);
+            break;
+        case ThermodynamicProperty::SpeedOfSound:
+            ablate::eos::tChem::SpeedOfSound::runHostBatch(policy, functionContext.stateHost, functionContext.mixtureHost, *functionContext.kineticsModelDataHost);
+            break;
+        case ThermodynamicProperty::Density:
+            break;
+    }
+
+    // copy back the mixture or per species results
+    if (batchContext->property == ThermodynamicProperty::SpeciesSensibleEnthalpy) {
+        for (PetscInt p = 0; p < numberPoints; ++p) {
+            for (ordinal_type s = 0; s < nSpec; ++s) {
+                property[p * nSpec + s] = functionContext.perSpeciesHost(p, s);
+            }
+        }
+    } else if (batchContext->property != ThermodynamicProperty::Temperature && batchContext->property != ThermodynamicProperty::Pressure) {
+        for (PetscInt p = 0; p < numberPoints; ++p) {
+            property[p] = functionContext.mixtureHost(p);
+        }
+    }
+
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::eos::TChem::DensityFunction(const PetscReal *conserved, PetscReal *density, void *ctx) {
     PetscFunctionBeginUser;
     auto functionContext = (FunctionContext *)ctx;
@@ -140,7 +264,9 @@ PetscErrorCode ablate::eos::TChem::TemperatureTemperatureFunction(const PetscRea
                                                   functionContext->mixtureHost,
                                                   functionContext->perSpeciesHost,
                                                   functionContext->enthalpyReferenceHost,
-                                                  *functionContext->kineticsModelDataHost);
+                                                  *functionContext->kineticsModelDataHost,
+                                                  functionContext->iterationsHost);
+    functionContext->RecordTemperatureSolves(1);
 
     // copy back the results
     *temperature = stateHost.Temperature();
@@ -174,7 +300,9 @@ PetscErrorCode ablate::eos::TChem::TemperatureTemperatureMassFractionFunction(co
                                                   functionContext->mixtureHost,
                                                   functionContext->perSpeciesHost,
                                                   functionContext->enthalpyReferenceHost,
-                                                  *functionContext->kineticsModelDataHost);
+                                                  *functionContext->kineticsModelDataHost,
+                                                  functionContext->iterationsHost);
+    functionContext->RecordTemperatureSolves(1);
 
     // copy back the results
     *temperature = stateHost.Temperature();
@@ -940,4 +1068,5 @@ REGISTER(ablate::eos::ChemistryModel, ablate::eos::TChem, "[TChemV2](https://git
          OPT(ablate::monitors::logs::Log, "log", "An optional log for TChem echo output (only used with yaml input)"),
          OPT(ablate::parameters::Parameters, "options",
              "time stepping options (dtMin, dtMax, dtDefault, dtEstimateFactor, relToleranceTime, relToleranceTime, absToleranceTime, relToleranceNewton, absToleranceNewton, maxNumNewtonIterations, "
-             "numTimeIterationsPerInterval, jacobianInterval, maxAttempts, thresholdTemperature)"));
+             "numTimeIterationsPerInterval, jacobianInterval, maxAttempts, thresholdTemperature, isatTolerance, isatMaxMemory, isatRegionTolerance, isatMassFractionRegionTolerance, "
+             "isatReportInterval)"));
@@ -73,6 +73,15 @@ class TChem : public TChemBase, public std::enable_shared_from_this<ablate::eos:
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Single function to produce a batched thermodynamic function for any property based upon the available fields.  The batch is computed with a single
+     * tChem kernel launch over all points (plus the temperature solve when needed).
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
     /**
      * Single function to produce thermodynamic function for any property based upon the available fields and yi
      * @param property
@@ -213,6 +222,30 @@ class TChem : public TChemBase, public std::enable_shared_from_this<ablate::eos:
     static PetscErrorCode SpeciesSensibleEnthalpyTemperatureMassFractionFunction(const PetscReal conserved[], const PetscReal yi[], PetscReal T, PetscReal* property, void* ctx);
     /** @} */
 
+    /**
+     * The context for the batch function.  The views in the function context are grown to the largest batch size seen.
+     */
+    struct BatchFunctionContext {
+        //! the property being computed
+        ThermodynamicProperty property;
+        //! the views, offsets and kinetics data
+        FunctionContext functionContext;
+        //! the scratch size needed for both the temperature solve and property
+        std::size_t perTeamScratch;
+    };
+
+    /**
+     * The batch function used for all properties
+     * @param numberPoints
+     * @param conserved
+     * @param stride
+     * @param temperature
+     * @param property
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode BatchFunction(PetscInt numberPoints, const PetscReal conserved[], PetscInt stride, const PetscReal temperature[], PetscReal property[], void* ctx);
+
     /**
      * template function to call base tChem function
      */
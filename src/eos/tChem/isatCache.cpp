@@ -0,0 +1,141 @@
+#include "isatCache.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+ablate::eos::tChem::IsatCache::IsatCache(std::size_t keySize, std::size_t valueSize, double errorTolerance, const std::vector<double>& regionTolerances, std::size_t maxMemory,
+                                         double binWidth)
+    : keySize(keySize),
+      valueSize(valueSize),
+      errorTolerance(errorTolerance),
+      binWidth(binWidth),
+      entryBytes(sizeof(Entry) + sizeof(double) * (keySize + keySize * keySize + valueSize)),
+      maxEntries(std::max<std::size_t>(1, maxMemory / entryBytes)),
+      difference(keySize),
+      ellipsoidDifference(keySize) {
+    if (errorTolerance <= 0.0) {
+        throw std::invalid_argument("The ablate::eos::tChem::IsatCache errorTolerance must be greater than zero.");
+    }
+    if (binWidth <= 0.0) {
+        throw std::invalid_argument("The ablate::eos::tChem::IsatCache binWidth must be greater than zero.");
+    }
+    if (regionTolerances.size() != keySize) {
+        throw std::invalid_argument("The ablate::eos::tChem::IsatCache requires a region tolerance for each key component.");
+    }
+    for (const auto& regionTolerance : regionTolerances) {
+        if (regionTolerance <= 0.0) {
+            throw std::invalid_argument("The ablate::eos::tChem::IsatCache regionTolerances must be greater than zero.");
+        }
+        initialEllipsoid.push_back(1.0 / (regionTolerance * regionTolerance));
+    }
+}
+
+long ablate::eos::tChem::IsatCache::Bin(const double* key) const { return (long)std::floor(key[0] / binWidth); }
+
+double ablate::eos::tChem::IsatCache::EllipsoidDistance(const Entry& entry, const double* key) {
+    for (std::size_t i = 0; i < keySize; ++i) {
+        difference[i] = key[i] - entry.key[i];
+    }
+
+    double distance = 0.0;
+    for (std::size_t i = 0; i < keySize; ++i) {
+        const double* ellipsoidRow = entry.ellipsoid.data() + i * keySize;
+        double rowSum = 0.0;
+        for (std::size_t j = 0; j < keySize; ++j) {
+            rowSum += ellipsoidRow[j] * difference[j];
+        }
+        ellipsoidDifference[i] = rowSum;
+        distance += difference[i] * rowSum;
+    }
+    return distance;
+}
+
+bool ablate::eos::tChem::IsatCache::Retrieve(const double* key, double* value) {
+    auto bin = bins.find(Bin(key));
+    if (bin == bins.end()) {
+        return false;
+    }
+
+    for (auto& entry : bin->second) {
+        if (EllipsoidDistance(*entry, key) <= 1.0) {
+            std::copy(entry->value.begin(), entry->value.end(), value);
+
+            // mark this as the most recently used entry
+            entries.splice(entries.begin(), entries, entry);
+            statistics.retrieves++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ablate::eos::tChem::IsatCache::Add(const double* key, const double* value) {
+    const auto binId = Bin(key);
+    auto& bin = bins[binId];
+
+    // find the nearest entry in this bin
+    std::list<Entry>::iterator nearest = entries.end();
+    double nearestDistance = std::numeric_limits<double>::max();
+    for (auto& entry : bin) {
+        auto distance = EllipsoidDistance(*entry, key);
+        if (distance < nearestDistance) {
+            nearestDistance = distance;
+            nearest = entry;
+        }
+    }
+
+    if (nearest != entries.end()) {
+        // check the error if the nearest entry is used for this point
+        double error = 0.0;
+        for (std::size_t v = 0; v < valueSize; ++v) {
+            error += (value[v] - nearest->value[v]) * (value[v] - nearest->value[v]);
+        }
+
+        if (std::sqrt(error) <= errorTolerance) {
+            entries.splice(entries.begin(), entries, nearest);
+            statistics.grows++;
+
+            // a point already inside (from an entry added since the retrieve) needs no growth
+            if (nearestDistance > 1.0) {
+                // Grow to the minimum ellipsoid containing the original and the point: G' = G + (1/d - 1) (G dx)(G dx)^T / d, where d = dx^T G dx
+                EllipsoidDistance(*nearest, key);
+                const double scale = (1.0 / nearestDistance - 1.0) / nearestDistance;
+                for (std::size_t i = 0; i < keySize; ++i) {
+                    double* ellipsoidRow = nearest->ellipsoid.data() + i * keySize;
+                    for (std::size_t j = 0; j < keySize; ++j) {
+                        ellipsoidRow[j] += scale * ellipsoidDifference[i] * ellipsoidDifference[j];
+                    }
+                }
+            }
+            return;
+        }
+    }
+
+    // add a new entry with the initial axis aligned EOA
+    if (entries.size() >= maxEntries) {
+        EvictLeastRecentlyUsed();
+    }
+    Entry entry{.key = std::vector<double>(key, key + keySize), .ellipsoid = std::vector<double>(keySize * keySize, 0.0), .value = std::vector<double>(value, value + valueSize), .bin = binId};
+    for (std::size_t i = 0; i < keySize; ++i) {
+        entry.ellipsoid[i * keySize + i] = initialEllipsoid[i];
+    }
+    entries.push_front(std::move(entry));
+    bins[binId].push_back(entries.begin());
+    statistics.adds++;
+}
+
+void ablate::eos::tChem::IsatCache::EvictLeastRecentlyUsed() {
+    auto leastRecentlyUsed = std::prev(entries.end());
+
+    // remove this entry from its bin
+    auto bin = bins.find(leastRecentlyUsed->bin);
+    auto& binEntries = bin->second;
+    binEntries.erase(std::find(binEntries.begin(), binEntries.end(), leastRecentlyUsed));
+    if (binEntries.empty()) {
+        bins.erase(bin);
+    }
+
+    entries.erase(leastRecentlyUsed);
+    statistics.evictions++;
+}
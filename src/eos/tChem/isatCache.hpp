@@ -0,0 +1,140 @@
+#ifndef ABLATELIBRARY_TCHEM_ISATCACHE_HPP
+#define ABLATELIBRARY_TCHEM_ISATCACHE_HPP
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace ablate::eos::tChem {
+
+/**
+ * In-situ adaptive tabulation (ISAT) cache for the chemistry source (Pope, 1997).  Each entry stores the result of a direct integration at a
+ * query point and an ellipsoid of accuracy (EOA) in the query space, {x : (x - x0)^T G (x - x0) <= 1}.  A query inside any EOA retrieves the stored value.
+ * When a query misses, the caller integrates directly and adds the result.  If the result is within the error tolerance of the nearest entry, that entry's EOA is
+ * grown to include the query point.  Otherwise a new entry is added with an axis aligned EOA whose semi-axis in each key component is the region tolerance for that
+ * component, so the key components do not need to share units.
+ *
+ * The search is restricted to entries in the same bin of the first key component, so a retrieve may miss an EOA it lies in.  This only costs a direct integration.
+ * Memory is capped by evicting the least recently used entries.
+ *
+ * This is a piecewise-constant (zeroth order) ISAT that does not require the mapping gradient.  Every grow is checked against a direct result.
+ */
+class IsatCache {
+   public:
+    /**
+     * Counters for each type of cache access
+     */
+    struct Statistics {
+        //! the number of queries that were retrieved from the cache
+        std::size_t retrieves = 0;
+        //! the number of direct results that grew an existing ellipsoid of accuracy
+        std::size_t grows = 0;
+        //! the number of direct results added as new entries
+        std::size_t adds = 0;
+        //! the number of entries removed to stay under the memory cap
+        std::size_t evictions = 0;
+
+        //! the number of queries that required direct evaluation
+        [[nodiscard]] inline std::size_t Misses() const { return grows + adds; }
+    };
+
+    /**
+     * Create the cache
+     * @param keySize the size of the (scaled) query vector
+     * @param valueSize the size of the stored result
+     * @param errorTolerance the allowed two-norm error in the value
+     * @param regionTolerances the initial EOA semi-axis for each key component (keySize)
+     * @param maxMemory the approximate maximum number of bytes used for the entries
+     * @param binWidth the bin width in the first key component used to limit the search
+     */
+    IsatCache(std::size_t keySize, std::size_t valueSize, double errorTolerance, const std::vector<double>& regionTolerances, std::size_t maxMemory, double binWidth);
+
+    /**
+     * Look for an entry whose ellipsoid of accuracy contains the key
+     * @param key the query of keySize
+     * @param value the result of valueSize, only set if found
+     * @return true if the value was retrieved
+     */
+    bool Retrieve(const double* key, double* value);
+
+    /**
+     * Add a directly computed value, either growing the nearest entry or adding a new entry
+     * @param key the query of keySize
+     * @param value the directly computed value of valueSize
+     */
+    void Add(const double* key, const double* value);
+
+    /**
+     * The current statistics for the cache
+     */
+    [[nodiscard]] inline const Statistics& GetStatistics() const { return statistics; }
+
+    /**
+     * The number of entries in the cache
+     */
+    [[nodiscard]] inline std::size_t Size() const { return entries.size(); }
+
+    /**
+     * The approximate memory used by the entries (bytes)
+     */
+    [[nodiscard]] inline std::size_t MemoryUsage() const { return entries.size() * entryBytes; }
+
+   private:
+    /**
+     * A single tabulated point
+     */
+    struct Entry {
+        //! the key at the tabulation point
+        std::vector<double> key;
+        //! the symmetric positive definite matrix describing the EOA
+        std::vector<double> ellipsoid;
+        //! the stored result
+        std::vector<double> value;
+        //! the bin holding this entry
+        long bin;
+    };
+
+    const std::size_t keySize;
+    const std::size_t valueSize;
+    const double errorTolerance;
+    const double binWidth;
+
+    //! the diagonal of the initial EOA, 1/r^2 for the region tolerance r of each key component
+    std::vector<double> initialEllipsoid;
+
+    //! the approximate memory for a single entry and the resulting maximum number of entries
+    const std::size_t entryBytes;
+    const std::size_t maxEntries;
+
+    //! the entries ordered from most to least recently used
+    std::list<Entry> entries;
+
+    //! the entries in each bin of the first key component
+    std::unordered_map<long, std::vector<std::list<Entry>::iterator>> bins;
+
+    //! the cache statistics
+    Statistics statistics;
+
+    //! scratch storage for the key difference
+    std::vector<double> difference;
+    std::vector<double> ellipsoidDifference;
+
+    /**
+     * Compute the bin for this key
+     */
+    [[nodiscard]] long Bin(const double* key) const;
+
+    /**
+     * Compute the scaled distance (x - x0)^T G (x - x0) for this entry.  The key difference is left in difference.
+     */
+    double EllipsoidDistance(const Entry& entry, const double* key);
+
+    /**
+     * Remove the least recently used entry
+     */
+    void EvictLeastRecentlyUsed();
+};
+
+}  // namespace ablate::eos::tChem
+#endif  // ABLATELIBRARY_TCHEM_ISATCACHE_HPP
@@ -25,6 +25,11 @@ void ablate::eos::tChem::SourceCalculator::ChemistryConstraints::Set(const std::
         maxAttempts = options->Get("maxAttempts", maxAttempts);
         thresholdTemperature = options->Get("thresholdTemperature", thresholdTemperature);
         reactorType = options->Get("reactorType", ReactorType::ConstantPressure);
+        isatTolerance = options->Get("isatTolerance", isatTolerance);
+        isatMaxMemory = options->Get("isatMaxMemory", isatMaxMemory);
+        isatRegionTolerance = options->Get("isatRegionTolerance", isatRegionTolerance);
+        isatMassFractionRegionTolerance = options->Get("isatMassFractionRegionTolerance", isatMassFractionRegionTolerance);
+        isatReportInterval = options->Get("isatReportInterval", isatReportInterval);
     }
 }
 
@@ -49,6 +54,17 @@ ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain:
     perSpeciesScratchDevice = real_type_2d_view("perSpeciesScratchDevice", numberCells, kineticModelGasConstData.nSpec);
     timeViewDevice = real_type_1d_view("time", numberCells);
     dtViewDevice = real_type_1d_view("delta time", numberCells);
+    retryIndexDevice = ordinal_type_1d_view("retryIndexDevice", numberCells);
+    retryIndexNextDevice = ordinal_type_1d_view("retryIndexNextDevice", numberCells);
+
+    // create the optional isat table keyed on (ln T, ln p, ln dt, Yi) storing the change in Yi.  The log and mass fraction components each have their own region size.
+    if (constraints.isatTolerance > 0.0) {
+        std::vector<double> regionTolerances(numberSpecies + 3, constraints.isatMassFractionRegionTolerance > 0.0 ? constraints.isatMassFractionRegionTolerance : constraints.isatTolerance);
+        std::fill_n(regionTolerances.begin(), 3, constraints.isatRegionTolerance > 0.0 ? constraints.isatRegionTolerance : constraints.isatTolerance);
+        isatCache = std::make_unique<IsatCache>(
+            numberSpecies + 3, numberSpecies, constraints.isatTolerance, regionTolerances, (std::size_t)(constraints.isatMaxMemory * 1.0E6), isatTemperatureBinWidth);
+        endStateHost = Kokkos::create_mirror(endStateDevice);
+    }
 
     // Create the default timeAdvanceObject
     timeAdvanceDefault._tbeg = 0.0;
@@ -208,126 +224,214 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::domain::R
     auto chemistryConstraintsLocal = chemistryConstraints;
     auto timeViewDeviceLocal = timeViewDevice;
 
-    double minimumPressure = 0;
-    for (int attempt = 0; (attempt < chemistryConstraints.maxAttempts) && minimumPressure == 0; ++attempt) {
-        auto factor = PetscPowInt(2, attempt);
-        // Use a parallel for updating timeAdvanceDevice dt
+    auto stateDeviceLocal = stateDevice;
+    auto endStateDeviceLocal = endStateDevice;
+    auto nSpecLocal = kineticModelGasConstDataDevice.nSpec;
+    const ordinal_type stateVecDim = stateDevice.extent(1);
+
+    // the number of cells in the retryIndexDevice that still need to be integrated
+    ordinal_type numberFailed = 0;
+    int firstAttempt = 1;
+
+    if (isatCache) {
+        // copy the computed temperature and pressure back to the host and try to retrieve each cell from the isat table
+        Kokkos::deep_copy(stateHost, stateDevice);
+        auto retryIndexHost = Kokkos::create_mirror_view(retryIndexDevice);
+        const auto keySize = numberSpecies + 3;
+        isatKeys.resize(numberCells * keySize);
+        isatValues.resize(numberCells * numberSpecies);
+        isatRetrieved.assign(numberCells, false);
+        isatCacheable.assign(numberCells, false);
+
+        for (ordinal_type chemIndex = 0; chemIndex < numberCells; ++chemIndex) {
+            const auto stateAtI = Kokkos::subview(stateHost, chemIndex, Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view_host> stateVector(nSpecLocal, stateAtI);
+
+            if (stateVector.Temperature() > 0 && stateVector.Pressure() > 0) {
+                // the key is (ln T, ln p, ln dt, Yi) so that each component is dimensionless
+                auto key = isatKeys.data() + chemIndex * keySize;
+                key[0] = PetscLogReal(stateVector.Temperature());
+                key[1] = PetscLogReal(stateVector.Pressure());
+                key[2] = PetscLogReal(dt);
+                const auto ys = stateVector.MassFractions();
+                for (std::size_t s = 0; s < numberSpecies; ++s) {
+                    key[s + 3] = ys(s);
+                }
+                isatCacheable[chemIndex] = true;
+                isatRetrieved[chemIndex] = isatCache->Retrieve(key, isatValues.data() + chemIndex * numberSpecies);
+            }
+
+            if (!isatRetrieved[chemIndex]) {
+                retryIndexHost(numberFailed++) = chemIndex;
+            }
+        }
+        Kokkos::deep_copy(retryIndexDevice, retryIndexHost);
+
+        // the isat misses are integrated in the compacted storage starting with the default dt
+        firstAttempt = 0;
+    } else {
+        // integrate every cell once using the previous dt estimate
         Kokkos::parallel_for(
             "timeAdvanceUpdate", Kokkos::RangePolicy<tChemLib::exec_space>(0, numberCells), KOKKOS_LAMBDA(const ordinal_type& i) {
                 auto& tAdvAtI = timeAdvanceDeviceLocal(i);
 
                 tAdvAtI._tbeg = time;
                 tAdvAtI._tend = time + dt;
-                tAdvAtI._dt = Kokkos::max(Kokkos::min(Kokkos::min(dtViewDeviceLocal(i) * chemistryConstraintsLocal.dtEstimateFactor, dt), tAdvAtI._dtmax) / factor, tAdvAtI._dtmin);
+                tAdvAtI._dt = Kokkos::max(Kokkos::min(Kokkos::min(dtViewDeviceLocal(i) * chemistryConstraintsLocal.dtEstimateFactor, dt), tAdvAtI._dtmax), tAdvAtI._dtmin);
                 // set the default time information
                 timeViewDeviceLocal(i) = time;
             });
+        IntegrateChemistry(numberCells, timeAdvanceDevice, stateDevice, timeViewDevice, dtViewDevice, endStateDevice, facDevice);
+
+        // compact the cells that failed to integrate (the end pressure is set to zero) into the retry list
+        auto retryIndexDeviceLocal = retryIndexDevice;
+        Kokkos::parallel_scan(
+            "failedCellCompact",
+            Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberCells),
+            KOKKOS_LAMBDA(const ordinal_type& chemIndex, ordinal_type& offset, const bool final) {
+                const auto endStateAtI = Kokkos::subview(endStateDeviceLocal, chemIndex, Kokkos::ALL());
+                Impl::StateVector<real_type_1d_view> endStateVector(nSpecLocal, endStateAtI);
+                if (endStateVector.Pressure() <= 0) {
+                    if (final) {
+                        retryIndexDeviceLocal(offset) = chemIndex;
+                    }
+                    ++offset;
+                }
+            },
+            numberFailed);
+    }
+
+    // Only the failed cells are re-integrated with a successively smaller dt
+    std::vector<ordinal_type> retryCounts;
+    for (int attempt = firstAttempt; (attempt < chemistryConstraints.maxAttempts) && numberFailed > 0; ++attempt) {
+        if (attempt > 0) {
+            retryCounts.push_back(numberFailed);
+        }
 
-        auto chemistryFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberCells, Kokkos::AUTO());
-
-        // determine the required team size
-        switch (chemistryConstraints.reactorType) {
-            case ReactorType::ConstantPressure:
-                chemistryFunctionPolicy.set_scratch_size(
-                    1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::IgnitionZeroD::getWorkSpaceSize(kineticModelGasConstDataDevice))));
-                break;
-            case ReactorType::ConstantVolume:
-                chemistryFunctionPolicy.set_scratch_size(
-                    1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::ConstantVolumeIgnitionReactor::getWorkSpaceSize(solveTla, kineticModelGasConstDataDevice))));
-                break;
+        // grow the retry storage if needed
+        if ((ordinal_type)retryStateDevice.extent(0) < numberFailed) {
+            Kokkos::realloc(retryStateDevice, numberFailed, stateVecDim);
+            Kokkos::realloc(retryEndStateDevice, numberFailed, stateVecDim);
+            Kokkos::realloc(retryFacDevice, numberFailed, facDevice.extent(1));
+            Kokkos::realloc(retryTimeAdvanceDevice, numberFailed);
+            Kokkos::deep_copy(retryTimeAdvanceDevice, timeAdvanceDefault);
+            Kokkos::realloc(retryTimeViewDevice, numberFailed);
+            Kokkos::realloc(retryDtViewDevice, numberFailed);
         }
 
-        // assume a constant pressure zero D reaction for each cell
-        switch (chemistryConstraints.reactorType) {
-            case ReactorType::ConstantPressure:
-                if (chemistryConstraints.thresholdTemperature != 0.0) {
-                    // If there is a thresholdTemperature, use the modified version of IgnitionZeroDTemperatureThreshold
-                    ablate::eos::tChem::IgnitionZeroDTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
-                                                                                          tolNewtonDevice,
-                                                                                          tolTimeDevice,
-                                                                                          facDevice,
-                                                                                          timeAdvanceDevice,
-                                                                                          stateDevice,
-                                                                                          timeViewDevice,
-                                                                                          dtViewDevice,
-                                                                                          endStateDevice,
-                                                                                          kineticModelGasConstDataDevices,
-                                                                                          chemistryConstraints.thresholdTemperature);
-                } else {
-                    // else fall back to the default tChem version
-                    tChemLib::IgnitionZeroD::runDeviceBatch(chemistryFunctionPolicy,
-                                                            tolNewtonDevice,
-                                                            tolTimeDevice,
-                                                            facDevice,
-                                                            timeAdvanceDevice,
-                                                            stateDevice,
-                                                            timeViewDevice,
-                                                            dtViewDevice,
-                                                            endStateDevice,
-                                                            kineticModelGasConstDataDevices);
+        // gather the failed states
+        auto factor = PetscPowInt(2, attempt);
+        auto retryIndexDeviceLocal = retryIndexDevice;
+        auto retryIndexNextDeviceLocal = retryIndexNextDevice;
+        auto retryStateDeviceLocal = retryStateDevice;
+        auto retryEndStateDeviceLocal = retryEndStateDevice;
+        auto retryTimeAdvanceDeviceLocal = retryTimeAdvanceDevice;
+        auto retryTimeViewDeviceLocal = retryTimeViewDevice;
+        auto retryDtViewDeviceLocal = retryDtViewDevice;
+        Kokkos::parallel_for(
+            "retryGather", Kokkos::RangePolicy<tChemLib::exec_space>(0, numberFailed), KOKKOS_LAMBDA(const ordinal_type& r) {
+                const auto chemIndex = retryIndexDeviceLocal(r);
+                for (ordinal_type k = 0; k < stateVecDim; ++k) {
+                    retryStateDeviceLocal(r, k) = stateDeviceLocal(chemIndex, k);
+                }
+
+                auto& tAdvAtR = retryTimeAdvanceDeviceLocal(r);
+                tAdvAtR._tbeg = time;
+                tAdvAtR._tend = time + dt;
+                tAdvAtR._dt = Kokkos::max(Kokkos::min(Kokkos::min(dtViewDeviceLocal(chemIndex) * chemistryConstraintsLocal.dtEstimateFactor, dt), tAdvAtR._dtmax) / factor, tAdvAtR._dtmin);
+                retryTimeViewDeviceLocal(r) = time;
+                retryDtViewDeviceLocal(r) = dtViewDeviceLocal(chemIndex);
+            });
+
+        IntegrateChemistry(numberFailed, retryTimeAdvanceDevice, retryStateDevice, retryTimeViewDevice, retryDtViewDevice, retryEndStateDevice, retryFacDevice);
+
+        // scatter the result back and compact the cells that still failed
+        ordinal_type numberStillFailed = 0;
+        Kokkos::parallel_scan(
+            "retryScatter",
+            Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberFailed),
+            KOKKOS_LAMBDA(const ordinal_type& r, ordinal_type& offset, const bool final) {
+                const auto chemIndex = retryIndexDeviceLocal(r);
+                const auto retryEndStateAtR = Kokkos::subview(retryEndStateDeviceLocal, r, Kokkos::ALL());
+                Impl::StateVector<real_type_1d_view> retryEndStateVector(nSpecLocal, retryEndStateAtR);
+                if (final) {
+                    for (ordinal_type k = 0; k < stateVecDim; ++k) {
+                        endStateDeviceLocal(chemIndex, k) = retryEndStateAtR(k);
+                    }
+                    dtViewDeviceLocal(chemIndex) = retryDtViewDeviceLocal(r);
                 }
-                break;
-            case ReactorType::ConstantVolume:
-                // These arrays are not used when solveTla is false
-                real_type_3d_view state_z;
-                if (chemistryConstraints.thresholdTemperature != 0.0) {
-                    ablate::eos::tChem::ConstantVolumeIgnitionReactorTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
-                                                                                                          solveTla,
-                                                                                                          thetaTla,
-                                                                                                          tolNewtonDevice,
-                                                                                                          tolTimeDevice,
-                                                                                                          facDevice,
-                                                                                                          timeAdvanceDevice,
-                                                                                                          stateDevice,
-                                                                                                          state_z,
-                                                                                                          timeViewDevice,
-                                                                                                          dtViewDevice,
-                                                                                                          endStateDevice,
-                                                                                                          state_z,
-                                                                                                          kineticModelGasConstDataDevices,
-                                                                                                          chemistryConstraints.thresholdTemperature);
-                } else {
-                    ConstantVolumeIgnitionReactor::runDeviceBatch(chemistryFunctionPolicy,
-                                                                  solveTla,
-                                                                  thetaTla,
-                                                                  tolNewtonDevice,
-                                                                  tolTimeDevice,
-                                                                  facDevice,
-                                                                  timeAdvanceDevice,
-                                                                  stateDevice,
-                                                                  state_z,
-                                                                  timeViewDevice,
-                                                                  dtViewDevice,
-                                                                  endStateDevice,
-                                                                  state_z,
-                                                                  kineticModelGasConstDataDevices);
+                if (retryEndStateVector.Pressure() <= 0) {
+                    if (final) {
+                        retryIndexNextDeviceLocal(offset) = chemIndex;
+                    }
+                    ++offset;
                 }
+            },
+            numberStillFailed);
+
+        std::swap(retryIndexDevice, retryIndexNextDevice);
+        numberFailed = numberStillFailed;
+    }
 
-                break;
+    // report the number of cells integrated at each retry attempt
+    if (!retryCounts.empty()) {
+        std::stringstream retryMessage;
+        retryMessage << "tChem::SourceCalculator retried chemistry on rank " << rank << " (" << numberCells << " cells):";
+        for (std::size_t a = 0; a < retryCounts.size(); ++a) {
+            retryMessage << " attempt " << (a + 1) << ": " << retryCounts[a] << " cells;";
         }
+        retryMessage << " failed: " << numberFailed << " cells\n";
+        eos->GetLog()->Print(retryMessage.str().c_str());
+    }
 
-        // check the output pressure, if it is zero the integration failed
-        auto endStateDeviceLocal = endStateDevice;
-        auto nSpecLocal = kineticModelGasConstDataDevice.nSpec;
-        Kokkos::parallel_reduce(
-            "pressureCheck",
-            Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberCells),
-            KOKKOS_LAMBDA(const int& chemIndex, double& pressureMin) {
-                // cast the state at i to a state vector
-                const auto stateAtI = Kokkos::subview(endStateDeviceLocal, chemIndex, Kokkos::ALL());
-                Impl::StateVector<real_type_1d_view> stateVector(nSpecLocal, stateAtI);
-                auto pressureAtI = stateVector.Pressure();
-                if (pressureAtI < pressureMin) {
-                    pressureMin = pressureAtI;
+    if (isatCache) {
+        // set the end state for the retrieved cells and add the integrated cells to the isat table
+        Kokkos::deep_copy(endStateHost, endStateDevice);
+        const auto keySize = numberSpecies + 3;
+        for (ordinal_type chemIndex = 0; chemIndex < numberCells; ++chemIndex) {
+            if (!isatCacheable[chemIndex]) {
+                continue;
+            }
+            const auto stateAtI = Kokkos::subview(stateHost, chemIndex, Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view_host> stateVector(nSpecLocal, stateAtI);
+            const auto ys = stateVector.MassFractions();
+
+            const auto endStateAtI = Kokkos::subview(endStateHost, chemIndex, Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view_host> endStateVector(nSpecLocal, endStateAtI);
+            auto ye = endStateVector.MassFractions();
+
+            // the table stores the change in mass fraction over dt
+            auto value = isatValues.data() + chemIndex * numberSpecies;
+            if (isatRetrieved[chemIndex]) {
+                Kokkos::deep_copy(endStateAtI, stateAtI);
+                for (std::size_t s = 0; s < numberSpecies; ++s) {
+                    ye(s) = ys(s) + value[s];
                 }
-            },
-            Kokkos::Min<double>(minimumPressure));
+            } else if (endStateVector.Pressure() > 0) {
+                for (std::size_t s = 0; s < numberSpecies; ++s) {
+                    value[s] = ye(s) - ys(s);
+                }
+                isatCache->Add(isatKeys.data() + chemIndex * keySize, value);
+            }
+        }
+        Kokkos::deep_copy(endStateDevice, endStateHost);
+
+        // only report the statistics when requested
+        isatComputeCount++;
+        if (chemistryConstraints.isatReportInterval > 0 && isatComputeCount % (std::size_t)chemistryConstraints.isatReportInterval == 0) {
+            const auto& statistics = isatCache->GetStatistics();
+            eos->GetLog()->Printf("tChem::SourceCalculator isat on rank %d: %zu retrieved, %zu grown, %zu added, %zu evicted, %zu entries (%g MB)\n",
+                                  rank,
+                                  statistics.retrieves,
+                                  statistics.grows,
+                                  statistics.adds,
+                                  statistics.evictions,
+                                  isatCache->Size(),
+                                  (double)isatCache->MemoryUsage() / 1.0E6);
+        }
     }
 
     // Get the local copies
-    auto stateDeviceLocal = stateDevice;
-    auto endStateDeviceLocal = endStateDevice;
-    auto nSpecLocal = kineticModelGasConstDataDevice.nSpec;
     auto sourceTermsDeviceLocal = sourceTermsDevice;
     auto cellRangeStartLocal = cellRange.start;
     // Use a parallel for computing the source term
@@ -375,10 +479,14 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::domain::R
                 }
 
 #ifndef KOKKOS_ENABLE_CUDA
-                // compute the cell centroid
-                PetscReal centroid[3];
+                // compute the cell centroid, the dm may not be a plex when integrating cells from another rank
+                PetscReal centroid[3] = {0.0, 0.0, 0.0};
                 const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
-                DMPlexComputeCellGeometryFVM(solutionDm, cell, nullptr, centroid, nullptr) >> utilities::PetscUtilities::checkError;
+                PetscBool isPlex;
+                PetscObjectTypeCompare((PetscObject)solutionDm, DMPLEX, &isPlex) >> utilities::PetscUtilities::checkError;
+                if (isPlex) {
+                    DMPlexComputeCellGeometryFVM(solutionDm, cell, nullptr, centroid, nullptr) >> utilities::PetscUtilities::checkError;
+                }
 
                 // Output error information
                 std::stringstream warningMessage;
@@ -401,6 +509,93 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::domain::R
     Kokkos::deep_copy(sourceTermsHost, sourceTermsDevice);
     EndEvent();
 }
+void ablate::eos::tChem::SourceCalculator::IntegrateChemistry(ordinal_type numberIntegrations, const time_advance_type_1d_view& timeAdvance, const real_type_2d_view& state,
+                                                              const real_type_1d_view& timeView, const real_type_1d_view& dtView, const real_type_2d_view& endState,
+                                                              const real_type_2d_view& fac) {
+    auto chemistryFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberIntegrations, Kokkos::AUTO());
+
+    // determine the required team size
+    switch (chemistryConstraints.reactorType) {
+        case ReactorType::ConstantPressure:
+            chemistryFunctionPolicy.set_scratch_size(
+                1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::IgnitionZeroD::getWorkSpaceSize(kineticModelGasConstDataDevice))));
+            break;
+        case ReactorType::ConstantVolume:
+            chemistryFunctionPolicy.set_scratch_size(
+                1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::ConstantVolumeIgnitionReactor::getWorkSpaceSize(solveTla, kineticModelGasConstDataDevice))));
+            break;
+    }
+
+    // assume a constant pressure zero D reaction for each cell
+    switch (chemistryConstraints.reactorType) {
+        case ReactorType::ConstantPressure:
+            if (chemistryConstraints.thresholdTemperature != 0.0) {
+                // If there is a thresholdTemperature, use the modified version of IgnitionZeroDTemperatureThreshold
+                ablate::eos::tChem::IgnitionZeroDTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
+                                                                                      tolNewtonDevice,
+                                                                                      tolTimeDevice,
+                                                                                      fac,
+                                                                                      timeAdvance,
+                                                                                      state,
+                                                                                      timeView,
+                                                                                      dtView,
+                                                                                      endState,
+                                                                                      kineticModelGasConstDataDevices,
+                                                                                      chemistryConstraints.thresholdTemperature);
+            } else {
+                // else fall back to the default tChem version
+                tChemLib::IgnitionZeroD::runDeviceBatch(chemistryFunctionPolicy,
+                                                        tolNewtonDevice,
+                                                        tolTimeDevice,
+                                                        fac,
+                                                        timeAdvance,
+                                                        state,
+                                                        timeView,
+                                                        dtView,
+                                                        endState,
+                                                        kineticModelGasConstDataDevices);
+            }
+            break;
+        case ReactorType::ConstantVolume:
+            // These arrays are not used when solveTla is false
+            real_type_3d_view state_z;
+            if (chemistryConstraints.thresholdTemperature != 0.0) {
+                ablate::eos::tChem::ConstantVolumeIgnitionReactorTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
+                                                                                                      solveTla,
+                                                                                                      thetaTla,
+                                                                                                      tolNewtonDevice,
+                                                                                                      tolTimeDevice,
+                                                                                                      fac,
+                                                                                                      timeAdvance,
+                                                                                                      state,
+                                                                                                      state_z,
+                                                                                                      timeView,
+                                                                                                      dtView,
+                                                                                                      endState,
+                                                                                                      state_z,
+                                                                                                      kineticModelGasConstDataDevices,
+                                                                                                      chemistryConstraints.thresholdTemperature);
+            } else {
+                ConstantVolumeIgnitionReactor::runDeviceBatch(chemistryFunctionPolicy,
+                                                              solveTla,
+                                                              thetaTla,
+                                                              tolNewtonDevice,
+                                                              tolTimeDevice,
+                                                              fac,
+                                                              timeAdvance,
+                                                              state,
+                                                              state_z,
+                                                              timeView,
+                                                              dtView,
+                                                              endState,
+                                                              state_z,
+                                                              kineticModelGasConstDataDevices);
+            }
+
+            break;
+    }
+}
+
 void ablate::eos::tChem::SourceCalculator::AddSource(const ablate::domain::Range& cellRange, Vec, Vec locFVec) {
     StartEvent("tChem::SourceCalculator::AddSource");
     // get access to the fArray
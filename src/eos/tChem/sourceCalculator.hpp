@@ -2,7 +2,9 @@
 #define ABLATELIBRARY_TCHEM_SOURCECALCULATOR_HPP
 
 #include <TChem_KineticModelGasConstData.hpp>
+#include <memory>
 #include "eos/chemistryModel.hpp"
+#include "isatCache.hpp"
 
 namespace tChemLib = TChem;
 
@@ -44,6 +46,21 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
         // store an optional threshold temperature.  Only compute the reactions if the temperature is above thresholdTemperature
         double thresholdTemperature = 0.0;
 
+        // optional in-situ adaptive tabulation (ISAT) of the chemistry source.  The table is only used when isatTolerance (the allowed error in the change of Yi) is greater than zero
+        double isatTolerance = 0.0;
+
+        // the initial isat region size for the ln(T), ln(p), and ln(dt) key components (a relative change).  Defaults to isatTolerance when not set.
+        double isatRegionTolerance = 0.0;
+
+        // the initial isat region size for the mass fraction key components.  Defaults to isatTolerance when not set.
+        double isatMassFractionRegionTolerance = 0.0;
+
+        // report the isat statistics through the eos log every isatReportInterval calls to ComputeSource.  The statistics are not reported when zero.
+        int isatReportInterval = 0;
+
+        // the approximate maximum memory (MB) used by the isat table on each rank
+        double isatMaxMemory = 512;
+
         void Set(const std::shared_ptr<ablate::parameters::Parameters>&);
     };
 
@@ -70,7 +87,25 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
      */
     void AddSource(const ablate::domain::Range& cellRange, Vec localXVec, Vec localFVec) override;
 
+    /**
+     * The optional isat table, nullptr if not used
+     */
+    [[nodiscard]] inline const IsatCache* GetIsatCache() const { return isatCache.get(); }
+
    private:
+    /**
+     * Integrate the first numberIntegrations states using the chemistryConstraints reactor type
+     * @param numberIntegrations
+     * @param timeAdvance
+     * @param state
+     * @param timeView
+     * @param dtView
+     * @param endState
+     * @param fac
+     */
+    void IntegrateChemistry(ordinal_type numberIntegrations, const time_advance_type_1d_view& timeAdvance, const real_type_2d_view& state, const real_type_1d_view& timeView,
+                            const real_type_1d_view& dtView, const real_type_2d_view& endState, const real_type_2d_view& fac);
+
     //! copy of constraints
     ChemistryConstraints chemistryConstraints;
 
@@ -115,6 +150,30 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
     real_type_1d_view timeViewDevice;
     real_type_1d_view dtViewDevice;
 
+    // compacted storage for the cells that are integrated separately (isat misses and failed cells).  These grow as needed.
+    ordinal_type_1d_view retryIndexDevice;
+    ordinal_type_1d_view retryIndexNextDevice;
+    real_type_2d_view retryStateDevice;
+    real_type_2d_view retryEndStateDevice;
+    real_type_2d_view retryFacDevice;
+    time_advance_type_1d_view retryTimeAdvanceDevice;
+    real_type_1d_view retryTimeViewDevice;
+    real_type_1d_view retryDtViewDevice;
+
+    // the optional isat table and the per cell keys/values used to query it
+    std::unique_ptr<IsatCache> isatCache;
+    real_type_2d_view_host endStateHost;
+    std::vector<double> isatKeys;
+    std::vector<double> isatValues;
+    std::vector<bool> isatRetrieved;
+    std::vector<bool> isatCacheable;
+
+    // the number of calls to ComputeSource with the isat table, used for the isatReportInterval
+    std::size_t isatComputeCount = 0;
+
+    // the isat search is limited to entries within this bin width of ln(T)
+    static inline constexpr double isatTemperatureBinWidth = 0.01;
+
     // Hard code some values needed for the constant volume reactor
     static inline constexpr bool solveTla = false;   // do not calculate tangent linear approximation (TLA) for the const volume reactions
     static inline constexpr real_type thetaTla = 0;  // this is not used when solveTla is false
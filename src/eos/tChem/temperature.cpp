@@ -7,7 +7,7 @@ void Temperature_TemplateRun(const std::string& profile_name,
                              /// team size setting
                              const PolicyType& policy, const Tines::value_type_2d_view<real_type, DeviceType>& state, const Tines::value_type_1d_view<real_type, DeviceType>& internalEnergyRef,
                              const Tines::value_type_2d_view<real_type, DeviceType>& enthalpyMass, const Tines::value_type_1d_view<real_type, DeviceType>& enthalpyReference,
-                             const KineticModelConstData<DeviceType>& kmcd) {
+                             const KineticModelConstData<DeviceType>& kmcd, const Tines::value_type_1d_view<ordinal_type, DeviceType>& iterations) {
     Kokkos::Profiling::pushRegion(profile_name);
     using policy_type = PolicyType;
     using device_type = DeviceType;
@@ -17,6 +17,7 @@ void Temperature_TemplateRun(const std::string& profile_name,
 
     const ordinal_type level = 1;
     const ordinal_type per_team_extent = Temperature::getWorkSpaceSize(kmcd.nSpec);
+    const bool recordIterations = iterations.extent(0) > 0;
 
     Kokkos::parallel_for(
         profile_name, policy, KOKKOS_LAMBDA(const typename policy_type::member_type& member) {
@@ -39,6 +40,12 @@ void Temperature_TemplateRun(const std::string& profile_name,
                 const auto EPS_T_RHO_E = 1E-8;
                 const auto ITERMAX_T = 100;
 
+                // count the energy evaluations after the initial guess so the effect of the guess can be reported
+                ordinal_type iterationCount = 0;
+                if (recordIterations) {
+                    iterations(i) = 0;
+                }
+
                 // compute the first error
                 double e2 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd);
                 double f2 = internalEnergyRef_at_i() - e2;
@@ -57,8 +64,12 @@ void Temperature_TemplateRun(const std::string& profile_name,
                         t = t2;
                         e2 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd);
                         f2 = internalEnergyRef_at_i() - e2;
+                        iterationCount++;
                         if (Tines::ats<real_type>::abs(f2) <= EPS_T_RHO_E) {
                             t = t2;
+                            if (recordIterations) {
+                                iterations(i) = iterationCount;
+                            }
                             return;
                         }
                         t0 = t1;
@@ -81,8 +92,12 @@ void Temperature_TemplateRun(const std::string& profile_name,
                         t = t2;
                         e2 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd);
                         f2 = internalEnergyRef_at_i() - e2;
+                        iterationCount++;
                         if (Tines::ats<real_type>::abs(f2) <= EPS_T_RHO_E) {
                             t = t2;
+                            if (recordIterations) {
+                                iterations(i) = iterationCount;
+                            }
                             return;
                         }
                         t0 = t1;
@@ -92,6 +107,9 @@ void Temperature_TemplateRun(const std::string& profile_name,
                     }
 
                     t = t2;
+                    if (recordIterations) {
+                        iterations(i) = iterationCount;
+                    }
                 }
             }
         });
@@ -102,14 +120,16 @@ void Temperature_TemplateRun(const std::string& profile_name,
 
 [[maybe_unused]] void ablate::eos::tChem::Temperature::runDeviceBatch(typename UseThisTeamPolicy<exec_space>::type& policy, const Temperature::real_type_2d_view_type& state,
                                                                       const Temperature::real_type_1d_view_type& internalEnergyRef, const Temperature::real_type_2d_view_type& enthalpyMass,
-                                                                      const Temperature::real_type_1d_view_type& enthalpyReference, const Temperature::kinetic_model_type& kmcd) {
-    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runDeviceBatch", policy, state, internalEnergyRef, enthalpyMass, enthalpyReference, kmcd);
+                                                                      const Temperature::real_type_1d_view_type& enthalpyReference, const Temperature::kinetic_model_type& kmcd,
+                                                                      const Temperature::ordinal_type_1d_view_type& iterations) {
+    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runDeviceBatch", policy, state, internalEnergyRef, enthalpyMass, enthalpyReference, kmcd, iterations);
 }
 
 [[maybe_unused]] void ablate::eos::tChem::Temperature::runHostBatch(const typename UseThisTeamPolicy<host_exec_space>::type& policy,
                                                                     const ablate::eos::tChem::Temperature::real_type_2d_view_host_type& state,
                                                                     const ablate::eos::tChem::Temperature::real_type_1d_view_host_type& internalEnergyRef,
                                                                     const Temperature::real_type_2d_view_host_type& enthalpyMass, const Temperature::real_type_1d_view_host_type& enthalpyReference,
-                                                                    const ablate::eos::tChem::Temperature::kinetic_model_host_type& kmcd) {
-    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runHostBatch", policy, state, internalEnergyRef, enthalpyMass, enthalpyReference, kmcd);
+                                                                    const ablate::eos::tChem::Temperature::kinetic_model_host_type& kmcd,
+                                                                    const ablate::eos::tChem::Temperature::ordinal_type_1d_view_host_type& iterations) {
+    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runHostBatch", policy, state, internalEnergyRef, enthalpyMass, enthalpyReference, kmcd, iterations);
 }
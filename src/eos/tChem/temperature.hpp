@@ -16,6 +16,9 @@ struct Temperature {
     using real_type_1d_view_host_type = Tines::value_type_1d_view<real_type, host_device_type>;
     using real_type_2d_view_host_type = Tines::value_type_2d_view<real_type, host_device_type>;
 
+    using ordinal_type_1d_view_type = Tines::value_type_1d_view<ordinal_type, device_type>;
+    using ordinal_type_1d_view_host_type = Tines::value_type_1d_view<ordinal_type, host_device_type>;
+
     using kinetic_model_type = KineticModelConstData<device_type>;
     using kinetic_model_host_type = KineticModelConstData<host_device_type>;
 
@@ -29,6 +32,7 @@ struct Temperature {
      * @param mwMix
      * @param temperature
      * @param kmcd
+     * @param iterations optional view to record the number of iterations used for each point, the initial guess is used for the state temperature
      */
     [[maybe_unused]] static void runDeviceBatch(  /// thread block size
         typename UseThisTeamPolicy<exec_space>::type& policy,
@@ -37,7 +41,9 @@ struct Temperature {
         /// useful scratch
         const real_type_2d_view_type& enthalpyMass,
         /// const data from kinetic model
-        const real_type_1d_view_type& enthalpyReference, const kinetic_model_type& kmcd);
+        const real_type_1d_view_type& enthalpyReference, const kinetic_model_type& kmcd,
+        /// optional iteration count per point
+        const ordinal_type_1d_view_type& iterations = {});
 
     /**
      * tchem like function to compute temperature on host
@@ -47,6 +53,7 @@ struct Temperature {
      * @param mwMix
      * @param temperature
      * @param kmcd
+     * @param iterations optional view to record the number of iterations used for each point, the initial guess is used for the state temperature
      */
     [[maybe_unused]] static void runHostBatch(  /// thread block size
         const typename UseThisTeamPolicy<host_exec_space>::type& policy,
@@ -55,7 +62,9 @@ struct Temperature {
         /// useful scratch
         const real_type_2d_view_host_type& enthalpyMass,
         /// const data from kinetic model
-        const real_type_1d_view_host_type& enthalpyReference, const kinetic_model_host_type& kmcd);
+        const real_type_1d_view_host_type& enthalpyReference, const kinetic_model_host_type& kmcd,
+        /// optional iteration count per point
+        const ordinal_type_1d_view_host_type& iterations = {});
 };
 
 }  // namespace ablate::eos::tChem
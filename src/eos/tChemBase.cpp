@@ -80,6 +80,34 @@ void ablate::eos::TChemBase::View(std::ostream &stream) const {
     stream << "EOS: " << type << std::endl;
     stream << "\tmechFile: " << mechanismFile << std::endl;
     stream << "\tnumberSpecies: " << species.size() << std::endl;
+    const auto statistics = GetTemperatureSolveStatistics();
+    if (statistics.solves) {
+        stream << "\ttemperatureSolves: " << statistics.solves << std::endl;
+        stream << "\ttemperatureSolveIterations: " << statistics.iterations << " (mean " << (double)statistics.iterations / (double)statistics.solves << ", max " << statistics.maxIterations
+               << ")" << std::endl;
+    }
     tChemLib::exec_space().print_configuration(stream, true);
     tChemLib::host_exec_space().print_configuration(stream, true);
-}
\ No newline at end of file
+}
+std::shared_ptr<ablate::eos::TChemBase::TemperatureSolveStatistics> ablate::eos::TChemBase::CreateTemperatureSolveStatistics() const {
+    std::lock_guard<std::mutex> lock(temperatureSolveStatisticsMutex);
+    return temperatureSolveStatistics.emplace_back(std::make_shared<TemperatureSolveStatistics>());
+}
+
+ablate::eos::TChemBase::TemperatureSolveStatistics ablate::eos::TChemBase::GetTemperatureSolveStatistics() const {
+    std::lock_guard<std::mutex> lock(temperatureSolveStatisticsMutex);
+    TemperatureSolveStatistics total;
+    for (const auto &statistics : temperatureSolveStatistics) {
+        total.solves += statistics->solves;
+        total.iterations += statistics->iterations;
+        total.maxIterations = PetscMax(total.maxIterations, statistics->maxIterations);
+    }
+    return total;
+}
+
+void ablate::eos::TChemBase::ResetTemperatureSolveStatistics() {
+    std::lock_guard<std::mutex> lock(temperatureSolveStatisticsMutex);
+    for (auto &statistics : temperatureSolveStatistics) {
+        *statistics = {};
+    }
+}
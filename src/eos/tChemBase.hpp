@@ -4,6 +4,8 @@
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "TChem_KineticModelData.hpp"
 #include "chemistryModel.hpp"
 #include "eos.hpp"
@@ -63,6 +65,32 @@ class TChemBase : public ChemistryModel {
      */
     real_type_1d_view_host enthalpyReferenceHost;
 
+   public:
+    /**
+     * Running totals of the temperature solves made by the thermodynamic functions, used to report the effect of the initial temperature guess
+     */
+    struct TemperatureSolveStatistics {
+        //! the number of temperature solves
+        PetscInt solves = 0;
+        //! the total number of iterations over every solve
+        PetscInt iterations = 0;
+        //! the largest number of iterations used by a single solve
+        PetscInt maxIterations = 0;
+    };
+
+   private:
+    //! the temperature solve statistics for each function context created by this eos.  Each context records into its own statistics so that contexts can be used concurrently
+    mutable std::vector<std::shared_ptr<TemperatureSolveStatistics>> temperatureSolveStatistics;
+    //! guard the list of temperature solve statistics
+    mutable std::mutex temperatureSolveStatisticsMutex;
+
+   protected:
+    /**
+     * Create the temperature solve statistics for a new function context
+     * @return
+     */
+    [[nodiscard]] std::shared_ptr<TemperatureSolveStatistics> CreateTemperatureSolveStatistics() const;
+
    public:
     /**
      * The tChem EOS can utilize either a mechanical & thermo file using the Chemkin file format for a modern yaml file.
@@ -101,6 +129,21 @@ class TChemBase : public ChemistryModel {
      */
     tChemLib::KineticModelData& GetKineticModelData() { return kineticsModel; }
 
+    /**
+     * return the statistics for the temperature solves made by this eos
+     */
+    [[nodiscard]] TemperatureSolveStatistics GetTemperatureSolveStatistics() const;
+
+    /**
+     * reset the statistics for the temperature solves made by this eos
+     */
+    void ResetTemperatureSolveStatistics();
+
+    /**
+     * return the log used for tchem output, a NullLog when no log was provided
+     */
+    [[nodiscard]] const std::shared_ptr<ablate::monitors::logs::Log>& GetLog() const { return log; }
+
     /**
      * Get the  reference enthalpy per species
      */
@@ -161,6 +204,27 @@ class TChemBase : public ChemistryModel {
 
         //! the kinetics data
         std::shared_ptr<tChemLib::KineticModelGasConstData<typename Tines::UseThisDevice<host_exec_space>::type>> kineticsModelDataHost;
+
+        //! the number of iterations used by each temperature solve
+        tChem::Temperature::ordinal_type_1d_view_host_type iterationsHost = {};
+
+        //! the statistics updated after each temperature solve
+        std::shared_ptr<TemperatureSolveStatistics> temperatureSolveStatistics = nullptr;
+
+        /**
+         * Add the iterations recorded for the first numberPoints temperature solves to the statistics
+         * @param numberPoints
+         */
+        inline void RecordTemperatureSolves(PetscInt numberPoints) const {
+            if (!temperatureSolveStatistics) {
+                return;
+            }
+            temperatureSolveStatistics->solves += numberPoints;
+            for (PetscInt p = 0; p < numberPoints; ++p) {
+                temperatureSolveStatistics->iterations += iterationsHost(p);
+                temperatureSolveStatistics->maxIterations = PetscMax(temperatureSolveStatistics->maxIterations, (PetscInt)iterationsHost(p));
+            }
+        }
     };
 
    public:
@@ -232,7 +232,7 @@ ablate::eos::ThermodynamicFunction ablate::eos::TwoPhase::GetThermodynamicFuncti
     PetscInt propertySize = speciesSizedProperties.count(property) ? (PetscInt)species.size() : 1;
 
     if (parameters.p01 == 0 && parameters.p02 == 0) {  // GasGas case
-        return ThermodynamicFunction{.function = thermodynamicFunctionsGasGas.at(property).first,
+        return ThermodynamicFunction{.function = std::get<0>(thermodynamicFunctionsGasGas.at(property)),
                                      .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                   .eulerOffset = eulerField->offset,
                                                                                                   .densityVFOffset = densityVFField->offset,
@@ -240,7 +240,7 @@ ablate::eos::ThermodynamicFunction ablate::eos::TwoPhase::GetThermodynamicFuncti
                                                                                                   .parameters = parameters}),
                                      .propertySize = propertySize};
     } else if (parameters.p01 == 0 && parameters.p02 != 0) {  // GasLiquid case
-        return ThermodynamicFunction{.function = thermodynamicFunctionsGasLiquid.at(property).first,
+        return ThermodynamicFunction{.function = std::get<0>(thermodynamicFunctionsGasLiquid.at(property)),
                                      .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                   .eulerOffset = eulerField->offset,
                                                                                                   .densityVFOffset = densityVFField->offset,
@@ -248,7 +248,7 @@ ablate::eos::ThermodynamicFunction ablate::eos::TwoPhase::GetThermodynamicFuncti
                                                                                                   .parameters = parameters}),
                                      .propertySize = propertySize};
     } else if (parameters.p01 != 0 && parameters.p02 != 0) {  // LiquidLiquid case
-        return ThermodynamicFunction{.function = thermodynamicFunctionsLiquidLiquid.at(property).first,
+        return ThermodynamicFunction{.function = std::get<0>(thermodynamicFunctionsLiquidLiquid.at(property)),
                                      .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                   .eulerOffset = eulerField->offset,
                                                                                                   .densityVFOffset = densityVFField->offset,
@@ -256,7 +256,7 @@ ablate::eos::ThermodynamicFunction ablate::eos::TwoPhase::GetThermodynamicFuncti
                                                                                                   .parameters = parameters}),
                                      .propertySize = propertySize};
     } else {  // default ?? here default is GasLiquid air/water
-        return ThermodynamicFunction{.function = thermodynamicFunctionsGasLiquid.at(property).first,
+        return ThermodynamicFunction{.function = std::get<0>(thermodynamicFunctionsGasLiquid.at(property)),
                                      .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                   .eulerOffset = eulerField->offset,
                                                                                                   .densityVFOffset = densityVFField->offset,
@@ -275,28 +275,28 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::TwoPhase::GetThermody
     }
 
     if (parameters.p01 == 0 && parameters.p02 == 0) {  // GasGas case
-        return ThermodynamicTemperatureFunction{.function = thermodynamicFunctionsGasGas.at(property).second,
+        return ThermodynamicTemperatureFunction{.function = std::get<1>(thermodynamicFunctionsGasGas.at(property)),
                                                 .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                              .eulerOffset = eulerField->offset,
                                                                                                              .densityVFOffset = densityVFField->offset,
                                                                                                              .volumeFractionOffset = volumeFractionField->offset,
                                                                                                              .parameters = parameters})};
     } else if (parameters.p01 == 0 && parameters.p02 != 0) {  // GasLiquid case
-        return ThermodynamicTemperatureFunction{.function = thermodynamicFunctionsGasLiquid.at(property).second,
+        return ThermodynamicTemperatureFunction{.function = std::get<1>(thermodynamicFunctionsGasLiquid.at(property)),
                                                 .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                              .eulerOffset = eulerField->offset,
                                                                                                              .densityVFOffset = densityVFField->offset,
                                                                                                              .volumeFractionOffset = volumeFractionField->offset,
                                                                                                              .parameters = parameters})};
     } else if (parameters.p01 != 0 && parameters.p02 != 0) {  // LiquidLiquid case
-        return ThermodynamicTemperatureFunction{.function = thermodynamicFunctionsLiquidLiquid.at(property).second,
+        return ThermodynamicTemperatureFunction{.function = std::get<1>(thermodynamicFunctionsLiquidLiquid.at(property)),
                                                 .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                              .eulerOffset = eulerField->offset,
                                                                                                              .densityVFOffset = densityVFField->offset,
                                                                                                              .volumeFractionOffset = volumeFractionField->offset,
                                                                                                              .parameters = parameters})};
     } else {  // default ?? here default is GasLiquid air/water
-        return ThermodynamicTemperatureFunction{.function = thermodynamicFunctionsGasLiquid.at(property).second,
+        return ThermodynamicTemperatureFunction{.function = std::get<1>(thermodynamicFunctionsGasLiquid.at(property)),
                                                 .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
                                                                                                              .eulerOffset = eulerField->offset,
                                                                                                              .densityVFOffset = densityVFField->offset,
@@ -305,6 +305,39 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::TwoPhase::GetThermody
     }
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::TwoPhase::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    auto densityVFField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::processes::TwoPhaseEulerAdvection::DENSITY_VF_FIELD; });
+    auto volumeFractionField =
+        std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::processes::TwoPhaseEulerAdvection::VOLUME_FRACTION_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::TwoPhase requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    // select the batch function for this case, the default is GasLiquid air/water
+    ThermodynamicBatchStaticFunction batchFunction;
+    if (parameters.p01 == 0 && parameters.p02 == 0) {  // GasGas case
+        batchFunction = std::get<2>(thermodynamicFunctionsGasGas.at(property));
+    } else if (parameters.p01 != 0 && parameters.p02 != 0) {  // LiquidLiquid case
+        batchFunction = std::get<2>(thermodynamicFunctionsLiquidLiquid.at(property));
+    } else {  // GasLiquid case
+        batchFunction = std::get<2>(thermodynamicFunctionsGasLiquid.at(property));
+    }
+
+    // species sized properties use the default batch function
+    if (!batchFunction) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+
+    return ThermodynamicBatchFunction{.function = batchFunction,
+                                      .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
+                                                                                                   .eulerOffset = eulerField->offset,
+                                                                                                   .densityVFOffset = densityVFField->offset,
+                                                                                                   .volumeFractionOffset = volumeFractionField->offset,
+                                                                                                   .parameters = parameters}),
+                                      .propertySize = 1};
+}
+
 ablate::eos::EOSFunction ablate::eos::TwoPhase::GetFieldFunctionFunction(const std::string &field, ablate::eos::ThermodynamicProperty property1, ablate::eos::ThermodynamicProperty property2,
                                                                          std::vector<std::string> otherProperties) const {
     if (otherProperties != std::vector<std::string>{VF} && otherProperties != std::vector<std::string>{VF, YI}) {  // VF not in otherProperties){
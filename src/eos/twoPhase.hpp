@@ -114,39 +114,74 @@ class TwoPhase : public EOS {  // , public std::enabled_shared_from_this<TwoPhas
 
     using ThermodynamicStaticFunction = PetscErrorCode (*)(const PetscReal conserved[], PetscReal* property, void* ctx);
     using ThermodynamicTemperatureStaticFunction = PetscErrorCode (*)(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
+    using ThermodynamicBatchStaticFunction = PetscErrorCode (*)(PetscInt numberPoints, const PetscReal conserved[], PetscInt stride, const PetscReal temperature[], PetscReal property[], void* ctx);
+    // species sized properties do not have a batch function and use the default EOS batch function
     // map for GasGas case
-    std::map<ThermodynamicProperty, std::pair<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction>> thermodynamicFunctionsGasGas = {
-        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction}},
-        {ThermodynamicProperty::Pressure, {PressureFunctionGasGas, PressureTemperatureFunctionGasGas}},
-        {ThermodynamicProperty::Temperature, {TemperatureFunctionGasGas, TemperatureTemperatureFunctionGasGas}},
-        {ThermodynamicProperty::InternalSensibleEnergy, {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction}},
-        {ThermodynamicProperty::SensibleEnthalpy, {SensibleEnthalpyFunctionGasGas, SensibleEnthalpyTemperatureFunctionGasGas}},
-        {ThermodynamicProperty::SpecificHeatConstantVolume, {SpecificHeatConstantVolumeFunctionGasGas, SpecificHeatConstantVolumeTemperatureFunctionGasGas}},
-        {ThermodynamicProperty::SpecificHeatConstantPressure, {SpecificHeatConstantPressureFunctionGasGas, SpecificHeatConstantPressureTemperatureFunctionGasGas}},
-        {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundFunctionGasGas, SpeedOfSoundTemperatureFunctionGasGas}},
-        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction}}};
+    std::map<ThermodynamicProperty, std::tuple<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction, ThermodynamicBatchStaticFunction>> thermodynamicFunctionsGasGas = {
+        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction, ThermodynamicBatchLoop<DensityFunction, DensityTemperatureFunction>}},
+        {ThermodynamicProperty::Pressure, {PressureFunctionGasGas, PressureTemperatureFunctionGasGas, ThermodynamicBatchLoop<PressureFunctionGasGas, PressureTemperatureFunctionGasGas>}},
+        {ThermodynamicProperty::Temperature,
+         {TemperatureFunctionGasGas, TemperatureTemperatureFunctionGasGas, ThermodynamicBatchLoop<TemperatureFunctionGasGas, TemperatureTemperatureFunctionGasGas>}},
+        {ThermodynamicProperty::InternalSensibleEnergy,
+         {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction, ThermodynamicBatchLoop<InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction>}},
+        {ThermodynamicProperty::SensibleEnthalpy,
+         {SensibleEnthalpyFunctionGasGas, SensibleEnthalpyTemperatureFunctionGasGas, ThermodynamicBatchLoop<SensibleEnthalpyFunctionGasGas, SensibleEnthalpyTemperatureFunctionGasGas>}},
+        {ThermodynamicProperty::SpecificHeatConstantVolume,
+         {SpecificHeatConstantVolumeFunctionGasGas,
+          SpecificHeatConstantVolumeTemperatureFunctionGasGas,
+          ThermodynamicBatchLoop<SpecificHeatConstantVolumeFunctionGasGas, SpecificHeatConstantVolumeTemperatureFunctionGasGas>}},
+        {ThermodynamicProperty::SpecificHeatConstantPressure,
+         {SpecificHeatConstantPressureFunctionGasGas,
+          SpecificHeatConstantPressureTemperatureFunctionGasGas,
+          ThermodynamicBatchLoop<SpecificHeatConstantPressureFunctionGasGas, SpecificHeatConstantPressureTemperatureFunctionGasGas>}},
+        {ThermodynamicProperty::SpeedOfSound,
+         {SpeedOfSoundFunctionGasGas, SpeedOfSoundTemperatureFunctionGasGas, ThermodynamicBatchLoop<SpeedOfSoundFunctionGasGas, SpeedOfSoundTemperatureFunctionGasGas>}},
+        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction, nullptr}}};
     // map for GasLiquid case
-    std::map<ThermodynamicProperty, std::pair<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction>> thermodynamicFunctionsGasLiquid = {
-        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction}},
-        {ThermodynamicProperty::Pressure, {PressureFunctionGasLiquid, PressureTemperatureFunctionGasLiquid}},
-        {ThermodynamicProperty::Temperature, {TemperatureFunctionGasLiquid, TemperatureTemperatureFunctionGasLiquid}},
-        {ThermodynamicProperty::InternalSensibleEnergy, {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction}},
-        {ThermodynamicProperty::SensibleEnthalpy, {SensibleEnthalpyFunctionGasLiquid, SensibleEnthalpyTemperatureFunctionGasLiquid}},
-        {ThermodynamicProperty::SpecificHeatConstantVolume, {SpecificHeatConstantVolumeFunctionGasLiquid, SpecificHeatConstantVolumeTemperatureFunctionGasLiquid}},
-        {ThermodynamicProperty::SpecificHeatConstantPressure, {SpecificHeatConstantPressureFunctionGasLiquid, SpecificHeatConstantPressureTemperatureFunctionGasLiquid}},
-        {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundFunctionGasLiquid, SpeedOfSoundTemperatureFunctionGasLiquid}},
-        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction}}};
+    std::map<ThermodynamicProperty, std::tuple<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction, ThermodynamicBatchStaticFunction>> thermodynamicFunctionsGasLiquid = {
+        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction, ThermodynamicBatchLoop<DensityFunction, DensityTemperatureFunction>}},
+        {ThermodynamicProperty::Pressure, {PressureFunctionGasLiquid, PressureTemperatureFunctionGasLiquid, ThermodynamicBatchLoop<PressureFunctionGasLiquid, PressureTemperatureFunctionGasLiquid>}},
+        {ThermodynamicProperty::Temperature,
+         {TemperatureFunctionGasLiquid, TemperatureTemperatureFunctionGasLiquid, ThermodynamicBatchLoop<TemperatureFunctionGasLiquid, TemperatureTemperatureFunctionGasLiquid>}},
+        {ThermodynamicProperty::InternalSensibleEnergy,
+         {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction, ThermodynamicBatchLoop<InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction>}},
+        {ThermodynamicProperty::SensibleEnthalpy,
+         {SensibleEnthalpyFunctionGasLiquid, SensibleEnthalpyTemperatureFunctionGasLiquid, ThermodynamicBatchLoop<SensibleEnthalpyFunctionGasLiquid, SensibleEnthalpyTemperatureFunctionGasLiquid>}},
+        {ThermodynamicProperty::SpecificHeatConstantVolume,
+         {SpecificHeatConstantVolumeFunctionGasLiquid,
+          SpecificHeatConstantVolumeTemperatureFunctionGasLiquid,
+          ThermodynamicBatchLoop<SpecificHeatConstantVolumeFunctionGasLiquid, SpecificHeatConstantVolumeTemperatureFunctionGasLiquid>}},
+        {ThermodynamicProperty::SpecificHeatConstantPressure,
+         {SpecificHeatConstantPressureFunctionGasLiquid,
+          SpecificHeatConstantPressureTemperatureFunctionGasLiquid,
+          ThermodynamicBatchLoop<SpecificHeatConstantPressureFunctionGasLiquid, SpecificHeatConstantPressureTemperatureFunctionGasLiquid>}},
+        {ThermodynamicProperty::SpeedOfSound,
+         {SpeedOfSoundFunctionGasLiquid, SpeedOfSoundTemperatureFunctionGasLiquid, ThermodynamicBatchLoop<SpeedOfSoundFunctionGasLiquid, SpeedOfSoundTemperatureFunctionGasLiquid>}},
+        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction, nullptr}}};
     // map for LiquidLiquid case
-    std::map<ThermodynamicProperty, std::pair<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction>> thermodynamicFunctionsLiquidLiquid = {
-        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction}},
-        {ThermodynamicProperty::Pressure, {PressureFunctionLiquidLiquid, PressureTemperatureFunctionLiquidLiquid}},
-        {ThermodynamicProperty::Temperature, {TemperatureFunctionLiquidLiquid, TemperatureTemperatureFunctionLiquidLiquid}},
-        {ThermodynamicProperty::InternalSensibleEnergy, {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction}},
-        {ThermodynamicProperty::SensibleEnthalpy, {SensibleEnthalpyFunctionLiquidLiquid, SensibleEnthalpyTemperatureFunctionLiquidLiquid}},
-        {ThermodynamicProperty::SpecificHeatConstantVolume, {SpecificHeatConstantVolumeFunctionLiquidLiquid, SpecificHeatConstantVolumeTemperatureFunctionLiquidLiquid}},
-        {ThermodynamicProperty::SpecificHeatConstantPressure, {SpecificHeatConstantPressureFunctionLiquidLiquid, SpecificHeatConstantPressureTemperatureFunctionLiquidLiquid}},
-        {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundFunctionLiquidLiquid, SpeedOfSoundTemperatureFunctionLiquidLiquid}},
-        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction}}};
+    std::map<ThermodynamicProperty, std::tuple<ThermodynamicStaticFunction, ThermodynamicTemperatureStaticFunction, ThermodynamicBatchStaticFunction>> thermodynamicFunctionsLiquidLiquid = {
+        {ThermodynamicProperty::Density, {DensityFunction, DensityTemperatureFunction, ThermodynamicBatchLoop<DensityFunction, DensityTemperatureFunction>}},
+        {ThermodynamicProperty::Pressure,
+         {PressureFunctionLiquidLiquid, PressureTemperatureFunctionLiquidLiquid, ThermodynamicBatchLoop<PressureFunctionLiquidLiquid, PressureTemperatureFunctionLiquidLiquid>}},
+        {ThermodynamicProperty::Temperature,
+         {TemperatureFunctionLiquidLiquid, TemperatureTemperatureFunctionLiquidLiquid, ThermodynamicBatchLoop<TemperatureFunctionLiquidLiquid, TemperatureTemperatureFunctionLiquidLiquid>}},
+        {ThermodynamicProperty::InternalSensibleEnergy,
+         {InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction, ThermodynamicBatchLoop<InternalSensibleEnergyFunction, InternalSensibleEnergyTemperatureFunction>}},
+        {ThermodynamicProperty::SensibleEnthalpy,
+         {SensibleEnthalpyFunctionLiquidLiquid,
+          SensibleEnthalpyTemperatureFunctionLiquidLiquid,
+          ThermodynamicBatchLoop<SensibleEnthalpyFunctionLiquidLiquid, SensibleEnthalpyTemperatureFunctionLiquidLiquid>}},
+        {ThermodynamicProperty::SpecificHeatConstantVolume,
+         {SpecificHeatConstantVolumeFunctionLiquidLiquid,
+          SpecificHeatConstantVolumeTemperatureFunctionLiquidLiquid,
+          ThermodynamicBatchLoop<SpecificHeatConstantVolumeFunctionLiquidLiquid, SpecificHeatConstantVolumeTemperatureFunctionLiquidLiquid>}},
+        {ThermodynamicProperty::SpecificHeatConstantPressure,
+         {SpecificHeatConstantPressureFunctionLiquidLiquid,
+          SpecificHeatConstantPressureTemperatureFunctionLiquidLiquid,
+          ThermodynamicBatchLoop<SpecificHeatConstantPressureFunctionLiquidLiquid, SpecificHeatConstantPressureTemperatureFunctionLiquidLiquid>}},
+        {ThermodynamicProperty::SpeedOfSound,
+         {SpeedOfSoundFunctionLiquidLiquid, SpeedOfSoundTemperatureFunctionLiquidLiquid, ThermodynamicBatchLoop<SpeedOfSoundFunctionLiquidLiquid, SpeedOfSoundTemperatureFunctionLiquidLiquid>}},
+        {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction, nullptr}}};
 
     /**
      * Store a list of properties that are sized by species, everything is assumed to be size one
@@ -160,10 +195,14 @@ class TwoPhase : public EOS {  // , public std::enabled_shared_from_this<TwoPhas
     const std::shared_ptr<ablate::eos::EOS> GetEOSGas() const { return eos1; }
     const std::shared_ptr<ablate::eos::EOS> GetEOSLiquid() const { return eos2; }
 
+    [[nodiscard]] bool IsThreadSafe() const override { return eos1->IsThreadSafe() && eos2->IsThreadSafe(); }
+
     ThermodynamicFunction GetThermodynamicFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
     ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
     EOSFunction GetFieldFunctionFunction(const std::string& field, ThermodynamicProperty property1, ThermodynamicProperty property2, std::vector<std::string> otherProperties) const override;
     const std::vector<std::string>& GetFieldFunctionProperties() const override { return otherPropertiesList; }  // list of other properties i.e. VF;
 
@@ -0,0 +1,135 @@
+#include "advectionFaceState.hpp"
+#include <utility>
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "utilities/mathUtilities.hpp"
+
+ablate::finiteVolume::AdvectionFaceState::AdvectionFaceState(std::shared_ptr<eos::EOS> eosIn, const std::shared_ptr<fluxCalculator::FluxCalculator>& fluxCalculator,
+                                                             const std::vector<domain::Field>& fields, bool useAuxTemperatureGuessIn)
+    : eos(std::move(eosIn)),
+      fluxCalculatorFunction(fluxCalculator->GetFluxCalculatorFunction()),
+      fluxCalculatorCtx(fluxCalculator->GetFluxCalculatorContext()),
+      useAuxTemperatureGuess(useAuxTemperatureGuessIn) {
+    // each call to the eos builds a new function context, so build a set for each host thread when the eos can be called concurrently
+    threadContexts.resize(eos->IsThreadSafe() ? utilities::KokkosUtilities::GetMaxHostThreads() : 1);
+    for (auto& threadContext : threadContexts) {
+        threadContext.computeTemperature = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, fields);
+        threadContext.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, fields);
+        threadContext.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, fields);
+        threadContext.computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, fields);
+    }
+}
+
+bool ablate::finiteVolume::AdvectionFaceState::Matches(const std::shared_ptr<eos::EOS>& eosIn, const std::shared_ptr<fluxCalculator::FluxCalculator>& fluxCalculator) const {
+    // Flux calculators without a context are stateless, so any instance with the same function produces the same result
+    return eos == eosIn && fluxCalculatorFunction == fluxCalculator->GetFluxCalculatorFunction() && fluxCalculatorCtx == fluxCalculator->GetFluxCalculatorContext();
+}
+
+PetscErrorCode ablate::finiteVolume::AdvectionFaceState::ComputeFaceState(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt leftCell, PetscInt rightCell, const PetscInt* uOff,
+                                                                          const PetscScalar* fieldL, const PetscScalar* fieldR, const PetscInt* aOff, const PetscScalar* auxL,
+                                                                          const PetscScalar* auxR, void* ctx) {
+    PetscFunctionBeginUser;
+    auto faceState = (AdvectionFaceState*)ctx;
+    auto& threadContext = faceState->threadContexts[faceState->threadContexts.size() > 1 ? utilities::KokkosUtilities::GetHostThreadId() : 0];
+    const int EULER_FIELD = 0;
+    const int TEMPERATURE_FIELD = 0;
+
+    // warm start the temperature decode from the last temperature in each cell
+    PetscReal temperatureGuessL = DEFAULT_TEMPERATURE_GUESS;
+    PetscReal temperatureGuessR = DEFAULT_TEMPERATURE_GUESS;
+    if (faceState->useAuxTemperatureGuess) {
+        // the aux temperature may not be set yet (or in a ghost cell), so only use valid temperatures
+        if (auxL[aOff[TEMPERATURE_FIELD]] > 0.0) {
+            temperatureGuessL = auxL[aOff[TEMPERATURE_FIELD]];
+        }
+        if (auxR[aOff[TEMPERATURE_FIELD]] > 0.0) {
+            temperatureGuessR = auxR[aOff[TEMPERATURE_FIELD]];
+        }
+    }
+
+    PetscCall(DecodeFace(dim,
+                         fg,
+                         uOff[EULER_FIELD],
+                         fieldL,
+                         fieldR,
+                         threadContext.computeTemperature,
+                         temperatureGuessL,
+                         temperatureGuessR,
+                         threadContext.computeInternalEnergy,
+                         threadContext.computeSpeedOfSound,
+                         threadContext.computePressure,
+                         faceState->fluxCalculatorFunction,
+                         faceState->fluxCalculatorCtx,
+                         threadContext.state));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::AdvectionFaceState::DecodeFace(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt eulerOffset, const PetscScalar* fieldL, const PetscScalar* fieldR,
+                                                                    const eos::ThermodynamicFunction& computeTemperature, const eos::ThermodynamicTemperatureFunction& computeInternalEnergy,
+                                                                    const eos::ThermodynamicTemperatureFunction& computeSpeedOfSound, const eos::ThermodynamicTemperatureFunction& computePressure,
+                                                                    fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction, void* fluxCalculatorCtx, State& state) {
+    PetscFunctionBeginUser;
+    PetscCall(computeTemperature.function(fieldL, &state.temperatureL, computeTemperature.context.get()));
+    PetscCall(computeTemperature.function(fieldR, &state.temperatureR, computeTemperature.context.get()));
+    PetscCall(DecodeFaceFromTemperature(dim, fg, eulerOffset, fieldL, fieldR, computeInternalEnergy, computeSpeedOfSound, computePressure, fluxCalculatorFunction, fluxCalculatorCtx, state));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::AdvectionFaceState::DecodeFace(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt eulerOffset, const PetscScalar* fieldL, const PetscScalar* fieldR,
+                                                                    const eos::ThermodynamicTemperatureFunction& computeTemperature, PetscReal temperatureGuessL, PetscReal temperatureGuessR,
+                                                                    const eos::ThermodynamicTemperatureFunction& computeInternalEnergy, const eos::ThermodynamicTemperatureFunction& computeSpeedOfSound,
+                                                                    const eos::ThermodynamicTemperatureFunction& computePressure, fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction,
+                                                                    void* fluxCalculatorCtx, State& state) {
+    PetscFunctionBeginUser;
+    PetscCall(computeTemperature.function(fieldL, temperatureGuessL, &state.temperatureL, computeTemperature.context.get()));
+    PetscCall(computeTemperature.function(fieldR, temperatureGuessR, &state.temperatureR, computeTemperature.context.get()));
+    PetscCall(DecodeFaceFromTemperature(dim, fg, eulerOffset, fieldL, fieldR, computeInternalEnergy, computeSpeedOfSound, computePressure, fluxCalculatorFunction, fluxCalculatorCtx, state));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::AdvectionFaceState::DecodeFaceFromTemperature(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt eulerOffset, const PetscScalar* fieldL,
+                                                                                   const PetscScalar* fieldR, const eos::ThermodynamicTemperatureFunction& computeInternalEnergy,
+                                                                                   const eos::ThermodynamicTemperatureFunction& computeSpeedOfSound,
+                                                                                   const eos::ThermodynamicTemperatureFunction& computePressure,
+                                                                                   fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction, void* fluxCalculatorCtx, State& state) {
+    PetscFunctionBeginUser;
+    // Compute the norm
+    utilities::MathUtilities::NormVector(dim, fg->normal, state.norm);
+    state.areaMag = utilities::MathUtilities::MagVector(dim, fg->normal);
+
+    // decode the left side
+    {
+        state.densityL = fieldL[eulerOffset + CompressibleFlowFields::RHO];
+
+        // Get the velocity in this direction
+        state.normalVelocityL = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            state.velocityL[d] = fieldL[eulerOffset + CompressibleFlowFields::RHOU + d] / state.densityL;
+            state.normalVelocityL += state.velocityL[d] * state.norm[d];
+        }
+
+        PetscCall(computeInternalEnergy.function(fieldL, state.temperatureL, &state.internalEnergyL, computeInternalEnergy.context.get()));
+        PetscCall(computeSpeedOfSound.function(fieldL, state.temperatureL, &state.aL, computeSpeedOfSound.context.get()));
+        PetscCall(computePressure.function(fieldL, state.temperatureL, &state.pL, computePressure.context.get()));
+    }
+
+    {  // decode right state
+        state.densityR = fieldR[eulerOffset + CompressibleFlowFields::RHO];
+
+        // Get the velocity in this direction
+        state.normalVelocityR = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            state.velocityR[d] = fieldR[eulerOffset + CompressibleFlowFields::RHOU + d] / state.densityR;
+            state.normalVelocityR += state.velocityR[d] * state.norm[d];
+        }
+
+        PetscCall(computeInternalEnergy.function(fieldR, state.temperatureR, &state.internalEnergyR, computeInternalEnergy.context.get()));
+        PetscCall(computeSpeedOfSound.function(fieldR, state.temperatureR, &state.aR, computeSpeedOfSound.context.get()));
+        PetscCall(computePressure.function(fieldR, state.temperatureR, &state.pR, computePressure.context.get()));
+    }
+
+    // compute the face values
+    state.direction = fluxCalculatorFunction(
+        fluxCalculatorCtx, state.normalVelocityL, state.aL, state.densityL, state.pL, state.normalVelocityR, state.aR, state.densityR, state.pR, &state.massFlux, &state.p12);
+
+    PetscFunctionReturn(0);
+}
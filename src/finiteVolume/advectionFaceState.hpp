@@ -0,0 +1,165 @@
+#ifndef ABLATELIBRARY_ADVECTIONFACESTATE_HPP
+#define ABLATELIBRARY_ADVECTIONFACESTATE_HPP
+
+#include <petsc.h>
+#include <memory>
+#include <vector>
+#include "domain/field.hpp"
+#include "eos/eos.hpp"
+#include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
+#include "utilities/kokkosUtilities.hpp"
+
+namespace ablate::finiteVolume {
+
+/**
+ * Decodes the left/right euler state on a face once and stores the flux calculator (Riemann) result so that it can be shared by every
+ * advection process (NavierStokesTransport, SpeciesTransport, EVTransport) using the same eos and flux calculator.  The state is computed
+ * by the CellInterpolant as a face state function before any of the discontinuous flux functions are called on that face.
+ */
+class AdvectionFaceState {
+   public:
+    /**
+     * The decoded state and flux calculator result for a single face
+     */
+    struct State {
+        //! the unit normal and area of the face
+        PetscReal norm[3];
+        PetscReal areaMag;
+
+        //! the decoded left/right state
+        PetscReal densityL, densityR;
+        PetscReal velocityL[3], velocityR[3];
+        PetscReal normalVelocityL, normalVelocityR;
+        PetscReal temperatureL, temperatureR;
+        PetscReal internalEnergyL, internalEnergyR;
+        PetscReal aL, aR;
+        PetscReal pL, pR;
+
+        //! the result from the flux calculator
+        PetscReal massFlux;
+        PetscReal p12;
+        fluxCalculator::Direction direction;
+    };
+
+   private:
+    //! the eos and flux calculator used to build the state, used to determine if this state can be shared
+    const std::shared_ptr<eos::EOS> eos;
+    const fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction;
+    void* const fluxCalculatorCtx;
+
+    //! if true, the aux temperature field in the left/right cells is used as the initial guess for the temperature decode
+    const bool useAuxTemperatureGuess;
+
+    /**
+     * The eos functions and face state used by a single host thread.  The eos function contexts may hold mutable work arrays, so each thread
+     * gets its own copy so that faces can be computed concurrently.
+     */
+    struct ThreadContext {
+        //! EOS function calls, the temperature is computed using the initial guess
+        eos::ThermodynamicTemperatureFunction computeTemperature;
+        eos::ThermodynamicTemperatureFunction computeInternalEnergy;
+        eos::ThermodynamicTemperatureFunction computeSpeedOfSound;
+        eos::ThermodynamicTemperatureFunction computePressure;
+
+        //! the state for the current face on this thread
+        State state{};
+    };
+
+    //! the context for each host thread
+    std::vector<ThreadContext> threadContexts;
+
+   public:
+    /**
+     * Create the face state for the supplied eos and flux calculator
+     * @param eos
+     * @param fluxCalculator
+     * @param fields all fields in the subDomain
+     * @param useAuxTemperatureGuess if true, the face state is registered with the temperature aux field and it is used as the initial guess
+     */
+    AdvectionFaceState(std::shared_ptr<eos::EOS> eos, const std::shared_ptr<fluxCalculator::FluxCalculator>& fluxCalculator, const std::vector<domain::Field>& fields,
+                       bool useAuxTemperatureGuess = false);
+
+    //! the temperature guess used when the aux temperature is not available or not valid
+    inline static const PetscReal DEFAULT_TEMPERATURE_GUESS = 300.0;
+
+    /**
+     * Determine if this face state was computed with the same eos and flux calculator
+     * @param eos
+     * @param fluxCalculator
+     * @return
+     */
+    [[nodiscard]] bool Matches(const std::shared_ptr<eos::EOS>& eos, const std::shared_ptr<fluxCalculator::FluxCalculator>& fluxCalculator) const;
+
+    /**
+     * The state for the face currently being computed by the calling thread
+     * @return
+     */
+    [[nodiscard]] inline const State& GetState() const { return threadContexts[threadContexts.size() > 1 ? utilities::KokkosUtilities::GetHostThreadId() : 0].state; }
+
+    /**
+     * Face state function to compute the shared state on the face
+     * u = {"euler"}
+     * a = {"temperature"} (optional, see useAuxTemperatureGuess)
+     * ctx = AdvectionFaceState
+     * @return
+     */
+    static PetscErrorCode ComputeFaceState(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt leftCell, PetscInt rightCell, const PetscInt uOff[], const PetscScalar fieldL[],
+                                           const PetscScalar fieldR[], const PetscInt aOff[], const PetscScalar auxL[], const PetscScalar auxR[], void* ctx);
+
+    /**
+     * Support function to decode the left/right state and compute the flux calculator result on a face
+     * @param dim
+     * @param fg
+     * @param eulerOffset the offset of the euler field in the fieldL/fieldR arrays
+     * @param fieldL
+     * @param fieldR
+     * @param computeTemperature
+     * @param computeInternalEnergy
+     * @param computeSpeedOfSound
+     * @param computePressure
+     * @param fluxCalculatorFunction
+     * @param fluxCalculatorCtx
+     * @param state the decoded state
+     * @return
+     */
+    static PetscErrorCode DecodeFace(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt eulerOffset, const PetscScalar fieldL[], const PetscScalar fieldR[],
+                                     const eos::ThermodynamicFunction& computeTemperature, const eos::ThermodynamicTemperatureFunction& computeInternalEnergy,
+                                     const eos::ThermodynamicTemperatureFunction& computeSpeedOfSound, const eos::ThermodynamicTemperatureFunction& computePressure,
+                                     fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction, void* fluxCalculatorCtx, State& state);
+
+    /**
+     * Support function to decode the left/right state and compute the flux calculator result on a face using an initial guess for each temperature
+     * @param dim
+     * @param fg
+     * @param eulerOffset the offset of the euler field in the fieldL/fieldR arrays
+     * @param fieldL
+     * @param fieldR
+     * @param computeTemperature the temperature function, the temperature argument is used as the initial guess
+     * @param temperatureGuessL the initial guess for the left temperature, typically the last temperature in the left cell
+     * @param temperatureGuessR the initial guess for the right temperature, typically the last temperature in the right cell
+     * @param computeInternalEnergy
+     * @param computeSpeedOfSound
+     * @param computePressure
+     * @param fluxCalculatorFunction
+     * @param fluxCalculatorCtx
+     * @param state the decoded state
+     * @return
+     */
+    static PetscErrorCode DecodeFace(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt eulerOffset, const PetscScalar fieldL[], const PetscScalar fieldR[],
+                                     const eos::ThermodynamicTemperatureFunction& computeTemperature, PetscReal temperatureGuessL, PetscReal temperatureGuessR,
+                                     const eos::ThermodynamicTemperatureFunction& computeInternalEnergy, const eos::ThermodynamicTemperatureFunction& computeSpeedOfSound,
+                                     const eos::ThermodynamicTemperatureFunction& computePressure, fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction, void* fluxCalculatorCtx,
+                                     State& state);
+
+   private:
+    /**
+     * Decode the remaining left/right state once the left/right temperatures (in the state) are known and compute the flux calculator result
+     */
+    static PetscErrorCode DecodeFaceFromTemperature(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt eulerOffset, const PetscScalar fieldL[], const PetscScalar fieldR[],
+                                                    const eos::ThermodynamicTemperatureFunction& computeInternalEnergy, const eos::ThermodynamicTemperatureFunction& computeSpeedOfSound,
+                                                    const eos::ThermodynamicTemperatureFunction& computePressure, fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction,
+                                                    void* fluxCalculatorCtx, State& state);
+};
+
+}  // namespace ablate::finiteVolume
+#endif  // ABLATELIBRARY_ADVECTIONFACESTATE_HPP
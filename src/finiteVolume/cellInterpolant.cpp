@@ -1,77 +1,85 @@
 #include "cellInterpolant.hpp"
 #include <petsc/private/dmpleximpl.h>
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <functional>
 #include <utility>
+#include "utilities/kokkosUtilities.hpp"
 
 ablate::finiteVolume::CellInterpolant::CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomainIn, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec)
     : subDomain(std::move(std::move(subDomainIn))) {
-    auto getGradientDm = [this, solverRegion, faceGeomVec, cellGeomVec](const domain::Field& fieldInfo, std::vector<DM>& gradDMs) {
-        auto petscField = subDomain->GetPetscFieldObject(fieldInfo);
-        auto petscFieldFV = (PetscFV)petscField;
+    // precompute the packed gradient dm and stencil for every field that supports it
+    BuildGradientStencil(solverRegion, faceGeomVec, cellGeomVec);
 
-        PetscBool computeGradients;
-        PetscFVGetComputeGradients(petscFieldFV, &computeGradients) >> utilities::PetscUtilities::checkError;
+    // precompute the face topology used in the flux loop
+    BuildFaceConnectivity(solverRegion, faceGeomVec, cellGeomVec);
+}
 
-        if (computeGradients) {
-            DM dmGradInt;
+ablate::finiteVolume::CellInterpolant::~CellInterpolant() {
+    if (gradientDm) {
+        DMDestroy(&gradientDm) >> utilities::PetscUtilities::checkError;
+    }
+}
 
-            DMLabel regionLabel = nullptr;
-            PetscInt regionValue = PETSC_DECIDE;
-            domain::Region::GetLabel(solverRegion, subDomain->GetDM(), regionLabel, regionValue);
+void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
+                                                       std::vector<CellInterpolant::FaceStateFunctionDescription>& faceStateFunctions,
+                                                       std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, Vec cellGeomVec, Vec faceGeomVec,
+                                                       const std::function<void()>& overlapFunction) {
+    // the gradients for every field are packed into a single vector
+    Vec locGradVec = nullptr;
+    Vec globGradVec = nullptr;
 
-            ComputeGradientFVM(subDomain->GetFieldDM(fieldInfo), regionLabel, regionValue, petscFieldFV, faceGeomVec, cellGeomVec, &dmGradInt) >> utilities::PetscUtilities::checkError;
-            gradDMs.push_back(dmGradInt);
-        } else {
-            gradDMs.push_back(nullptr);
-        }
-    };
+    /* Reconstruct and limit cell gradients */
+    // compute the gradient for all fields and start the exchange to the localGrads vector
+    ComputeFieldGradients(locXVec, locGradVec, globGradVec, faceGeomVec);
 
-    // Compute the gradient dm for each field that supports it
-    for (const auto& fieldInfo : subDomain->GetFields()) {
-        getGradientDm(fieldInfo, gradientCellDms);
+    // The faces between owned cells only need the owned gradients, so compute them while the gradients are exchanged
+    ComputeFluxSourceTerms(locXVec, locAuxVec, locFVec, cellGeomVec, faceGeomVec, locGradVec, faceStateFunctions, rhsFunctions, 0, faceConnectivity.numberInteriorFaces);
+    if (overlapFunction) {
+        overlapFunction();
     }
-}
 
-ablate::finiteVolume::CellInterpolant::~CellInterpolant() {
-    for (auto& dm : gradientCellDms) {
-        if (dm) {
-            DMDestroy(&dm) >> utilities::PetscUtilities::checkError;
-        }
+    // complete the exchange
+    if (globGradVec) {
+        DMGlobalToLocalEnd(gradientDm, globGradVec, INSERT_VALUES, locGradVec) >> utilities::PetscUtilities::checkError;
+        DMRestoreGlobalVector(gradientDm, &globGradVec) >> utilities::PetscUtilities::checkError;
+    }
+
+    // compute the remaining faces that need the exchanged gradients
+    ComputeFluxSourceTerms(locXVec, locAuxVec, locFVec, cellGeomVec, faceGeomVec, locGradVec, faceStateFunctions, rhsFunctions, faceConnectivity.numberInteriorFaces, faceConnectivity.Size());
+
+    // clean up cell grads
+    if (locGradVec) {
+        DMRestoreLocalVector(gradientDm, &locGradVec) >> utilities::PetscUtilities::checkError;
     }
 }
 
-void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
-                                                       std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const ablate::domain::Range& faceRange,
-                                                       const ablate::domain::Range& cellRange, Vec cellGeomVec, Vec faceGeomVec) {
+void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(Vec locXVec, Vec locAuxVec, Vec locFVec, Vec cellGeomVec, Vec faceGeomVec, Vec locGradVec,
+                                                                   std::vector<CellInterpolant::FaceStateFunctionDescription>& faceStateFunctions,
+                                                                   std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, std::size_t faceStart, std::size_t faceEnd) {
+    if (faceStart >= faceEnd) {
+        return;
+    }
     auto dm = subDomain->GetDM();
     auto dmAux = subDomain->GetAuxDM();
 
-    /* 1: Get sizes from dm and dmAux */
-    PetscSection section = nullptr;
-    DMGetLocalSection(dm, &section) >> utilities::PetscUtilities::checkError;
-
     // Get the ds from he subDomain and required info
     auto ds = subDomain->GetDiscreteSystem();
-    PetscInt nf, totDim;
-    PetscDSGetNumFields(ds, &nf) >> utilities::PetscUtilities::checkError;
+    PetscInt totDim;
     PetscDSGetTotalDimension(ds, &totDim) >> utilities::PetscUtilities::checkError;
 
     // Check to see if the dm has an auxVec/auxDM associated with it.  If it does, extract it
     PetscDS dsAux = subDomain->GetAuxDiscreteSystem();
-    PetscInt naf = 0, totDimAux = 0;
+    PetscInt totDimAux = 0;
     if (locAuxVec) {
         PetscDSGetTotalDimension(dsAux, &totDimAux) >> utilities::PetscUtilities::checkError;
-        PetscDSGetNumFields(dsAux, &naf) >> utilities::PetscUtilities::checkError;
     }
 
-    /* 2: Get geometric data */
     // We can use a single call for the geometry data because it does not depend on the fv object
     const PetscScalar* cellGeomArray = nullptr;
     const PetscScalar* faceGeomArray = nullptr;
     VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
     VecGetArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
-    DM faceDM, cellDM;
-    VecGetDM(faceGeomVec, &faceDM) >> utilities::PetscUtilities::checkError;
-    VecGetDM(cellGeomVec, &cellDM) >> utilities::PetscUtilities::checkError;
 
     // Get raw access to the computed values
     const PetscScalar *xArray, *auxArray = nullptr;
@@ -84,59 +92,25 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
     PetscScalar* locFArray;
     VecGetArray(locFVec, &locFArray) >> utilities::PetscUtilities::checkError;
 
-    // there must be a separate gradient vector/dm for field because they can be different sizes
-    std::vector<Vec> locGradVecs(nf, nullptr);
-
-    /* Reconstruct and limit cell gradients */
-    // for each field compute the gradient in the localGrads vector
-    for (const auto& field : subDomain->GetFields()) {
-        ComputeFieldGradients(field, locXVec, locGradVecs[field.subId], gradientCellDms[field.subId], cellGeomVec, faceGeomVec, faceRange, cellRange);
+    const PetscScalar* locGradArray = nullptr;
+    if (locGradVec) {
+        VecGetArrayRead(locGradVec, &locGradArray) >> utilities::PetscUtilities::checkError;
     }
 
-    std::vector<const PetscScalar*> locGradArrays(nf, nullptr);
-    for (const auto& field : subDomain->GetFields()) {
-        if (locGradVecs[field.subId]) {
-            VecGetArrayRead(locGradVecs[field.subId], &locGradArrays[field.subId]) >> utilities::PetscUtilities::checkError;
-        }
-    }
-
-    ComputeFluxSourceTerms(dm,
-                           ds,
-                           totDim,
-                           xArray,
-                           dmAux,
-                           dsAux,
-                           totDimAux,
-                           auxArray,
-                           faceDM,
-                           faceGeomArray,
-                           cellDM,
-                           cellGeomArray,
-                           gradientCellDms,
-                           locGradArrays,
-                           locFArray,
-                           solverRegion,
-                           rhsFunctions,
-                           faceRange,
-                           cellRange);
+    ComputeFluxSourceTerms(dm, ds, totDim, xArray, dmAux, dsAux, totDimAux, auxArray, faceGeomArray, cellGeomArray, locGradArray, locFArray, faceStateFunctions, rhsFunctions, faceStart, faceEnd);
 
-    // clean up cell grads
-    for (const auto& field : subDomain->GetFields()) {
-        if (locGradVecs[field.subId]) {
-            VecRestoreArrayRead(locGradVecs[field.subId], &locGradArrays[field.subId]) >> utilities::PetscUtilities::checkError;
-            DMRestoreLocalVector(gradientCellDms[field.subId], &locGradVecs[field.subId]) >> utilities::PetscUtilities::checkError;
-        }
+    // restore the arrays
+    if (locGradVec) {
+        VecRestoreArrayRead(locGradVec, &locGradArray) >> utilities::PetscUtilities::checkError;
     }
-
-    // cleanup (restore access to locGradVecs, locAuxGradVecs with DMRestoreLocalVector)
     VecRestoreArrayRead(locXVec, &xArray) >> utilities::PetscUtilities::checkError;
     if (locAuxVec) {
         VecRestoreArrayRead(locAuxVec, &auxArray) >> utilities::PetscUtilities::checkError;
     }
 
     VecRestoreArray(locFVec, &locFArray) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(faceGeomVec, (const PetscScalar**)&faceGeomArray) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(cellGeomVec, (const PetscScalar**)&cellGeomArray) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
 }
 
 void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
@@ -276,211 +250,510 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
 }
 
-/**
- * This is a duplication of PETSC that we don't have access to
- */
-static PetscErrorCode DMPlexApplyLimiter_Internal(DM dm, DM dmCell, PetscLimiter lim, PetscInt dim, PetscInt dof, PetscInt cell, PetscInt field, PetscInt face, PetscInt fStart, PetscInt fEnd,
-                                                  PetscReal* cellPhi, const PetscScalar* x, const PetscScalar* cellgeom, const PetscFVCellGeom* cg, const PetscScalar* cx, const PetscScalar* cgrad) {
-    const PetscInt* children;
-    PetscInt numChildren;
+void ablate::finiteVolume::CellInterpolant::BuildGradientStencil(const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec) {
+    auto dm = subDomain->GetDM();
+    auto ds = subDomain->GetDiscreteSystem();
+    const PetscInt dim = subDomain->GetDimensions();
 
-    PetscFunctionBegin;
-    PetscCall(DMPlexGetTreeChildren(dm, face, &numChildren, &children));
-    if (numChildren) {
-        PetscInt c;
+    // start with an empty stencil
+    PetscInt nf;
+    PetscDSGetNumFields(ds, &nf) >> utilities::PetscUtilities::checkError;
+    gradientStencil = {};
+    gradientStencil.fieldOffsets.resize(nf, -1);
+    gradientStencil.fieldSolutionOffsets.resize(nf, 0);
+    gradientStencil.fieldLimiters.resize(nf, nullptr);
+    gradientStencil.fieldLimiterTypes.resize(nf, slopeLimiters::LimiterType::None);
 
-        for (c = 0; c < numChildren; c++) {
-            PetscInt childFace = children[c];
+    // get the label for this region
+    DMLabel regionLabel = nullptr;
+    PetscInt regionValue = PETSC_DECIDE;
+    domain::Region::GetLabel(solverRegion, dm, regionLabel, regionValue);
 
-            if (childFace >= fStart && childFace < fEnd) {
-                PetscCall(DMPlexApplyLimiter_Internal(dm, dmCell, lim, dim, dof, cell, field, childFace, fStart, fEnd, cellPhi, x, cellgeom, cg, cx, cgrad));
-            }
-        }
-    } else {
-        PetscScalar* ncx;
-        PetscFVCellGeom* ncg;
-        const PetscInt* fcells;
-        PetscInt ncell, d;
-        PetscReal v[3];
+    // make sure the ablate limiters can be selected with the petsclimiter_type option before the field limiters are set up
+    slopeLimiters::Register();
 
-        PetscCall(DMPlexGetSupport(dm, face, &fcells));
-        ncell = cell == fcells[0] ? fcells[1] : fcells[0];
-        if (field >= 0) {
-            PetscCall(DMPlexPointLocalFieldRead(dm, ncell, field, x, &ncx));
-        } else {
-            PetscCall(DMPlexPointLocalRead(dm, ncell, x, &ncx));
+    // Compute the reconstruction for each field that supports it and pack the field gradient after the previous fields
+    for (const auto& field : subDomain->GetFields()) {
+        auto fvm = (PetscFV)subDomain->GetPetscFieldObject(field);
+
+        PetscBool computeGradients;
+        PetscFVGetComputeGradients(fvm, &computeGradients) >> utilities::PetscUtilities::checkError;
+        if (!computeGradients) {
+            continue;
         }
-        PetscCall(DMPlexPointLocalRead(dmCell, ncell, cellgeom, &ncg));
-        DMPlex_WaxpyD_Internal(dim, -1, cg->centroid, ncg->centroid, v);
-        for (d = 0; d < dof; ++d) {
-            /* We use the symmetric slope limited form of Berger, Aftosmis, and Murman 2005 */
-            PetscReal denom = DMPlex_DotD_Internal(dim, &cgrad[d * dim], v);
-            PetscReal phi, flim = 0.5 * PetscRealPart(ncx[d] - cx[d]) / denom;
 
-            PetscCall(PetscLimiterLimit(lim, flim, &phi));
-            cellPhi[d] = PetscMin(cellPhi[d], phi);
+        ComputeGradientFVM(subDomain->GetFieldDM(field), regionLabel, regionValue, fvm, faceGeomVec, cellGeomVec) >> utilities::PetscUtilities::checkError;
+        gradientStencil.fieldOffsets[field.subId] = gradientStencil.packedSize;
+        gradientStencil.packedSize += field.numberComponents * dim;
+        PetscDSGetFieldOffset(ds, field.subId, &gradientStencil.fieldSolutionOffsets[field.subId]) >> utilities::PetscUtilities::checkError;
+        PetscFVGetLimiter(fvm, &gradientStencil.fieldLimiters[field.subId]) >> utilities::PetscUtilities::checkError;
+        if (gradientStencil.fieldLimiters[field.subId]) {
+            PetscLimiterSetFromOptions(gradientStencil.fieldLimiters[field.subId]) >> utilities::PetscUtilities::checkError;
+            gradientStencil.fieldLimiterTypes[field.subId] = slopeLimiters::GetLimiterType(gradientStencil.fieldLimiters[field.subId]);
         }
     }
-    PetscFunctionReturn(0);
-}
-
-void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec,
-                                                                  const ablate::domain::Range& faceRange, const ablate::domain::Range& cellRange) {
-    // get the FVM petsc field associated with this field
-    auto fvm = (PetscFV)subDomain->GetPetscFieldObject(field);
-    auto dm = subDomain->GetFieldDM(field);
 
-    // Get the dm for this grad field
-    // If there is no grad, return
-    if (!dmGrad) {
+    // If there are no gradients, there is nothing else to compute
+    if (gradientStencil.packedSize == 0) {
         return;
     }
 
-    // Create a gradLocVec
-    DMGetLocalVector(dmGrad, &gradLocVec) >> utilities::PetscUtilities::checkError;
+    /* Create storage for the packed gradients */
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    DMClone(dm, &gradientDm) >> utilities::PetscUtilities::checkError;
+    PetscSection sectionGrad;
+    PetscSectionCreate(PetscObjectComm((PetscObject)dm), &sectionGrad) >> utilities::PetscUtilities::checkError;
+    PetscSectionSetChart(sectionGrad, cStart, cEnd) >> utilities::PetscUtilities::checkError;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscSectionSetDof(sectionGrad, c, gradientStencil.packedSize) >> utilities::PetscUtilities::checkError;
+    }
+    PetscSectionSetUp(sectionGrad) >> utilities::PetscUtilities::checkError;
+    DMSetLocalSection(gradientDm, sectionGrad) >> utilities::PetscUtilities::checkError;
+    PetscSectionDestroy(&sectionGrad) >> utilities::PetscUtilities::checkError;
 
-    // Get the correct sized vec (gradient for this field)
+    // the global offsets are stored relative to the start of this rank's portion of the global vector
     Vec gradGlobVec;
-    DMGetGlobalVector(dmGrad, &gradGlobVec) >> utilities::PetscUtilities::checkError;
-    VecZeroEntries(gradGlobVec) >> utilities::PetscUtilities::checkError;
+    PetscInt rStart;
+    DMGetGlobalVector(gradientDm, &gradGlobVec) >> utilities::PetscUtilities::checkError;
+    VecGetOwnershipRange(gradGlobVec, &rStart, nullptr) >> utilities::PetscUtilities::checkError;
+    DMRestoreGlobalVector(gradientDm, &gradGlobVec) >> utilities::PetscUtilities::checkError;
+
+    // store the solution and gradient offsets for each cell
+    gradientStencil.cStart = cStart;
+    gradientStencil.solutionOffsets.resize(cEnd - cStart);
+    gradientStencil.localOffsets.resize(cEnd - cStart);
+    gradientStencil.globalOffsets.resize(cEnd - cStart);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscInt globalOffset;
+        DMPlexGetPointLocal(dm, c, &gradientStencil.solutionOffsets[c - cStart], nullptr) >> utilities::PetscUtilities::checkError;
+        DMPlexGetPointLocal(gradientDm, c, &gradientStencil.localOffsets[c - cStart], nullptr) >> utilities::PetscUtilities::checkError;
+        DMPlexGetPointGlobal(gradientDm, c, &globalOffset, nullptr) >> utilities::PetscUtilities::checkError;
+        gradientStencil.globalOffsets[c - cStart] = globalOffset >= 0 ? globalOffset - rStart : -1;
+    }
 
     // check to see if there is a ghost label
     DMLabel ghostLabel;
     DMGetLabel(dm, "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
 
-    // Get the face geometry
-    DM dmFace;
-    const PetscScalar* faceGeometryArray;
-    VecGetDM(faceGeomVec, &dmFace) >> utilities::PetscUtilities::checkError;
-    VecGetArrayRead(faceGeomVec, &faceGeometryArray);
-
-    // extract the local x array
-    const PetscScalar* xLocalArray;
-    VecGetArrayRead(xLocalVec, &xLocalArray);
-
-    // extract the global grad array
-    PetscScalar* gradGlobArray;
-    VecGetArray(gradGlobVec, &gradGlobArray);
-
-    // Get the dof and dim
-    PetscInt dim = subDomain->GetDimensions();
-    PetscInt dof = field.numberComponents;
-
+    // store each face that contributes to the gradients
+    DM faceDM;
+    VecGetDM(faceGeomVec, &faceDM) >> utilities::PetscUtilities::checkError;
+    ablate::domain::Range faceRange;
+    subDomain->GetFaceRange(solverRegion, faceRange);
     for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
-        PetscInt face = faceRange.points ? faceRange.points[f] : f;
+        const PetscInt face = faceRange.GetPoint(f);
 
         // make sure that this is a face we should use
         PetscBool boundary;
         PetscInt ghost = -1;
         if (ghostLabel) {
-            DMLabelGetValue(ghostLabel, face, &ghost);
+            DMLabelGetValue(ghostLabel, face, &ghost) >> utilities::PetscUtilities::checkError;
         }
-        DMIsBoundaryPoint(dm, face, &boundary);
+        DMIsBoundaryPoint(dm, face, &boundary) >> utilities::PetscUtilities::checkError;
         PetscInt numChildren;
-        DMPlexGetTreeChildren(dm, face, &numChildren, nullptr);
+        DMPlexGetTreeChildren(dm, face, &numChildren, nullptr) >> utilities::PetscUtilities::checkError;
         if (ghost >= 0 || boundary || numChildren) continue;
 
         // Do a sanity check on the number of cells connected to this face
         PetscInt numCells;
-        DMPlexGetSupportSize(dm, face, &numCells);
+        DMPlexGetSupportSize(dm, face, &numCells) >> utilities::PetscUtilities::checkError;
         if (numCells != 2) {
             throw std::runtime_error("face " + std::to_string(face) + " has " + std::to_string(numCells) + " support points (cells): expected 2");
         }
 
-        // add in the contributions from this face
-        const PetscInt* cells;
-        PetscFVFaceGeom* fg;
-        PetscScalar* cx[2];
-        PetscScalar* cgrad[2];
+        const PetscInt* faceCells;
+        PetscInt faceGeomOffset;
+        DMPlexGetSupport(dm, face, &faceCells) >> utilities::PetscUtilities::checkError;
+        DMPlexGetPointLocal(faceDM, face, &faceGeomOffset, nullptr) >> utilities::PetscUtilities::checkError;
+        gradientStencil.faceGeomOffsets.push_back(faceGeomOffset);
+        gradientStencil.leftCells.push_back(faceCells[0]);
+        gradientStencil.rightCells.push_back(faceCells[1]);
+    }
+    subDomain->RestoreRange(faceRange);
 
-        DMPlexGetSupport(dm, face, &cells);
-        DMPlexPointLocalRead(dmFace, face, faceGeometryArray, &fg);
-        for (PetscInt c = 0; c < 2; ++c) {
-            DMPlexPointLocalFieldRead(dm, cells[c], field.id, xLocalArray, &cx[c]) >> utilities::PetscUtilities::checkError;
-            DMPlexPointGlobalRef(dmGrad, cells[c], gradGlobArray, &cgrad[c]) >> utilities::PetscUtilities::checkError;
-        }
-        for (PetscInt pd = 0; pd < dof; ++pd) {
-            PetscScalar delta = cx[1][pd] - cx[0][pd];
+    // Only compute the limiter neighbors if any field is limited
+    if (std::all_of(gradientStencil.fieldLimiterTypes.begin(), gradientStencil.fieldLimiterTypes.end(), [](auto type) { return type == slopeLimiters::LimiterType::None; })) {
+        return;
+    }
+
+    // Get the cell geometry
+    DM cellDM;
+    const PetscScalar* cellGeomArray;
+    VecGetDM(cellGeomVec, &cellDM) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    PetscInt fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> utilities::PetscUtilities::checkError;
 
-            for (PetscInt d = 0; d < dim; ++d) {
-                if (cgrad[0]) cgrad[0][pd * dim + d] += fg->grad[0][d] * delta;
-                if (cgrad[1]) cgrad[1][pd * dim + d] -= fg->grad[1][d] * delta;
+    // add the neighbor across this face, the children of a refined face are used in place of the face
+    std::function<void(PetscInt, PetscInt, const PetscFVCellGeom*)> addNeighbor = [&](PetscInt cell, PetscInt face, const PetscFVCellGeom* cg) {
+        const PetscInt* children;
+        PetscInt numChildren;
+        DMPlexGetTreeChildren(dm, face, &numChildren, &children) >> utilities::PetscUtilities::checkError;
+        if (numChildren) {
+            for (PetscInt c = 0; c < numChildren; c++) {
+                if (children[c] >= fStart && children[c] < fEnd) {
+                    addNeighbor(cell, children[c], cg);
+                }
             }
+            return;
+        }
+
+        // there is no neighbor across a face on the domain boundary
+        PetscInt numCells;
+        DMPlexGetSupportSize(dm, face, &numCells) >> utilities::PetscUtilities::checkError;
+        if (numCells < 2) {
+            return;
+        }
+        const PetscInt* faceCells;
+        DMPlexGetSupport(dm, face, &faceCells) >> utilities::PetscUtilities::checkError;
+        const PetscInt neighbor = cell == faceCells[0] ? faceCells[1] : faceCells[0];
+
+        const PetscFVCellGeom* ncg;
+        DMPlexPointLocalRead(cellDM, neighbor, cellGeomArray, &ncg) >> utilities::PetscUtilities::checkError;
+        gradientStencil.limiterNeighborSolutionOffsets.push_back(gradientStencil.solutionOffsets[neighbor - cStart]);
+        for (PetscInt d = 0; d < dim; ++d) {
+            gradientStencil.limiterNeighborDx.push_back(ncg->centroid[d] - cg->centroid[d]);
+        }
+    };
+
+    /* Limit interior gradients (using cell-based loop because it generalizes better to vector limiters) */
+    ablate::domain::Range cellRange;
+    subDomain->GetCellRange(solverRegion, cellRange);
+    gradientStencil.limiterNeighborOffsets.push_back(0);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.GetPoint(c);
+
+        // Unowned overlap cell, we do not compute
+        if (gradientStencil.globalOffsets[cell - cStart] < 0) {
+            continue;
+        }
+
+        const PetscInt* cellFaces;
+        PetscInt coneSize;
+        const PetscFVCellGeom* cg;
+        DMPlexGetConeSize(dm, cell, &coneSize) >> utilities::PetscUtilities::checkError;
+        DMPlexGetCone(dm, cell, &cellFaces) >> utilities::PetscUtilities::checkError;
+        DMPlexPointLocalRead(cellDM, cell, cellGeomArray, &cg) >> utilities::PetscUtilities::checkError;
+        for (PetscInt f = 0; f < coneSize; ++f) {
+            addNeighbor(cell, cellFaces[f], cg);
         }
+        gradientStencil.limitedCells.push_back(cell);
+        gradientStencil.limitedCellLengths.push_back(PetscPowReal(cg->volume, 1.0 / dim));
+        gradientStencil.limiterNeighborOffsets.push_back((PetscInt)gradientStencil.limiterNeighborSolutionOffsets.size());
     }
 
-    // Check for a limiter the limiter
-    PetscLimiter lim;
-    PetscFVGetLimiter(fvm, &lim) >> utilities::PetscUtilities::checkError;
-    if (lim) {
-        /* Limit interior gradients (using cell-based loop because it generalizes better to vector limiters) */
-        // Get the cell geometry
-        DM dmCell;
-        const PetscScalar* cellGeometryArray;
-        VecGetDM(cellGeomVec, &dmCell) >> utilities::PetscUtilities::checkError;
-        VecGetArrayRead(cellGeomVec, &cellGeometryArray);
-
-        // create a temp work array
-        PetscReal* cellPhi;
-        DMGetWorkArray(dm, dof, MPIU_REAL, &cellPhi) >> utilities::PetscUtilities::checkError;
-
-        for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-            PetscInt cell = cellRange.points ? cellRange.points[c] : c;
-
-            const PetscInt* cellFaces;
-            PetscScalar* cx;
-            PetscFVCellGeom* cg;
-            PetscScalar* cgrad;
-            PetscInt coneSize;
-
-            DMPlexGetConeSize(dm, cell, &coneSize) >> utilities::PetscUtilities::checkError;
-            DMPlexGetCone(dm, cell, &cellFaces) >> utilities::PetscUtilities::checkError;
-            DMPlexPointLocalFieldRead(dm, cell, field.id, xLocalArray, &cx) >> utilities::PetscUtilities::checkError;
-            DMPlexPointLocalRead(dmCell, cell, cellGeometryArray, &cg) >> utilities::PetscUtilities::checkError;
-            DMPlexPointGlobalRef(dmGrad, cell, gradGlobArray, &cgrad) >> utilities::PetscUtilities::checkError;
-
-            if (!cgrad) {
-                /* Unowned overlap cell, we do not compute */
-                continue;
-            }
-            /* Limiter will be minimum value over all neighbors */
-            for (PetscInt d = 0; d < dof; ++d) {
-                cellPhi[d] = PETSC_MAX_REAL;
-            }
-            for (PetscInt f = 0; f < coneSize; ++f) {
-                DMPlexApplyLimiter_Internal(dm, dmCell, lim, dim, dof, cell, field.id, cellFaces[f], faceRange.start, faceRange.end, cellPhi, xLocalArray, cellGeometryArray, cg, cx, cgrad) >>
-                    utilities::PetscUtilities::checkError;
-            }
-            /* Apply limiter to gradient */
-            for (PetscInt pd = 0; pd < dof; ++pd) {
-                /* Scalar limiter applied to each component separately */
+    // cleanup
+    subDomain->RestoreRange(cellRange);
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+}
+
+template <bool bounded, class LimiterFunction>
+void ablate::finiteVolume::CellInterpolant::LimitFieldGradients(const domain::Field& field, const LimiterFunction& function, const PetscScalar* xLocalArray, PetscScalar* gradGlobArray,
+                                                                PetscReal* work) const {
+    const auto& stencil = gradientStencil;
+    const PetscInt dim = subDomain->GetDimensions();
+    const PetscInt gradOffset = stencil.fieldOffsets[field.subId];
+
+    // the solution values are offset to this field
+    slopeLimiters::CellStencil cellStencil{};
+    cellStencil.dim = dim;
+    cellStencil.dof = field.numberComponents;
+    cellStencil.xArray = xLocalArray + stencil.fieldSolutionOffsets[field.subId];
+
+    for (std::size_t c = 0; c < stencil.limitedCells.size(); ++c) {
+        const PetscInt cell = stencil.limitedCells[c] - stencil.cStart;
+        const PetscInt neighborStart = stencil.limiterNeighborOffsets[c];
+
+        cellStencil.u = cellStencil.xArray + stencil.solutionOffsets[cell];
+        cellStencil.numberNeighbors = stencil.limiterNeighborOffsets[c + 1] - neighborStart;
+        cellStencil.neighborOffsets = stencil.limiterNeighborSolutionOffsets.data() + neighborStart;
+        cellStencil.neighborDx = stencil.limiterNeighborDx.data() + neighborStart * dim;
+        cellStencil.cellLength = stencil.limitedCellLengths[c];
+
+        PetscScalar* cgrad = gradGlobArray + stencil.globalOffsets[cell] + gradOffset;
+        if constexpr (bounded) {
+            slopeLimiters::ComputeBounded(function, cellStencil, cgrad, work);
+        } else {
+            slopeLimiters::ComputeSymmetric(function, cellStencil, cgrad, work);
+        }
+        slopeLimiters::ApplyLimiter(dim, field.numberComponents, work, cgrad);
+    }
+}
+
+void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(Vec xLocalVec, Vec& gradLocVec, Vec& gradGlobVec, Vec faceGeomVec) {
+    // If there are no gradients, return
+    if (!gradientDm) {
+        return;
+    }
+    const auto& stencil = gradientStencil;
+    const auto& fields = subDomain->GetFields();
+    const PetscInt dim = subDomain->GetDimensions();
+
+    // Create a gradLocVec
+    DMGetLocalVector(gradientDm, &gradLocVec) >> utilities::PetscUtilities::checkError;
+
+    // Get the packed global gradient vec
+    DMGetGlobalVector(gradientDm, &gradGlobVec) >> utilities::PetscUtilities::checkError;
+    VecZeroEntries(gradGlobVec) >> utilities::PetscUtilities::checkError;
+
+    // Get the face geometry
+    const PetscScalar* faceGeometryArray;
+    VecGetArrayRead(faceGeomVec, &faceGeometryArray) >> utilities::PetscUtilities::checkError;
+
+    // extract the local x array
+    const PetscScalar* xLocalArray;
+    VecGetArrayRead(xLocalVec, &xLocalArray) >> utilities::PetscUtilities::checkError;
+
+    // extract the global grad array
+    PetscScalar* gradGlobArray;
+    VecGetArray(gradGlobVec, &gradGlobArray) >> utilities::PetscUtilities::checkError;
+
+    // March over each face once, adding in the contributions to every field
+    for (std::size_t f = 0; f < stencil.faceGeomOffsets.size(); ++f) {
+        const auto fg = (const PetscFVFaceGeom*)(faceGeometryArray + stencil.faceGeomOffsets[f]);
+        const PetscInt cells[2] = {stencil.leftCells[f] - stencil.cStart, stencil.rightCells[f] - stencil.cStart};
+
+        const PetscScalar* cx[2];
+        PetscScalar* cgrad[2];
+        for (PetscInt c = 0; c < 2; ++c) {
+            cx[c] = xLocalArray + stencil.solutionOffsets[cells[c]];
+            cgrad[c] = stencil.globalOffsets[cells[c]] >= 0 ? gradGlobArray + stencil.globalOffsets[cells[c]] : nullptr;
+        }
+
+        for (const auto& field : fields) {
+            const PetscInt gradOffset = stencil.fieldOffsets[field.subId];
+            if (gradOffset < 0) continue;
+            const PetscInt solutionOffset = stencil.fieldSolutionOffsets[field.subId];
+
+            for (PetscInt pd = 0; pd < field.numberComponents; ++pd) {
+                PetscScalar delta = cx[1][solutionOffset + pd] - cx[0][solutionOffset + pd];
+
                 for (PetscInt d = 0; d < dim; ++d) {
-                    cgrad[pd * dim + d] *= cellPhi[pd];
+                    if (cgrad[0]) cgrad[0][gradOffset + pd * dim + d] += fg->grad[0][d] * delta;
+                    if (cgrad[1]) cgrad[1][gradOffset + pd * dim + d] -= fg->grad[1][d] * delta;
                 }
             }
         }
+    }
 
-        // clean up the limiter work
-        DMRestoreWorkArray(dm, dof, MPIU_REAL, &cellPhi) >> utilities::PetscUtilities::checkError;
-        VecRestoreArrayRead(cellGeomVec, &cellGeometryArray);
+    // Limit each field over the owned cells using the inline limiter for the field
+    if (!stencil.limitedCells.empty()) {
+        // create a temp work array large enough for any field
+        std::vector<PetscReal> work(3 * stencil.packedSize);
+
+        for (const auto& field : fields) {
+            PetscLimiter limiter = stencil.fieldLimiters[field.subId];
+            switch (stencil.fieldLimiterTypes[field.subId]) {
+                case slopeLimiters::LimiterType::None:
+                    break;
+                case slopeLimiters::LimiterType::Zero:
+                    LimitFieldGradients<false>(field, slopeLimiters::Zero{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::Sin:
+                    LimitFieldGradients<false>(field, slopeLimiters::Sin{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::Minmod:
+                    LimitFieldGradients<false>(field, slopeLimiters::Minmod{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::VanLeer:
+                    LimitFieldGradients<false>(field, slopeLimiters::VanLeer{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::VanAlbada:
+                    LimitFieldGradients<false>(field, slopeLimiters::VanAlbada{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::Superbee:
+                    LimitFieldGradients<false>(field, slopeLimiters::Superbee{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::MC:
+                    LimitFieldGradients<false>(field, slopeLimiters::MC{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::BarthJespersen:
+                    LimitFieldGradients<true>(field, slopeLimiters::BarthJespersen{}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::Venkatakrishnan:
+                    LimitFieldGradients<true>(field, slopeLimiters::Venkatakrishnan{slopeLimiters::GetVenkatakrishnanK(limiter)}, xLocalArray, gradGlobArray, work.data());
+                    break;
+                case slopeLimiters::LimiterType::Petsc:
+                    LimitFieldGradients<false>(field, slopeLimiters::Petsc{limiter}, xLocalArray, gradGlobArray, work.data());
+                    break;
+            }
+        }
+    }
+
+    // Copy the owned gradients to the local vector so they can be used before the exchange is complete
+    PetscScalar* gradLocArray;
+    VecGetArray(gradLocVec, &gradLocArray) >> utilities::PetscUtilities::checkError;
+    for (std::size_t c = 0; c < stencil.globalOffsets.size(); ++c) {
+        if (stencil.globalOffsets[c] >= 0) {
+            PetscArraycpy(gradLocArray + stencil.localOffsets[c], gradGlobArray + stencil.globalOffsets[c], stencil.packedSize) >> utilities::PetscUtilities::checkError;
+        }
     }
-    // Communicate gradient values
+    VecRestoreArray(gradLocVec, &gradLocArray) >> utilities::PetscUtilities::checkError;
+
+    // Start communicating the gradient values for every field, this is completed in ComputeRHS
     VecRestoreArray(gradGlobVec, &gradGlobArray) >> utilities::PetscUtilities::checkError;
-    DMGlobalToLocalBegin(dmGrad, gradGlobVec, INSERT_VALUES, gradLocVec) >> utilities::PetscUtilities::checkError;
-    DMGlobalToLocalEnd(dmGrad, gradGlobVec, INSERT_VALUES, gradLocVec) >> utilities::PetscUtilities::checkError;
+    DMGlobalToLocalBegin(gradientDm, gradGlobVec, INSERT_VALUES, gradLocVec) >> utilities::PetscUtilities::checkError;
 
     // cleanup
     VecRestoreArrayRead(xLocalVec, &xLocalArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(faceGeomVec, &faceGeometryArray) >> utilities::PetscUtilities::checkError;
-    DMRestoreGlobalVector(dmGrad, &gradGlobVec) >> utilities::PetscUtilities::checkError;
+}
+
+void ablate::finiteVolume::CellInterpolant::BuildFaceConnectivity(const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec) {
+    auto dm = subDomain->GetDM();
+
+    // get the faces in this region
+    ablate::domain::Range faceRange;
+    subDomain->GetFaceRange(solverRegion, faceRange);
+
+    // Get the geometry dm and arrays
+    DM faceDM, cellDM;
+    VecGetDM(faceGeomVec, &faceDM) >> utilities::PetscUtilities::checkError;
+    VecGetDM(cellGeomVec, &cellDM) >> utilities::PetscUtilities::checkError;
+    const PetscScalar* cellGeomArray;
+    const PetscScalar* faceGeomArray;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
+
+    // check for ghost cells
+    DMLabel ghostLabel;
+    DMGetLabel(dm, "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
+
+    // get the label for this region
+    DMLabel regionLabel = nullptr;
+    PetscInt regionValue = 0;
+    domain::Region::GetLabel(solverRegion, dm, regionLabel, regionValue);
+
+    // determine if the cell is inside the solver region
+    auto inRegion = [regionLabel, regionValue](PetscInt cell) {
+        PetscInt cellLabelValue = regionValue;
+        if (regionLabel) {
+            DMLabelGetValue(regionLabel, cell, &cellLabelValue) >> utilities::PetscUtilities::checkError;
+        }
+        return cellLabelValue == regionValue;
+    };
+
+    // determine the local offset of the cell rhs, -1 if not owned by this region
+    auto rhsOffset = [dm, ghostLabel, &inRegion](PetscInt cell) {
+        PetscInt ghost = -1;
+        if (ghostLabel) {
+            DMLabelGetValue(ghostLabel, cell, &ghost) >> utilities::PetscUtilities::checkError;
+        }
+        PetscInt offset = -1;
+        if (ghost <= 0 && inRegion(cell)) {
+            DMPlexGetPointLocal(dm, cell, &offset, nullptr) >> utilities::PetscUtilities::checkError;
+        }
+        return offset;
+    };
+
+    // start with an empty table
+    faceConnectivity = {};
+    const auto maxFaces = (std::size_t)PetscMax(faceRange.end - faceRange.start, 0);
+    faceConnectivity.faces.reserve(maxFaces);
+    faceConnectivity.leftCells.reserve(maxFaces);
+    faceConnectivity.rightCells.reserve(maxFaces);
+    faceConnectivity.leftRhsOffsets.reserve(maxFaces);
+    faceConnectivity.rightRhsOffsets.reserve(maxFaces);
+    faceConnectivity.leftProject.reserve(maxFaces);
+    faceConnectivity.rightProject.reserve(maxFaces);
+    faceConnectivity.faceGeomOffsets.reserve(maxFaces);
+    faceConnectivity.leftCellGeomOffsets.reserve(maxFaces);
+    faceConnectivity.rightCellGeomOffsets.reserve(maxFaces);
+    faceConnectivity.leftInverseVolumes.reserve(maxFaces);
+    faceConnectivity.rightInverseVolumes.reserve(maxFaces);
+
+    // mark the cells that are not owned by this rank (leaves in the point sf) so the faces that need exchanged data can be ordered last
+    PetscInt pStart, pEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> utilities::PetscUtilities::checkError;
+    std::vector<bool> ownedPoint(pEnd - pStart, true);
+    PetscSF pointSf;
+    DMGetPointSF(dm, &pointSf) >> utilities::PetscUtilities::checkError;
+    if (pointSf) {
+        PetscInt numberLeaves;
+        const PetscInt* leaves;
+        PetscSFGetGraph(pointSf, nullptr, &numberLeaves, &leaves, nullptr) >> utilities::PetscUtilities::checkError;
+        for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+            ownedPoint[(leaves ? leaves[l] : l) - pStart] = false;
+        }
+    }
+    auto ownedCell = [&ownedPoint, pStart, ghostLabel](PetscInt cell) {
+        PetscInt ghost = -1;
+        if (ghostLabel) {
+            DMLabelGetValue(ghostLabel, cell, &ghost) >> utilities::PetscUtilities::checkError;
+        }
+        return ghost <= 0 && ownedPoint[cell - pStart];
+    };
+
+    // March over each face in this region, sorting the valid faces into interior (both cells owned) and halo faces
+    std::vector<PetscInt> interiorFaces;
+    std::vector<PetscInt> haloFaces;
+    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
+        const PetscInt face = faceRange.GetPoint(f);
+
+        // make sure that this is a valid face
+        PetscInt ghost = -1, nsupp, nchild;
+        if (ghostLabel) {
+            DMLabelGetValue(ghostLabel, face, &ghost) >> utilities::PetscUtilities::checkError;
+        }
+        DMPlexGetSupportSize(dm, face, &nsupp) >> utilities::PetscUtilities::checkError;
+        DMPlexGetTreeChildren(dm, face, &nchild, nullptr) >> utilities::PetscUtilities::checkError;
+        if (ghost >= 0 || nsupp > 2 || nchild > 0) continue;
+
+        const PetscInt* faceCells;
+        DMPlexGetSupport(dm, face, &faceCells) >> utilities::PetscUtilities::checkError;
+        if (ownedCell(faceCells[0]) && ownedCell(faceCells[1])) {
+            interiorFaces.push_back(face);
+        } else {
+            haloFaces.push_back(face);
+        }
+    }
+    faceConnectivity.numberInteriorFaces = interiorFaces.size();
+
+    // store the connectivity for each face in order
+    auto addFace = [&](PetscInt face) {
+        const PetscInt* faceCells;
+        DMPlexGetSupport(dm, face, &faceCells) >> utilities::PetscUtilities::checkError;
+
+        // Get the geometry offsets
+        PetscInt faceGeomOffset, leftCellGeomOffset, rightCellGeomOffset;
+        DMPlexGetPointLocal(faceDM, face, &faceGeomOffset, nullptr) >> utilities::PetscUtilities::checkError;
+        DMPlexGetPointLocal(cellDM, faceCells[0], &leftCellGeomOffset, nullptr) >> utilities::PetscUtilities::checkError;
+        DMPlexGetPointLocal(cellDM, faceCells[1], &rightCellGeomOffset, nullptr) >> utilities::PetscUtilities::checkError;
+        const auto cgL = (const PetscFVCellGeom*)(cellGeomArray + leftCellGeomOffset);
+        const auto cgR = (const PetscFVCellGeom*)(cellGeomArray + rightCellGeomOffset);
+
+        faceConnectivity.faces.push_back(face);
+        faceConnectivity.leftCells.push_back(faceCells[0]);
+        faceConnectivity.rightCells.push_back(faceCells[1]);
+        faceConnectivity.leftRhsOffsets.push_back(rhsOffset(faceCells[0]));
+        faceConnectivity.rightRhsOffsets.push_back(rhsOffset(faceCells[1]));
+        faceConnectivity.leftProject.push_back(inRegion(faceCells[0]));
+        faceConnectivity.rightProject.push_back(inRegion(faceCells[1]));
+        faceConnectivity.faceGeomOffsets.push_back(faceGeomOffset);
+        faceConnectivity.leftCellGeomOffsets.push_back(leftCellGeomOffset);
+        faceConnectivity.rightCellGeomOffsets.push_back(rightCellGeomOffset);
+        faceConnectivity.leftInverseVolumes.push_back(1.0 / cgL->volume);
+        faceConnectivity.rightInverseVolumes.push_back(1.0 / cgR->volume);
+    };
+    for (const auto face : interiorFaces) {
+        addFace(face);
+    }
+    for (const auto face : haloFaces) {
+        addFace(face);
+    }
+
+    // cleanup
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
+    subDomain->RestoreRange(faceRange);
 }
 
 void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscDS ds, PetscInt totDim, const PetscScalar* xArray, DM dmAux, PetscDS dsAux, PetscInt totDimAux,
-                                                                   const PetscScalar* auxArray, DM faceDM, const PetscScalar* faceGeomArray, DM cellDM, const PetscScalar* cellGeomArray,
-                                                                   std::vector<DM>& dmGrads, std::vector<const PetscScalar*>& locGradArrays, PetscScalar* locFArray,
-                                                                   const std::shared_ptr<domain::Region>& solverRegion,
-                                                                   std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const ablate::domain::Range& faceRange,
-                                                                   const ablate::domain::Range& cellRange) {
+                                                                   const PetscScalar* auxArray, const PetscScalar* faceGeomArray, const PetscScalar* cellGeomArray, const PetscScalar* locGradArray,
+                                                                   PetscScalar* locFArray,
+                                                                   std::vector<CellInterpolant::FaceStateFunctionDescription>& faceStateFunctions,
+                                                                   std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, std::size_t faceStart, std::size_t faceEnd) {
     PetscInt dim = subDomain->GetDimensions();
 
     // Size up the work arrays (uL, uR, gradL, gradR, auxL, auxR, gradAuxL, gradAuxR), these are only sized for one face at a time
@@ -500,7 +773,7 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
 
     // Precompute the offsets to pass into the rhsFluxFunctionDescriptions
     std::vector<PetscInt> fluxComponentSize(rhsFunctions.size());
-    std::vector<PetscInt> fluxId(rhsFunctions.size());
+    std::vector<PetscInt> fluxComponentOffset(rhsFunctions.size());
     std::vector<std::vector<PetscInt>> uOff(rhsFunctions.size());
     std::vector<std::vector<PetscInt>> aOff(rhsFunctions.size());
 
@@ -511,12 +784,21 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
     for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
         const auto& field = subDomain->GetField(rhsFunctions[fun].field);
         fluxComponentSize[fun] = field.numberComponents;
-        fluxId[fun] = field.id;
+        PetscDSGetFieldOffset(ds, field.subId, &fluxComponentOffset[fun]) >> utilities::PetscUtilities::checkError;
         for (std::size_t f = 0; f < rhsFunctions[fun].inputFields.size(); f++) {
             uOff[fun].push_back(uOffTotal[rhsFunctions[fun].inputFields[f]]);
         }
     }
 
+    // Precompute the offsets to pass into the faceStateFunctions
+    std::vector<std::vector<PetscInt>> faceStateUOff(faceStateFunctions.size());
+    std::vector<std::vector<PetscInt>> faceStateAOff(faceStateFunctions.size());
+    for (std::size_t fun = 0; fun < faceStateFunctions.size(); fun++) {
+        for (const auto& inputField : faceStateFunctions[fun].inputFields) {
+            faceStateUOff[fun].push_back(uOffTotal[inputField]);
+        }
+    }
+
     if (dsAux) {
         PetscInt* auxOffTotal;
         PetscDSGetComponentOffsets(dsAux, &auxOffTotal) >> utilities::PetscUtilities::checkError;
@@ -525,82 +807,139 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
                 aOff[fun].push_back(auxOffTotal[rhsFunctions[fun].auxFields[f]]);
             }
         }
+        for (std::size_t fun = 0; fun < faceStateFunctions.size(); fun++) {
+            for (const auto& auxField : faceStateFunctions[fun].auxFields) {
+                faceStateAOff[fun].push_back(auxOffTotal[auxField]);
+            }
+        }
     }
-    // check for ghost cells
-    DMLabel ghostLabel;
-    DMGetLabel(dm, "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
-
-    // get the label for this region
-    DMLabel regionLabel = nullptr;
-    PetscInt regionValue = 0;
-    domain::Region::GetLabel(solverRegion, subDomain->GetDM(), regionLabel, regionValue);
-
-    // March over each face in this region
-    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
-        const PetscInt face = faceRange.points ? faceRange.points[f] : f;
-
-        // make sure that this is a valid face
-        PetscInt ghost, nsupp, nchild;
-        DMLabelGetValue(ghostLabel, face, &ghost) >> utilities::PetscUtilities::checkError;
-        DMPlexGetSupportSize(dm, face, &nsupp) >> utilities::PetscUtilities::checkError;
-        DMPlexGetTreeChildren(dm, face, &nchild, nullptr) >> utilities::PetscUtilities::checkError;
-        if (ghost >= 0 || nsupp > 2 || nchild > 0) continue;
 
-        // Get the face geometry
-        const PetscInt* faceCells;
-        PetscFVFaceGeom* fg;
-        PetscFVCellGeom *cgL, *cgR;
-        DMPlexPointLocalRead(faceDM, face, faceGeomArray, &fg) >> utilities::PetscUtilities::checkError;
-        DMPlexGetSupport(dm, face, &faceCells) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(cellDM, faceCells[0], cellGeomArray, &cgL) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(cellDM, faceCells[1], cellGeomArray, &cgR) >> utilities::PetscUtilities::checkError;
+    // The faces can be computed concurrently when there is more than one host thread and every face function supports it
+    const auto isThreadSafe = [](const auto& description) { return description.threadSafe; };
+    const bool computeConcurrently = faceEnd > faceStart + 1 && std::all_of(faceStateFunctions.begin(), faceStateFunctions.end(), isThreadSafe) &&
+                                     std::all_of(rhsFunctions.begin(), rhsFunctions.end(), isThreadSafe) && utilities::KokkosUtilities::GetMaxHostThreads() > 1;
 
-        PetscInt leftFlowLabelValue = regionValue;
-        PetscInt rightFlowLabelValue = regionValue;
-        if (regionLabel) {
-            DMLabelGetValue(regionLabel, faceCells[0], &leftFlowLabelValue);
-            DMLabelGetValue(regionLabel, faceCells[1], &rightFlowLabelValue);
+    // March over each requested precomputed face in this region
+    const auto& fc = faceConnectivity;
+    if (computeConcurrently) {
+        // each face stores the flux from every function back to back
+        std::vector<PetscInt> faceFluxOffset(rhsFunctions.size() + 1, 0);
+        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+            faceFluxOffset[fun + 1] = faceFluxOffset[fun] + fluxComponentSize[fun];
         }
-        // compute the left/right face values
-        ProjectToFace(subDomain->GetFields(), ds, *fg, faceCells[0], *cgL, dm, xArray, dmGrads, locGradArrays, uL, gradL, leftFlowLabelValue == regionValue);
-        ProjectToFace(subDomain->GetFields(), ds, *fg, faceCells[1], *cgR, dm, xArray, dmGrads, locGradArrays, uR, gradR, rightFlowLabelValue == regionValue);
+        const PetscInt faceFluxSize = faceFluxOffset.back();
+        faceFluxes.resize((faceEnd - faceStart) * faceFluxSize);
 
-        // determine the left/right cells
-        if (auxArray) {
-            // Get the field values at this cell
-            DMPlexPointLocalRead(dmAux, faceCells[0], auxArray, &auxL) >> utilities::PetscUtilities::checkError;
-            DMPlexPointLocalRead(dmAux, faceCells[1], auxArray, &auxR) >> utilities::PetscUtilities::checkError;
+        // each thread gets its own work arrays (flux, uL, uR, gradL, gradR)
+        threadWorkArrays.resize(utilities::KokkosUtilities::GetMaxHostThreads());
+        for (auto& threadWorkArray : threadWorkArrays) {
+            threadWorkArray.resize(3 * totDim + 2 * dim * totDim);
         }
 
-        // March over each source function
-        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
-            PetscArrayzero(flux, totDim) >> utilities::PetscUtilities::checkError;
-            const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
-            rhsFluxFunctionDescription.function(dim, fg, uOff[fun].data(), uL, uR, aOff[fun].data(), auxL, auxR, flux, rhsFluxFunctionDescription.context) >> utilities::PetscUtilities::checkError;
-
-            // add the flux back to the cell
-            PetscScalar *fL = nullptr, *fR = nullptr;
-            PetscInt cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[0], &ghost) >> utilities::PetscUtilities::checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[0], &cellLabelValue) >> utilities::PetscUtilities::checkError;
+        // compute the flux on each face, any error is reduced so that it can be thrown outside the parallel region
+        int faceError = 0;
+        Kokkos::parallel_reduce(
+            "CellInterpolant::ComputeFluxSourceTerms",
+            Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(faceStart, faceEnd),
+            [&](const std::size_t i, int& error) {
+                if (error) {
+                    return;
+                }
+                auto& threadWorkArray = threadWorkArrays[utilities::KokkosUtilities::GetHostThreadId()];
+                PetscScalar* faceFlux = threadWorkArray.data();
+                PetscScalar* faceUL = faceFlux + totDim;
+                PetscScalar* faceUR = faceUL + totDim;
+                PetscScalar* faceGradL = faceUR + totDim;
+                PetscScalar* faceGradR = faceGradL + dim * totDim;
+                const PetscScalar *faceAuxL = nullptr, *faceAuxR = nullptr;
+
+                try {
+                    // Get the face geometry
+                    const auto fg = (const PetscFVFaceGeom*)(faceGeomArray + fc.faceGeomOffsets[i]);
+                    const auto cgL = (const PetscFVCellGeom*)(cellGeomArray + fc.leftCellGeomOffsets[i]);
+                    const auto cgR = (const PetscFVCellGeom*)(cellGeomArray + fc.rightCellGeomOffsets[i]);
+
+                    // compute the left/right face values
+                    ProjectToFace(subDomain->GetFields(), ds, *fg, fc.leftCells[i], *cgL, dm, xArray, locGradArray, faceUL, faceGradL, fc.leftProject[i]);
+                    ProjectToFace(subDomain->GetFields(), ds, *fg, fc.rightCells[i], *cgR, dm, xArray, locGradArray, faceUR, faceGradR, fc.rightProject[i]);
+                    if (auxArray) {
+                        DMPlexPointLocalRead(dmAux, fc.leftCells[i], auxArray, &faceAuxL) >> utilities::PetscUtilities::checkError;
+                        DMPlexPointLocalRead(dmAux, fc.rightCells[i], auxArray, &faceAuxR) >> utilities::PetscUtilities::checkError;
+                    }
+
+                    // compute any shared face state before the flux functions
+                    for (std::size_t fun = 0; fun < faceStateFunctions.size() && !error; fun++) {
+                        error = faceStateFunctions[fun].function(
+                            dim, fg, fc.leftCells[i], fc.rightCells[i], faceStateUOff[fun].data(), faceUL, faceUR, faceStateAOff[fun].data(), faceAuxL, faceAuxR,
+                            faceStateFunctions[fun].context);
+                    }
+
+                    // store the flux from each function for this face
+                    PetscScalar* storedFlux = faceFluxes.data() + (i - faceStart) * faceFluxSize;
+                    for (std::size_t fun = 0; fun < rhsFunctions.size() && !error; fun++) {
+                        PetscArrayzero(faceFlux, totDim) >> utilities::PetscUtilities::checkError;
+                        error = rhsFunctions[fun].function(dim, fg, uOff[fun].data(), faceUL, faceUR, aOff[fun].data(), faceAuxL, faceAuxR, faceFlux, rhsFunctions[fun].context);
+                        std::copy_n(faceFlux, fluxComponentSize[fun], storedFlux + faceFluxOffset[fun]);
+                    }
+                } catch (std::exception&) {
+                    error = PETSC_ERR_LIB;
+                }
+            },
+            Kokkos::Max<int>(faceError));
+        ((PetscErrorCode)faceError) >> utilities::PetscUtilities::checkError;
+
+        // add the flux back to the cells in face order so that no two threads update the same cell
+        for (std::size_t i = faceStart; i < faceEnd; ++i) {
+            const PetscScalar* storedFlux = faceFluxes.data() + (i - faceStart) * faceFluxSize;
+            for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+                PetscScalar* fL = fc.leftRhsOffsets[i] >= 0 ? locFArray + fc.leftRhsOffsets[i] + fluxComponentOffset[fun] : nullptr;
+                PetscScalar* fR = fc.rightRhsOffsets[i] >= 0 ? locFArray + fc.rightRhsOffsets[i] + fluxComponentOffset[fun] : nullptr;
+
+                for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
+                    if (fL) fL[d] -= storedFlux[faceFluxOffset[fun] + d] * fc.leftInverseVolumes[i];
+                    if (fR) fR[d] += storedFlux[faceFluxOffset[fun] + d] * fc.rightInverseVolumes[i];
+                }
             }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[0], fluxId[fun], locFArray, &fL) >> utilities::PetscUtilities::checkError;
+        }
+    } else {
+        for (std::size_t i = faceStart; i < faceEnd; ++i) {
+            // Get the face geometry
+            const auto fg = (const PetscFVFaceGeom*)(faceGeomArray + fc.faceGeomOffsets[i]);
+            const auto cgL = (const PetscFVCellGeom*)(cellGeomArray + fc.leftCellGeomOffsets[i]);
+            const auto cgR = (const PetscFVCellGeom*)(cellGeomArray + fc.rightCellGeomOffsets[i]);
+
+            // compute the left/right face values
+            ProjectToFace(subDomain->GetFields(), ds, *fg, fc.leftCells[i], *cgL, dm, xArray, locGradArray, uL, gradL, fc.leftProject[i]);
+            ProjectToFace(subDomain->GetFields(), ds, *fg, fc.rightCells[i], *cgR, dm, xArray, locGradArray, uR, gradR, fc.rightProject[i]);
+
+            // determine the left/right cells
+            if (auxArray) {
+                // Get the field values at this cell
+                DMPlexPointLocalRead(dmAux, fc.leftCells[i], auxArray, &auxL) >> utilities::PetscUtilities::checkError;
+                DMPlexPointLocalRead(dmAux, fc.rightCells[i], auxArray, &auxR) >> utilities::PetscUtilities::checkError;
             }
 
-            cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[1], &ghost) >> utilities::PetscUtilities::checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[1], &cellLabelValue) >> utilities::PetscUtilities::checkError;
-            }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[1], fluxId[fun], locFArray, &fR) >> utilities::PetscUtilities::checkError;
+            // compute any shared face state before the flux functions
+            for (std::size_t fun = 0; fun < faceStateFunctions.size(); fun++) {
+                faceStateFunctions[fun].function(
+                    dim, fg, fc.leftCells[i], fc.rightCells[i], faceStateUOff[fun].data(), uL, uR, faceStateAOff[fun].data(), auxL, auxR, faceStateFunctions[fun].context) >>
+                    utilities::PetscUtilities::checkError;
             }
 
-            for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
-                if (fL) fL[d] -= flux[d] / cgL->volume;
-                if (fR) fR[d] += flux[d] / cgR->volume;
+            // March over each source function
+            for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+                PetscArrayzero(flux, totDim) >> utilities::PetscUtilities::checkError;
+                const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
+                rhsFluxFunctionDescription.function(dim, fg, uOff[fun].data(), uL, uR, aOff[fun].data(), auxL, auxR, flux, rhsFluxFunctionDescription.context) >> utilities::PetscUtilities::checkError;
+
+                // add the flux back to the cell
+                PetscScalar* fL = fc.leftRhsOffsets[i] >= 0 ? locFArray + fc.leftRhsOffsets[i] + fluxComponentOffset[fun] : nullptr;
+                PetscScalar* fR = fc.rightRhsOffsets[i] >= 0 ? locFArray + fc.rightRhsOffsets[i] + fluxComponentOffset[fun] : nullptr;
+
+                for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
+                    if (fL) fL[d] -= flux[d] * fc.leftInverseVolumes[i];
+                    if (fR) fR[d] += flux[d] * fc.rightInverseVolumes[i];
+                }
             }
         }
     }
@@ -827,17 +1166,12 @@ static PetscErrorCode BuildGradientReconstruction_Internal_Tree(DM dm, DMLabel r
     PetscFunctionReturn(0);
 }
 
-PetscErrorCode ablate::finiteVolume::CellInterpolant::ComputeGradientFVM(DM dm, DMLabel regionLabel, PetscInt regionValue, PetscFV fvm, Vec faceGeometry, Vec cellGeometry, DM* dmGrad) {
+PetscErrorCode ablate::finiteVolume::CellInterpolant::ComputeGradientFVM(DM dm, DMLabel regionLabel, PetscInt regionValue, PetscFV fvm, Vec faceGeometry, Vec cellGeometry) {
     DM dmFace, dmCell;
     PetscScalar *fgeom, *cgeom;
-    PetscSection sectionGrad, parentSection;
-    PetscInt dim, pdim, cStart, cEnd, cEndInterior, c;
+    PetscSection parentSection;
 
     PetscFunctionBegin;
-    PetscCall(DMGetDimension(dm, &dim));
-    PetscCall(PetscFVGetNumComponents(fvm, &pdim));
-    PetscCall(DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd));
-    PetscCall(DMPlexGetCellTypeStratum(dm, DM_POLYTOPE_FV_GHOST, &cEndInterior, nullptr));
     /* Construct the interpolant corresponding to each face from the least-square solution over the cell neighborhood */
     PetscCall(VecGetDM(faceGeometry, &dmFace));
     PetscCall(VecGetDM(cellGeometry, &dmCell));
@@ -851,19 +1185,10 @@ PetscErrorCode ablate::finiteVolume::CellInterpolant::ComputeGradientFVM(DM dm,
     }
     PetscCall(VecRestoreArray(faceGeometry, &fgeom));
     PetscCall(VecRestoreArray(cellGeometry, &cgeom));
-    /* Create storage for gradients */
-    PetscCall(DMClone(dm, dmGrad));
-    PetscCall(PetscSectionCreate(PetscObjectComm((PetscObject)dm), &sectionGrad));
-    PetscCall(PetscSectionSetChart(sectionGrad, cStart, cEnd));
-    for (c = cStart; c < cEnd; ++c) PetscCall(PetscSectionSetDof(sectionGrad, c, pdim * dim));
-    PetscCall(PetscSectionSetUp(sectionGrad));
-    PetscCall(DMSetLocalSection(*dmGrad, sectionGrad));
-    PetscCall(PetscSectionDestroy(&sectionGrad));
     PetscFunctionReturn(0);
 }
 void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<domain::Field>& fields, PetscDS ds, const PetscFVFaceGeom& faceGeom, PetscInt cellId, const PetscFVCellGeom& cellGeom,
-                                                          DM dm, const PetscScalar* xArray, const std::vector<DM>& dmGrads, const std::vector<const PetscScalar*>& gradArrays, PetscScalar* u,
-                                                          PetscScalar* grad, bool projectField) {
+                                                          DM dm, const PetscScalar* xArray, const PetscScalar* gradArray, PetscScalar* u, PetscScalar* grad, bool projectField) {
     const auto dim = subDomain->GetDimensions();
 
     // Keep track of derivative offset
@@ -876,14 +1201,16 @@ void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<doma
     for (const auto& field : fields) {
         PetscReal dx[3];
         PetscScalar* xCell;
-        PetscScalar* gradCell;
 
         // Get the field values at this cell
         DMPlexPointLocalFieldRead(dm, cellId, field.subId, xArray, &xCell) >> utilities::PetscUtilities::checkError;
 
+        // the gradient for this field is packed with the other fields at this cell
+        const PetscInt gradOffset = gradientStencil.fieldOffsets[field.subId];
+        const PetscScalar* gradCell = gradArray && gradOffset >= 0 ? gradArray + gradientStencil.localOffsets[cellId - gradientStencil.cStart] + gradOffset : nullptr;
+
         // If we need to project the field
-        if (projectField && dmGrads[field.subId]) {
-            DMPlexPointLocalRead(dmGrads[field.subId], cellId, gradArrays[field.subId], &gradCell) >> utilities::PetscUtilities::checkError;
+        if (projectField && gradCell) {
             DMPlex_WaxpyD_Internal(dim, -1, cellGeom.centroid, faceGeom.centroid, dx);
 
             // Project the cell centered value onto the face
@@ -896,9 +1223,7 @@ void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<doma
                 }
             }
 
-        } else if (dmGrads[field.subId]) {
-            // Project the cell centered value onto the face
-            DMPlexPointLocalRead(dmGrads[field.subId], cellId, gradArrays[field.subId], &gradCell) >> utilities::PetscUtilities::checkError;
+        } else if (gradCell) {
             // Project the cell centered value onto the face
             for (PetscInt c = 0; c < field.numberComponents; ++c) {
                 u[offsets[field.subId] + c] = xCell[c];
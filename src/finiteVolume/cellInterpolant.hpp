@@ -2,10 +2,12 @@
 #define ABLATELIBRARY_CELLINTERPOLANT_HPP
 
 #include <petsc.h>
+#include <functional>
 #include <vector>
 #include "domain/range.hpp"
 #include "domain/region.hpp"
 #include "domain/subDomain.hpp"
+#include "slopeLimiters.hpp"
 namespace ablate::finiteVolume {
 
 class CellInterpolant {
@@ -22,6 +24,13 @@ class CellInterpolant {
     using PointFunction = PetscErrorCode (*)(PetscInt dim, PetscReal time, const PetscFVCellGeom* cg, const PetscInt uOff[], const PetscScalar u[], const PetscInt aOff[], const PetscScalar a[],
                                              PetscScalar f[], void* ctx);
 
+    /**
+     * Function called once per face before any DiscontinuousFluxFunction to compute state shared between the flux functions.  The result is stored in the ctx.
+     * The left/right cells are the dm points on each side of the face so that per cell data (e.g. a solver warm start) can be used.
+     */
+    using FaceStateFunction = PetscErrorCode (*)(PetscInt dim, const PetscFVFaceGeom* fg, PetscInt leftCell, PetscInt rightCell, const PetscInt uOff[], const PetscScalar fieldL[],
+                                                 const PetscScalar fieldR[], const PetscInt aOff[], const PetscScalar auxL[], const PetscScalar auxR[], void* ctx);
+
     struct DiscontinuousFluxFunctionDescription {
         DiscontinuousFluxFunction function;
         void* context;
@@ -29,6 +38,23 @@ class CellInterpolant {
         PetscInt field;
         std::vector<PetscInt> inputFields;
         std::vector<PetscInt> auxFields;
+
+        //! true if the function can be called concurrently for different faces
+        bool threadSafe = false;
+    };
+
+    /**
+     * struct to describe the face state functions computed before the discontinuous flux functions
+     */
+    struct FaceStateFunctionDescription {
+        FaceStateFunction function;
+        void* context;
+
+        std::vector<PetscInt> inputFields;
+        std::vector<PetscInt> auxFields;
+
+        //! true if the function can be called concurrently for different faces, the computed state must be stored per thread
+        bool threadSafe = false;
     };
 
     /**
@@ -47,53 +73,179 @@ class CellInterpolant {
     //! use the subDomain to setup the problem
     std::shared_ptr<ablate::domain::SubDomain> subDomain;
 
-    //! store the dmGrad, these are specific to this finite volume solver
-    std::vector<DM> gradientCellDms;
+    //! the dm for the packed cell gradients of every field, this is specific to this finite volume solver
+    DM gradientDm = nullptr;
+
+    /**
+     * Precomputed description of the fused gradient computation.  The gradients of all fields are packed together for each cell so that they are
+     * computed in a single face sweep and exchanged with a single message.  Like the face connectivity, this is computed once when the interpolant is created.
+     */
+    struct GradientStencil {
+        //! the offset of each field (by subId) in the packed cell gradient, -1 if gradients are not computed for the field
+        std::vector<PetscInt> fieldOffsets;
+
+        //! the offset of each field (by subId) in the solution at each cell
+        std::vector<PetscInt> fieldSolutionOffsets;
+
+        //! the optional limiter for each field (by subId)
+        std::vector<PetscLimiter> fieldLimiters;
+
+        //! the inline limiter used for each field (by subId), None if the field is not limited
+        std::vector<slopeLimiters::LimiterType> fieldLimiterTypes;
+
+        //! the size of the packed gradient at each cell
+        PetscInt packedSize = 0;
+
+        //! the first cell in the gradient dm
+        PetscInt cStart = 0;
+
+        //! the local solution offset of each cell
+        std::vector<PetscInt> solutionOffsets;
+
+        //! the offset of each cell in the local packed gradient vector
+        std::vector<PetscInt> localOffsets;
+
+        //! the offset of each cell in the global packed gradient array, -1 if the cell is not owned by this rank
+        std::vector<PetscInt> globalOffsets;
+
+        //! the face geometry offset and left/right cells for each face used to compute the gradients
+        std::vector<PetscInt> faceGeomOffsets;
+        std::vector<PetscInt> leftCells;
+        std::vector<PetscInt> rightCells;
+
+        //! the owned cells in the solver region that are limited, with the characteristic length of each cell
+        std::vector<PetscInt> limitedCells;
+        std::vector<PetscReal> limitedCellLengths;
+
+        //! the neighbors of each limited cell (in csr format) stored as the local solution offset and the distance to each neighbor centroid
+        std::vector<PetscInt> limiterNeighborOffsets;
+        std::vector<PetscInt> limiterNeighborSolutionOffsets;
+        std::vector<PetscReal> limiterNeighborDx;
+    };
+
+    //! the precomputed gradient stencil for this region
+    GradientStencil gradientStencil;
+
+    /**
+     * Struct-of-arrays description of every valid face in the solver region.  The mesh topology does not change between rhs evaluations,
+     * so the ghost/region label and plex queries are done once when the interpolant is created (and again on any re-creation after a mesh change).
+     */
+    struct FaceConnectivity {
+        //! the face point for each valid face
+        std::vector<PetscInt> faces;
+
+        //! the left/right (support) cells for each face
+        std::vector<PetscInt> leftCells;
+        std::vector<PetscInt> rightCells;
+
+        //! the local (solution and rhs) point offset of the left/right cell, -1 if the rhs for that cell is not owned by this region
+        std::vector<PetscInt> leftRhsOffsets;
+        std::vector<PetscInt> rightRhsOffsets;
+
+        //! true if the left/right cell is inside the solver region and the field should be projected to the face
+        std::vector<bool> leftProject;
+        std::vector<bool> rightProject;
+
+        //! the offsets into the face and cell geometry arrays
+        std::vector<PetscInt> faceGeomOffsets;
+        std::vector<PetscInt> leftCellGeomOffsets;
+        std::vector<PetscInt> rightCellGeomOffsets;
+
+        //! the precomputed inverse volume of the left/right cell
+        std::vector<PetscReal> leftInverseVolumes;
+        std::vector<PetscReal> rightInverseVolumes;
+
+        //! the faces are ordered so that the first numberInteriorFaces have both cells owned by this rank.  These do not need the exchanged cell gradients.
+        std::size_t numberInteriorFaces = 0;
+
+        //! the number of valid faces
+        [[nodiscard]] inline std::size_t Size() const { return faces.size(); }
+    };
+
+    //! the precomputed face connectivity for this region
+    FaceConnectivity faceConnectivity;
+
+    //! the work arrays (flux, uL, uR, gradL, gradR) for each host thread when the faces are computed concurrently
+    std::vector<std::vector<PetscScalar>> threadWorkArrays;
+
+    //! the flux from every discontinuous flux function on each face, stored when the faces are computed concurrently and added to the cells afterwards
+    std::vector<PetscScalar> faceFluxes;
+
+    /**
+     * Build the faceConnectivity table over the solver region
+     * @param solverRegion
+     * @param faceGeomVec
+     * @param cellGeomVec
+     */
+    void BuildFaceConnectivity(const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec);
+
+    /**
+     * Build the packed gradient dm and the gradientStencil over the solver region
+     * @param solverRegion
+     * @param faceGeomVec
+     * @param cellGeomVec
+     */
+    void BuildGradientStencil(const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec);
 
     /**
      * Function to compute the flux source terms
      */
-    void ComputeFluxSourceTerms(DM dm, PetscDS ds, PetscInt totDim, const PetscScalar* xArray, DM dmAux, PetscDS dsAux, PetscInt totDimAux, const PetscScalar* auxArray, DM faceDM,
-                                const PetscScalar* faceGeomArray, DM cellDM, const PetscScalar* cellGeomArray, std::vector<DM>& dmGrads, std::vector<const PetscScalar*>& locGradArrays,
-                                PetscScalar* locFArray, const std::shared_ptr<domain::Region>& solverRegion, std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
-                                const ablate::domain::Range& faceRange, const ablate::domain::Range& cellRange);
+    void ComputeFluxSourceTerms(DM dm, PetscDS ds, PetscInt totDim, const PetscScalar* xArray, DM dmAux, PetscDS dsAux, PetscInt totDimAux, const PetscScalar* auxArray,
+                                const PetscScalar* faceGeomArray, const PetscScalar* cellGeomArray, const PetscScalar* locGradArray, PetscScalar* locFArray,
+                                std::vector<CellInterpolant::FaceStateFunctionDescription>& faceStateFunctions, std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
+                                std::size_t faceStart, std::size_t faceEnd);
+
+    /**
+     * Compute the flux source terms over the faceConnectivity faces [faceStart, faceEnd)
+     */
+    void ComputeFluxSourceTerms(Vec locXVec, Vec locAuxVec, Vec locFVec, Vec cellGeomVec, Vec faceGeomVec, Vec locGradVec,
+                                std::vector<CellInterpolant::FaceStateFunctionDescription>& faceStateFunctions, std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
+                                std::size_t faceStart, std::size_t faceEnd);
 
     /**
      * support call to project to a single face from a side
      */
     void ProjectToFace(const std::vector<domain::Field>& fields, PetscDS ds, const PetscFVFaceGeom& faceGeom, PetscInt cellId, const PetscFVCellGeom& cellGeom, DM dm, const PetscScalar* xArray,
-                       const std::vector<DM>& dmGrads, const std::vector<const PetscScalar*>& gradArrays, PetscScalar* u, PetscScalar* grad, bool projectField = true);
+                       const PetscScalar* gradArray, PetscScalar* u, PetscScalar* grad, bool projectField = true);
 
     /**
-     * computes the cell gradients
-     * @param field
+     * computes the packed cell gradients of every field in a single face sweep and begins the exchange of the gradients to the local vector.  The owned gradients
+     * are copied to the local vector before returning, so only the gradients of non owned cells are invalid until the exchange is completed with DMGlobalToLocalEnd.
      * @param xLocalVec
      * @param gradLocVec
-     * @param dmGrad
-     * @param cellGeomVec
+     * @param gradGlobVec
      * @param faceGeomVec
-     * @param faceRange
-     * @param cellRange
      */
-    void ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec, const ablate::domain::Range& faceRange,
-                               const ablate::domain::Range& cellRange);
+    void ComputeFieldGradients(Vec xLocalVec, Vec& gradLocVec, Vec& gradGlobVec, Vec faceGeomVec);
+
+    /**
+     * Limit the owned cell gradients for a single field.  The limiter function is a template argument so that it is inlined into the cell loop.
+     * @tparam bounded true if the limiter function bounds the reconstruction by the neighborhood minimum/maximum, false for a symmetric limiter function
+     * @param field
+     * @param function
+     * @param xLocalArray
+     * @param gradGlobArray
+     * @param work scratch space sized for three times the number of field components
+     */
+    template <bool bounded, class LimiterFunction>
+    void LimitFieldGradients(const domain::Field& field, const LimiterFunction& function, const PetscScalar* xLocalArray, PetscScalar* gradGlobArray, PetscReal* work) const;
 
     /**
-     * Helper function to compute the gradient at each cell
+     * Helper function to compute the gradient reconstruction stencil stored in the face geometry
      * @param dm
      * @param regionLabel
      * @param regionValue
      * @param fvm
      * @param faceGeometry
      * @param cellGeometry
-     * @param dmGrad
      * @return
      */
-    static PetscErrorCode ComputeGradientFVM(DM dm, DMLabel regionLabel, PetscInt regionValue, PetscFV fvm, Vec faceGeometry, Vec cellGeometry, DM* dmGrad);
+    static PetscErrorCode ComputeGradientFVM(DM dm, DMLabel regionLabel, PetscInt regionValue, PetscFV fvm, Vec faceGeometry, Vec cellGeometry);
 
    public:
     /**
-     * Create an instance of the cell interpolant for the current solver region
+     * Create an instance of the cell interpolant for the current solver region.  The face connectivity is computed here and
+     * the interpolant must be recreated if the mesh changes.
      * @param subDomain
      * @param solverRegion
      * @param faceGeomVec
@@ -103,14 +255,17 @@ class CellInterpolant {
     ~CellInterpolant();
 
     /**
-     * Adds in contributions for face based rhs functions
+     * Adds in contributions for face based rhs functions.  The face state functions are called on each face before the rhs functions.
+     * The gradients of all fields are computed together and exchanged with a single message.  The faces between owned cells are computed while the cell gradients
+     * are exchanged, followed by the faces that need the exchanged gradients.  The faces are the solver region faces cached when the interpolant was created.
      * @param time
      * @param locXVec
      * @param locFVec
+     * @param overlapFunction optional work (not using the gradients) to do while the gradients are exchanged
      */
     void ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
-                    std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const ablate::domain::Range& faceRange, const ablate::domain::Range& cellRange, Vec cellGeomVec,
-                    Vec faceGeomVec);
+                    std::vector<CellInterpolant::FaceStateFunctionDescription>& faceStateFunctions, std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
+                    Vec cellGeomVec, Vec faceGeomVec, const std::function<void()>& overlapFunction = {});
 
     /**
      * Adds in contributions for face based rhs point cell functions
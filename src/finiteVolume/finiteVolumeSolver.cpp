@@ -1,6 +1,7 @@
 #include "finiteVolumeSolver.hpp"
 #include <utility>
 #include "cellInterpolant.hpp"
+#include "compressibleFlowFields.hpp"
 #include "faceInterpolant.hpp"
 #include "processes/process.hpp"
 #include "utilities/constants.hpp"
@@ -48,6 +49,9 @@ void ablate::finiteVolume::FiniteVolumeSolver::Initialize() {
     // call the base class Initialize
     ablate::solver::CellSolver::Initialize();
 
+    // the cell interpolant caches the mesh topology, so force it to be rebuilt against the current mesh
+    cellInterpolant.reset();
+
     // add each boundary condition
     for (const auto& boundary : boundaryConditions) {
         const auto& fieldId = subDomain->GetField(boundary->GetFieldName());
@@ -227,6 +231,21 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
     ablate::domain::Range faceRange, cellRange;
     GetFaceRange(faceRange);
     GetCellRange(cellRange);
+    // the point functions do not depend upon the cell gradients, so they can be computed while the gradients are exchanged
+    bool pointFunctionsComputed = false;
+    auto computePointFunctions = [&]() {
+        StartEvent("FiniteVolumeSolver::ComputeRHSFunction::pointFunction");
+        if (!pointFunctionDescriptions.empty()) {
+            if (cellInterpolant == nullptr) {
+                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
+            }
+
+            cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), pointFunctionDescriptions, cellRange, cellGeomVec);
+        }
+        EndEvent();
+        pointFunctionsComputed = true;
+    };
+
     try {
         StartEvent("FiniteVolumeSolver::ComputeRHSFunction::discontinuousFluxFunction");
         if (!discontinuousFluxFunctionDescriptions.empty()) {
@@ -234,7 +253,22 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
                 cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
             }
 
-            cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), discontinuousFluxFunctionDescriptions, faceRange, cellRange, cellGeomVec, faceGeomVec);
+            cellInterpolant->ComputeRHS(time,
+                                        locXVec,
+                                        subDomain->GetAuxVector(),
+                                        locFVec,
+                                        GetRegion(),
+                                        faceStateFunctionDescriptions,
+                                        discontinuousFluxFunctionDescriptions,
+                                        cellGeomVec,
+                                        faceGeomVec,
+                                        [&computePointFunctions]() {
+                                            try {
+                                                computePointFunctions();
+                                            } catch (std::exception& exception) {
+                                                throw std::runtime_error(std::string("Error in CellInterpolant pointFunctionDescriptions: ") + exception.what());
+                                            }
+                                        });
         }
         EndEvent();
     } catch (std::exception& exception) {
@@ -242,15 +276,9 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
     }
 
     try {
-        StartEvent("FiniteVolumeSolver::ComputeRHSFunction::pointFunction");
-        if (!pointFunctionDescriptions.empty()) {
-            if (cellInterpolant == nullptr) {
-                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
-            }
-
-            cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), pointFunctionDescriptions, cellRange, cellGeomVec);
+        if (!pointFunctionsComputed) {
+            computePointFunctions();
         }
-        EndEvent();
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in CellInterpolant pointFunctionDescriptions: %s", exception.what());
     }
@@ -283,12 +311,12 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
 }
 
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(CellInterpolant::DiscontinuousFluxFunction function, void* context, const std::string& field,
-                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields) {
+                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields, bool threadSafe) {
     // map the field, inputFields, and auxFields to locations
     auto& fieldId = subDomain->GetField(field);
 
     // Create the FVMRHS Function
-    CellInterpolant::DiscontinuousFluxFunctionDescription functionDescription{.function = function, .context = context, .field = fieldId.id};
+    CellInterpolant::DiscontinuousFluxFunctionDescription functionDescription{.function = function, .context = context, .field = fieldId.id, .threadSafe = threadSafe};
 
     for (auto& inputField : inputFields) {
         auto& inputFieldId = subDomain->GetField(inputField);
@@ -347,34 +375,98 @@ void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(CellInterpola
     pointFunctionDescriptions.push_back(functionDescription);
 }
 
+void ablate::finiteVolume::FiniteVolumeSolver::RegisterFaceStateFunction(CellInterpolant::FaceStateFunction function, void* context, const std::vector<std::string>& inputFields,
+                                                                         const std::vector<std::string>& auxFields, bool threadSafe) {
+    CellInterpolant::FaceStateFunctionDescription functionDescription{.function = function, .context = context, .threadSafe = threadSafe};
+
+    for (const auto& inputField : inputFields) {
+        auto& fieldId = subDomain->GetField(inputField);
+        functionDescription.inputFields.push_back(fieldId.id);
+    }
+
+    for (const auto& auxField : auxFields) {
+        auto& fieldId = subDomain->GetField(auxField);
+        functionDescription.auxFields.push_back(fieldId.id);
+    }
+
+    faceStateFunctionDescriptions.push_back(functionDescription);
+}
+
+std::shared_ptr<ablate::finiteVolume::AdvectionFaceState> ablate::finiteVolume::FiniteVolumeSolver::GetAdvectionFaceState(const std::shared_ptr<eos::EOS>& eos,
+                                                                                                                          const std::shared_ptr<fluxCalculator::FluxCalculator>& fluxCalculator) {
+    // check to see if this face state has already been created
+    for (const auto& advectionFaceState : advectionFaceStates) {
+        if (advectionFaceState->Matches(eos, fluxCalculator)) {
+            return advectionFaceState;
+        }
+    }
+
+    // create and register a new face state, the last temperature in each cell is used to warm start the temperature decode when available
+    const bool useAuxTemperatureGuess =
+        subDomain->ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD) && subDomain->GetField(CompressibleFlowFields::TEMPERATURE_FIELD).location == domain::FieldLocation::AUX;
+    auto advectionFaceState = std::make_shared<AdvectionFaceState>(eos, fluxCalculator, subDomain->GetFields(), useAuxTemperatureGuess);
+    RegisterFaceStateFunction(AdvectionFaceState::ComputeFaceState,
+                              advectionFaceState.get(),
+                              {CompressibleFlowFields::EULER_FIELD},
+                              useAuxTemperatureGuess ? std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD} : std::vector<std::string>{},
+                              eos->IsThreadSafe());
+    advectionFaceStates.push_back(advectionFaceState);
+    return advectionFaceState;
+}
+
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(RHSArbitraryFunction function, void* context) { rhsArbitraryFunctions.emplace_back(function, context); }
 
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterPreRHSFunction(PreRHSFunctionDefinition function, void* context) { preRhsFunctions.emplace_back(function, context); }
 
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name) {
-    timeStepFunctions.emplace_back(ComputeTimeStepDescription{.function = function, .context = ctx, .name = std::move(name)});
+    timeStepFunctions.emplace_back(ComputeTimeStepDescription{.function = function, .timeStepsFunction = nullptr, .context = ctx, .names = {std::move(name)}});
+}
+
+void ablate::finiteVolume::FiniteVolumeSolver::RegisterComputeTimeStepFunction(ComputeTimeStepsFunction function, void* ctx, std::vector<std::string> names) {
+    timeStepFunctions.emplace_back(ComputeTimeStepDescription{.function = nullptr, .timeStepsFunction = function, .context = ctx, .names = std::move(names)});
+}
+
+void ablate::finiteVolume::FiniteVolumeSolver::ComputeLocalTimeSteps(TS ts, std::vector<PetscReal>& dts) {
+    dts.clear();
+    for (const auto& dtFunction : timeStepFunctions) {
+        if (dtFunction.timeStepsFunction) {
+            // each time step is computed in the same pass over the cells
+            auto offset = dts.size();
+            dts.resize(offset + dtFunction.names.size(), ablate::utilities::Constants::large);
+            dtFunction.timeStepsFunction(ts, *this, dts.data() + offset, dtFunction.context);
+        } else {
+            dts.push_back(dtFunction.function(ts, *this, dtFunction.context));
+        }
+    }
 }
 
 double ablate::finiteVolume::FiniteVolumeSolver::ComputePhysicsTimeStep(TS ts) {
     // march over each calculator
+    std::vector<PetscReal> dts;
+    ComputeLocalTimeSteps(ts, dts);
+
     PetscReal dtMin = ablate::utilities::Constants::large;
-    for (const auto& dtFunction : timeStepFunctions) {
-        dtMin = PetscMin(dtMin, dtFunction.function(ts, *this, dtFunction.context));
+    for (const auto& dt : dts) {
+        dtMin = PetscMin(dtMin, dt);
     }
 
     return dtMin;
 }
 
 std::map<std::string, double> ablate::finiteVolume::FiniteVolumeSolver::ComputePhysicsTimeSteps(TS ts) {
+    // compute every local time step and then reduce them all at once
+    std::vector<PetscReal> dts;
+    ComputeLocalTimeSteps(ts, dts);
+    std::vector<PetscReal> dtsGlobal(dts.size());
+    MPI_Reduce(dts.data(), dtsGlobal.data(), (PetscMPIInt)dts.size(), MPIU_REAL, MPI_MIN, 0, PetscObjectComm((PetscObject)ts)) >> ablate::utilities::MpiUtilities::checkError;
+
     // time steps
     std::map<std::string, double> timeSteps;
-
-    // march over each calculator
+    std::size_t i = 0;
     for (const auto& dtFunction : timeStepFunctions) {
-        double dt = dtFunction.function(ts, *this, dtFunction.context);
-        PetscReal dtMinGlobal;
-        MPI_Reduce(&dt, &dtMinGlobal, 1, MPIU_REAL, MPI_MIN, 0, PetscObjectComm((PetscObject)ts)) >> ablate::utilities::MpiUtilities::checkError;
-        timeSteps[dtFunction.name] = dtMinGlobal;
+        for (const auto& name : dtFunction.names) {
+            timeSteps[name] = dtsGlobal[i++];
+        }
     }
 
     return timeSteps;
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include "advectionFaceState.hpp"
 #include "boundaryConditions/boundaryCondition.hpp"
 #include "cellInterpolant.hpp"
 #include "eos/eos.hpp"
@@ -30,6 +31,8 @@ class FiniteVolumeSolver : public solver::CellSolver,
     using PreRHSFunctionDefinition = PetscErrorCode (*)(FiniteVolumeSolver&, TS ts, PetscReal time, bool initialStage, Vec locX, void* ctx);
     using RHSArbitraryFunction = PetscErrorCode (*)(const FiniteVolumeSolver&, DM dm, PetscReal time, Vec locXVec, Vec locFVec, void* ctx);
     using ComputeTimeStepFunction = double (*)(TS ts, FiniteVolumeSolver&, void* ctx);
+    //! compute several time steps in a single pass over the cells, dts is sized to the number of registered names
+    using ComputeTimeStepsFunction = void (*)(TS ts, FiniteVolumeSolver&, PetscReal dts[], void* ctx);
 
     //! store an enum for the fields in the meshCharacteristicsDm
     enum MeshCharacteristics { MIN_CELL_RADIUS = 0, MAX_CELL_RADIUS };
@@ -40,8 +43,10 @@ class FiniteVolumeSolver : public solver::CellSolver,
      */
     struct ComputeTimeStepDescription {
         ComputeTimeStepFunction function;
+        //! the function used when computing more than one time step at once
+        ComputeTimeStepsFunction timeStepsFunction;
         void* context;
-        std::string name; /**used for output**/
+        std::vector<std::string> names; /**used for output**/
     };
 
     // hold the update functions for flux and point sources
@@ -49,6 +54,12 @@ class FiniteVolumeSolver : public solver::CellSolver,
     std::vector<FaceInterpolant::ContinuousFluxFunctionDescription> continuousFluxFunctionDescriptions;
     std::vector<CellInterpolant::PointFunctionDescription> pointFunctionDescriptions;
 
+    // hold the face state functions that are computed once per face before the discontinuous flux functions
+    std::vector<CellInterpolant::FaceStateFunctionDescription> faceStateFunctionDescriptions;
+
+    // hold the advection face states shared between processes
+    std::vector<std::shared_ptr<AdvectionFaceState>> advectionFaceStates;
+
     // allow the use of any arbitrary rhs functions
     std::vector<std::pair<RHSArbitraryFunction, void*>> rhsArbitraryFunctions;
 
@@ -79,6 +90,13 @@ class FiniteVolumeSolver : public solver::CellSolver,
     //! Store a dm, vec and array for mesh characteristics specific to the fvm
     Vec meshCharacteristicsLocalVec = nullptr;
 
+    /**
+     * Compute the local time step for every registered name, in registration order
+     * @param ts
+     * @param dts
+     */
+    void ComputeLocalTimeSteps(TS ts, std::vector<PetscReal>& dts);
+
    public:
     FiniteVolumeSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, std::vector<std::shared_ptr<processes::Process>> flowProcesses,
                        std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions);
@@ -117,9 +135,10 @@ class FiniteVolumeSolver : public solver::CellSolver,
      * @param field
      * @param inputFields
      * @param auxFields
+     * @param threadSafe true if the function (and its context) can be called concurrently for different faces
      */
     void RegisterRHSFunction(CellInterpolant::DiscontinuousFluxFunction function, void* context, const std::string& field, const std::vector<std::string>& inputFields,
-                             const std::vector<std::string>& auxFields);
+                             const std::vector<std::string>& auxFields, bool threadSafe = false);
 
     /**
      * Register a FVM rhs continuous flux function
@@ -143,6 +162,26 @@ class FiniteVolumeSolver : public solver::CellSolver,
     void RegisterRHSFunction(CellInterpolant::PointFunction function, void* context, const std::vector<std::string>& fields, const std::vector<std::string>& inputFields,
                              const std::vector<std::string>& auxFields);
 
+    /**
+     * Register a face state function.  This is called once per face before any discontinuous flux function so that state can be shared between them.
+     * @param function
+     * @param context
+     * @param inputFields
+     * @param auxFields
+     * @param threadSafe true if the function can be called concurrently for different faces, the state must then be stored per thread
+     */
+    void RegisterFaceStateFunction(CellInterpolant::FaceStateFunction function, void* context, const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields,
+                                   bool threadSafe = false);
+
+    /**
+     * Returns the advection face state for this eos and flux calculator. The face state is created and registered on first request and shared
+     * with any other process using the same eos and flux calculator so each face is only decoded once.
+     * @param eos
+     * @param fluxCalculator
+     * @return
+     */
+    std::shared_ptr<AdvectionFaceState> GetAdvectionFaceState(const std::shared_ptr<eos::EOS>& eos, const std::shared_ptr<fluxCalculator::FluxCalculator>& fluxCalculator);
+
     /**
      * Register an arbitrary function.  The user is responsible for all work
      * @param function
@@ -167,6 +206,14 @@ class FiniteVolumeSolver : public solver::CellSolver,
      */
     void RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name);
 
+    /**
+     * Register a dtCalculator that computes several time steps in a single pass over the cells
+     * @param function
+     * @param ctx
+     * @param names the name of each time step computed by the function
+     */
+    void RegisterComputeTimeStepFunction(ComputeTimeStepsFunction function, void* ctx, std::vector<std::string> names);
+
     /**
      * Computes the individual time steps useful for output/debugging.
      */
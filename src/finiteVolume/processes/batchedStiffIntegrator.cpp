@@ -0,0 +1,299 @@
+#include "batchedStiffIntegrator.hpp"
+#include <algorithm>
+#include <utility>
+
+ablate::finiteVolume::processes::BatchedStiffIntegrator::BatchedStiffIntegrator(PetscInt size, RHSFunction rhsFunction, const Options& options)
+    : size(size), rhsFunction(std::move(rhsFunction)), options(options) {}
+
+PetscErrorCode ablate::finiteVolume::processes::BatchedStiffIntegrator::Solve(std::size_t numberPoints, PetscReal* y, PetscReal time, PetscReal dt) {
+    PetscFunctionBeginUser;
+    statistics = {};
+    failedPoints.clear();
+    if (numberPoints == 0 || dt <= 0.0) {
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+    const PetscReal endTime = time + dt;
+    const PetscReal timeTolerance = 10.0 * PETSC_MACHINE_EPSILON * PetscMax(PetscAbsReal(endTime), dt);
+
+    // every system starts at the same time with the same initial step
+    systemTime.assign(numberPoints, time);
+    systemDt.assign(numberPoints, PetscMin(options.dtInit, dt));
+    systemFailed.assign(numberPoints, false);
+    activeSystems.resize(numberPoints);
+    for (std::size_t p = 0; p < numberPoints; ++p) {
+        activeSystems[p] = (PetscInt)p;
+    }
+
+    // take a step for every active system until they all reach the end time
+    while (!activeSystems.empty()) {
+        const std::size_t numberActive = activeSystems.size();
+        const std::size_t activeSize = numberActive * size;
+        y0.resize(activeSize);
+        f0.resize(activeSize);
+        stageBase.resize(activeSize);
+        stageValue.resize(activeSize);
+        k1.resize(activeSize);
+        k2.resize(activeSize);
+        work.resize(activeSize);
+        workF.resize(activeSize);
+        jacobian.resize(activeSize * size);
+        pivots.resize(activeSize);
+        stepDt.resize(numberActive);
+        stageConverged.assign(numberActive, true);
+
+        // copy in the current state and limit the step to the end time
+        for (std::size_t a = 0; a < numberActive; ++a) {
+            const auto s = activeSystems[a];
+            stepDt[a] = PetscMin(systemDt[s], endTime - systemTime[s]);
+            std::copy_n(y + s * size, size, y0.data() + a * size);
+        }
+
+        // evaluate the rhs and the iteration matrix at the start of the step
+        newtonSystems.resize(numberActive);
+        for (std::size_t a = 0; a < numberActive; ++a) {
+            newtonSystems[a] = (PetscInt)a;
+        }
+        EvaluateRHS(newtonSystems, y0, f0);
+        ComputeIterationMatrices();
+
+        // Stage 1: Y1 = y0 + h gamma f(Y1)
+        for (std::size_t i = 0; i < activeSize; ++i) {
+            work[i] = y0[i] + stepDt[i / size] * sdirkGamma * f0[i];
+        }
+        SolveStage(y0, work);
+        for (std::size_t i = 0; i < activeSize; ++i) {
+            k1[i] = (stageValue[i] - y0[i]) / (stepDt[i / size] * sdirkGamma);
+        }
+
+        // Stage 2: Y2 = y0 + h (1 - gamma) k1 + h gamma f(Y2)
+        for (std::size_t i = 0; i < activeSize; ++i) {
+            const PetscReal h = stepDt[i / size];
+            stageBase[i] = y0[i] + h * (1.0 - sdirkGamma) * k1[i];
+            work[i] = stageBase[i] + h * sdirkGamma * k1[i];
+        }
+        SolveStage(stageBase, work);
+        for (std::size_t i = 0; i < activeSize; ++i) {
+            k2[i] = (stageValue[i] - stageBase[i]) / (stepDt[i / size] * sdirkGamma);
+        }
+
+        // accept or reject the step for each system
+        for (std::size_t a = 0; a < numberActive; ++a) {
+            const auto s = activeSystems[a];
+            const PetscReal h = stepDt[a];
+
+            if (!stageConverged[a]) {
+                statistics.newtonFailures++;
+                if (h <= options.dtMin) {
+                    // the step cannot be reduced any further, so stop integrating this system and leave it at the last accepted step
+                    systemFailed[s] = true;
+                    failedPoints.push_back(s);
+                    statistics.failedPoints++;
+                } else {
+                    // retry with a smaller step
+                    systemDt[s] = PetscMax(0.25 * h, options.dtMin);
+                }
+                continue;
+            }
+
+            // The embedded first order estimate (y0 + h k1) filtered through the iteration matrix to damp the stiff components
+            PetscReal* error = work.data() + a * size;
+            for (PetscInt i = 0; i < size; ++i) {
+                error[i] = h * sdirkGamma * (k2[a * size + i] - k1[a * size + i]);
+            }
+            SolveFactored(a, error);
+            const PetscReal errorNorm = WeightedNorm(error, y0.data() + a * size, stageValue.data() + a * size);
+
+            // compute the next step size for the first order error estimate
+            const PetscReal factor = PetscMin(5.0, PetscMax(0.2, 0.9 / PetscSqrtReal(PetscMax(errorNorm, 1E-10))));
+            if (errorNorm <= 1.0) {
+                // the method is stiffly accurate, so the solution is the last stage
+                std::copy_n(stageValue.data() + a * size, size, y + s * size);
+                systemTime[s] += h;
+                systemDt[s] = PetscMin(PetscMax(h * factor, options.dtMin), options.dtMax);
+                statistics.acceptedSteps++;
+            } else {
+                statistics.rejectedSteps++;
+                if (h <= options.dtMin) {
+                    // the error test cannot be met at the minimum time step, so leave this system at the last accepted step
+                    systemFailed[s] = true;
+                    failedPoints.push_back(s);
+                    statistics.failedPoints++;
+                } else {
+                    systemDt[s] = PetscMax(h * factor, options.dtMin);
+                }
+            }
+        }
+
+        // compact the list of systems that have not reached the end time or failed
+        activeSystems.erase(
+            std::remove_if(activeSystems.begin(), activeSystems.end(), [this, endTime, timeTolerance](PetscInt s) { return systemFailed[s] || systemTime[s] >= endTime - timeTolerance; }),
+            activeSystems.end());
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+void ablate::finiteVolume::processes::BatchedStiffIntegrator::EvaluateRHS(const std::vector<PetscInt>& subset, const std::vector<PetscReal>& state, std::vector<PetscReal>& f) {
+    statistics.rhsEvaluations++;
+
+    // If every active system is needed, evaluate in place
+    if (subset.size() == activeSystems.size()) {
+        rhsFunction(subset.size(), activeSystems.data(), state.data(), f.data());
+        return;
+    }
+
+    // otherwise pack the subset
+    packedPoints.resize(subset.size());
+    packedState.resize(subset.size() * size);
+    packedF.resize(subset.size() * size);
+    for (std::size_t i = 0; i < subset.size(); ++i) {
+        packedPoints[i] = activeSystems[subset[i]];
+        std::copy_n(state.data() + subset[i] * size, size, packedState.data() + i * size);
+    }
+    rhsFunction(subset.size(), packedPoints.data(), packedState.data(), packedF.data());
+    for (std::size_t i = 0; i < subset.size(); ++i) {
+        std::copy_n(packedF.data() + i * size, size, f.data() + subset[i] * size);
+    }
+}
+
+void ablate::finiteVolume::processes::BatchedStiffIntegrator::ComputeIterationMatrices() {
+    const std::size_t numberActive = activeSystems.size();
+    const PetscReal sqrtEpsilon = PetscSqrtReal(PETSC_MACHINE_EPSILON);
+
+    // Compute the Jacobian one column at a time for every system with a forward difference
+    std::vector<PetscReal> delta(numberActive);
+    for (PetscInt j = 0; j < size; ++j) {
+        std::copy(y0.begin(), y0.end(), work.begin());
+        for (std::size_t a = 0; a < numberActive; ++a) {
+            delta[a] = sqrtEpsilon * PetscMax(PetscAbsReal(y0[a * size + j]), options.absoluteTolerance);
+            work[a * size + j] += delta[a];
+        }
+        EvaluateRHS(newtonSystems, work, workF);
+
+        for (std::size_t a = 0; a < numberActive; ++a) {
+            PetscReal* matrix = jacobian.data() + a * size * size;
+            for (PetscInt i = 0; i < size; ++i) {
+                matrix[i * size + j] = (workF[a * size + i] - f0[a * size + i]) / delta[a];
+            }
+        }
+    }
+
+    // Form and factor (I - h gamma J) for each system with partial pivoting
+    for (std::size_t a = 0; a < numberActive; ++a) {
+        PetscReal* matrix = jacobian.data() + a * size * size;
+        PetscInt* pivot = pivots.data() + a * size;
+        const PetscReal scale = -stepDt[a] * sdirkGamma;
+        for (PetscInt i = 0; i < size * size; ++i) {
+            matrix[i] *= scale;
+        }
+        for (PetscInt i = 0; i < size; ++i) {
+            matrix[i * size + i] += 1.0;
+        }
+
+        for (PetscInt k = 0; k < size; ++k) {
+            // find the pivot row
+            PetscInt pivotRow = k;
+            for (PetscInt i = k + 1; i < size; ++i) {
+                if (PetscAbsReal(matrix[i * size + k]) > PetscAbsReal(matrix[pivotRow * size + k])) {
+                    pivotRow = i;
+                }
+            }
+            pivot[k] = pivotRow;
+            if (pivotRow != k) {
+                std::swap_ranges(matrix + k * size, matrix + (k + 1) * size, matrix + pivotRow * size);
+            }
+            if (matrix[k * size + k] == 0.0) {
+                matrix[k * size + k] = PETSC_SMALL;
+            }
+
+            // eliminate below the pivot
+            const PetscReal inversePivot = 1.0 / matrix[k * size + k];
+            for (PetscInt i = k + 1; i < size; ++i) {
+                const PetscReal multiplier = matrix[i * size + k] * inversePivot;
+                matrix[i * size + k] = multiplier;
+                for (PetscInt c = k + 1; c < size; ++c) {
+                    matrix[i * size + c] -= multiplier * matrix[k * size + c];
+                }
+            }
+        }
+    }
+}
+
+void ablate::finiteVolume::processes::BatchedStiffIntegrator::SolveFactored(std::size_t active, PetscReal* b) const {
+    const PetscReal* matrix = jacobian.data() + active * size * size;
+    const PetscInt* pivot = pivots.data() + active * size;
+
+    // forward substitution with the unit lower factor
+    for (PetscInt k = 0; k < size; ++k) {
+        if (pivot[k] != k) {
+            std::swap(b[k], b[pivot[k]]);
+        }
+        for (PetscInt i = k + 1; i < size; ++i) {
+            b[i] -= matrix[i * size + k] * b[k];
+        }
+    }
+
+    // back substitution with the upper factor
+    for (PetscInt i = size - 1; i >= 0; --i) {
+        for (PetscInt c = i + 1; c < size; ++c) {
+            b[i] -= matrix[i * size + c] * b[c];
+        }
+        b[i] /= matrix[i * size + i];
+    }
+}
+
+void ablate::finiteVolume::processes::BatchedStiffIntegrator::SolveStage(const std::vector<PetscReal>& base, const std::vector<PetscReal>& guess) {
+    const std::size_t numberActive = activeSystems.size();
+
+    // only iterate on the systems that have converged so far
+    newtonSystems.clear();
+    for (std::size_t a = 0; a < numberActive; ++a) {
+        if (stageConverged[a]) {
+            newtonSystems.push_back((PetscInt)a);
+            std::copy_n(guess.data() + a * size, size, stageValue.data() + a * size);
+        }
+    }
+
+    std::vector<PetscReal> correction(size);
+    for (PetscInt iteration = 0; iteration < options.maxNewtonIterations && !newtonSystems.empty(); ++iteration) {
+        // evaluate the rhs for every system still iterating in a single call
+        EvaluateRHS(newtonSystems, stageValue, workF);
+
+        std::size_t remaining = 0;
+        for (const auto a : newtonSystems) {
+            const PetscReal hGamma = stepDt[a] * sdirkGamma;
+            PetscReal* value = stageValue.data() + a * size;
+
+            // solve (I - h gamma J) dY = -(Y - base - h gamma f(Y))
+            for (PetscInt i = 0; i < size; ++i) {
+                correction[i] = -(value[i] - base[a * size + i] - hGamma * workF[a * size + i]);
+            }
+            SolveFactored(a, correction.data());
+            for (PetscInt i = 0; i < size; ++i) {
+                value[i] += correction[i];
+            }
+
+            // check for convergence
+            const PetscReal correctionNorm = WeightedNorm(correction.data(), y0.data() + a * size, value);
+            if (PetscIsInfOrNanReal(correctionNorm)) {
+                stageConverged[a] = false;
+            } else if (correctionNorm > 1E-2) {
+                newtonSystems[remaining++] = a;
+            }
+        }
+        newtonSystems.resize(remaining);
+    }
+
+    // any system that is still iterating did not converge
+    for (const auto a : newtonSystems) {
+        stageConverged[a] = false;
+    }
+}
+
+PetscReal ablate::finiteVolume::processes::BatchedStiffIntegrator::WeightedNorm(const PetscReal* value, const PetscReal* yOld, const PetscReal* yNew) const {
+    PetscReal sum = 0.0;
+    for (PetscInt i = 0; i < size; ++i) {
+        const PetscReal weight = options.absoluteTolerance + options.relativeTolerance * PetscMax(PetscAbsReal(yOld[i]), PetscAbsReal(yNew[i]));
+        sum += PetscSqr(value[i] / weight);
+    }
+    return PetscSqrtReal(sum / (PetscReal)size);
+}
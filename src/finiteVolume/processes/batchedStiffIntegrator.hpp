@@ -0,0 +1,175 @@
+#ifndef ABLATELIBRARY_BATCHEDSTIFFINTEGRATOR_HPP
+#define ABLATELIBRARY_BATCHEDSTIFFINTEGRATOR_HPP
+
+#include <petsc.h>
+#include <functional>
+#include <vector>
+
+namespace ablate::finiteVolume::processes {
+
+/**
+ * Integrates many small, independent, stiff ode systems (one per cell) over the same time interval.  Each system is advanced with the two stage, L-stable,
+ * stiffly accurate SDIRK method of Alexander (1977) using a dense Jacobian, simplified Newton iterations, and its own adaptive time step.  The systems
+ * are advanced together so that every right hand side evaluation is done in a single batched call over the active systems.  Systems are removed from the
+ * compact active list as soon as they reach the end time.  A system whose Newton iteration does not converge, or whose step fails the error test, at the
+ * minimum time step is removed from the active list and reported in GetFailedPoints so that it can be integrated with a more robust method.
+ */
+class BatchedStiffIntegrator {
+   public:
+    /**
+     * The batched right hand side function.  The state for each point is stored contiguously in y (numberPoints x size) and f must be filled in the same layout.
+     * The points array holds the index of each point in the original batch so that any per point data (i.e. density) can be located.
+     */
+    using RHSFunction = std::function<void(std::size_t numberPoints, const PetscInt points[], const PetscReal y[], PetscReal f[])>;
+
+    /**
+     * The integrator options
+     */
+    struct Options {
+        //! the initial time step for each system
+        PetscReal dtInit = 1E-6;
+        //! the minimum allowed time step
+        PetscReal dtMin = 1E-12;
+        //! the maximum allowed time step
+        PetscReal dtMax = 1E-4;
+        //! the relative tolerance used for the error estimate
+        PetscReal relativeTolerance = 1E-4;
+        //! the absolute tolerance used for the error estimate
+        PetscReal absoluteTolerance = 1E-4;
+        //! the maximum number of Newton iterations per stage before the step is retried with a smaller dt
+        PetscInt maxNewtonIterations = 10;
+    };
+
+    /**
+     * Counters for the last Solve
+     */
+    struct Statistics {
+        //! the number of accepted steps over all systems
+        std::size_t acceptedSteps = 0;
+        //! the number of steps rejected by the error estimate
+        std::size_t rejectedSteps = 0;
+        //! the number of steps rejected because Newton did not converge
+        std::size_t newtonFailures = 0;
+        //! the number of batched right hand side calls
+        std::size_t rhsEvaluations = 0;
+        //! the number of systems that could not be integrated to the end time
+        std::size_t failedPoints = 0;
+    };
+
+    /**
+     * Create the integrator for systems of a fixed size
+     * @param size the number of equations per system
+     * @param rhsFunction the batched right hand side function
+     * @param options the integrator options
+     */
+    BatchedStiffIntegrator(PetscInt size, RHSFunction rhsFunction, const Options& options);
+
+    /**
+     * Advance every system from time to time + dt
+     * @param numberPoints the number of systems
+     * @param y the state for each system (numberPoints x size), replaced with the state at time + dt.  The state of a failed point is left at the last accepted step.
+     * @param time the start time
+     * @param dt the interval to integrate over
+     * @return
+     */
+    PetscErrorCode Solve(std::size_t numberPoints, PetscReal y[], PetscReal time, PetscReal dt);
+
+    /**
+     * The statistics for the last call to Solve
+     */
+    [[nodiscard]] inline const Statistics& GetStatistics() const { return statistics; }
+
+    /**
+     * The points in the last call to Solve that did not reach the end time because Newton failed to converge or the error test failed at the minimum time step
+     */
+    [[nodiscard]] inline const std::vector<PetscInt>& GetFailedPoints() const { return failedPoints; }
+
+    /**
+     * The time reached by this point in the last call to Solve.  This is the end time unless the point failed.
+     * @param point
+     */
+    [[nodiscard]] inline PetscReal GetPointTime(PetscInt point) const { return systemTime[point]; }
+
+   private:
+    //! the number of equations per system
+    const PetscInt size;
+
+    //! the batched right hand side
+    const RHSFunction rhsFunction;
+
+    //! the integrator options
+    const Options options;
+
+    //! The SDIRK coefficient (1 - 1/sqrt(2))
+    static inline const PetscReal sdirkGamma = 1.0 - 1.0 / PetscSqrtReal(2.0);
+
+    //! statistics for the last solve
+    Statistics statistics;
+
+    //! the current time and next time step for each system
+    std::vector<PetscReal> systemTime;
+    std::vector<PetscReal> systemDt;
+
+    //! the compact list of systems still being integrated and the systems in the current Newton iteration
+    std::vector<PetscInt> activeSystems;
+    std::vector<PetscInt> newtonSystems;
+
+    //! the systems that could not be integrated to the end time
+    std::vector<PetscInt> failedPoints;
+    std::vector<bool> systemFailed;
+
+    //! the step size used by each active system in the current step
+    std::vector<PetscReal> stepDt;
+
+    //! scratch storage for each active system (active x size) and the Jacobian/LU (active x size x size)
+    std::vector<PetscReal> y0;
+    std::vector<PetscReal> f0;
+    std::vector<PetscReal> stageBase;
+    std::vector<PetscReal> stageValue;
+    std::vector<PetscReal> k1;
+    std::vector<PetscReal> k2;
+    std::vector<PetscReal> work;
+    std::vector<PetscReal> workF;
+    std::vector<PetscReal> jacobian;
+    std::vector<PetscInt> pivots;
+    std::vector<bool> stageConverged;
+
+    //! packed storage used when only a subset of the active systems is evaluated
+    std::vector<PetscInt> packedPoints;
+    std::vector<PetscReal> packedState;
+    std::vector<PetscReal> packedF;
+
+    /**
+     * Evaluate the rhs for a subset of the active systems, packing the state into contiguous storage as needed
+     * @param subset the active indices to evaluate
+     * @param state the state for every active system (active x size)
+     * @param f the rhs for every active system (active x size), only the subset is updated
+     */
+    void EvaluateRHS(const std::vector<PetscInt>& subset, const std::vector<PetscReal>& state, std::vector<PetscReal>& f);
+
+    /**
+     * Compute the finite difference Jacobian for each active system at y0 and factor (I - h gamma J)
+     */
+    void ComputeIterationMatrices();
+
+    /**
+     * Solve a single stage, Y = base + h gamma f(Y), with simplified Newton for each active system that has converged so far.
+     * The stage value is returned in stageValue and stageConverged is cleared for any system that did not converge.
+     * @param base the explicit part of the stage for each active system
+     * @param guess the initial guess for each active system
+     */
+    void SolveStage(const std::vector<PetscReal>& base, const std::vector<PetscReal>& guess);
+
+    /**
+     * Solve (I - h gamma J) x = b in place using the factored matrix for this active system
+     */
+    void SolveFactored(std::size_t active, PetscReal* b) const;
+
+    /**
+     * The weighted rms norm used for the error and Newton convergence
+     */
+    [[nodiscard]] PetscReal WeightedNorm(const PetscReal* value, const PetscReal* yOld, const PetscReal* yNew) const;
+};
+
+}  // namespace ablate::finiteVolume::processes
+#endif  // ABLATELIBRARY_BATCHEDSTIFFINTEGRATOR_HPP
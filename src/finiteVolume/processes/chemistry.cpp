@@ -1,16 +1,41 @@
 #include "chemistry.hpp"
 
+#include <petscdmshell.h>
+#include <petsctime.h>
+#include <algorithm>
+#include <numeric>
 #include <utility>
+#include "utilities/mpiUtilities.hpp"
 #include "utilities/petscUtilities.hpp"
 #include "utilities/vectorUtilities.hpp"
 
-ablate::finiteVolume::processes::Chemistry::Chemistry(std::shared_ptr<ablate::eos::ChemistryModel> chemistryModel) : chemistryModel(std::move(chemistryModel)) {}
+ablate::finiteVolume::processes::Chemistry::Chemistry(std::shared_ptr<ablate::eos::ChemistryModel> chemistryModel, bool loadBalance)
+    : chemistryModel(std::move(chemistryModel)), loadBalance(loadBalance) {}
+
+ablate::finiteVolume::processes::Chemistry::~Chemistry() {
+    if (remoteSolutionVec) {
+        VecDestroy(&remoteSolutionVec) >> utilities::PetscUtilities::checkError;
+    }
+    if (remoteSourceVec) {
+        VecDestroy(&remoteSourceVec) >> utilities::PetscUtilities::checkError;
+    }
+    if (remoteDm) {
+        DMDestroy(&remoteDm) >> utilities::PetscUtilities::checkError;
+    }
+    if (loadBalanceComm != MPI_COMM_NULL) {
+        PetscCommDestroy(&loadBalanceComm) >> utilities::PetscUtilities::checkError;
+    }
+}
 
 void ablate::finiteVolume::processes::Chemistry::Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) {
     // Check if there is another preStage call to make
     for (auto& updateFunction : chemistryModel->GetSolutionFieldUpdates()) {
         flow.RegisterSolutionFieldUpdate(std::get<0>(updateFunction), std::get<1>(updateFunction), std::get<2>(updateFunction));
     }
+    // the batch updates replace any point update with the same input fields
+    for (auto& updateFunction : chemistryModel->GetSolutionFieldBatchUpdates()) {
+        flow.RegisterSolutionFieldUpdate(std::get<0>(updateFunction), std::get<1>(updateFunction), std::get<2>(updateFunction));
+    }
 
     // Before each step, compute the source term over the entire dt
     auto chemistryPreStage = std::bind(&ablate::finiteVolume::processes::Chemistry::ChemistryPreStage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
@@ -28,9 +53,252 @@ void ablate::finiteVolume::processes::Chemistry::Initialize(ablate::finiteVolume
     // size up a calculator for this number of fields and cell range
     sourceCalculator = chemistryModel->CreateSourceCalculator(flow.GetSubDomain().GetFields(), cellRange);
 
+    if (loadBalance) {
+        // determine the solution dof in each cell. Ranks without any cells in this region get the values from the other ranks
+        PetscSection section;
+        DMGetLocalSection(flow.GetSubDomain().GetDM(), &section) >> utilities::PetscUtilities::checkError;
+        PetscInt numberFields;
+        PetscSectionGetNumFields(section, &numberFields) >> utilities::PetscUtilities::checkError;
+        cellFieldDof.assign(numberFields, 0);
+        if (cellRange.end > cellRange.start) {
+            for (PetscInt f = 0; f < numberFields; ++f) {
+                PetscSectionGetFieldDof(section, cellRange.GetPoint(cellRange.start), f, &cellFieldDof[f]) >> utilities::PetscUtilities::checkError;
+            }
+        }
+        MPI_Allreduce(MPI_IN_PLACE, cellFieldDof.data(), (int)numberFields, MPIU_INT, MPI_MAX, flow.GetSubDomain().GetComm()) >> utilities::MpiUtilities::checkError;
+        cellDof = std::accumulate(cellFieldDof.begin(), cellFieldDof.end(), (PetscInt)0);
+
+        // get unique tags so the transfers cannot match any other messages on the communicator
+        if (loadBalanceComm == MPI_COMM_NULL) {
+            PetscCommDuplicate(flow.GetSubDomain().GetComm(), &loadBalanceComm, nullptr) >> utilities::PetscUtilities::checkError;
+            PetscCommGetNewTag(loadBalanceComm, &solutionTag) >> utilities::PetscUtilities::checkError;
+            PetscCommGetNewTag(loadBalanceComm, &sourceTag) >> utilities::PetscUtilities::checkError;
+        }
+
+        // reset any previous transfers and remote storage because the mesh may have changed, the first step assumes a uniform cost per cell
+        localCellCost = 1.0;
+        numberKeptCells = -1;
+        sentCells.clear();
+        sentCellSources.clear();
+        remoteCapacity = 0;
+    }
+
     flow.RestoreRange(cellRange);
 }
 
+void ablate::finiteVolume::processes::Chemistry::PlanChemistryTransfers(PetscInt numberLocalCells, std::vector<ChemistryTransfer>& sends, std::vector<ChemistryTransfer>& receives) const {
+    sends.clear();
+    receives.clear();
+
+    PetscMPIInt size, rank;
+    MPI_Comm_size(loadBalanceComm, &size) >> utilities::MpiUtilities::checkError;
+    MPI_Comm_rank(loadBalanceComm, &rank) >> utilities::MpiUtilities::checkError;
+    if (size == 1) {
+        return;
+    }
+
+    // gather the per cell cost, total cost, and number of cells from every rank
+    PetscReal localCost[3] = {localCellCost, localCellCost * (PetscReal)numberLocalCells, (PetscReal)numberLocalCells};
+    std::vector<PetscReal> costs(3 * size);
+    MPI_Allgather(localCost, 3, MPIU_REAL, costs.data(), 3, MPIU_REAL, loadBalanceComm) >> utilities::MpiUtilities::checkError;
+
+    PetscReal meanCost = 0.0;
+    PetscReal maxCost = 0.0;
+    for (PetscMPIInt r = 0; r < size; ++r) {
+        meanCost += costs[3 * r + 1];
+        maxCost = PetscMax(maxCost, costs[3 * r + 1]);
+    }
+    meanCost /= (PetscReal)size;
+    if (meanCost <= 0.0 || maxCost <= (1.0 + loadBalanceThreshold) * meanCost) {
+        return;
+    }
+
+    // greedily move the excess cost from ranks above the mean to ranks below the mean
+    std::vector<PetscReal> excess(size);
+    for (PetscMPIInt r = 0; r < size; ++r) {
+        excess[r] = costs[3 * r + 1] - meanCost;
+    }
+
+    // the cost and cells moved so far from each rank
+    std::vector<PetscReal> movedCost(size, 0.0);
+    std::vector<PetscInt> movedCells(size, 0);
+    PetscMPIInt heavy = 0, light = 0;
+    while (true) {
+        while (heavy < size && excess[heavy] <= 0.0) {
+            heavy++;
+        }
+        while (light < size && excess[light] >= 0.0) {
+            light++;
+        }
+        if (heavy == size || light == size) {
+            break;
+        }
+
+        const PetscReal amount = PetscMin(excess[heavy], -excess[light]);
+        excess[heavy] -= amount;
+        excess[light] += amount;
+
+        // round the cumulative cost moved from the heavy rank so the remainder is not lost between transfers
+        movedCost[heavy] += amount;
+        const auto totalCells = PetscMin((PetscInt)PetscRoundReal(movedCost[heavy] / costs[3 * heavy]), (PetscInt)costs[3 * heavy + 2]);
+        const PetscInt numberCells = totalCells - movedCells[heavy];
+        movedCells[heavy] = totalCells;
+        if (numberCells > 0) {
+            if (heavy == rank) {
+                sends.push_back({.rank = light, .numberCells = numberCells});
+            }
+            if (light == rank) {
+                receives.push_back({.rank = heavy, .numberCells = numberCells});
+            }
+        }
+    }
+}
+
+void ablate::finiteVolume::processes::Chemistry::SetupRemoteStorage(ablate::finiteVolume::FiniteVolumeSolver& fvSolver, PetscInt numberRemoteCells) {
+    if (numberRemoteCells <= remoteCapacity) {
+        return;
+    }
+    if (remoteSolutionVec) {
+        VecDestroy(&remoteSolutionVec) >> utilities::PetscUtilities::checkError;
+    }
+    if (remoteSourceVec) {
+        VecDestroy(&remoteSourceVec) >> utilities::PetscUtilities::checkError;
+    }
+    if (remoteDm) {
+        DMDestroy(&remoteDm) >> utilities::PetscUtilities::checkError;
+    }
+    remoteCapacity = PetscMax(numberRemoteCells, 2 * remoteCapacity);
+
+    // build a section where every point matches a single solution cell
+    PetscSection remoteSection;
+    PetscSectionCreate(PETSC_COMM_SELF, &remoteSection) >> utilities::PetscUtilities::checkError;
+    PetscSectionSetNumFields(remoteSection, (PetscInt)cellFieldDof.size()) >> utilities::PetscUtilities::checkError;
+    for (std::size_t f = 0; f < cellFieldDof.size(); ++f) {
+        PetscSectionSetFieldComponents(remoteSection, (PetscInt)f, cellFieldDof[f]) >> utilities::PetscUtilities::checkError;
+    }
+    PetscSectionSetChart(remoteSection, 0, remoteCapacity) >> utilities::PetscUtilities::checkError;
+    for (PetscInt p = 0; p < remoteCapacity; ++p) {
+        PetscSectionSetDof(remoteSection, p, cellDof) >> utilities::PetscUtilities::checkError;
+        for (std::size_t f = 0; f < cellFieldDof.size(); ++f) {
+            PetscSectionSetFieldDof(remoteSection, p, (PetscInt)f, cellFieldDof[f]) >> utilities::PetscUtilities::checkError;
+        }
+    }
+    PetscSectionSetUp(remoteSection) >> utilities::PetscUtilities::checkError;
+
+    PetscInt dim;
+    DMGetDimension(fvSolver.GetSubDomain().GetDM(), &dim) >> utilities::PetscUtilities::checkError;
+    DMShellCreate(PETSC_COMM_SELF, &remoteDm) >> utilities::PetscUtilities::checkError;
+    DMSetDimension(remoteDm, dim) >> utilities::PetscUtilities::checkError;
+    DMSetLocalSection(remoteDm, remoteSection) >> utilities::PetscUtilities::checkError;
+    PetscSectionDestroy(&remoteSection) >> utilities::PetscUtilities::checkError;
+
+    VecCreateSeq(PETSC_COMM_SELF, remoteCapacity * cellDof, &remoteSolutionVec) >> utilities::PetscUtilities::checkError;
+    VecSetDM(remoteSolutionVec, remoteDm) >> utilities::PetscUtilities::checkError;
+    VecCreateSeq(PETSC_COMM_SELF, remoteCapacity * cellDof, &remoteSourceVec) >> utilities::PetscUtilities::checkError;
+    VecSetDM(remoteSourceVec, remoteDm) >> utilities::PetscUtilities::checkError;
+
+    // the remote cells are numbered 0 to numberRemoteCells in the remote dm
+    ablate::domain::Range remoteRange{.start = 0, .end = remoteCapacity};
+    remoteSourceCalculator = chemistryModel->CreateSourceCalculator(fvSolver.GetSubDomain().GetFields(), remoteRange);
+}
+
+void ablate::finiteVolume::processes::Chemistry::ComputeBalancedSource(ablate::finiteVolume::FiniteVolumeSolver& fvSolver, const ablate::domain::Range& cellRange, PetscReal time, PetscReal dt,
+                                                                        Vec globFlowVec) {
+    auto comm = loadBalanceComm;
+    const PetscInt numberLocalCells = cellRange.end - cellRange.start;
+    std::vector<ChemistryTransfer> sends, receives;
+    PlanChemistryTransfers(numberLocalCells, sends, receives);
+
+    // the sent cells are taken from the end of the local range
+    PetscInt numberSentCells = 0;
+    for (const auto& send : sends) {
+        numberSentCells += send.numberCells;
+    }
+    PetscInt numberRemoteCells = 0;
+    for (const auto& receive : receives) {
+        numberRemoteCells += receive.numberCells;
+    }
+    numberKeptCells = numberLocalCells - numberSentCells;
+
+    // pack the solution for each sent cell
+    DM dm;
+    VecGetDM(globFlowVec, &dm) >> utilities::PetscUtilities::checkError;
+    sentCells.resize(numberSentCells);
+    sentCellSources.assign(numberSentCells * cellDof, 0.0);
+    std::vector<PetscScalar> sentCellSolutions(numberSentCells * cellDof);
+    const PetscScalar* flowArray;
+    VecGetArrayRead(globFlowVec, &flowArray) >> utilities::PetscUtilities::checkError;
+    for (PetscInt c = 0; c < numberSentCells; ++c) {
+        sentCells[c] = cellRange.GetPoint(cellRange.start + numberKeptCells + c);
+        const PetscScalar* cellSolution;
+        DMPlexPointLocalRead(dm, sentCells[c], flowArray, &cellSolution) >> utilities::PetscUtilities::checkError;
+        std::copy(cellSolution, cellSolution + cellDof, sentCellSolutions.begin() + c * cellDof);
+    }
+    VecRestoreArrayRead(globFlowVec, &flowArray) >> utilities::PetscUtilities::checkError;
+
+    // start the exchange of the cell solutions
+    PetscScalar* remoteSolutionArray = nullptr;
+    if (numberRemoteCells > 0) {
+        SetupRemoteStorage(fvSolver, numberRemoteCells);
+        VecGetArray(remoteSolutionVec, &remoteSolutionArray) >> utilities::PetscUtilities::checkError;
+    }
+    std::vector<MPI_Request> requests(sends.size() + receives.size());
+    PetscInt offset = 0;
+    for (std::size_t r = 0; r < receives.size(); ++r) {
+        MPI_Irecv(remoteSolutionArray + offset * cellDof, (PetscMPIInt)(receives[r].numberCells * cellDof), MPIU_SCALAR, receives[r].rank, solutionTag, comm, &requests[r]) >>
+            utilities::MpiUtilities::checkError;
+        offset += receives[r].numberCells;
+    }
+    offset = 0;
+    for (std::size_t s = 0; s < sends.size(); ++s) {
+        MPI_Isend(sentCellSolutions.data() + offset * cellDof, (PetscMPIInt)(sends[s].numberCells * cellDof), MPIU_SCALAR, sends[s].rank, solutionTag, comm, &requests[receives.size() + s]) >>
+            utilities::MpiUtilities::checkError;
+        offset += sends[s].numberCells;
+    }
+
+    // integrate the kept local cells while the solutions are exchanged, recording the cost for the next step
+    ablate::domain::Range keptRange = cellRange;
+    keptRange.end = cellRange.start + numberKeptCells;
+    PetscLogDouble startTime, endTime;
+    PetscTime(&startTime) >> utilities::PetscUtilities::checkError;
+    sourceCalculator->ComputeSource(keptRange, time, dt, globFlowVec);
+    PetscTime(&endTime) >> utilities::PetscUtilities::checkError;
+    if (numberKeptCells > 0) {
+        localCellCost = (PetscReal)(endTime - startTime) / (PetscReal)numberKeptCells;
+    }
+
+    MPI_Waitall((int)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> utilities::MpiUtilities::checkError;
+
+    // integrate the cells from the other ranks
+    const PetscScalar* remoteSourceArray = nullptr;
+    if (numberRemoteCells > 0) {
+        VecRestoreArray(remoteSolutionVec, &remoteSolutionArray) >> utilities::PetscUtilities::checkError;
+        VecZeroEntries(remoteSourceVec) >> utilities::PetscUtilities::checkError;
+        ablate::domain::Range remoteRange{.start = 0, .end = numberRemoteCells};
+        remoteSourceCalculator->ComputeSource(remoteRange, time, dt, remoteSolutionVec);
+        remoteSourceCalculator->AddSource(remoteRange, remoteSolutionVec, remoteSourceVec);
+        VecGetArrayRead(remoteSourceVec, &remoteSourceArray) >> utilities::PetscUtilities::checkError;
+    }
+
+    // return the sources to the ranks that own the cells
+    offset = 0;
+    for (std::size_t s = 0; s < sends.size(); ++s) {
+        MPI_Irecv(sentCellSources.data() + offset * cellDof, (PetscMPIInt)(sends[s].numberCells * cellDof), MPIU_SCALAR, sends[s].rank, sourceTag, comm, &requests[s]) >>
+            utilities::MpiUtilities::checkError;
+        offset += sends[s].numberCells;
+    }
+    offset = 0;
+    for (std::size_t r = 0; r < receives.size(); ++r) {
+        MPI_Isend(remoteSourceArray + offset * cellDof, (PetscMPIInt)(receives[r].numberCells * cellDof), MPIU_SCALAR, receives[r].rank, sourceTag, comm, &requests[sends.size() + r]) >>
+            utilities::MpiUtilities::checkError;
+        offset += receives[r].numberCells;
+    }
+    MPI_Waitall((int)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> utilities::MpiUtilities::checkError;
+    if (numberRemoteCells > 0) {
+        VecRestoreArrayRead(remoteSourceVec, &remoteSourceArray) >> utilities::PetscUtilities::checkError;
+    }
+}
+
 PetscErrorCode ablate::finiteVolume::processes::Chemistry::ChemistryPreStage(TS flowTs, ablate::solver::Solver& solver, PetscReal stagetime) {
     PetscFunctionBegin;
     // get time step information from the ts
@@ -59,7 +327,11 @@ PetscErrorCode ablate::finiteVolume::processes::Chemistry::ChemistryPreStage(TS
 
     // Compute the current source terms
     try {
-        sourceCalculator->ComputeSource(cellRange, time, dt, globFlowVec);
+        if (loadBalance) {
+            ComputeBalancedSource(fvSolver, cellRange, time, dt, globFlowVec);
+        } else {
+            sourceCalculator->ComputeSource(cellRange, time, dt, globFlowVec);
+        }
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
     }
@@ -78,13 +350,33 @@ PetscErrorCode ablate::finiteVolume::processes::Chemistry::AddChemistrySourceToF
     ablate::domain::Range cellRange;
     solver.GetCellRangeWithoutGhost(cellRange);
 
-    // add in contributions
+    // add in contributions, only the kept cells are computed locally when load balancing
+    ablate::domain::Range localRange = cellRange;
+    if (process->numberKeptCells >= 0) {
+        localRange.end = PetscMin(cellRange.end, cellRange.start + process->numberKeptCells);
+    }
     try {
-        process->sourceCalculator->AddSource(cellRange, locX, locFVec);
+        process->sourceCalculator->AddSource(localRange, locX, locFVec);
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
     }
 
+    // add the sources computed on other ranks
+    if (!process->sentCells.empty()) {
+        DM fDm;
+        PetscCall(VecGetDM(locFVec, &fDm));
+        PetscScalar* fArray;
+        PetscCall(VecGetArray(locFVec, &fArray));
+        for (std::size_t c = 0; c < process->sentCells.size(); ++c) {
+            PetscScalar* cellSource;
+            PetscCall(DMPlexPointLocalRef(fDm, process->sentCells[c], fArray, &cellSource));
+            for (PetscInt d = 0; d < process->cellDof; ++d) {
+                cellSource[d] += process->sentCellSources[c * process->cellDof + d];
+            }
+        }
+        PetscCall(VecRestoreArray(locFVec, &fArray));
+    }
+
     // cleanup
     solver.RestoreRange(cellRange);
 
@@ -98,4 +390,5 @@ void ablate::finiteVolume::processes::Chemistry::AddChemistrySourceToFlow(const
 
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::Chemistry, "adds chemistry source terms from a chemistry model to the finite volume flow",
-         ARG(ablate::eos::ChemistryModel, "eos", "the eos/chemistry model to generate source terms"));
+         ARG(ablate::eos::ChemistryModel, "eos", "the eos/chemistry model to generate source terms"),
+         OPT(bool, "loadBalance", "ship the chemistry integration from expensive ranks to less expensive ranks each step without changing the mesh partition (default false)"));
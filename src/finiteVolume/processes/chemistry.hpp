@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_FINITEVOLUME_CHEMISTRY_HPP
 
 #include <memory>
+#include <vector>
 #include "eos/chemistryModel.hpp"
 #include "process.hpp"
 
@@ -15,6 +16,66 @@ class Chemistry : public Process, public ablate::utilities::Loggable<Chemistry>
     //! the current active chemistry calculator
     std::shared_ptr<ablate::eos::ChemistryModel::SourceCalculator> sourceCalculator;
 
+    //! when true the chemistry integration is redistributed from ranks with a high cost to ranks with a low cost
+    const bool loadBalance;
+
+    //! only redistribute when the most expensive rank exceeds the mean cost by this fraction
+    static inline constexpr PetscReal loadBalanceThreshold = 0.1;
+
+    //! the petsc communicator and the unique tags used to send the cell solutions and return the sources
+    MPI_Comm loadBalanceComm = MPI_COMM_NULL;
+    PetscMPIInt solutionTag = 0;
+    PetscMPIInt sourceTag = 0;
+
+    /**
+     * Describes a block of cells exchanged with another rank for chemistry integration
+     */
+    struct ChemistryTransfer {
+        //! the rank sending or receiving the cells
+        PetscMPIInt rank;
+        //! the number of cells in the transfer
+        PetscInt numberCells;
+    };
+
+    //! the measured chemistry cost per local cell (wall time) from the previous step.  Before the first measurement every cell is assumed to have the same cost.
+    PetscReal localCellCost = 1.0;
+
+    //! the number of local cells integrated on this rank during the last prestage.  The remaining cells at the end of the range were sent to other ranks.
+    PetscInt numberKeptCells = -1;
+
+    //! the cells sent to other ranks and the source (full point dof) returned for each
+    std::vector<PetscInt> sentCells;
+    std::vector<PetscScalar> sentCellSources;
+
+    //! the number of solution dof for each field and the total in each cell
+    std::vector<PetscInt> cellFieldDof;
+    PetscInt cellDof = 0;
+
+    //! a DMShell with a section matching a single solution cell that is used to integrate the cells received from other ranks
+    DM remoteDm = nullptr;
+    Vec remoteSolutionVec = nullptr;
+    Vec remoteSourceVec = nullptr;
+    PetscInt remoteCapacity = 0;
+
+    //! the calculator used for the cells received from other ranks
+    std::shared_ptr<ablate::eos::ChemistryModel::SourceCalculator> remoteSourceCalculator;
+
+    /**
+     * Determine the transfers for this rank from the previous cost of every rank.  Each rank computes the same plan.  The cells moved from each rank are rounded from the
+     * cumulative cost moved so that the last transfer from a rank includes the remainder.
+     * @param numberLocalCells
+     * @param sends the cells to send from the end of the local range
+     * @param receives the cells to receive
+     */
+    void PlanChemistryTransfers(PetscInt numberLocalCells, std::vector<ChemistryTransfer> &sends, std::vector<ChemistryTransfer> &receives) const;
+
+    /**
+     * Size the remote dm/vectors/calculator to hold at least numberRemoteCells
+     * @param fvSolver
+     * @param numberRemoteCells
+     */
+    void SetupRemoteStorage(ablate::finiteVolume::FiniteVolumeSolver &fvSolver, PetscInt numberRemoteCells);
+
     /**
      * private function to compute the energy and densityYi source terms over the next dt
      * @param flowTs
@@ -23,6 +84,16 @@ class Chemistry : public Process, public ablate::utilities::Loggable<Chemistry>
      */
     PetscErrorCode ChemistryPreStage(TS flowTs, ablate::solver::Solver &flow, PetscReal stagetime);
 
+    /**
+     * Compute the source terms while shipping the cells from expensive ranks to less expensive ranks.  The sources for the sent cells are returned before this function exits.
+     * @param fvSolver
+     * @param cellRange
+     * @param time
+     * @param dt
+     * @param globFlowVec
+     */
+    void ComputeBalancedSource(ablate::finiteVolume::FiniteVolumeSolver &fvSolver, const ablate::domain::Range &cellRange, PetscReal time, PetscReal dt, Vec globFlowVec);
+
     /**
      * static function to add chemistry source terms
      * @param solver
@@ -38,8 +109,15 @@ class Chemistry : public Process, public ablate::utilities::Loggable<Chemistry>
    public:
     /**
      * The chemistry processes need a chemistry model
+     * @param chemistryModel
+     * @param loadBalance when true, the chemistry integration for cells on expensive ranks is shipped to less expensive ranks.  The mesh partition is not changed.
+     */
+    explicit Chemistry(std::shared_ptr<ablate::eos::ChemistryModel> chemistryModel, bool loadBalance = false);
+
+    /**
+     * clean up the remote storage and communicator
      */
-    explicit Chemistry(std::shared_ptr<ablate::eos::ChemistryModel>);
+    ~Chemistry() override;
 
     /**
      * public function to link this process with the flow
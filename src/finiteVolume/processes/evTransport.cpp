@@ -39,7 +39,10 @@ void ablate::finiteVolume::processes::EVTransport::Setup(ablate::finiteVolume::F
             advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
             advectionData.computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
 
-            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD, evConservedField.name}, {});
+            // share the decoded face state with any other advection process using this eos/flux calculator
+            advectionData.faceState = flow.GetAdvectionFaceState(eos, fluxCalculator);
+
+            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD, evConservedField.name}, {}, eos->IsThreadSafe());
         }
 
         if (transportModel) {
@@ -141,78 +144,44 @@ PetscErrorCode ablate::finiteVolume::processes::EVTransport::AdvectionFlux(Petsc
     PetscFunctionBeginUser;
     auto eulerAdvectionData = (AdvectionData *)ctx;
 
-    // Compute the norm
-    PetscReal norm[3];
-    utilities::MathUtilities::NormVector(dim, fg->normal, norm);
-    const PetscReal areaMag = utilities::MathUtilities::MagVector(dim, fg->normal);
-
     const int EULER_FIELD = 0;
     const int DENSITY_EV_FIELD = 1;
 
-    // Decode the left and right states
-    PetscReal densityL;
-    PetscReal normalVelocityL;
-    PetscReal velocityL[3];
-    PetscReal internalEnergyL;
-    PetscReal aL;
-    PetscReal pL;
-    {
-        densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureL;
-
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
-
-        // Get the velocity in this direction
-        normalVelocityL = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityL[d] = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityL;
-            normalVelocityL += velocityL[d] * norm[d];
-        }
-
-        PetscCall(eulerAdvectionData->computeInternalEnergy.function(fieldL, temperatureL, &internalEnergyL, eulerAdvectionData->computeInternalEnergy.context.get()));
-        PetscCall(eulerAdvectionData->computeSpeedOfSound.function(fieldL, temperatureL, &aL, eulerAdvectionData->computeSpeedOfSound.context.get()));
-        PetscCall(eulerAdvectionData->computePressure.function(fieldL, temperatureL, &pL, eulerAdvectionData->computePressure.context.get()));
-    }
-
-    PetscReal densityR;
-    PetscReal normalVelocityR;
-    PetscReal velocityR[3];
-    PetscReal internalEnergyR;
-    PetscReal aR;
-    PetscReal pR;
-    {  // decode right state
-        densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureR;
-
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
-
-        // Get the velocity in this direction
-        normalVelocityR = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityR[d] = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityR;
-            normalVelocityR += velocityR[d] * norm[d];
-        }
-
-        PetscCall(eulerAdvectionData->computeInternalEnergy.function(fieldR, temperatureR, &internalEnergyR, eulerAdvectionData->computeInternalEnergy.context.get()));
-        PetscCall(eulerAdvectionData->computeSpeedOfSound.function(fieldR, temperatureR, &aR, eulerAdvectionData->computeSpeedOfSound.context.get()));
-        PetscCall(eulerAdvectionData->computePressure.function(fieldR, temperatureR, &pR, eulerAdvectionData->computePressure.context.get()));
+    // use the shared face state when available, otherwise decode the left and right states
+    AdvectionFaceState::State localState;
+    const AdvectionFaceState::State *state = &localState;
+    if (eulerAdvectionData->faceState) {
+        state = &eulerAdvectionData->faceState->GetState();
+    } else {
+        PetscCall(AdvectionFaceState::DecodeFace(dim,
+                                                 fg,
+                                                 uOff[EULER_FIELD],
+                                                 fieldL,
+                                                 fieldR,
+                                                 eulerAdvectionData->computeTemperature,
+                                                 eulerAdvectionData->computeInternalEnergy,
+                                                 eulerAdvectionData->computeSpeedOfSound,
+                                                 eulerAdvectionData->computePressure,
+                                                 eulerAdvectionData->fluxCalculatorFunction,
+                                                 eulerAdvectionData->fluxCalculatorCtx,
+                                                 localState));
     }
 
     // get the face values
-    PetscReal massFlux;
+    const PetscReal massFlux = state->massFlux;
+    const PetscReal areaMag = state->areaMag;
 
-    if (eulerAdvectionData->fluxCalculatorFunction(eulerAdvectionData->fluxCalculatorCtx, normalVelocityL, aL, densityL, pL, normalVelocityR, aR, densityR, pR, &massFlux, NULL) ==
-        fluxCalculator::LEFT) {
-        // march over each gas species
+    if (state->direction == fluxCalculator::LEFT) {
+        // march over each ev
         for (PetscInt ev = 0; ev < eulerAdvectionData->numberEV; ev++) {
             // Note: there is no density in the flux because uR and UL are density*yi
-            flux[ev] = (massFlux * fieldL[uOff[DENSITY_EV_FIELD] + ev] / densityL) * areaMag;
+            flux[ev] = (massFlux * fieldL[uOff[DENSITY_EV_FIELD] + ev] / state->densityL) * areaMag;
         }
     } else {
-        // march over each gas species
+        // march over each ev
         for (PetscInt ev = 0; ev < eulerAdvectionData->numberEV; ev++) {
             // Note: there is no density in the flux because uR and UL are density*yi
-            flux[ev] = (massFlux * fieldR[uOff[DENSITY_EV_FIELD] + ev] / densityR) * areaMag;
+            flux[ev] = (massFlux * fieldR[uOff[DENSITY_EV_FIELD] + ev] / state->densityR) * areaMag;
         }
     }
 
@@ -3,6 +3,7 @@
 
 #include <eos/transport/transportModel.hpp>
 #include "eos/transport/transportModel.hpp"
+#include "finiteVolume/advectionFaceState.hpp"
 #include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
 #include "flowProcess.hpp"
 
@@ -33,6 +34,9 @@ class EVTransport : public FlowProcess {
         /* store method used for flux calculator */
         ablate::finiteVolume::fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction;
         void* fluxCalculatorCtx;
+
+        /* optional shared face state, when not set the face is decoded in the flux function */
+        std::shared_ptr<ablate::finiteVolume::AdvectionFaceState> faceState = nullptr;
     };
 
     struct DiffusionData {
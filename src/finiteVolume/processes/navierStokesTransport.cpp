@@ -1,4 +1,5 @@
 #include "navierStokesTransport.hpp"
+#include <algorithm>
 #include <utility>
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "finiteVolume/fluxCalculator/ausm.hpp"
@@ -28,22 +29,24 @@ ablate::finiteVolume::processes::NavierStokesTransport::NavierStokesTransport(co
     timeStepData.advectionData = &advectionData;
     timeStepData.pgs = std::move(pgs);
 
-    diffusionTimeStepData.conductionStabilityFactor = parameters->Get<PetscReal>("conductionStabilityFactor", 0.0);
-    diffusionTimeStepData.viscousStabilityFactor = parameters->Get<PetscReal>("viscousStabilityFactor", 0.0);
+    timeStepData.conductionStabilityFactor = parameters->Get<PetscReal>("conductionStabilityFactor", 0.0);
+    timeStepData.viscousStabilityFactor = parameters->Get<PetscReal>("viscousStabilityFactor", 0.0);
 }
 
 void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) {
     // Register the euler source terms
     if (fluxCalculator) {
-        flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::EULER_FIELD, {CompressibleFlowFields::EULER_FIELD}, {});
+        // the flux only reads the shared face state, which is stored per thread, so faces can be computed concurrently when the eos allows it
+        flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::EULER_FIELD, {CompressibleFlowFields::EULER_FIELD}, {}, eos->IsThreadSafe());
 
-        // PetscErrorCode PetscOptionsGetBool(PetscOptions options,const char pre[],const char name[],PetscBool *ivalue,PetscBool *set)
-        flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl");
 
         advectionData.computeTemperature = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
         advectionData.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
         advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
         advectionData.computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
+
+        // share the decoded face state with any other advection process using this eos/flux calculator
+        advectionData.faceState = flow.GetAdvectionFaceState(eos, fluxCalculator);
     }
 
     // if there are any coefficients for diffusion, compute diffusion
@@ -60,21 +63,32 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
                                      {CompressibleFlowFields::EULER_FIELD},
                                      {CompressibleFlowFields::TEMPERATURE_FIELD, CompressibleFlowFields::VELOCITY_FIELD});
         }
+    }
 
-        // Check to see if time step calculations should be added for viscosity or conduction
-        if (diffusionTimeStepData.conductionStabilityFactor > 0 || diffusionTimeStepData.viscousStabilityFactor > 0) {
-            diffusionTimeStepData.kFunction = diffusionData.kFunction;
-            diffusionTimeStepData.muFunction = diffusionData.muFunction;
-            diffusionTimeStepData.specificHeat = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpecificHeatConstantVolume, flow.GetSubDomain().GetFields());
-            diffusionTimeStepData.density = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Density, flow.GetSubDomain().GetFields());
-
-            if (diffusionTimeStepData.conductionStabilityFactor > 0) {
-                flow.RegisterComputeTimeStepFunction(ComputeConductionTimeStep, &diffusionTimeStepData, "cond");
-            }
-            if (diffusionTimeStepData.viscousStabilityFactor > 0) {
-                flow.RegisterComputeTimeStepFunction(ComputeViscousDiffusionTimeStep, &diffusionTimeStepData, "visc");
-            }
+    // compute each of the time steps in a single pass over the cells
+    std::vector<std::string> timeStepNames;
+    if (fluxCalculator) {
+        timeStepData.cflIndex = (PetscInt)timeStepNames.size();
+        timeStepNames.emplace_back("cfl");
+        timeStepData.computeSpeedOfSound = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
+    }
+    if (transportModel && timeStepData.conductionStabilityFactor > 0) {
+        timeStepData.conductionIndex = (PetscInt)timeStepNames.size();
+        timeStepNames.emplace_back("cond");
+        timeStepData.kFunction = diffusionData.kFunction;
+        timeStepData.computeSpecificHeat = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::SpecificHeatConstantVolume, flow.GetSubDomain().GetFields());
+    }
+    if (transportModel && timeStepData.viscousStabilityFactor > 0) {
+        timeStepData.viscousIndex = (PetscInt)timeStepNames.size();
+        timeStepNames.emplace_back("visc");
+        timeStepData.muFunction = diffusionData.muFunction;
+    }
+    if (!timeStepNames.empty()) {
+        timeStepData.computeTemperature = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+            timeStepData.temperatureAuxField = flow.GetSubDomain().GetField(CompressibleFlowFields::TEMPERATURE_FIELD).id;
         }
+        flow.RegisterComputeTimeStepFunction(ComputeTimeSteps, &timeStepData, timeStepNames);
     }
 
     // check to see if auxFieldUpdates needed to be added
@@ -83,14 +97,22 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
     }
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
         // set decode state functions
-        computeTemperatureFunction = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        computeTemperatureBatchData.function = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
         // add in aux update variables
-        flow.RegisterAuxFieldUpdate(UpdateAuxTemperatureField, &computeTemperatureFunction, std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD}, {});
+        flow.RegisterAuxFieldUpdate(UpdateAuxTemperatureFieldBatch, &computeTemperatureBatchData, std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD}, {});
     }
 
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD)) {
-        computePressureFunction = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
-        flow.RegisterAuxFieldUpdate(UpdateAuxPressureField, &computePressureFunction, std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD}, {});
+        computePressureBatchData.function = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
+
+        // the temperature is updated before the pressure, so reuse it rather than solving for it again
+        computePressureBatchData.useAuxTemperature = flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD);
+        flow.RegisterAuxFieldUpdate(UpdateAuxPressureFieldBatch,
+                                    &computePressureBatchData,
+                                    computePressureBatchData.useAuxTemperature
+                                        ? std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD, CompressibleFlowFields::TEMPERATURE_FIELD}
+                                        : std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD},
+                                    {});
     }
 }
 
@@ -103,105 +125,78 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Advection
 
     const int EULER_FIELD = 0;
 
-    // Compute the norm
-    PetscReal norm[3];
-    utilities::MathUtilities::NormVector(dim, fg->normal, norm);
-    const PetscReal areaMag = utilities::MathUtilities::MagVector(dim, fg->normal);
-
-    // Decode the left and right states
-    PetscReal densityL;
-    PetscReal normalVelocityL;
-    PetscReal velocityL[3];
-    PetscReal internalEnergyL;
-    PetscReal aL;
-    PetscReal pL;
-
-    // decode the left side
-    {
-        densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureL;
-
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
-
-        // Get the velocity in this direction
-        normalVelocityL = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityL[d] = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityL;
-            normalVelocityL += velocityL[d] * norm[d];
-        }
-
-        PetscCall(eulerAdvectionData->computeInternalEnergy.function(fieldL, temperatureL, &internalEnergyL, eulerAdvectionData->computeInternalEnergy.context.get()));
-        PetscCall(eulerAdvectionData->computeSpeedOfSound.function(fieldL, temperatureL, &aL, eulerAdvectionData->computeSpeedOfSound.context.get()));
-        PetscCall(eulerAdvectionData->computePressure.function(fieldL, temperatureL, &pL, eulerAdvectionData->computePressure.context.get()));
-    }
-
-    PetscReal densityR;
-    PetscReal normalVelocityR;
-    PetscReal velocityR[3];
-    PetscReal internalEnergyR;
-    PetscReal aR;
-    PetscReal pR;
-
-    {  // decode right state
-        densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureR;
-
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
-
-        // Get the velocity in this direction
-        normalVelocityR = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityR[d] = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityR;
-            normalVelocityR += velocityR[d] * norm[d];
-        }
-
-        PetscCall(eulerAdvectionData->computeInternalEnergy.function(fieldR, temperatureR, &internalEnergyR, eulerAdvectionData->computeInternalEnergy.context.get()));
-        PetscCall(eulerAdvectionData->computeSpeedOfSound.function(fieldR, temperatureR, &aR, eulerAdvectionData->computeSpeedOfSound.context.get()));
-        PetscCall(eulerAdvectionData->computePressure.function(fieldR, temperatureR, &pR, eulerAdvectionData->computePressure.context.get()));
+    // use the shared face state when available, otherwise decode the left and right states
+    AdvectionFaceState::State localState;
+    const AdvectionFaceState::State* state = &localState;
+    if (eulerAdvectionData->faceState) {
+        state = &eulerAdvectionData->faceState->GetState();
+    } else {
+        PetscCall(AdvectionFaceState::DecodeFace(dim,
+                                                 fg,
+                                                 uOff[EULER_FIELD],
+                                                 fieldL,
+                                                 fieldR,
+                                                 eulerAdvectionData->computeTemperature,
+                                                 eulerAdvectionData->computeInternalEnergy,
+                                                 eulerAdvectionData->computeSpeedOfSound,
+                                                 eulerAdvectionData->computePressure,
+                                                 eulerAdvectionData->fluxCalculatorFunction,
+                                                 eulerAdvectionData->fluxCalculatorCtx,
+                                                 localState));
     }
 
     // get the face values
-    PetscReal massFlux;
-    PetscReal p12;
+    const PetscReal areaMag = state->areaMag;
+    const PetscReal massFlux = state->massFlux;
+    const PetscReal p12 = state->p12;
 
-    fluxCalculator::Direction direction =
-        eulerAdvectionData->fluxCalculatorFunction(eulerAdvectionData->fluxCalculatorCtx, normalVelocityL, aL, densityL, pL, normalVelocityR, aR, densityR, pR, &massFlux, &p12);
-
-    if (direction == fluxCalculator::LEFT) {
+    if (state->direction == fluxCalculator::LEFT) {
         flux[CompressibleFlowFields::RHO] = massFlux * areaMag;
-        PetscReal velMagL = utilities::MathUtilities::MagVector(dim, velocityL);
-        PetscReal HL = internalEnergyL + velMagL * velMagL / 2.0 + pL / densityL;
+        PetscReal velMagL = utilities::MathUtilities::MagVector(dim, state->velocityL);
+        PetscReal HL = state->internalEnergyL + velMagL * velMagL / 2.0 + state->pL / state->densityL;
         flux[CompressibleFlowFields::RHOE] = HL * massFlux * areaMag;
         for (PetscInt n = 0; n < dim; n++) {
-            flux[CompressibleFlowFields::RHOU + n] = velocityL[n] * massFlux * areaMag + p12 * fg->normal[n];
+            flux[CompressibleFlowFields::RHOU + n] = state->velocityL[n] * massFlux * areaMag + p12 * fg->normal[n];
         }
-    } else if (direction == fluxCalculator::RIGHT) {
+    } else if (state->direction == fluxCalculator::RIGHT) {
         flux[CompressibleFlowFields::RHO] = massFlux * areaMag;
-        PetscReal velMagR = utilities::MathUtilities::MagVector(dim, velocityR);
-        PetscReal HR = internalEnergyR + velMagR * velMagR / 2.0 + pR / densityR;
+        PetscReal velMagR = utilities::MathUtilities::MagVector(dim, state->velocityR);
+        PetscReal HR = state->internalEnergyR + velMagR * velMagR / 2.0 + state->pR / state->densityR;
         flux[CompressibleFlowFields::RHOE] = HR * massFlux * areaMag;
         for (PetscInt n = 0; n < dim; n++) {
-            flux[CompressibleFlowFields::RHOU + n] = velocityR[n] * massFlux * areaMag + p12 * fg->normal[n];
+            flux[CompressibleFlowFields::RHOU + n] = state->velocityR[n] * massFlux * areaMag + p12 * fg->normal[n];
         }
     } else {
         flux[CompressibleFlowFields::RHO] = massFlux * areaMag;
 
-        PetscReal velMagL = utilities::MathUtilities::MagVector(dim, velocityL);
-        PetscReal HL = internalEnergyL + velMagL * velMagL / 2.0 + pL / densityL;
+        PetscReal velMagL = utilities::MathUtilities::MagVector(dim, state->velocityL);
+        PetscReal HL = state->internalEnergyL + velMagL * velMagL / 2.0 + state->pL / state->densityL;
 
-        PetscReal velMagR = utilities::MathUtilities::MagVector(dim, velocityR);
-        PetscReal HR = internalEnergyR + velMagR * velMagR / 2.0 + pR / densityR;
+        PetscReal velMagR = utilities::MathUtilities::MagVector(dim, state->velocityR);
+        PetscReal HR = state->internalEnergyR + velMagR * velMagR / 2.0 + state->pR / state->densityR;
 
         flux[CompressibleFlowFields::RHOE] = 0.5 * (HL + HR) * massFlux * areaMag;
         for (PetscInt n = 0; n < dim; n++) {
-            flux[CompressibleFlowFields::RHOU + n] = 0.5 * (velocityL[n] + velocityR[n]) * massFlux * areaMag + p12 * fg->normal[n];
+            flux[CompressibleFlowFields::RHOU + n] = 0.5 * (state->velocityL[n] + state->velocityR[n]) * massFlux * areaMag + p12 * fg->normal[n];
         }
     }
 
     PetscFunctionReturn(0);
 }
 
-double ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx) {
+/**
+ * The cfl time step kernel for a single decoded cell
+ */
+static inline PetscReal CflTimeStep(PetscReal cfl, PetscReal pgsAlpha, PetscReal dx, PetscReal speedOfSound, PetscReal velocitySum) {
+    return cfl * dx / (speedOfSound / pgsAlpha + velocitySum);
+}
+
+/**
+ * The diffusion (conduction or viscous) time step kernel for a single decoded cell
+ */
+static inline PetscReal DiffusionTimeStep(PetscReal stabilityFactor, PetscReal dx, PetscReal diffusivity) { return PetscAbs(stabilityFactor * PetscSqr(dx) / diffusivity); }
+
+void ablate::finiteVolume::processes::NavierStokesTransport::ComputeTimeSteps(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, PetscReal dts[], void* ctx) {
     // Get the dm and current solution vector
     DM dm;
     TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
@@ -209,8 +204,7 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeSte
     TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
 
     // Get the flow param
-    auto timeStepData = (CflTimeStepData*)ctx;
-    auto advectionData = timeStepData->advectionData;
+    auto timeStepData = (TimeStepData*)ctx;
 
     // Get the fv geom
     Vec locCharacteristicsVec;
@@ -239,8 +233,26 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeSte
         pgsAlpha = timeStepData->pgs->GetAlpha();
     }
 
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
+    // Get the size of the conserved values for each cell
+    PetscInt totDim;
+    PetscDSGetTotalDimension(flow.GetSubDomain().GetDiscreteSystem(), &totDim) >> utilities::PetscUtilities::checkError;
+
+    // size the working arrays
+    const PetscInt rangeSize = cellRange.end - cellRange.start;
+    timeStepData->conserved.resize(rangeSize * totDim);
+    timeStepData->dx.resize(rangeSize);
+    timeStepData->density.resize(rangeSize);
+    timeStepData->velocitySum.resize(rangeSize);
+    timeStepData->temperatureGuess.resize(rangeSize);
+
+    // the last temperature is used as the initial guess for the temperature
+    const PetscScalar* aux = nullptr;
+    if (timeStepData->temperatureAuxField >= 0) {
+        VecGetArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
+    }
+
+    // March over each cell once and pack the conserved values for each real cell
+    PetscInt numberCells = 0;
     for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
         auto cell = cellRange.GetPoint(c);
 
@@ -253,196 +265,91 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeSte
 
         if (euler) {  // must be real cell and not ghost
             PetscReal rho = euler[CompressibleFlowFields::RHO];
+            std::copy_n(conserved, totDim, timeStepData->conserved.data() + numberCells * totDim);
 
-            // Get the speed of sound from the eos
-            PetscReal temperature;
-            advectionData->computeTemperature.function(conserved, &temperature, advectionData->computeTemperature.context.get()) >> utilities::PetscUtilities::checkError;
-            PetscReal a;
-            advectionData->computeSpeedOfSound.function(conserved, temperature, &a, advectionData->computeSpeedOfSound.context.get()) >> utilities::PetscUtilities::checkError;
-
-            PetscReal dx = 2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS];
+            timeStepData->dx[numberCells] = 2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS];
+            timeStepData->density[numberCells] = rho;
 
             PetscReal velSum = 0.0;
             for (PetscInt d = 0; d < dim; d++) {
                 velSum += PetscAbsReal(euler[CompressibleFlowFields::RHOU + d]) / rho;
             }
-            PetscReal dt = advectionData->cfl * dx / (a / pgsAlpha + velSum);
+            timeStepData->velocitySum[numberCells] = velSum;
 
-            dtMin = PetscMin(dtMin, dt);
+            const PetscReal* temperature = nullptr;
+            if (aux) {
+                DMPlexPointLocalFieldRead(flow.GetSubDomain().GetAuxDM(), cell, timeStepData->temperatureAuxField, aux, &temperature) >> utilities::PetscUtilities::checkError;
+            }
+            timeStepData->temperatureGuess[numberCells] = temperature && *temperature > 0.0 ? *temperature : AdvectionFaceState::DEFAULT_TEMPERATURE_GUESS;
+            numberCells++;
         }
     }
+
+    if (aux) {
+        VecRestoreArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
+    }
     VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
     flow.RestoreRange(cellRange);
     VecRestoreArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
 
-    return dtMin;
-}
-
-double ablate::finiteVolume::processes::NavierStokesTransport::ComputeConductionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
-    Vec v;
-    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
-
-    // Get the flow param
-    auto diffusionData = (DiffusionTimeStepData*)ctx;
-
-    // Get the fv geom
-    Vec locCharacteristicsVec;
-    DM characteristicsDm;
-    const PetscScalar* locCharacteristicsArray;
-    flow.GetMeshCharacteristics(characteristicsDm, locCharacteristicsVec);
-    VecGetArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-
-    // Get the valid cell range over this region
-    ablate::domain::Range cellRange;
-    flow.GetCellRangeWithoutGhost(cellRange);
-
-    // Get the solution data
-    const PetscScalar* x;
-    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-
-    // Get the auxData
-    const PetscScalar* aux;
-    const DM auxDM = flow.GetSubDomain().GetAuxDM();
-    VecGetArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-
-    // Get the dim from the dm
-    PetscInt dim;
-    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
-
-    // Get field location for temperature
-    auto temperatureField = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD).id;
-
-    // get functions
-    auto kFunction = diffusionData->kFunction.function;
-    auto kFunctionContext = diffusionData->kFunction.context.get();
-    auto cvFunction = diffusionData->specificHeat.function;
-    auto cvFunctionContext = diffusionData->specificHeat.context.get();
-    auto density = diffusionData->density.function;
-    auto densityContext = diffusionData->density.context.get();
-    auto stabFactor = diffusionData->conductionStabilityFactor;
-
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        auto cell = cellRange.GetPoint(c);
-
-        const PetscReal* conserved = NULL;
-        DMPlexPointGlobalRead(dm, cell, x, &conserved) >> utilities::PetscUtilities::checkError;
-
-        const PetscReal* temperature = NULL;
-        DMPlexPointLocalFieldRead(auxDM, cell, temperatureField, aux, &temperature) >> utilities::PetscUtilities::checkError;
-
-        const PetscReal* cellCharacteristics = NULL;
-        DMPlexPointLocalRead(characteristicsDm, cell, locCharacteristicsArray, &cellCharacteristics) >> utilities::PetscUtilities::checkError;
+    // Decode every cell at once, the temperature solve starts from the guess and is shared by each eos property
+    timeStepData->temperature.resize(numberCells);
+    timeStepData->computeTemperature.function(
+        numberCells, timeStepData->conserved.data(), totDim, timeStepData->temperatureGuess.data(), timeStepData->temperature.data(), timeStepData->computeTemperature.context.get()) >>
+        utilities::PetscUtilities::checkError;
+    if (timeStepData->cflIndex >= 0) {
+        timeStepData->speedOfSound.resize(numberCells);
+        timeStepData->computeSpeedOfSound.function(
+            numberCells, timeStepData->conserved.data(), totDim, timeStepData->temperature.data(), timeStepData->speedOfSound.data(), timeStepData->computeSpeedOfSound.context.get()) >>
+            utilities::PetscUtilities::checkError;
+    }
+    if (timeStepData->conductionIndex >= 0) {
+        timeStepData->specificHeat.resize(numberCells);
+        timeStepData->computeSpecificHeat.function(
+            numberCells, timeStepData->conserved.data(), totDim, timeStepData->temperature.data(), timeStepData->specificHeat.data(), timeStepData->computeSpecificHeat.context.get()) >>
+            utilities::PetscUtilities::checkError;
+    }
 
-        if (conserved) {  // must be real cell and not ghost
+    // Evaluate each enabled time step kernel using the shared decoded state
+    PetscReal cflDtMin = ablate::utilities::Constants::large;
+    PetscReal conductionDtMin = ablate::utilities::Constants::large;
+    PetscReal viscousDtMin = ablate::utilities::Constants::large;
+    for (PetscInt i = 0; i < numberCells; ++i) {
+        const PetscReal* conserved = timeStepData->conserved.data() + i * totDim;
+        const PetscReal dx = timeStepData->dx[i];
+        const PetscReal rho = timeStepData->density[i];
+        const PetscReal temperature = timeStepData->temperature[i];
+
+        if (timeStepData->cflIndex >= 0) {
+            cflDtMin = PetscMin(cflDtMin, CflTimeStep(timeStepData->advectionData->cfl, pgsAlpha, dx, timeStepData->speedOfSound[i], timeStepData->velocitySum[i]));
+        }
+        if (timeStepData->conductionIndex >= 0) {
             PetscReal k;
-            kFunction(conserved, *temperature, &k, kFunctionContext) >> utilities::PetscUtilities::checkError;
-            PetscReal cv;
-            cvFunction(conserved, *temperature, &cv, cvFunctionContext) >> utilities::PetscUtilities::checkError;
-            PetscReal rho;
-            density(conserved, *temperature, &rho, densityContext) >> utilities::PetscUtilities::checkError;
+            timeStepData->kFunction.function(conserved, temperature, &k, timeStepData->kFunction.context.get()) >> utilities::PetscUtilities::checkError;
 
             // Compute alpha
-            PetscReal alpha = k / (rho * cv);
-
-            PetscReal dx2 = PetscSqr(2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS]);
-
-            // compute dt
-            double dt = PetscAbs(stabFactor * dx2 / alpha);
-            dtMin = PetscMin(dtMin, dt);
+            PetscReal alpha = k / (rho * timeStepData->specificHeat[i]);
+            conductionDtMin = PetscMin(conductionDtMin, DiffusionTimeStep(timeStepData->conductionStabilityFactor, dx, alpha));
         }
-    }
-    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-    flow.RestoreRange(cellRange);
-
-    return dtMin;
-}
-
-double ablate::finiteVolume::processes::NavierStokesTransport::ComputeViscousDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> utilities::PetscUtilities::checkError;
-    Vec v;
-    TSGetSolution(ts, &v) >> utilities::PetscUtilities::checkError;
-
-    // Get the flow param
-    auto diffusionData = (DiffusionTimeStepData*)ctx;
-
-    // Get the fv geom
-    Vec locCharacteristicsVec;
-    DM characteristicsDm;
-    const PetscScalar* locCharacteristicsArray;
-    flow.GetMeshCharacteristics(characteristicsDm, locCharacteristicsVec);
-    VecGetArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-
-    // Get the valid cell range over this region
-    ablate::domain::Range cellRange;
-    flow.GetCellRangeWithoutGhost(cellRange);
-
-    // Get the solution data
-    const PetscScalar* x;
-    VecGetArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-
-    // Get the auxData
-    const PetscScalar* aux;
-    const DM auxDM = flow.GetSubDomain().GetAuxDM();
-    VecGetArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-
-    // Get the dim from the dm
-    PetscInt dim;
-    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
-
-    // Get field location for temperature
-    auto temperatureField = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD).id;
-
-    // get functions
-    auto muFunction = diffusionData->muFunction.function;
-    auto muFunctionContext = diffusionData->muFunction.context.get();
-    auto density = diffusionData->density.function;
-    auto densityContext = diffusionData->density.context.get();
-    auto stabFactor = diffusionData->viscousStabilityFactor;
-
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        auto cell = cellRange.GetPoint(c);
-
-        const PetscReal* conserved = NULL;
-        DMPlexPointGlobalRead(dm, cell, x, &conserved) >> utilities::PetscUtilities::checkError;
-
-        const PetscReal* temperature = NULL;
-        DMPlexPointLocalFieldRead(auxDM, cell, temperatureField, aux, &temperature) >> utilities::PetscUtilities::checkError;
-
-        const PetscReal* cellCharacteristics = NULL;
-        DMPlexPointLocalRead(characteristicsDm, cell, locCharacteristicsArray, &cellCharacteristics) >> utilities::PetscUtilities::checkError;
-
-        if (conserved) {  // must be real cell and not ghost
+        if (timeStepData->viscousIndex >= 0) {
             PetscReal mu;
-            muFunction(conserved, *temperature, &mu, muFunctionContext) >> utilities::PetscUtilities::checkError;
-            PetscReal rho;
-            density(conserved, *temperature, &rho, densityContext) >> utilities::PetscUtilities::checkError;
+            timeStepData->muFunction.function(conserved, temperature, &mu, timeStepData->muFunction.context.get()) >> utilities::PetscUtilities::checkError;
 
             // Compute nu
             PetscReal nu = mu / rho;
-
-            PetscReal dx2 = PetscSqr(2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS]);
-
-            // compute dt
-            double dt = PetscAbs(stabFactor * dx2 / nu);
-            dtMin = PetscMin(dtMin, dt);
+            viscousDtMin = PetscMin(viscousDtMin, DiffusionTimeStep(timeStepData->viscousStabilityFactor, dx, nu));
         }
     }
-    VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(flow.GetSubDomain().GetAuxGlobalVector(), &aux) >> utilities::PetscUtilities::checkError;
-    VecRestoreArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
-    flow.RestoreRange(cellRange);
-    return dtMin;
+
+    if (timeStepData->cflIndex >= 0) {
+        dts[timeStepData->cflIndex] = cflDtMin;
+    }
+    if (timeStepData->conductionIndex >= 0) {
+        dts[timeStepData->conductionIndex] = conductionDtMin;
+    }
+    if (timeStepData->viscousIndex >= 0) {
+        dts[timeStepData->viscousIndex] = viscousDtMin;
+    }
 }
 
 PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::DiffusionFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
@@ -547,6 +454,26 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAux
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAuxTemperatureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride,
+                                                                                                      const PetscScalar* conservedValues, const PetscInt aOff[], PetscInt aStride,
+                                                                                                      PetscScalar* auxField, void* ctx) {
+    PetscFunctionBeginUser;
+    auto batchData = (AuxUpdateBatchData*)ctx;
+    batchData->temperature.resize(numberCells);
+    batchData->property.resize(numberCells);
+
+    // use the current temperature as the guess
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        batchData->temperature[c] = auxField[c * aStride + aOff[0]];
+    }
+    PetscCall(batchData->function.function(numberCells, conservedValues, uStride, batchData->temperature.data(), batchData->property.data(), batchData->function.context.get()));
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        auxField[c * aStride + aOff[0]] = batchData->property[c];
+    }
+
+    PetscFunctionReturn(0);
+}
+
 // When used, you must request euler, then densityYi
 PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAuxPressureField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[],
                                                                                               const PetscScalar* conservedValues, const PetscInt aOff[], PetscScalar* auxField, void* ctx) {
@@ -559,6 +486,31 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAux
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAuxPressureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride,
+                                                                                                   const PetscScalar* conservedValues, const PetscInt aOff[], PetscInt aStride,
+                                                                                                   PetscScalar* auxField, void* ctx) {
+    PetscFunctionBeginUser;
+    auto batchData = (AuxUpdateBatchData*)ctx;
+    batchData->property.resize(numberCells);
+
+    // when available, use the updated temperature so that the eos does not need to solve for it
+    const PetscReal* temperature = nullptr;
+    if (batchData->useAuxTemperature) {
+        batchData->temperature.resize(numberCells);
+        for (PetscInt c = 0; c < numberCells; ++c) {
+            batchData->temperature[c] = auxField[c * aStride + aOff[1]];
+        }
+        temperature = batchData->temperature.data();
+    }
+
+    PetscCall(batchData->function.function(numberCells, conservedValues, uStride, temperature, batchData->property.data(), batchData->function.context.get()));
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        auxField[c * aStride + aOff[0]] = batchData->property[c];
+    }
+
+    PetscFunctionReturn(0);
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::NavierStokesTransport, "build advection/diffusion for the euler field",
          OPT(ablate::parameters::Parameters, "parameters", "the parameters used by advection/diffusion: cfl(.5), conductionStabilityFactor(0), viscousStabilityFactor(0)"),
@@ -3,6 +3,7 @@
 
 #include <petsc.h>
 #include "eos/transport/transportModel.hpp"
+#include "finiteVolume/advectionFaceState.hpp"
 #include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
 #include "flowProcess.hpp"
 #include "pressureGradientScaling.hpp"
@@ -28,6 +29,9 @@ class NavierStokesTransport : public FlowProcess {
         /* store method used for flux calculator */
         ablate::finiteVolume::fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction;
         void* fluxCalculatorCtx;
+
+        /* optional shared face state, when not set the face is decoded in the flux function */
+        std::shared_ptr<ablate::finiteVolume::AdvectionFaceState> faceState = nullptr;
     };
 
     // Store ctx needed for static function diffusion function passed to PETSc
@@ -44,51 +48,72 @@ class NavierStokesTransport : public FlowProcess {
     const std::shared_ptr<eos::transport::TransportModel> transportModel;
     AdvectionData advectionData;
 
-    eos::ThermodynamicTemperatureFunction computeTemperatureFunction;
+    //! the batched eos function and working arrays used to update an aux field over every cell
+    struct AuxUpdateBatchData {
+        eos::ThermodynamicBatchFunction function;
+        std::vector<PetscReal> temperature;
+        std::vector<PetscReal> property;
+        //! if true, the second aux field is the (already updated) temperature which is passed to the function
+        bool useAuxTemperature = false;
+    };
+
+    AuxUpdateBatchData computeTemperatureBatchData;
 
     DiffusionData diffusionData;
 
-    eos::ThermodynamicFunction computePressureFunction;
+    AuxUpdateBatchData computePressureBatchData;
 
     // Store the required ctx for time stepping
-    struct CflTimeStepData {
-        /* thermal conductivity*/
+    struct TimeStepData {
+        /* advection data, only used when computing the cfl time step */
         AdvectionData* advectionData;
 
         /**
          * pressure gradient scaling
          */
         std::shared_ptr<ablate::finiteVolume::processes::PressureGradientScaling> pgs;
-    };
-    CflTimeStepData timeStepData;
 
-    //! methods and functions to compute diffusion based time stepping
-    struct DiffusionTimeStepData {
         //! stability factor for condition time step. 0 (default) does not compute factor
         PetscReal conductionStabilityFactor;
 
         //! stability factor for viscous diffusion time step. 0 (default) does not compute factor
         PetscReal viscousStabilityFactor;
 
+        //! the index of each time step in the computed dts, -1 if not computed
+        PetscInt cflIndex = -1;
+        PetscInt conductionIndex = -1;
+        PetscInt viscousIndex = -1;
+
+        //! batched eos functions used to decode each cell once
+        eos::ThermodynamicBatchFunction computeTemperature;
+        eos::ThermodynamicBatchFunction computeSpeedOfSound;
+        eos::ThermodynamicBatchFunction computeSpecificHeat;
+
         /* thermal conductivity*/
         eos::ThermodynamicTemperatureFunction kFunction;
         /* dynamic viscosity*/
         eos::ThermodynamicTemperatureFunction muFunction;
-        /* specific heat*/
-        eos::ThermodynamicTemperatureFunction specificHeat;
-        /* density */
-        eos::ThermodynamicTemperatureFunction density;
-    };
-    DiffusionTimeStepData diffusionTimeStepData;
-
-    // static function to compute time step for euler advection
-    static double ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
 
-    // static function to compute the conduction based time step
-    static double ComputeConductionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+        //! the id of the temperature aux field used as the initial guess for the temperature, -1 if not available
+        PetscInt temperatureAuxField = -1;
+
+        //! working arrays for the packed cell values
+        std::vector<PetscReal> conserved;
+        std::vector<PetscReal> dx;
+        std::vector<PetscReal> density;
+        std::vector<PetscReal> velocitySum;
+        std::vector<PetscReal> temperatureGuess;
+        std::vector<PetscReal> temperature;
+        std::vector<PetscReal> speedOfSound;
+        std::vector<PetscReal> specificHeat;
+    };
+    TimeStepData timeStepData;
 
-    // static function to compute the conduction based time step
-    static double ComputeViscousDiffusionTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
+    /**
+     * static function to compute the cfl, conduction, and viscous diffusion time steps in a single pass over the cells.  Each cell is decoded once and
+     * shared between the enabled time step kernels.
+     */
+    static void ComputeTimeSteps(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, PetscReal dts[], void* ctx);
 
    public:
     /**
@@ -96,6 +121,11 @@ class NavierStokesTransport : public FlowProcess {
      */
     static PetscErrorCode UpdateAuxTemperatureField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues, const PetscInt aOff[],
                                                     PetscScalar* auxField, void* ctx);
+    /**
+     * Function to compute the temperature field over a batch of cells using the aux temperature as the initial guess. The ctx is an AuxUpdateBatchData.
+     */
+    static PetscErrorCode UpdateAuxTemperatureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, const PetscScalar* conservedValues,
+                                                         const PetscInt aOff[], PetscInt aStride, PetscScalar* auxField, void* ctx);
     /**
      * Function to compute the velocity. This function assumes that the input values will be {"euler"}
      */
@@ -108,6 +138,12 @@ class NavierStokesTransport : public FlowProcess {
     static PetscErrorCode UpdateAuxPressureField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues, const PetscInt aOff[],
                                                  PetscScalar* auxField, void* ctx);
 
+    /**
+     * Function to compute the pressure field over a batch of cells. The ctx is an AuxUpdateBatchData.
+     */
+    static PetscErrorCode UpdateAuxPressureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, const PetscScalar* conservedValues,
+                                                      const PetscInt aOff[], PetscInt aStride, PetscScalar* auxField, void* ctx);
+
     /**
      *
      * public constructor for euler advection
@@ -1,4 +1,5 @@
 #include "soot.hpp"
+#include <algorithm>
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "utilities/petscUtilities.hpp"
 
@@ -9,37 +10,33 @@ ablate::finiteVolume::processes::Soot::Soot(const std::shared_ptr<eos::EOS>& eos
         throw std::invalid_argument("ablate::finiteVolume::processes::Soot only accepts EOS of type eos::TChem");
     }
 
-    // Set the options if provided
+    // Set the integrator options, these use the same names and defaults as the previous PETSc TS
+    integratorOptions.dtInit = dtInitDefault;
     if (options) {
-        PetscOptionsCreate(&petscOptions) >> utilities::PetscUtilities::checkError;
-        options->Fill(petscOptions);
+        // Only these options are used, so do not silently ignore any other PETSc TS option
+        for (const auto& key : options->GetKeys()) {
+            if (std::find(std::begin(SupportedOptions), std::end(SupportedOptions), key) == std::end(SupportedOptions)) {
+                throw std::invalid_argument("ablate::finiteVolume::processes::Soot does not support the option " + key +
+                                            ", only ts_type (sdirk or arkimex), ts_dt, ts_adapt_dt_min, ts_adapt_dt_max, ts_rtol, and ts_atol are used");
+            }
+        }
+
+        const auto tsType = options->Get<std::string>("ts_type", "sdirk");
+        if (tsType == "arkimex") {
+            batchedIntegration = false;
+        } else if (tsType != "sdirk") {
+            throw std::invalid_argument("ablate::finiteVolume::processes::Soot ts_type must be sdirk or arkimex, not " + tsType);
+        }
+        integratorOptions.dtInit = options->Get<PetscReal>("ts_dt", integratorOptions.dtInit);
+        integratorOptions.dtMin = options->Get<PetscReal>("ts_adapt_dt_min", integratorOptions.dtMin);
+        integratorOptions.dtMax = options->Get<PetscReal>("ts_adapt_dt_max", integratorOptions.dtMax);
+        integratorOptions.relativeTolerance = options->Get<PetscReal>("ts_rtol", integratorOptions.relativeTolerance);
+        integratorOptions.absoluteTolerance = options->Get<PetscReal>("ts_atol", integratorOptions.absoluteTolerance);
     }
 
-    // Create a vector and mat for local ode calculation
-    VecCreateSeq(PETSC_COMM_SELF, TotalEquations, &pointData) >> utilities::PetscUtilities::checkError;
-    MatCreateSeqDense(PETSC_COMM_SELF, TotalEquations, TotalEquations, nullptr, &pointJacobian) >> utilities::PetscUtilities::checkError;
-    MatSetFromOptions(pointJacobian) >> utilities::PetscUtilities::checkError;
-
-    /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-          Create timestepping solver context
-          - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
-    TSCreate(PETSC_COMM_SELF, &pointTs) >> utilities::PetscUtilities::checkError;
-    PetscObjectSetOptions((PetscObject)pointTs, petscOptions) >> utilities::PetscUtilities::checkError;
-    TSSetType(pointTs, TSARKIMEX) >> utilities::PetscUtilities::checkError;
-    TSARKIMEXSetFullyImplicit(pointTs, PETSC_TRUE) >> utilities::PetscUtilities::checkError;
-    TSARKIMEXSetType(pointTs, TSARKIMEX4) >> utilities::PetscUtilities::checkError;
-    TSSetRHSFunction(pointTs, nullptr, SinglePointSootChemistryRHS, &pointInformation) >> utilities::PetscUtilities::checkError;
-    TSSetExactFinalTime(pointTs, TS_EXACTFINALTIME_MATCHSTEP) >> utilities::PetscUtilities::checkError;
-
-    // set the adapting control
-    TSSetSolution(pointTs, pointData) >> utilities::PetscUtilities::checkError;
-    TSSetTimeStep(pointTs, dtInitDefault) >> utilities::PetscUtilities::checkError;
-    TSAdapt adapt;
-    TSGetAdapt(pointTs, &adapt) >> utilities::PetscUtilities::checkError;
-    TSAdaptSetStepLimits(adapt, 1e-12, 1E-4) >> utilities::PetscUtilities::checkError; /* Also available with -ts_adapt_dt_min/-ts_adapt_dt_max */
-    TSSetMaxSNESFailures(pointTs, -1) >> utilities::PetscUtilities::checkError;        /* Retry step an unlimited number of times */
-    TSSetFromOptions(pointTs) >> utilities::PetscUtilities::checkError;
-    TSGetTimeStep(pointTs, &dtInit) >> utilities::PetscUtilities::checkError;
+    // Create the integrator used to advance all cells together
+    integrator = std::make_unique<BatchedStiffIntegrator>(
+        TotalEquations, [this](std::size_t numberPoints, const PetscInt points[], const PetscReal y[], PetscReal f[]) { BatchedSootChemistryRHS(numberPoints, points, y, f); }, integratorOptions);
 }
 ablate::finiteVolume::processes::Soot::~Soot() {
     if (sourceDm) {
@@ -48,9 +45,6 @@ ablate::finiteVolume::processes::Soot::~Soot() {
     if (sourceVec) {
         VecDestroy(&sourceVec) >> utilities::PetscUtilities::checkError;
     }
-    if (petscOptions) {
-        utilities::PetscUtilities::PetscOptionsDestroyAndCheck("TChemReactions", &petscOptions);
-    }
     if (pointTs) {
         TSDestroy(&pointTs) >> utilities::PetscUtilities::checkError;
     }
@@ -167,8 +161,13 @@ PetscErrorCode ablate::finiteVolume::processes::Soot::ComputeSootChemistryPreSte
 
     // get an easy reference to the point information
     auto& pointInformation = soot->pointInformation;
+    const auto numberSpecies = (std::size_t)flowDensityYiId.numberComponents;
 
-    // March over each cell
+    // Build the compact list of cells that need to be integrated
+    soot->activeCells.clear();
+    soot->activeState.clear();
+    soot->activeDensity.clear();
+    soot->activeYi.clear();
     for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
         // if there is a cell array, use it, otherwise it is just c
         const PetscInt cell = cellRange.GetPoint(c);
@@ -179,72 +178,82 @@ PetscErrorCode ablate::finiteVolume::processes::Soot::ComputeSootChemistryPreSte
 
         // If a real cell (not ghost)
         if (conserved) {
-            // store the data for the chemistry ts (T, Yi...)
+            // Start with a zero source, only the integrated cells are updated
+            PetscScalar* fieldSource;
+            PetscCall(DMPlexPointLocalRef(soot->sourceDm, cell, sourceArray, &fieldSource));
+            PetscCall(PetscArrayzero(fieldSource, TotalEquations));
+
             PetscReal* temperature;
             PetscCall(DMPlexPointLocalFieldRead(temperatureDm, cell, temperatureField.id, temperatureArray, &temperature));
+            if (*temperature <= soot->thresholdTemperature) {
+                continue;
+            }
+
+            // store the data for the chemistry ode (Yi..., Ndd, T)
+            PetscReal density = conserved[flowEulerId.offset + ablate::finiteVolume::CompressibleFlowFields::RHO];
+            PetscReal pointState[TotalEquations];
+            pointState[ODE_T] = *temperature;
+            pointState[ODE_NDD] = (conserved[flowDensityProgressId.offset] / density) / NddScaling;
+            for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
+                pointState[s] = PetscMin(PetscMax(0.0, conserved[flowDensityYiId.offset + pointInformation.speciesIndex[s]] / density), 1.0);
+            }
+
+            // Without C2H2, soot, or particles every soot rate is zero so the cell can be skipped
+            if (pointState[C2H2] <= 0.0 && pointState[C_s] <= 0.0 && pointState[ODE_NDD] <= 0.0) {
+                continue;
+            }
 
-            if (*temperature > soot->thresholdTemperature) {
-                // get access to the point ode solver
-                PetscScalar* pointArray;
-                PetscCall(VecGetArray(soot->pointData, &pointArray));
-                PetscReal density = conserved[flowEulerId.offset + ablate::finiteVolume::CompressibleFlowFields::RHO];
-                pointInformation.currentDensity = density;
-                pointArray[ODE_T] = *temperature;
-                pointArray[ODE_NDD] = (conserved[flowDensityProgressId.offset] / density) / NddScaling;
-
-                // Fill the yi scratch
-                for (PetscInt s = 0; s < flowDensityYiId.numberComponents; s++) {
-                    pointInformation.yiScratch[s] = PetscMin(PetscMax(0.0, conserved[flowDensityYiId.offset + s] / density), 1.0);
-                }
-
-                for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
-                    pointArray[s] = pointInformation.yiScratch[pointInformation.speciesIndex[s]];
-                }
-
-                // Compute the Cv,mix
-                PetscCall(VecRestoreArray(soot->pointData, &pointArray));
-
-                // Do a soft reset on the ode solver
-                PetscCall(TSSetTime(soot->pointTs, time));
-                PetscCall(TSSetMaxTime(soot->pointTs, time + dt));
-                PetscCall(TSSetTimeStep(soot->pointTs, soot->dtInit));
-                PetscCall(TSSetStepNumber(soot->pointTs, 0));
-
-                // solver for this point
-                PetscCall(TSSolve(soot->pointTs, soot->pointData));
-
-                // Use the updated values to compute the source terms for euler and species transport
-                PetscScalar* fieldSource;
-                PetscCall(DMPlexPointLocalRef(soot->sourceDm, cell, sourceArray, &fieldSource));
-
-                // get the array data again
-                PetscCall(VecGetArray(soot->pointData, &pointArray));
-
-                // store the computed source terms
-                fieldSource[ODE_T] = 0.0;
-                for (PetscInt s = 0; s < TOTAL_ODE_SPECIES; ++s) {
-                    fieldSource[ODE_T] += (conserved[pointInformation.speciesOffset[s]] / density - pointArray[s]) * pointInformation.enthalpyOfFormation[s];
-                    fieldSource[s] = pointArray[s] - conserved[pointInformation.speciesOffset[s]] / density;
-                }
-                // Add in the source term for the change in ndd
-                fieldSource[ODE_NDD] = pointArray[ODE_NDD] * NddScaling - conserved[flowDensityProgressId.offset] / density;
-
-                // Now scale everything by density/dt
-                for (PetscInt i = 0; i < TotalEquations; i++) {
-                    // for constant density problem, d Yi rho/dt = rho * d Yi/dt + Yi*d rho/dt = rho*dYi/dt ~~ rho*(Yi+1 - Y1)/dt
-                    fieldSource[i] *= density / dt;
-                }
-
-                PetscCall(VecRestoreArray(soot->pointData, &pointArray));
-            } else {
-                // Use the updated values to compute the source terms for euler and species transport
-                PetscScalar* fieldSource;
-                PetscCall(DMPlexPointLocalRef(soot->sourceDm, cell, sourceArray, &fieldSource));
-                PetscArrayzero(fieldSource, TotalEquations);
+            soot->activeCells.push_back(cell);
+            soot->activeDensity.push_back(density);
+            soot->activeState.insert(soot->activeState.end(), pointState, pointState + TotalEquations);
+            for (std::size_t s = 0; s < numberSpecies; s++) {
+                soot->activeYi.push_back(PetscMin(PetscMax(0.0, conserved[flowDensityYiId.offset + s] / density), 1.0));
             }
         }
     }
 
+    if (soot->batchedIntegration) {
+        // Advance every active cell together over the flow dt
+        PetscCall(soot->integrator->Solve(soot->activeCells.size(), soot->activeState.data(), time, dt));
+
+        // Finish any cell that failed at the minimum time step with the single point TS
+        for (const auto failedPoint : soot->integrator->GetFailedPoints()) {
+            PetscCall(soot->SinglePointSootChemistrySolve(failedPoint, soot->integrator->GetPointTime(failedPoint), time + dt));
+        }
+    } else {
+        // Advance each active cell on its own with the single point TS
+        for (std::size_t a = 0; a < soot->activeCells.size(); ++a) {
+            PetscCall(soot->SinglePointSootChemistrySolve((PetscInt)a, time, time + dt));
+        }
+    }
+
+    // Use the updated values to compute the source terms for euler and species transport
+    for (std::size_t a = 0; a < soot->activeCells.size(); ++a) {
+        const PetscInt cell = soot->activeCells[a];
+        const PetscReal density = soot->activeDensity[a];
+        const PetscReal* pointArray = soot->activeState.data() + a * TotalEquations;
+
+        const PetscScalar* conserved = nullptr;
+        PetscCall(DMPlexPointGlobalRead(flow.GetSubDomain().GetDM(), cell, solutionArray, &conserved));
+        PetscScalar* fieldSource;
+        PetscCall(DMPlexPointLocalRef(soot->sourceDm, cell, sourceArray, &fieldSource));
+
+        // store the computed source terms
+        fieldSource[ODE_T] = 0.0;
+        for (PetscInt s = 0; s < TOTAL_ODE_SPECIES; ++s) {
+            fieldSource[ODE_T] += (conserved[pointInformation.speciesOffset[s]] / density - pointArray[s]) * pointInformation.enthalpyOfFormation[s];
+            fieldSource[s] = pointArray[s] - conserved[pointInformation.speciesOffset[s]] / density;
+        }
+        // Add in the source term for the change in ndd
+        fieldSource[ODE_NDD] = pointArray[ODE_NDD] * NddScaling - conserved[flowDensityProgressId.offset] / density;
+
+        // Now scale everything by density/dt
+        for (PetscInt i = 0; i < TotalEquations; i++) {
+            // for constant density problem, d Yi rho/dt = rho * d Yi/dt + Yi*d rho/dt = rho*dYi/dt ~~ rho*(Yi+1 - Y1)/dt
+            fieldSource[i] *= density / dt;
+        }
+    }
+
     // cleanup
     flow.RestoreRange(cellRange);
     PetscCall(VecRestoreArray(soot->sourceVec, &sourceArray));
@@ -306,97 +315,162 @@ PetscErrorCode ablate::finiteVolume::processes::Soot::AddSootChemistrySourceToFl
 
     PetscFunctionReturn(0);
 }
-PetscErrorCode ablate::finiteVolume::processes::Soot::SinglePointSootChemistryRHS(TS ts, PetscReal t, Vec xVec, Vec fVec, void* ctx) {
+void ablate::finiteVolume::processes::Soot::BatchedSootChemistryRHS(std::size_t numberPoints, const PetscInt points[], const PetscReal y[], PetscReal f[]) {
+    const std::size_t numberSpecies = pointInformation.yiScratch.size();
+    for (std::size_t p = 0; p < numberPoints; ++p) {
+        // Start from the yi for this cell, the ode species are replaced in the single point rhs
+        std::copy_n(activeYi.data() + points[p] * numberSpecies, numberSpecies, pointInformation.yiScratch.data());
+        SinglePointSootChemistryRHS(activeDensity[points[p]], y + p * TotalEquations, f + p * TotalEquations, pointInformation);
+    }
+}
+
+PetscErrorCode ablate::finiteVolume::processes::Soot::SinglePointSootChemistrySolve(PetscInt activeCell, PetscReal time, PetscReal endTime) {
+    PetscFunctionBeginUser;
+    if (!pointTs) {
+        // Create a vector and mat for local ode calculation
+        PetscCall(VecCreateSeq(PETSC_COMM_SELF, TotalEquations, &pointData));
+        PetscCall(MatCreateSeqDense(PETSC_COMM_SELF, TotalEquations, TotalEquations, nullptr, &pointJacobian));
+
+        // Create timestepping solver context
+        PetscCall(TSCreate(PETSC_COMM_SELF, &pointTs));
+        PetscCall(TSSetType(pointTs, TSARKIMEX));
+        PetscCall(TSARKIMEXSetFullyImplicit(pointTs, PETSC_TRUE));
+        PetscCall(TSARKIMEXSetType(pointTs, TSARKIMEX4));
+        PetscCall(TSSetRHSFunction(pointTs, nullptr, SinglePointSootChemistryTSRHS, this));
+        PetscCall(TSSetExactFinalTime(pointTs, TS_EXACTFINALTIME_MATCHSTEP));
+        PetscCall(TSSetTolerances(pointTs, integratorOptions.absoluteTolerance, nullptr, integratorOptions.relativeTolerance, nullptr));
+
+        // set the adapting control
+        PetscCall(TSSetSolution(pointTs, pointData));
+        TSAdapt adapt;
+        PetscCall(TSGetAdapt(pointTs, &adapt));
+        PetscCall(TSAdaptSetStepLimits(adapt, integratorOptions.dtMin, integratorOptions.dtMax));
+        PetscCall(TSSetMaxSNESFailures(pointTs, -1)); /* Retry step an unlimited number of times */
+
+        // use a finite difference jacobian for the small dense system
+        SNES snes;
+        PetscCall(TSGetSNES(pointTs, &snes));
+        PetscCall(SNESSetJacobian(snes, pointJacobian, pointJacobian, SNESComputeJacobianDefault, nullptr));
+    }
+
+    // copy in the last accepted state from the batched integrator
+    PetscReal* state = activeState.data() + activeCell * TotalEquations;
+    PetscScalar* pointArray;
+    PetscCall(VecGetArray(pointData, &pointArray));
+    std::copy_n(state, TotalEquations, pointArray);
+    PetscCall(VecRestoreArray(pointData, &pointArray));
+
+    // Do a soft reset on the ode solver
+    pointTsActiveCell = activeCell;
+    PetscCall(TSSetTime(pointTs, time));
+    PetscCall(TSSetMaxTime(pointTs, endTime));
+    PetscCall(TSSetTimeStep(pointTs, integratorOptions.dtInit));
+    PetscCall(TSSetStepNumber(pointTs, 0));
+    PetscCall(TSSolve(pointTs, pointData));
+
+    // copy back the result
+    const PetscScalar* resultArray;
+    PetscCall(VecGetArrayRead(pointData, &resultArray));
+    std::copy_n(resultArray, TotalEquations, state);
+    PetscCall(VecRestoreArrayRead(pointData, &resultArray));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::Soot::SinglePointSootChemistryTSRHS(TS ts, PetscReal t, Vec xVec, Vec fVec, void* ctx) {
     PetscFunctionBeginUser;
-    auto pointInfo = (OdePointInformation*)ctx;
+    auto soot = (Soot*)ctx;
 
     // extract the read/write arrays
     const PetscScalar* xArray;
     PetscCall(VecGetArrayRead(xVec, &xArray));
-    PetscCall(VecZeroEntries(fVec));
     PetscScalar* fArray;
     PetscCall(VecGetArray(fVec, &fArray));
 
+    soot->BatchedSootChemistryRHS(1, &soot->pointTsActiveCell, xArray, fArray);
+
+    PetscCall(VecRestoreArrayRead(xVec, &xArray));
+    PetscCall(VecRestoreArray(fVec, &fArray));
+    PetscFunctionReturn(0);
+}
+
+void ablate::finiteVolume::processes::Soot::SinglePointSootChemistryRHS(PetscReal density, const PetscReal xArray[], PetscReal fArray[], OdePointInformation& pointInfo) {
+    std::fill_n(fArray, TotalEquations, 0.0);
+
     // copy over the updated to the scratch variable for now
     PetscReal localOdeValues[TotalEquations];
     for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
         localOdeValues[s] = PetscMax(PetscMin(xArray[s], 1.0), 0.0);
-        pointInfo->yiScratch[pointInfo->speciesIndex[s]] = localOdeValues[s];
+        pointInfo.yiScratch[pointInfo.speciesIndex[s]] = localOdeValues[s];
     }
     localOdeValues[ODE_T] = PetscMax(xArray[ODE_T], 0);
     localOdeValues[ODE_NDD] = PetscMax(xArray[ODE_NDD], 0);
 
     // Add in the Soot Reaction Sources
-    PetscReal SVF = localOdeValues[C_s] * pointInfo->currentDensity / solidCarbonDensity;
+    PetscReal SVF = localOdeValues[C_s] * density / solidCarbonDensity;
 
     // compute ndd that is not scalled
     PetscReal ndd = PetscMax(localOdeValues[ODE_NDD], 0) * NddScaling;
 
     // Total S.A. of soot / unit volume
-    PetscReal SA_V = calculateSurfaceArea_V(localOdeValues[C_s], ndd, pointInfo->currentDensity);
+    PetscReal SA_V = calculateSurfaceArea_V(localOdeValues[C_s], ndd, density);
 
     // Need the Concentrations of C2H2, O2, O, and OH
     // It is unclear in the formulations of the Reaction Rates whether to use to concentration in regards to the total mixture or just the gas phace, There is a difference due to the density relation
     //-> For now we will use the concentration to be the concentration in the gas phase as it makes more physical sense
-    PetscReal C2H2Conc = pointInfo->currentDensity * PetscMax(0, localOdeValues[C2H2]) / pointInfo->mw[C2H2];
-    PetscReal O2Conc = pointInfo->currentDensity * PetscMax(0, localOdeValues[O2]) / pointInfo->mw[O2];
-    PetscReal OConc = pointInfo->currentDensity * PetscMax(0, localOdeValues[O]) / pointInfo->mw[O];
-    PetscReal OHConc = pointInfo->currentDensity * PetscMax(0, localOdeValues[OH]) / pointInfo->mw[OH];
+    PetscReal C2H2Conc = density * PetscMax(0, localOdeValues[C2H2]) / pointInfo.mw[C2H2];
+    PetscReal O2Conc = density * PetscMax(0, localOdeValues[O2]) / pointInfo.mw[O2];
+    PetscReal OConc = density * PetscMax(0, localOdeValues[O]) / pointInfo.mw[O];
+    PetscReal OHConc = density * PetscMax(0, localOdeValues[OH]) / pointInfo.mw[OH];
 
     // Now plug in and solve the Nucleation, Surface Growth, Agglomeration, and Oxidation sources
     PetscReal NucRate = calculateNucleationReactionRate(localOdeValues[ODE_T], C2H2Conc, SVF);
     PetscReal SGRate = calculateSurfaceGrowthReactionRate(localOdeValues[ODE_T], C2H2Conc, SA_V);
 
-    PetscReal AggRate = calculateAgglomerationRate(localOdeValues[C_s], ndd, localOdeValues[ODE_T], pointInfo->currentDensity);
-    PetscReal O2OxRate = calculateO2OxidationRate(localOdeValues[C_s], ndd, O2Conc, pointInfo->currentDensity, localOdeValues[ODE_T], SA_V);
+    PetscReal AggRate = calculateAgglomerationRate(localOdeValues[C_s], ndd, localOdeValues[ODE_T], density);
+    PetscReal O2OxRate = calculateO2OxidationRate(localOdeValues[C_s], ndd, O2Conc, density, localOdeValues[ODE_T], SA_V);
     PetscReal OOxRate = calculateOOxidationRate(OConc, localOdeValues[ODE_T], SA_V, SVF);
     PetscReal OHOxRate = calculateOHOxidationRate(OHConc, localOdeValues[ODE_T], SA_V, SVF);
 
     // Now Add these rates correctly to the appropriate species sources (solving Yidot, i.e. also have to divide by the total density.
     // Keep in mind all these rates are kmol/m^3, need to convert to kg/m^3 for each appropriate species as well!
-    PetscReal O_totDens = 1. / pointInfo->currentDensity;
+    PetscReal O_totDens = 1. / density;
     // C2H2 (Loss from Nucleation and Surface Growth)
-    fArray[C2H2] += O_totDens * pointInfo->mw[C2H2] * (-NucRate - SGRate);
+    fArray[C2H2] += O_totDens * pointInfo.mw[C2H2] * (-NucRate - SGRate);
     // O ( Loss from O Oxidation)
-    fArray[O] += O_totDens * pointInfo->mw[O] * (-OOxRate);
+    fArray[O] += O_totDens * pointInfo.mw[O] * (-OOxRate);
     // O2 (Loss from O2 Oxidation)
-    fArray[O2] += O_totDens * pointInfo->mw[O2] * (-.5 * O2OxRate);
+    fArray[O2] += O_totDens * pointInfo.mw[O2] * (-.5 * O2OxRate);
     // OH ( Loss from OH Oxidation)
-    fArray[OH] += O_totDens * pointInfo->mw[OH] * (-OHOxRate);
+    fArray[OH] += O_totDens * pointInfo.mw[OH] * (-OHOxRate);
     // CO ( Generation From All Oxidations)
-    fArray[CO] += O_totDens * pointInfo->mw[CO] * (OHOxRate + O2OxRate + OOxRate);
+    fArray[CO] += O_totDens * pointInfo.mw[CO] * (OHOxRate + O2OxRate + OOxRate);
     // H2 ( Generation From Nucleation and SG)
-    fArray[H2] += O_totDens * pointInfo->mw[H2] * (NucRate + SGRate);
+    fArray[H2] += O_totDens * pointInfo.mw[H2] * (NucRate + SGRate);
     // H (Generation from OH Oxidation)
-    fArray[H] += O_totDens * pointInfo->mw[H] * (OHOxRate);
+    fArray[H] += O_totDens * pointInfo.mw[H] * (OHOxRate);
 
     // Now Onto The Solid Carbon and Ndd source terms
     // SC ( generation from Surface growth and Nucleation and loss from all oxidation's)
-    fArray[C_s] += O_totDens * pointInfo->mw[C_s] * (2 * (NucRate + SGRate) - O2OxRate - OOxRate - OHOxRate);
+    fArray[C_s] += O_totDens * pointInfo.mw[C_s] * (2 * (NucRate + SGRate) - O2OxRate - OOxRate - OHOxRate);
     fArray[ODE_NDD] += O_totDens * (NdNuclationConversionTerm * NucRate - AggRate);
     fArray[ODE_NDD] /= NddScaling;
 
     // compute the specific heat at constant volume.  We set this up to allow density to be the only conserved
     PetscReal cv;
-    pointInfo->specificHeatConstantVolumeFunction.function(
-        &(pointInfo->currentDensity), pointInfo->yiScratch.data(), localOdeValues[ODE_T], &cv, pointInfo->specificHeatConstantVolumeFunction.context.get());
+    pointInfo.specificHeatConstantVolumeFunction.function(&density, pointInfo.yiScratch.data(), localOdeValues[ODE_T], &cv, pointInfo.specificHeatConstantVolumeFunction.context.get());
 
     // compute the speciesSensibleEnthalpy and turn into internal energy
-    pointInfo->speciesSensibleEnthalpyFunction.function(
-        &(pointInfo->currentDensity), pointInfo->yiScratch.data(), localOdeValues[ODE_T], pointInfo->speciesSensibleEnthalpyScratch.data(), pointInfo->speciesSensibleEnthalpyFunction.context.get());
+    pointInfo.speciesSensibleEnthalpyFunction.function(
+        &density, pointInfo.yiScratch.data(), localOdeValues[ODE_T], pointInfo.speciesSensibleEnthalpyScratch.data(), pointInfo.speciesSensibleEnthalpyFunction.context.get());
 
     // compute the temperature source term
     for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
-        fArray[ODE_T] += fArray[s] * (pointInfo->speciesSensibleEnthalpyScratch[pointInfo->speciesIndex[s]] + pointInfo->enthalpyOfFormation[s] - RUNIV * 1.0e3 / pointInfo->mw[s]);
+        fArray[ODE_T] += fArray[s] * (pointInfo.speciesSensibleEnthalpyScratch[pointInfo.speciesIndex[s]] + pointInfo.enthalpyOfFormation[s] - RUNIV * 1.0e3 / pointInfo.mw[s]);
     }
     fArray[ODE_T] /= -cv;
-
-    PetscCall(VecRestoreArrayRead(xVec, &xArray));
-    PetscCall(VecRestoreArray(fVec, &fArray));
-    PetscFunctionReturn(0);
 }
 
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::Soot, "Soot only reactions", ARG(ablate::eos::EOS, "eos", "the tChem eos"),
-         OPT(ablate::parameters::Parameters, "options", "any PETSc options for the chemistry ts"),
+         OPT(ablate::parameters::Parameters, "options", "the chemistry integrator options (ts_type sdirk or arkimex, ts_dt, ts_adapt_dt_min, ts_adapt_dt_max, ts_rtol, ts_atol)"),
          OPT(double, "thresholdTemperature", "set a minimum temperature for the chemical kinetics ode integration"));
@@ -1,6 +1,9 @@
 #ifndef ABLATELIBRARY_SOOT_HPP
 #define ABLATELIBRARY_SOOT_HPP
 
+#include <memory>
+#include <string>
+#include "batchedStiffIntegrator.hpp"
 #include "eos/tChem.hpp"
 #include "process.hpp"
 #include "utilities/constants.hpp"
@@ -20,18 +23,12 @@ class Soot : public Process {
     // create a separate vec to hold the sources
     Vec sourceVec = nullptr;
 
-    // Petsc options specific to the chemTs. These may be null by default
-    PetscOptions petscOptions = nullptr;
-
     // the eos used to species the species and compute properties
     std::shared_ptr<eos::TChem> eos;
 
     // store the default dtInit
     inline const static PetscReal dtInitDefault = 1E-6;
 
-    // store the dtInit, this may be different from default if set with petsc options
-    PetscReal dtInit = dtInitDefault;
-
     // store an optional threshold temperature.  Only compute the reactions if the temperature is above thresholdTemperature
     double thresholdTemperature = 0.0;
 
@@ -50,15 +47,32 @@ class Soot : public Process {
     // compute the number of ode species
     inline static const PetscInt TotalEquations = TOTAL_ODE_SPECIES + 2;
 
-    // Hold the single point TS
+    // the only options used by the integrators
+    inline static const std::string SupportedOptions[] = {"ts_type", "ts_dt", "ts_adapt_dt_min", "ts_adapt_dt_max", "ts_rtol", "ts_atol"};
+
+    // Advance every active cell's ode together
+    std::unique_ptr<BatchedStiffIntegrator> integrator;
+    BatchedStiffIntegrator::Options integratorOptions;
+
+    // use the batched integrator (ts_type sdirk), otherwise every cell is integrated with the pointTs (ts_type arkimex)
+    bool batchedIntegration = true;
+
+    // The single point TS used for every cell with ts_type arkimex, or any cell the batched integrator could not integrate.  These are only created if needed.
     TS pointTs = nullptr;
     Vec pointData = nullptr;
     Mat pointJacobian = nullptr;
 
+    // the index in the active cell list of the cell being integrated with the pointTs
+    PetscInt pointTsActiveCell = -1;
+
+    // The compact list of cells being integrated this step, with their ode state, density, and full yi
+    std::vector<PetscInt> activeCells;
+    std::vector<PetscReal> activeState;
+    std::vector<PetscReal> activeDensity;
+    std::vector<PetscReal> activeYi;
+
     // Store a struct with the ode point information
     struct OdePointInformation {
-        // pass the current density into the ode solver
-        PetscReal currentDensity;
         // hold a vector of all yi for scratch to allow
         std::vector<PetscReal> yiScratch;
 
@@ -84,8 +98,36 @@ class Soot : public Process {
         std::array<PetscReal, TOTAL_ODE_SPECIES> mw;
     };
     OdePointInformation pointInformation;
+
+    /**
+     * Private function to compute the soot chemistry rhs for a single point.  The yiScratch must hold the yi for this point.
+     * @param density
+     * @param x the ode state (ode species, scaled ndd, T)
+     * @param f the ode rhs
+     * @param pointInfo
+     */
+    static void SinglePointSootChemistryRHS(PetscReal density, const PetscReal x[], PetscReal f[], OdePointInformation &pointInfo);
+
+    /**
+     * Compute the soot chemistry rhs for a batch of active cells
+     * @param numberPoints
+     * @param points the index of each point in the active cell list
+     * @param y
+     * @param f
+     */
+    void BatchedSootChemistryRHS(std::size_t numberPoints, const PetscInt points[], const PetscReal y[], PetscReal f[]);
+
+    /**
+     * Integrate a single active cell with the pointTs, used for ts_type arkimex or when the batched integrator fails for this cell
+     * @param activeCell the index in the active cell list
+     * @param time the start time, or the time reached by the batched integrator
+     * @param endTime
+     * @return
+     */
+    PetscErrorCode SinglePointSootChemistrySolve(PetscInt activeCell, PetscReal time, PetscReal endTime);
+
     /**
-     * Private function to integrate single point soot chemistry in time
+     * Private function to integrate single point soot chemistry in time with the pointTs
      * @param ts
      * @param t
      * @param X
@@ -93,7 +135,7 @@ class Soot : public Process {
      * @param ptr
      * @return
      */
-    static PetscErrorCode SinglePointSootChemistryRHS(TS ts, PetscReal t, Vec X, Vec F, void *ptr);
+    static PetscErrorCode SinglePointSootChemistryTSRHS(TS ts, PetscReal t, Vec X, Vec F, void *ptr);
 
     /**
      * Add the pre computed soot source to the flow
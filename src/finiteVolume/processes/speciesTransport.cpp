@@ -35,11 +35,15 @@ ablate::finiteVolume::processes::SpeciesTransport::SpeciesTransport(std::shared_
 void ablate::finiteVolume::processes::SpeciesTransport::Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) {
     if (!eos->GetSpeciesVariables().empty()) {
         if (fluxCalculator) {
-            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::DENSITY_YI_FIELD, {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD}, {});
+            flow.RegisterRHSFunction(
+                AdvectionFlux, &advectionData, CompressibleFlowFields::DENSITY_YI_FIELD, {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD}, {}, eos->IsThreadSafe());
             advectionData.computeTemperature = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
             advectionData.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
             advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
             advectionData.computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
+
+            // share the decoded face state with any other advection process using this eos/flux calculator
+            advectionData.faceState = flow.GetAdvectionFaceState(eos, fluxCalculator);
         }
 
         if (transportModel) {
@@ -261,75 +265,44 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::AdvectionFlux(
     PetscFunctionBeginUser;
     auto eulerAdvectionData = (AdvectionData *)ctx;
 
-    // Compute the norm
-    PetscReal norm[3];
-    utilities::MathUtilities::NormVector(dim, fg->normal, norm);
-    const PetscReal areaMag = utilities::MathUtilities::MagVector(dim, fg->normal);
-
     const int EULER_FIELD = 0;
     const int YI_FIELD = 1;
 
-    // Decode the left and right states
-    PetscReal densityL;
-    PetscReal normalVelocityL;
-    PetscReal velocityL[3];
-    PetscReal aL;
-    PetscReal pL;
-    // decode the left side
-    {
-        densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureL;
-
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
-
-        // Get the velocity in this direction
-        normalVelocityL = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityL[d] = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityL;
-            normalVelocityL += velocityL[d] * norm[d];
-        }
-
-        PetscCall(eulerAdvectionData->computeSpeedOfSound.function(fieldL, temperatureL, &aL, eulerAdvectionData->computeSpeedOfSound.context.get()));
-        PetscCall(eulerAdvectionData->computePressure.function(fieldL, temperatureL, &pL, eulerAdvectionData->computePressure.context.get()));
-    }
-
-    PetscReal densityR;
-    PetscReal normalVelocityR;
-    PetscReal velocityR[3];
-    PetscReal aR;
-    PetscReal pR;
-    {  // decode right state
-        densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureR;
-
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
-
-        // Get the velocity in this direction
-        normalVelocityR = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityR[d] = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityR;
-            normalVelocityR += velocityR[d] * norm[d];
-        }
-
-        PetscCall(eulerAdvectionData->computeSpeedOfSound.function(fieldR, temperatureR, &aR, eulerAdvectionData->computeSpeedOfSound.context.get()));
-        PetscCall(eulerAdvectionData->computePressure.function(fieldR, temperatureR, &pR, eulerAdvectionData->computePressure.context.get()));
+    // use the shared face state when available, otherwise decode the left and right states
+    AdvectionFaceState::State localState;
+    const AdvectionFaceState::State *state = &localState;
+    if (eulerAdvectionData->faceState) {
+        state = &eulerAdvectionData->faceState->GetState();
+    } else {
+        PetscCall(AdvectionFaceState::DecodeFace(dim,
+                                                 fg,
+                                                 uOff[EULER_FIELD],
+                                                 fieldL,
+                                                 fieldR,
+                                                 eulerAdvectionData->computeTemperature,
+                                                 eulerAdvectionData->computeInternalEnergy,
+                                                 eulerAdvectionData->computeSpeedOfSound,
+                                                 eulerAdvectionData->computePressure,
+                                                 eulerAdvectionData->fluxCalculatorFunction,
+                                                 eulerAdvectionData->fluxCalculatorCtx,
+                                                 localState));
     }
 
     // get the face values
-    PetscReal massFlux;
+    const PetscReal massFlux = state->massFlux;
+    const PetscReal areaMag = state->areaMag;
 
-    if (eulerAdvectionData->fluxCalculatorFunction(eulerAdvectionData->fluxCalculatorCtx, normalVelocityL, aL, densityL, pL, normalVelocityR, aR, densityR, pR, &massFlux, nullptr) ==
-        fluxCalculator::LEFT) {
+    if (state->direction == fluxCalculator::LEFT) {
         // march over each gas species
         for (PetscInt sp = 0; sp < eulerAdvectionData->numberSpecies; sp++) {
             // Note: there is no density in the flux because uR and UL are density*yi
-            flux[sp] = (massFlux * fieldL[uOff[YI_FIELD] + sp] / densityL) * areaMag;
+            flux[sp] = (massFlux * fieldL[uOff[YI_FIELD] + sp] / state->densityL) * areaMag;
         }
     } else {
         // march over each gas species
         for (PetscInt sp = 0; sp < eulerAdvectionData->numberSpecies; sp++) {
             // Note: there is no density in the flux because uR and UL are density*yi
-            flux[sp] = (massFlux * fieldR[uOff[YI_FIELD] + sp] / densityR) * areaMag;
+            flux[sp] = (massFlux * fieldR[uOff[YI_FIELD] + sp] / state->densityR) * areaMag;
         }
     }
 
@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_SPECIESTRANSPORT_HPP
 
 #include "eos/transport/transportModel.hpp"
+#include "finiteVolume/advectionFaceState.hpp"
 #include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
 #include "flowProcess.hpp"
 
@@ -27,6 +28,9 @@ class SpeciesTransport : public FlowProcess {
         /* store method used for flux calculator */
         ablate::finiteVolume::fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction;
         void* fluxCalculatorCtx;
+
+        /* optional shared face state, when not set the face is decoded in the flux function */
+        std::shared_ptr<ablate::finiteVolume::AdvectionFaceState> faceState = nullptr;
     };
     AdvectionData advectionData;
 
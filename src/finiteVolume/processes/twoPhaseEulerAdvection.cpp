@@ -1,5 +1,6 @@
 #include "twoPhaseEulerAdvection.hpp"
 
+#include <algorithm>
 #include <utility>
 #include "eos/perfectGas.hpp"
 #include "eos/stiffenedGas.hpp"
@@ -231,7 +232,8 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Setup(ablate::fini
     // Create the decoder based upon the eoses
     decoder = CreateTwoPhaseDecoder(flow.GetSubDomain().GetDimensions(), eosGas, eosLiquid);
 
-    // Currently, no option for species advection
+    // Currently, no option for species advection.  Each face is decoded once and shared by the euler and vf fluxes
+    flow.RegisterFaceStateFunction(ComputeTwoPhaseFaceState, this, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
     flow.RegisterRHSFunction(CompressibleFlowComputeEulerFlux, this, CompressibleFlowFields::EULER_FIELD, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
     flow.RegisterRHSFunction(CompressibleFlowComputeVFFlux, this, DENSITY_VF_FIELD, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
     flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl");
@@ -241,15 +243,19 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Setup(ablate::fini
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::VELOCITY_FIELD)) {
         flow.RegisterAuxFieldUpdate(UpdateAuxVelocityField2Gas, nullptr, std::vector<std::string>{CompressibleFlowFields::VELOCITY_FIELD}, {CompressibleFlowFields::EULER_FIELD});
     }
+    // the temperature and pressure are updated from a single decode of each cell
+    std::vector<std::string> auxTemperaturePressureFields;
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
-        // add in aux update variables
-        flow.RegisterAuxFieldUpdate(
-            UpdateAuxTemperatureField2Gas, this, std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD}, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD});
+        auxTemperatureIndex = (PetscInt)auxTemperaturePressureFields.size();
+        auxTemperaturePressureFields.push_back(CompressibleFlowFields::TEMPERATURE_FIELD);
     }
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD)) {
+        auxPressureIndex = (PetscInt)auxTemperaturePressureFields.size();
+        auxTemperaturePressureFields.push_back(CompressibleFlowFields::PRESSURE_FIELD);
+    }
+    if (!auxTemperaturePressureFields.empty()) {
         // add in aux update variables
-        flow.RegisterAuxFieldUpdate(
-            UpdateAuxPressureField2Gas, this, std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD}, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD});
+        flow.RegisterAuxFieldUpdate(UpdateAuxTemperaturePressureField2Gas, this, auxTemperaturePressureFields, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD});
     }
 }
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::MultiphaseFlowPreStage(TS flowTs, ablate::solver::Solver &solver, PetscReal stagetime) {
@@ -282,8 +288,15 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Multipha
     norm[1] = 1;
     norm[2] = 1;
 
+    // size up the warm start for every cell in the dm, the faces look up the guess by cell
+    PetscInt cStart, cEnd;
+    PetscCall(DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd));
+    preStageDecodeGuessCellStart = cStart;
+    preStageDecodeGuess.resize((cEnd - cStart) * DECODE_GUESS_SIZE, 0.0);
+
     for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
         const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
+        PetscReal *guess = preStageDecodeGuess.data() + (cell - cStart) * DECODE_GUESS_SIZE;
         PetscScalar *allFields = nullptr;
         DMPlexPointLocalRef(dm, cell, flowArray, &allFields) >> utilities::PetscUtilities::checkError;
         auto density = allFields[ablate::finiteVolume::CompressibleFlowFields::RHO];
@@ -307,8 +320,15 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Multipha
         PetscReal p;  // pressure equilibrium
         PetscReal t;
         PetscReal alpha;
+        if (guess[0] > 0.0) {
+            decoder->SetInitialGuess(guess);
+        }
         decoder->DecodeTwoPhaseEulerState(
             dim, uOff, allFields, norm, &density, &densityG, &densityL, &normalVelocity, velocity, &internalEnergy, &internalEnergyG, &internalEnergyL, &aG, &aL, &MG, &ML, &p, &t, &alpha);
+        guess[0] = densityG;
+        guess[1] = densityL;
+        guess[2] = internalEnergyG;
+        guess[3] = internalEnergyL;
         // maybe save other values for use later, would interpolation to the face be the same as calculating at face?
         allFields[uOff[0]] = alpha;  // sets volumeFraction field, does every iteration of time step (euler=1, rk=4)
     }
@@ -379,86 +399,67 @@ double ablate::finiteVolume::processes::TwoPhaseEulerAdvection::ComputeCflTimeSt
     return dtMin;
 }
 
+const PetscReal *ablate::finiteVolume::processes::TwoPhaseEulerAdvection::GetPreStageDecodeGuess(PetscInt cell) const {
+    const auto index = (std::size_t)(cell - preStageDecodeGuessCellStart) * DECODE_GUESS_SIZE;
+    if (cell < preStageDecodeGuessCellStart || index >= preStageDecodeGuess.size() || preStageDecodeGuess[index] <= 0.0) {
+        return nullptr;
+    }
+    return preStageDecodeGuess.data() + index;
+}
+
+PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::ComputeTwoPhaseFaceState(PetscInt dim, const PetscFVFaceGeom *fg, PetscInt leftCell, PetscInt rightCell,
+                                                                                                 const PetscInt *uOff, const PetscScalar *fieldL, const PetscScalar *fieldR, const PetscInt *aOff,
+                                                                                                 const PetscScalar *auxL, const PetscScalar *auxR, void *ctx) {
+    PetscFunctionBeginUser;
+    auto twoPhaseEulerAdvection = (TwoPhaseEulerAdvection *)ctx;
+    auto &faceState = twoPhaseEulerAdvection->faceState;
+
+    // Compute the norm of cell face
+    NormVector(dim, fg->normal, faceState.norm);
+    faceState.areaMag = MagVector(dim, fg->normal);
+
+    // Decode left and right states, warm starting each from the pre stage decode of the cell on that side
+    if (auto guess = twoPhaseEulerAdvection->GetPreStageDecodeGuess(leftCell)) {
+        twoPhaseEulerAdvection->decoder->SetInitialGuess(guess);
+    }
+    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim, uOff, fieldL, faceState.norm, faceState.left);
+    if (auto guess = twoPhaseEulerAdvection->GetPreStageDecodeGuess(rightCell)) {
+        twoPhaseEulerAdvection->decoder->SetInitialGuess(guess);
+    }
+    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim, uOff, fieldR, faceState.norm, faceState.right);
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CompressibleFlowComputeEulerFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt *uOff, const PetscScalar *fieldL,
                                                                                                          const PetscScalar *fieldR, const PetscInt *aOff, const PetscScalar *auxL,
                                                                                                          const PetscScalar *auxR, PetscScalar *flux, void *ctx) {
     PetscFunctionBeginUser;
     auto twoPhaseEulerAdvection = (TwoPhaseEulerAdvection *)ctx;
-    // Compute the norm of cell face
-    PetscReal norm[3];
-    NormVector(dim, fg->normal, norm);
-    const PetscReal areaMag = MagVector(dim, fg->normal);
-
-    // Decode left and right states
-    PetscReal densityL;
-    PetscReal densityG_L;
-    PetscReal densityL_L;
-    PetscReal normalVelocityL;  // uniform velocity in cell
-    PetscReal velocityL[3];
-    PetscReal internalEnergyL;
-    PetscReal internalEnergyG_L;
-    PetscReal internalEnergyL_L;
-    PetscReal aG_L;
-    PetscReal aL_L;
-    PetscReal MG_L;
-    PetscReal ML_L;
-    PetscReal pL;  // pressure equilibrium
-    PetscReal tL;
-    PetscReal alphaL;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldL,
-                                                              norm,
-                                                              &densityL,
-                                                              &densityG_L,
-                                                              &densityL_L,
-                                                              &normalVelocityL,
-                                                              velocityL,
-                                                              &internalEnergyL,
-                                                              &internalEnergyG_L,
-                                                              &internalEnergyL_L,
-                                                              &aG_L,
-                                                              &aL_L,
-                                                              &MG_L,
-                                                              &ML_L,
-                                                              &pL,
-                                                              &tL,
-                                                              &alphaL);
-
-    PetscReal densityR;
-    PetscReal densityG_R;
-    PetscReal densityL_R;
-    PetscReal normalVelocityR;
-    PetscReal velocityR[3];
-    PetscReal internalEnergyR;
-    PetscReal internalEnergyG_R;
-    PetscReal internalEnergyL_R;
-    PetscReal aG_R;
-    PetscReal aL_R;
-    PetscReal MG_R;
-    PetscReal ML_R;
-    PetscReal pR;
-    PetscReal tR;
-    PetscReal alphaR;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldR,
-                                                              norm,
-                                                              &densityR,
-                                                              &densityG_R,
-                                                              &densityL_R,
-                                                              &normalVelocityR,
-                                                              velocityR,
-                                                              &internalEnergyR,
-                                                              &internalEnergyG_R,
-                                                              &internalEnergyL_R,
-                                                              &aG_R,
-                                                              &aL_R,
-                                                              &MG_R,
-                                                              &ML_R,
-                                                              &pR,
-                                                              &tR,
-                                                              &alphaR);
+    // Get the decoded left and right states for this face
+    const auto &faceState = twoPhaseEulerAdvection->faceState;
+    const PetscReal areaMag = faceState.areaMag;
+
+    const PetscReal densityG_L = faceState.left.densityG;
+    const PetscReal densityL_L = faceState.left.densityL;
+    const PetscReal normalVelocityL = faceState.left.normalVelocity;
+    const PetscReal *velocityL = faceState.left.velocity;
+    const PetscReal internalEnergyG_L = faceState.left.internalEnergyG;
+    const PetscReal internalEnergyL_L = faceState.left.internalEnergyL;
+    const PetscReal aG_L = faceState.left.aG;
+    const PetscReal aL_L = faceState.left.aL;
+    const PetscReal pL = faceState.left.p;
+    const PetscReal alphaL = faceState.left.alpha;
+
+    const PetscReal densityG_R = faceState.right.densityG;
+    const PetscReal densityL_R = faceState.right.densityL;
+    const PetscReal normalVelocityR = faceState.right.normalVelocity;
+    const PetscReal *velocityR = faceState.right.velocity;
+    const PetscReal internalEnergyG_R = faceState.right.internalEnergyG;
+    const PetscReal internalEnergyL_R = faceState.right.internalEnergyL;
+    const PetscReal aG_R = faceState.right.aG;
+    const PetscReal aL_R = faceState.right.aL;
+    const PetscReal pR = faceState.right.p;
+    const PetscReal alphaR = faceState.right.alpha;
 
     // get the face values
     PetscReal massFluxGG;
@@ -626,81 +627,21 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     PetscFunctionBeginUser;
     auto twoPhaseEulerAdvection = (TwoPhaseEulerAdvection *)ctx;
 
-    // Compute the norm
-    PetscReal norm[3];
-    NormVector(dim, fg->normal, norm);
-    const PetscReal areaMag = MagVector(dim, fg->normal);
+    // Get the decoded left and right states for this face
+    const auto &faceState = twoPhaseEulerAdvection->faceState;
+    const PetscReal areaMag = faceState.areaMag;
 
-    //     Decode left and right states
-    PetscReal densityL;
-    PetscReal densityG_L;
-    PetscReal densityL_L;
-    PetscReal normalVelocityL;  // uniform velocity in cell
-    PetscReal velocityL[3];
-    PetscReal internalEnergyL;
-    PetscReal internalEnergyG_L;
-    PetscReal internalEnergyL_L;
-    PetscReal aG_L;
-    PetscReal aL_L;
-    PetscReal MG_L;
-    PetscReal ML_L;
-    PetscReal pL;  // pressure equilibrium
-    PetscReal tL;
-    PetscReal alphaL;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldL,
-                                                              norm,
-                                                              &densityL,
-                                                              &densityG_L,
-                                                              &densityL_L,
-                                                              &normalVelocityL,
-                                                              velocityL,
-                                                              &internalEnergyL,
-                                                              &internalEnergyG_L,
-                                                              &internalEnergyL_L,
-                                                              &aG_L,
-                                                              &aL_L,
-                                                              &MG_L,
-                                                              &ML_L,
-                                                              &pL,
-                                                              &tL,
-                                                              &alphaL);
-
-    PetscReal densityR;
-    PetscReal densityG_R;
-    PetscReal densityL_R;
-    PetscReal normalVelocityR;
-    PetscReal velocityR[3];
-    PetscReal internalEnergyR;
-    PetscReal internalEnergyG_R;
-    PetscReal internalEnergyL_R;
-    PetscReal aG_R;
-    PetscReal aL_R;
-    PetscReal MG_R;
-    PetscReal ML_R;
-    PetscReal pR;
-    PetscReal tR;
-    PetscReal alphaR;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldR,
-                                                              norm,
-                                                              &densityR,
-                                                              &densityG_R,
-                                                              &densityL_R,
-                                                              &normalVelocityR,
-                                                              velocityR,
-                                                              &internalEnergyR,
-                                                              &internalEnergyG_R,
-                                                              &internalEnergyL_R,
-                                                              &aG_R,
-                                                              &aL_R,
-                                                              &MG_R,
-                                                              &ML_R,
-                                                              &pR,
-                                                              &tR,
-                                                              &alphaR);
+    const PetscReal densityG_L = faceState.left.densityG;
+    const PetscReal normalVelocityL = faceState.left.normalVelocity;
+    const PetscReal aG_L = faceState.left.aG;
+    const PetscReal pL = faceState.left.p;
+    const PetscReal alphaL = faceState.left.alpha;
+
+    const PetscReal densityG_R = faceState.right.densityG;
+    const PetscReal normalVelocityR = faceState.right.normalVelocity;
+    const PetscReal aG_R = faceState.right.aG;
+    const PetscReal pR = faceState.right.p;
+    const PetscReal alphaR = faceState.right.alpha;
 
     // get the face values
     PetscReal massFlux;
@@ -733,6 +674,45 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::UpdateAu
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::UpdateAuxTemperaturePressureField2Gas(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[],
+                                                                                                              PetscInt uStride, const PetscScalar *conservedValues, const PetscInt aOff[],
+                                                                                                              PetscInt aStride, PetscScalar *auxField, void *ctx) {
+    PetscFunctionBeginUser;
+    auto twoPhaseEulerAdvection = (TwoPhaseEulerAdvection *)ctx;
+
+    // For cell center, the norm is unity
+    PetscReal norm[3];
+    norm[0] = 1;
+    norm[1] = 1;
+    norm[2] = 1;
+
+    // size up the warm start for each cell, the cell range is the same for every update
+    auto &decodeGuess = twoPhaseEulerAdvection->auxUpdateDecodeGuess;
+    decodeGuess.resize(numberCells * DECODE_GUESS_SIZE, 0.0);
+
+    DecodedState state{};
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        PetscReal *guess = decodeGuess.data() + c * DECODE_GUESS_SIZE;
+        if (guess[0] > 0.0) {
+            twoPhaseEulerAdvection->decoder->SetInitialGuess(guess);
+        }
+        twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim, uOff, conservedValues + c * uStride, norm, state);
+        guess[0] = state.densityG;
+        guess[1] = state.densityL;
+        guess[2] = state.internalEnergyG;
+        guess[3] = state.internalEnergyL;
+
+        PetscScalar *cellAux = auxField + c * aStride;
+        if (twoPhaseEulerAdvection->auxTemperatureIndex >= 0) {
+            cellAux[aOff[twoPhaseEulerAdvection->auxTemperatureIndex]] = state.T;
+        }
+        if (twoPhaseEulerAdvection->auxPressureIndex >= 0) {
+            cellAux[aOff[twoPhaseEulerAdvection->auxPressureIndex]] = state.p;
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::UpdateAuxTemperatureField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[],
                                                                                                       const PetscScalar *conservedValues, const PetscInt aOff[], PetscScalar *auxField, void *ctx) {
     PetscFunctionBeginUser;
@@ -1165,7 +1145,37 @@ ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffenedGa
     liquidComputeInternalEnergy = eosLiquid->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, {fakeEulerField});
     liquidComputeSpeedOfSound = eosLiquid->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, {fakeEulerField});
     liquidComputePressure = eosLiquid->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, {fakeEulerField});
+
+    // create the solver used for every decode, [rho1, rho2, e1, e2]
+    VecCreate(PETSC_COMM_SELF, &x) >> utilities::PetscUtilities::checkError;
+    VecSetSizes(x, PETSC_DECIDE, DECODE_GUESS_SIZE) >> utilities::PetscUtilities::checkError;
+    VecSetFromOptions(x) >> utilities::PetscUtilities::checkError;
+    VecDuplicate(x, &r) >> utilities::PetscUtilities::checkError;
+
+    MatCreate(PETSC_COMM_SELF, &J) >> utilities::PetscUtilities::checkError;
+    MatSetSizes(J, PETSC_DECIDE, PETSC_DECIDE, DECODE_GUESS_SIZE, DECODE_GUESS_SIZE) >> utilities::PetscUtilities::checkError;
+    MatSetFromOptions(J) >> utilities::PetscUtilities::checkError;
+    MatSetUp(J) >> utilities::PetscUtilities::checkError;
+
+    SNESCreate(PETSC_COMM_SELF, &snes) >> utilities::PetscUtilities::checkError;
+    SNESSetFunction(snes, r, FormFunctionStiff, &decodeDataStruct) >> utilities::PetscUtilities::checkError;
+    SNESSetJacobian(snes, J, J, FormJacobianStiff, &decodeDataStruct) >> utilities::PetscUtilities::checkError;
+    SNESSetTolerances(snes, 1E-8, 1E-12, 1E-8, 100, 1000) >> utilities::PetscUtilities::checkError;  // refine relative tolerance for more accurate pressure value
+    SNESSetFromOptions(snes) >> utilities::PetscUtilities::checkError;
+}
+
+ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffenedGasDecoder::~StiffenedGasStiffenedGasDecoder() {
+    SNESDestroy(&snes);
+    VecDestroy(&x);
+    VecDestroy(&r);
+    MatDestroy(&J);
 }
+
+void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffenedGasDecoder::SetInitialGuess(const PetscReal *guess) {
+    std::copy_n(guess, DECODE_GUESS_SIZE, initialGuess);
+    initialGuessSet = true;
+}
+
 void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffenedGasDecoder::DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues,
                                                                                                                         const PetscReal *normal, PetscReal *density, PetscReal *densityG,
                                                                                                                         PetscReal *densityL, PetscReal *normalVelocity, PetscReal *velocity,
@@ -1198,22 +1208,7 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffe
     PetscReal gamma1 = eosGas->GetSpecificHeatRatio();
     PetscReal gamma2 = eosLiquid->GetSpecificHeatRatio();
 
-    SNES snes;
-    Vec x, r;
-    Mat J;
-    VecCreate(PETSC_COMM_SELF, &x);
-    VecSetSizes(x, PETSC_DECIDE, 4);
-    VecSetFromOptions(x);
-    VecSet(x, (*density));  // set initial guess to conserved density, [rho1, rho2, e1, e2] = [rho, rho, rho, rho]
-    VecDuplicate(x, &r);
-
-    MatCreate(PETSC_COMM_SELF, &J);
-    MatSetSizes(J, PETSC_DECIDE, PETSC_DECIDE, 4, 4);
-    MatSetFromOptions(J);
-    MatSetUp(J);
-
-    SNESCreate(PETSC_COMM_SELF, &snes);
-    DecodeDataStructStiff decodeDataStruct{
+    decodeDataStruct = DecodeDataStructStiff{
         .etot = (*internalEnergy),
         .rhotot = (*density),
         .Yg = densityVF / (*density),
@@ -1225,23 +1220,46 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffe
         .p0g = p01,
         .p0l = p02,
     };
-    SNESSetFunction(snes, r, FormFunctionStiff, &decodeDataStruct);
-    SNESSetJacobian(snes, J, J, FormJacobianStiff, &decodeDataStruct);
-    SNESSetTolerances(snes, 1E-8, 1E-12, 1E-8, 100, 1000);  // refine relative tolerance for more accurate pressure value
-    SNESSetFromOptions(snes);
-    SNESSolve(snes, NULL, x);
 
-    const PetscScalar *ax;
-    VecGetArrayRead(x, &ax);
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
+    // warm start from the supplied guess
+    const PetscReal *warmStart = initialGuessSet ? initialGuess : nullptr;
+    initialGuessSet = false;
+    if (warmStart) {
+        PetscScalar *ax;
+        VecGetArray(x, &ax) >> utilities::PetscUtilities::checkError;
+        std::copy_n(warmStart, DECODE_GUESS_SIZE, ax);
+        VecRestoreArray(x, &ax) >> utilities::PetscUtilities::checkError;
+    } else {
+        VecSet(x, (*density)) >> utilities::PetscUtilities::checkError;  // set initial guess to conserved density, [rho1, rho2, e1, e2] = [rho, rho, rho, rho]
+    }
+    SNESSolve(snes, nullptr, x) >> utilities::PetscUtilities::checkError;
 
-    SNESDestroy(&snes);
-    VecDestroy(&x);
-    VecDestroy(&r);
-    MatDestroy(&J);
+    SNESConvergedReason reason;
+    SNESGetConvergedReason(snes, &reason) >> utilities::PetscUtilities::checkError;
+
+    PetscReal solution[DECODE_GUESS_SIZE];
+    {
+        const PetscScalar *ax;
+        VecGetArrayRead(x, &ax) >> utilities::PetscUtilities::checkError;
+        std::copy_n(ax, DECODE_GUESS_SIZE, solution);
+        VecRestoreArrayRead(x, &ax) >> utilities::PetscUtilities::checkError;
+    }
+
+    // if the warm start did not converge to a physical state, repeat from the original guess
+    if (warmStart && (reason < 0 || solution[0] <= 0.0 || solution[1] <= 0.0 || solution[2] <= 0.0 || solution[3] <= 0.0)) {
+        VecSet(x, (*density)) >> utilities::PetscUtilities::checkError;
+        SNESSolve(snes, nullptr, x) >> utilities::PetscUtilities::checkError;
+
+        const PetscScalar *ax;
+        VecGetArrayRead(x, &ax) >> utilities::PetscUtilities::checkError;
+        std::copy_n(ax, DECODE_GUESS_SIZE, solution);
+        VecRestoreArrayRead(x, &ax) >> utilities::PetscUtilities::checkError;
+    }
+
+    PetscReal rhoG = solution[0];
+    PetscReal rhoL = solution[1];
+    PetscReal eG = solution[2];
+    PetscReal eL = solution[3];
 
     PetscReal etG = eG + ke;
     PetscReal etL = eL + ke;
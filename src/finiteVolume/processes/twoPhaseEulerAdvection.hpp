@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_TWOPHASEEULERADVECTION_HPP
 
 #include <petsc.h>
+#include <vector>
 #include "eos/perfectGas.hpp"
 #include "eos/stiffenedGas.hpp"
 #include "eos/twoPhase.hpp"
@@ -52,6 +53,62 @@ class TwoPhaseEulerAdvection : public Process {
     static PetscErrorCode FormJacobianStiff(SNES snes, Vec x, Mat J, Mat P, void *ctx);
 
     PetscErrorCode MultiphaseFlowPreStage(TS flowTs, ablate::solver::Solver &flow, PetscReal stagetime);
+
+    /**
+     * The decoded two phase state at a cell or on one side of a face
+     */
+    struct DecodedState {
+        PetscReal density;
+        PetscReal densityG;
+        PetscReal densityL;
+        PetscReal normalVelocity;
+        PetscReal velocity[3];
+        PetscReal internalEnergy;
+        PetscReal internalEnergyG;
+        PetscReal internalEnergyL;
+        PetscReal aG;
+        PetscReal aL;
+        PetscReal MG;
+        PetscReal ML;
+        PetscReal p;
+        PetscReal T;
+        PetscReal alpha;
+    };
+
+    /**
+     * The left/right decoded state on the face currently being computed.  It is decoded once per face and shared by the euler and volume fraction fluxes.
+     */
+    struct FaceState {
+        PetscReal norm[3];
+        PetscReal areaMag;
+        DecodedState left;
+        DecodedState right;
+    };
+    FaceState faceState{};
+
+    //! the number of values in a decode guess (densityG, densityL, internalEnergyG, internalEnergyL)
+    static constexpr std::size_t DECODE_GUESS_SIZE = 4;
+
+    /**
+     * The last decoded (densityG, densityL, internalEnergyG, internalEnergyL) for each cell in the pre stage and aux update cell ranges.  These warm start the next decode of the same
+     * cell.  A zero densityG marks a cell that has not been decoded yet.  The pre stage guess is indexed by (cell - preStageDecodeGuessCellStart) over every cell in the dm so the
+     * face decodes can warm start from the cell on each side of the face, independent of the order the faces are computed.
+     */
+    std::vector<PetscReal> preStageDecodeGuess;
+    PetscInt preStageDecodeGuessCellStart = 0;
+    std::vector<PetscReal> auxUpdateDecodeGuess;
+
+    /**
+     * Returns the pre stage guess for this cell, or nullptr if the cell has not been decoded in the pre stage
+     * @param cell
+     * @return
+     */
+    [[nodiscard]] const PetscReal *GetPreStageDecodeGuess(PetscInt cell) const;
+
+    //! the index of the temperature/pressure in the aux fields passed to UpdateAuxTemperaturePressureField2Gas, -1 if not updated
+    PetscInt auxTemperatureIndex = -1;
+    PetscInt auxPressureIndex = -1;
+
     /**
      * General two phase decoder interface
      */
@@ -60,6 +117,38 @@ class TwoPhaseEulerAdvection : public Process {
         virtual void DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density, PetscReal *densityG,
                                               PetscReal *densityL, PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy, PetscReal *internalEnergyG, PetscReal *internalEnergyL,
                                               PetscReal *aG, PetscReal *aL, PetscReal *MG, PetscReal *ML, PetscReal *p, PetscReal *T, PetscReal *alpha) = 0;
+
+        /**
+         * Set the initial guess (densityG, densityL, internalEnergyG, internalEnergyL) used by the next decode.  Decoders with a closed form solution ignore the guess.
+         * @param guess
+         */
+        virtual void SetInitialGuess(const PetscReal *guess) {}
+
+        /**
+         * Support call to decode into a DecodedState
+         */
+        inline void DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, DecodedState &state) {
+            DecodeTwoPhaseEulerState(dim,
+                                     uOff,
+                                     conservedValues,
+                                     normal,
+                                     &state.density,
+                                     &state.densityG,
+                                     &state.densityL,
+                                     &state.normalVelocity,
+                                     state.velocity,
+                                     &state.internalEnergy,
+                                     &state.internalEnergyG,
+                                     &state.internalEnergyL,
+                                     &state.aG,
+                                     &state.aL,
+                                     &state.MG,
+                                     &state.ML,
+                                     &state.p,
+                                     &state.T,
+                                     &state.alpha);
+        }
+
         virtual ~TwoPhaseDecoder() = default;
     };
 
@@ -156,8 +245,26 @@ class TwoPhaseEulerAdvection : public Process {
         eos::ThermodynamicTemperatureFunction liquidComputeSpeedOfSound;
         eos::ThermodynamicTemperatureFunction liquidComputePressure;
 
+        /**
+         * The nonlinear solver, work vectors and jacobian are created once and reused for every decode
+         */
+        SNES snes = nullptr;
+        Vec x = nullptr;
+        Vec r = nullptr;
+        Mat J = nullptr;
+        DecodeDataStructStiff decodeDataStruct{};
+
+        /**
+         * The guess for the next decode.  When no guess is set the decode starts from the conserved density so the result does not depend on the previous decode.
+         */
+        PetscReal initialGuess[DECODE_GUESS_SIZE]{};
+        bool initialGuessSet = false;
+
        public:
         StiffenedGasStiffenedGasDecoder(PetscInt dim, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos1, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos2);
+        ~StiffenedGasStiffenedGasDecoder() override;
+
+        void SetInitialGuess(const PetscReal *guess) override;
 
         void DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density, PetscReal *densityG, PetscReal *densityL,
                                       PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy, PetscReal *internalEnergyG, PetscReal *internalEnergyL, PetscReal *aG, PetscReal *aL,
@@ -184,6 +291,12 @@ class TwoPhaseEulerAdvection : public Process {
     static PetscErrorCode UpdateAuxPressureField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[], const PetscScalar *conservedValues, const PetscInt aOff[],
                                                      PetscScalar *auxField, void *ctx);
 
+    /**
+     * Updates the temperature and/or pressure aux fields from a single decode of each cell.  The decode of each cell is warm started from the previous update.
+     */
+    static PetscErrorCode UpdateAuxTemperaturePressureField2Gas(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, const PetscScalar *conservedValues,
+                                                                const PetscInt aOff[], PetscInt aStride, PetscScalar *auxField, void *ctx);
+
     static PetscErrorCode UpdateAuxVelocityField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[], const PetscScalar *conservedValues, const PetscInt aOff[],
                                                      PetscScalar *auxField, void *ctx);
 
@@ -196,6 +309,14 @@ class TwoPhaseEulerAdvection : public Process {
     // static function to compute time step for twoPhase euler advection
     static double ComputeCflTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver &flow, void *ctx);
 
+    /**
+     * Face state function to decode the left/right state once per face
+     * u = {"volumeFraction", "densityvolumeFraction", "euler"}
+     * ctx = TwoPhaseEulerAdvection
+     */
+    static PetscErrorCode ComputeTwoPhaseFaceState(PetscInt dim, const PetscFVFaceGeom *fg, PetscInt leftCell, PetscInt rightCell, const PetscInt uOff[], const PetscScalar fieldL[],
+                                                   const PetscScalar fieldR[], const PetscInt aOff[], const PetscScalar auxL[], const PetscScalar auxR[], void *ctx);
+
     static PetscErrorCode CompressibleFlowComputeEulerFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt uOff[], const PetscScalar fieldL[], const PetscScalar fieldR[],
                                                            const PetscInt aOff[], const PetscScalar auxL[], const PetscScalar auxR[], PetscScalar *flux, void *ctx);
     static PetscErrorCode CompressibleFlowComputeVFFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt uOff[], const PetscScalar fieldL[], const PetscScalar fieldR[], const PetscInt aOff[],
@@ -0,0 +1,109 @@
+#include "slopeLimiters.hpp"
+#include <petsc/private/petscfvimpl.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ablate::finiteVolume::slopeLimiters {
+
+//! the default Venkatakrishnan K parameter
+static constexpr PetscReal defaultVenkatakrishnanK = 5.0;
+
+/**
+ * The data held by the bounded limiters
+ */
+struct BoundedLimiterData {
+    //! the Venkatakrishnan K parameter
+    PetscReal k;
+};
+
+/**
+ * The bounded limiters are applied in the CellInterpolant using the neighborhood minimum/maximum.  When called through PetscLimiterLimit
+ * the change is only bounded by the single neighbor, phi = min(1, (u[1] - u[0])/(grad u . v/2)) = min(1, 4f)
+ */
+static PetscErrorCode PetscLimiterLimit_Bounded(PetscLimiter, PetscReal f, PetscReal* phi) {
+    PetscFunctionBegin;
+    *phi = PetscMax(0, PetscMin(1, 4 * f));
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscLimiterDestroy_Bounded(PetscLimiter lim) {
+    PetscFunctionBegin;
+    PetscCall(PetscFree(lim->data));
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscLimiterView_Bounded(PetscLimiter lim, PetscViewer viewer) {
+    PetscBool isAscii;
+
+    PetscFunctionBegin;
+    PetscCall(PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERASCII, &isAscii));
+    if (isAscii) {
+        PetscCall(PetscViewerASCIIPrintf(viewer, "%s Slope Limiter:\n", ((PetscObject)lim)->type_name));
+    }
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscLimiterSetFromOptions_Venkatakrishnan(PetscLimiter lim) {
+    PetscFunctionBegin;
+    auto data = (BoundedLimiterData*)lim->data;
+    PetscCall(PetscOptionsGetReal(((PetscObject)lim)->options, ((PetscObject)lim)->prefix, "-petsclimiter_venkatakrishnan_k", &data->k, nullptr));
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscLimiterCreate_Bounded(PetscLimiter lim) {
+    BoundedLimiterData* data;
+
+    PetscFunctionBegin;
+    PetscCall(PetscNew(&data));
+    data->k = defaultVenkatakrishnanK;
+    lim->data = data;
+    lim->ops->view = PetscLimiterView_Bounded;
+    lim->ops->destroy = PetscLimiterDestroy_Bounded;
+    lim->ops->limit = PetscLimiterLimit_Bounded;
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscLimiterCreate_Venkatakrishnan(PetscLimiter lim) {
+    PetscFunctionBegin;
+    PetscCall(PetscLimiterCreate_Bounded(lim));
+    lim->ops->setfromoptions = PetscLimiterSetFromOptions_Venkatakrishnan;
+    PetscFunctionReturn(0);
+}
+
+}  // namespace ablate::finiteVolume::slopeLimiters
+
+void ablate::finiteVolume::slopeLimiters::Register() {
+    // Register the create functions with petsc, re-registering replaces the existing function
+    PetscLimiterRegister(barthJespersenName, PetscLimiterCreate_Bounded) >> utilities::PetscUtilities::checkError;
+    PetscLimiterRegister(venkatakrishnanName, PetscLimiterCreate_Venkatakrishnan) >> utilities::PetscUtilities::checkError;
+}
+
+ablate::finiteVolume::slopeLimiters::LimiterType ablate::finiteVolume::slopeLimiters::GetLimiterType(PetscLimiter limiter) {
+    const std::pair<const char*, LimiterType> types[] = {{PETSCLIMITERNONE, LimiterType::None},
+                                                         {PETSCLIMITERZERO, LimiterType::Zero},
+                                                         {PETSCLIMITERSIN, LimiterType::Sin},
+                                                         {PETSCLIMITERMINMOD, LimiterType::Minmod},
+                                                         {PETSCLIMITERVANLEER, LimiterType::VanLeer},
+                                                         {PETSCLIMITERVANALBADA, LimiterType::VanAlbada},
+                                                         {PETSCLIMITERSUPERBEE, LimiterType::Superbee},
+                                                         {PETSCLIMITERMC, LimiterType::MC},
+                                                         {barthJespersenName, LimiterType::BarthJespersen},
+                                                         {venkatakrishnanName, LimiterType::Venkatakrishnan}};
+
+    for (const auto& [name, type] : types) {
+        PetscBool match;
+        PetscObjectTypeCompare((PetscObject)limiter, name, &match) >> utilities::PetscUtilities::checkError;
+        if (match) {
+            return type;
+        }
+    }
+    return LimiterType::Petsc;
+}
+
+PetscReal ablate::finiteVolume::slopeLimiters::GetVenkatakrishnanK(PetscLimiter limiter) {
+    if (GetLimiterType(limiter) != LimiterType::Venkatakrishnan) {
+        throw std::invalid_argument("The limiter must be a " + std::string(venkatakrishnanName) + " limiter");
+    }
+    return ((BoundedLimiterData*)limiter->data)->k;
+}
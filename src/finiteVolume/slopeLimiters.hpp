@@ -0,0 +1,216 @@
+#ifndef ABLATELIBRARY_SLOPELIMITERS_HPP
+#define ABLATELIBRARY_SLOPELIMITERS_HPP
+
+#include <petsc.h>
+#include "utilities/petscUtilities.hpp"
+
+/**
+ * Inline slope limiters used to limit the cell gradients in the CellInterpolant.  The symmetric limiters reproduce the PetscLimiter of the same name
+ * using the symmetric slope limited form of Berger, Aftosmis, and Murman 2005, but are called directly instead of through the PetscLimiterLimit dispatch.
+ * The Barth-Jespersen and Venkatakrishnan limiters bound the reconstruction by the minimum/maximum of the cell neighborhood and are registered with
+ * petsc so that they can be selected with the petsclimiter_type option.
+ */
+namespace ablate::finiteVolume::slopeLimiters {
+
+/**
+ * The limiters with an inline implementation.  Any other PetscLimiter uses the Petsc limiter function.
+ */
+enum class LimiterType { Petsc, None, Zero, Sin, Minmod, VanLeer, VanAlbada, Superbee, MC, BarthJespersen, Venkatakrishnan };
+
+//! the petsc names for the additional limiters
+inline const char barthJespersenName[] = "barthjespersen";
+inline const char venkatakrishnanName[] = "venkatakrishnan";
+
+/**
+ * Register the Barth-Jespersen and Venkatakrishnan limiters with petsc.  This must be called before PetscLimiterSetFromOptions and is called by the
+ * CellInterpolant before the field limiters are set from options.
+ */
+void Register();
+
+/**
+ * Determine the inline limiter type for the petsc limiter
+ * @param limiter
+ * @return
+ */
+LimiterType GetLimiterType(PetscLimiter limiter);
+
+/**
+ * Get the Venkatakrishnan K parameter for a venkatakrishnan limiter
+ * @param limiter
+ * @return
+ */
+PetscReal GetVenkatakrishnanK(PetscLimiter limiter);
+
+/**
+ * The stencil around a single cell used to limit the cell gradient.  The values are offset to the field being limited.
+ */
+struct CellStencil {
+    //! the number of dimensions
+    PetscInt dim;
+    //! the number of components in the field
+    PetscInt dof;
+    //! the values at this cell
+    const PetscScalar* u;
+    //! the local solution array offset to the field
+    const PetscScalar* xArray;
+    //! the number of neighbors
+    PetscInt numberNeighbors;
+    //! the local solution offset of each neighbor
+    const PetscInt* neighborOffsets;
+    //! the distance from the cell centroid to each neighbor centroid (dim values for each neighbor)
+    const PetscReal* neighborDx;
+    //! a characteristic length for the cell
+    PetscReal cellLength;
+};
+
+/* The symmetric limiter functions w(f) with f = (u[0] - u[-1]) / (u[1] - u[-1]), these must match the petsc implementations */
+struct None {
+    inline PetscReal operator()(PetscReal) const { return 1.0; }
+};
+struct Zero {
+    inline PetscReal operator()(PetscReal) const { return 0.0; }
+};
+struct Sin {
+    inline PetscReal operator()(PetscReal f) const {
+        PetscReal fclip = PetscMax(0, PetscMin(f, 1));
+        return PetscSinReal(PETSC_PI * fclip);
+    }
+};
+struct Minmod {
+    inline PetscReal operator()(PetscReal f) const { return 2 * PetscMax(0, PetscMin(f, 1 - f)); }
+};
+struct VanLeer {
+    inline PetscReal operator()(PetscReal f) const { return PetscMax(0, 4 * f * (1 - f)); }
+};
+struct VanAlbada {
+    inline PetscReal operator()(PetscReal f) const { return PetscMax(0, 2 * f * (1 - f) / (PetscSqr(f) + PetscSqr(1 - f))); }
+};
+struct Superbee {
+    inline PetscReal operator()(PetscReal f) const { return 4 * PetscMax(0, PetscMin(f, 1 - f)); }
+};
+struct MC {
+    inline PetscReal operator()(PetscReal f) const { return PetscMin(1, 4 * PetscMax(0, PetscMin(f, 1 - f))); }
+};
+
+/**
+ * Call any other petsc limiter through PetscLimiterLimit
+ */
+struct Petsc {
+    PetscLimiter limiter;
+    inline PetscReal operator()(PetscReal f) const {
+        PetscReal phi;
+        PetscLimiterLimit(limiter, f, &phi) >> utilities::PetscUtilities::checkError;
+        return phi;
+    }
+};
+
+/**
+ * Compute the limiter (phi) for each component with a symmetric limiter function.  The limiter is the minimum value over all neighbors.
+ * @param function the symmetric limiter function
+ * @param stencil
+ * @param grad the cell gradient (dof*dim)
+ * @param phi the limiter for each component
+ */
+template <class LimiterFunction>
+inline void ComputeSymmetric(const LimiterFunction& function, const CellStencil& stencil, const PetscScalar* grad, PetscReal* phi) {
+    for (PetscInt c = 0; c < stencil.dof; ++c) {
+        phi[c] = PETSC_MAX_REAL;
+    }
+    for (PetscInt n = 0; n < stencil.numberNeighbors; ++n) {
+        const PetscScalar* un = stencil.xArray + stencil.neighborOffsets[n];
+        const PetscReal* v = stencil.neighborDx + n * stencil.dim;
+        for (PetscInt c = 0; c < stencil.dof; ++c) {
+            PetscReal denom = 0.0;
+            for (PetscInt d = 0; d < stencil.dim; ++d) {
+                denom += PetscRealPart(grad[c * stencil.dim + d]) * v[d];
+            }
+            /* We use the symmetric slope limited form of Berger, Aftosmis, and Murman 2005 */
+            PetscReal f = 0.5 * PetscRealPart(un[c] - stencil.u[c]) / denom;
+            phi[c] = PetscMin(phi[c], function(f));
+        }
+    }
+}
+
+/**
+ * Compute the minimum and maximum values of each component over the cell and its neighbors
+ */
+inline void ComputeNeighborhoodBounds(const CellStencil& stencil, PetscReal* uMin, PetscReal* uMax) {
+    for (PetscInt c = 0; c < stencil.dof; ++c) {
+        uMin[c] = uMax[c] = PetscRealPart(stencil.u[c]);
+    }
+    for (PetscInt n = 0; n < stencil.numberNeighbors; ++n) {
+        const PetscScalar* un = stencil.xArray + stencil.neighborOffsets[n];
+        for (PetscInt c = 0; c < stencil.dof; ++c) {
+            uMin[c] = PetscMin(uMin[c], PetscRealPart(un[c]));
+            uMax[c] = PetscMax(uMax[c], PetscRealPart(un[c]));
+        }
+    }
+}
+
+/**
+ * Barth and Jespersen 1989: the reconstruction at the midpoint to each neighbor is bounded by the neighborhood minimum/maximum
+ */
+struct BarthJespersen {
+    inline PetscReal operator()(PetscReal delta1, PetscReal delta2, PetscReal) const { return PetscMin(1.0, delta1 / delta2); }
+};
+
+/**
+ * Venkatakrishnan 1995: a smooth version of the Barth-Jespersen limiter with eps^2 = (K h)^3
+ */
+struct Venkatakrishnan {
+    PetscReal k;
+    inline PetscReal operator()(PetscReal delta1, PetscReal delta2, PetscReal cellLength) const {
+        const PetscReal eps2 = PetscPowRealInt(k * cellLength, 3);
+        const PetscReal delta1Sqr = delta1 * delta1, delta2Sqr = delta2 * delta2;
+        return ((delta1Sqr + eps2) * delta2 + 2 * delta2Sqr * delta1) / (delta2 * (delta1Sqr + 2 * delta2Sqr + delta1 * delta2 + eps2));
+    }
+};
+
+/**
+ * Compute the limiter (phi) for each component with a minimum/maximum limiter function.  The neighborhood bounds are computed once and reused for each neighbor.
+ * @param function the limiter function of the allowed change (delta1), the reconstructed change (delta2), and the cell length
+ * @param stencil
+ * @param grad the cell gradient (dof*dim)
+ * @param phi the limiter for each component, must be sized 3*dof to hold the bounds
+ */
+template <class LimiterFunction>
+inline void ComputeBounded(const LimiterFunction& function, const CellStencil& stencil, const PetscScalar* grad, PetscReal* phi) {
+    PetscReal* uMin = phi + stencil.dof;
+    PetscReal* uMax = uMin + stencil.dof;
+    ComputeNeighborhoodBounds(stencil, uMin, uMax);
+
+    for (PetscInt c = 0; c < stencil.dof; ++c) {
+        phi[c] = 1.0;
+    }
+    for (PetscInt n = 0; n < stencil.numberNeighbors; ++n) {
+        const PetscReal* v = stencil.neighborDx + n * stencil.dim;
+        for (PetscInt c = 0; c < stencil.dof; ++c) {
+            // the reconstructed change at the midpoint to the neighbor
+            PetscReal delta2 = 0.0;
+            for (PetscInt d = 0; d < stencil.dim; ++d) {
+                delta2 += 0.5 * PetscRealPart(grad[c * stencil.dim + d]) * v[d];
+            }
+            if (delta2 > 0) {
+                phi[c] = PetscMin(phi[c], function(uMax[c] - PetscRealPart(stencil.u[c]), delta2, stencil.cellLength));
+            } else if (delta2 < 0) {
+                phi[c] = PetscMin(phi[c], function(uMin[c] - PetscRealPart(stencil.u[c]), delta2, stencil.cellLength));
+            }
+        }
+    }
+}
+
+/**
+ * Limit the cell gradient in place, applying the scalar limiter to each component separately
+ * @param grad the cell gradient (dof*dim)
+ * @param phi the limiter for each component
+ */
+inline void ApplyLimiter(PetscInt dim, PetscInt dof, const PetscReal* phi, PetscScalar* grad) {
+    for (PetscInt c = 0; c < dof; ++c) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            grad[c * dim + d] *= phi[c];
+        }
+    }
+}
+
+}  // namespace ablate::finiteVolume::slopeLimiters
+#endif  // ABLATELIBRARY_SLOPELIMITERS_HPP
@@ -7,8 +7,12 @@
 #include "environment/runEnvironment.hpp"
 #include "generators.hpp"
 
-ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, const std::shared_ptr<parameters::Parameters>& options)
-    : interval(std::move(interval)), rootOutputDirectory(environment::RunEnvironment::Get().GetOutputDirectory()) {
+ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, const std::shared_ptr<parameters::Parameters>& options,
+                                                             const std::string& stagingDirectory, int maxPendingWrites)
+    : interval(std::move(interval)),
+      rootOutputDirectory(environment::RunEnvironment::Get().GetOutputDirectory()),
+      stagingDirectory(stagingDirectory),
+      maxPendingWrites(maxPendingWrites > 0 ? maxPendingWrites : 2) {
     // Load the metadata from the file is available, otherwise set to 0
     auto restartFilePath = rootOutputDirectory / "restart.rst";
 
@@ -40,9 +44,37 @@ ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<abl
         PetscOptionsCreate(&petscOptions) >> utilities::PetscUtilities::checkError;
         options->Fill(petscOptions);
     }
+
+    // start the background mover if staging
+    if (!this->stagingDirectory.empty()) {
+        std::filesystem::create_directories(this->stagingDirectory);
+        writerThread = std::thread(&Hdf5MultiFileSerializer::MoveStagedWrites, this);
+    }
 }
 
 ablate::io::Hdf5MultiFileSerializer::~Hdf5MultiFileSerializer() {
+    // make sure that every staged write is moved before the files are post processed.  The restart file can only be updated collectively in Flush.
+    if (writerThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            stopWriter = true;
+        }
+        writeCondition.notify_all();
+        writerThread.join();
+
+        if (writerError) {
+            try {
+                std::rethrow_exception(writerError);
+            } catch (std::exception& exception) {
+                std::cerr << "Unable to move the staged hdf5 files: " << exception.what() << std::endl;
+            }
+        }
+        if (lastMovedSequenceNumber > lastRecordedSequenceNumber) {
+            std::cerr << "Warning: the Hdf5MultiFileSerializer was destroyed without calling Flush, the restart file does not include sequence number " << lastMovedSequenceNumber
+                      << std::endl;
+        }
+    }
+
     // save each serializer
     for (const std::string& id : postProcessesIds) {
         std::vector<std::filesystem::path> inputFilePaths;
@@ -75,6 +107,11 @@ void ablate::io::Hdf5MultiFileSerializer::Register(std::weak_ptr<Serializable> s
     MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> utilities::PetscUtilities::checkError;
 
     if (auto serializableObject = serializable.lock()) {
+        // the collective files are written by every rank and moved by the first, so they must be staged in a shared directory
+        if (!stagingDirectory.empty() && !stagingDirectoryShared && serializableObject->Serialize() == Serializable::SerializerType::collective) {
+            CheckStagingDirectoryShared(PETSC_COMM_WORLD);
+        }
+
         // resume if needed
         if (resumed) {
             PetscViewer petscViewer = nullptr;
@@ -137,70 +174,217 @@ PetscErrorCode ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializerSaveS
         hdf5Serializer->timeStep = steps;
         hdf5Serializer->sequenceNumber++;
         TSGetTimeStep(ts, &(hdf5Serializer->dt)) >> utilities::PetscUtilities::checkError;
+        Metadata metadata{.time = hdf5Serializer->time, .dt = hdf5Serializer->dt, .timeStep = hdf5Serializer->timeStep, .sequenceNumber = hdf5Serializer->sequenceNumber};
+
+        if (hdf5Serializer->stagingDirectory.empty()) {
+            // Save this to a file
+            hdf5Serializer->SaveMetadata(PetscObjectComm((PetscObject)ts), metadata);
+
+            // save each serializer
+            PetscCall(hdf5Serializer->SaveSerializables(PetscObjectComm((PetscObject)ts), time, nullptr));
+        } else {
+            // record any previous writes that are now in the output directory on every rank
+            hdf5Serializer->UpdateRestartFromCompletedWrites(PetscObjectComm((PetscObject)ts), false);
 
-        // Save this to a file
-        hdf5Serializer->SaveMetadata(ts);
-
-        // save each serializer
-        for (auto& serializablePtr : hdf5Serializer->serializables) {
-            if (auto serializableObject = serializablePtr.lock()) {
-                // Create an output path
-
-                PetscViewer petscViewer = nullptr;
-                hdf5Serializer->StartEvent("PetscViewerHDF5Open");
-                switch (serializableObject->Serialize()) {
-                    case Serializable::SerializerType::collective: {
-                        auto filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId());
-                        PetscCall(PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
-                    } break;
-                    case Serializable::SerializerType::serial: {
-                        PetscMPIInt rank;
-                        MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank);
-                        auto filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId(), rank);
-                        PetscCall(PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
-                    } break;
-                    default:
-                        throw std::invalid_argument("Unable to determine Serializer Type");
+            // wait for room in the queue
+            {
+                std::unique_lock<std::mutex> lock(hdf5Serializer->writeMutex);
+                hdf5Serializer->writeCondition.wait(lock, [hdf5Serializer] { return hdf5Serializer->pendingWrites.size() < hdf5Serializer->maxPendingWrites || hdf5Serializer->writerError; });
+                if (hdf5Serializer->writerError) {
+                    std::rethrow_exception(hdf5Serializer->writerError);
                 }
-                hdf5Serializer->EndEvent();
+            }
 
-                // set the petsc options if provided
-                PetscCall(PetscObjectSetOptions((PetscObject)petscViewer, hdf5Serializer->petscOptions));
-                PetscCall(PetscViewerSetFromOptions(petscViewer));
-                PetscCall(PetscViewerViewFromOptions(petscViewer, nullptr, "-hdf5ViewerView"));
+            // write each serializer to the staging directory and hand the files to the writer thread
+            StagedWrite stagedWrite{.metadata = metadata, .files = {}};
+            PetscCall(hdf5Serializer->SaveSerializables(PetscObjectComm((PetscObject)ts), time, &stagedWrite));
+            {
+                std::lock_guard<std::mutex> lock(hdf5Serializer->writeMutex);
+                hdf5Serializer->pendingWrites.push_back(std::move(stagedWrite));
+            }
+            hdf5Serializer->writeCondition.notify_all();
+        }
+    }
+    PetscFunctionReturn(0);
+}
 
-                hdf5Serializer->StartEvent("Save");
-                // NOTE: as far as the output file the sequence number is always zero because it is a new file
-                PetscCall(serializableObject->Save(petscViewer, 0, time));
-                hdf5Serializer->EndEvent();
+PetscErrorCode ablate::io::Hdf5MultiFileSerializer::SaveSerializables(MPI_Comm comm, PetscReal time, StagedWrite* stagedWrite) {
+    PetscFunctionBeginUser;
+    PetscMPIInt rank;
+    PetscCallMPI(MPI_Comm_rank(comm, &rank));
 
-                hdf5Serializer->StartEvent("PetscViewerHDF5Destroy");
-                PetscCall(PetscOptionsRestoreViewer(&petscViewer));
-                hdf5Serializer->EndEvent();
+    // save each serializer
+    for (auto& serializablePtr : serializables) {
+        if (auto serializableObject = serializablePtr.lock()) {
+            // Create an output path
+            std::filesystem::path filePath;
+            MPI_Comm viewerComm;
+            switch (serializableObject->Serialize()) {
+                case Serializable::SerializerType::collective: {
+                    filePath = GetOutputFilePath(serializableObject->GetId());
+                    viewerComm = PETSC_COMM_WORLD;
+                } break;
+                case Serializable::SerializerType::serial: {
+                    filePath = GetOutputFilePath(serializableObject->GetId(), rank);
+                    viewerComm = PETSC_COMM_SELF;
+                } break;
+                default:
+                    throw std::invalid_argument("Unable to determine Serializer Type");
             }
+
+            // When staging, write to the same relative location in the staging directory. Only one rank moves a collective file.
+            if (stagedWrite) {
+                auto stagedFilePath = stagingDirectory / filePath.lexically_relative(rootOutputDirectory);
+                std::filesystem::create_directories(stagedFilePath.parent_path());
+                if (viewerComm == PETSC_COMM_SELF || rank == 0) {
+                    stagedWrite->files.emplace_back(stagedFilePath, filePath);
+                }
+                filePath = stagedFilePath;
+            }
+
+            PetscViewer petscViewer = nullptr;
+            StartEvent("PetscViewerHDF5Open");
+            PetscCall(PetscViewerHDF5Open(viewerComm, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
+            EndEvent();
+
+            // set the petsc options if provided
+            PetscCall(PetscObjectSetOptions((PetscObject)petscViewer, petscOptions));
+            PetscCall(PetscViewerSetFromOptions(petscViewer));
+            PetscCall(PetscViewerViewFromOptions(petscViewer, nullptr, "-hdf5ViewerView"));
+
+            StartEvent("Save");
+            // NOTE: as far as the output file the sequence number is always zero because it is a new file
+            PetscCall(serializableObject->Save(petscViewer, 0, time));
+            EndEvent();
+
+            StartEvent("PetscViewerHDF5Destroy");
+            PetscCall(PetscOptionsRestoreViewer(&petscViewer));
+            EndEvent();
         }
     }
     PetscFunctionReturn(0);
 }
 
-void ablate::io::Hdf5MultiFileSerializer::SaveMetadata(TS ts) const {
+void ablate::io::Hdf5MultiFileSerializer::MoveStagedWrites() {
+    std::unique_lock<std::mutex> lock(writeMutex);
+    while (true) {
+        writeCondition.wait(lock, [this] { return stopWriter || !pendingWrites.empty(); });
+        if (pendingWrites.empty()) {
+            return;
+        }
+
+        // the oldest write stays in the queue (for the back pressure) until it has been moved
+        const auto& stagedWrite = pendingWrites.front();
+        lock.unlock();
+        try {
+            for (const auto& [stagedFilePath, filePath] : stagedWrite.files) {
+                MoveStagedFile(stagedFilePath, filePath);
+            }
+        } catch (...) {
+            lock.lock();
+            writerError = std::current_exception();
+            pendingWrites.clear();
+            writeCondition.notify_all();
+            return;
+        }
+        lock.lock();
+        completedWrites.push_back(stagedWrite.metadata);
+        lastMovedSequenceNumber = stagedWrite.metadata.sequenceNumber;
+        pendingWrites.pop_front();
+        writeCondition.notify_all();
+    }
+}
+
+void ablate::io::Hdf5MultiFileSerializer::MoveStagedFile(const std::filesystem::path& stagedFilePath, const std::filesystem::path& filePath) {
+    // the staging directory may be on another file system, so copy if the rename fails
+    std::error_code renameError;
+    std::filesystem::rename(stagedFilePath, filePath, renameError);
+    if (renameError) {
+        std::filesystem::copy_file(stagedFilePath, filePath, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::remove(stagedFilePath);
+    }
+}
+
+void ablate::io::Hdf5MultiFileSerializer::CheckStagingDirectoryShared(MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank) >> utilities::PetscUtilities::checkError;
+
+    // the first rank marks the directory and every rank looks for the mark
+    auto markerPath = stagingDirectory / ".ablateStagingDirectory";
+    if (rank == 0) {
+        std::ofstream marker(markerPath);
+    }
+    MPI_Barrier(comm) >> utilities::PetscUtilities::checkError;
+    int localShared = std::filesystem::exists(markerPath);
+    int shared;
+    MPI_Allreduce(&localShared, &shared, 1, MPI_INT, MPI_LAND, comm) >> utilities::PetscUtilities::checkError;
+    MPI_Barrier(comm) >> utilities::PetscUtilities::checkError;
+    if (rank == 0) {
+        std::filesystem::remove(markerPath);
+    }
+
+    if (!shared) {
+        throw std::invalid_argument("The Hdf5MultiFileSerializer stagingDirectory " + stagingDirectory.string() +
+                                    " must be a single directory shared by all ranks when using collective serializables.");
+    }
+    stagingDirectoryShared = true;
+}
+
+void ablate::io::Hdf5MultiFileSerializer::UpdateRestartFromCompletedWrites(MPI_Comm comm, bool wait) {
+    PetscInt localMovedSequenceNumber;
+    {
+        std::unique_lock<std::mutex> lock(writeMutex);
+        if (wait) {
+            writeCondition.wait(lock, [this] { return pendingWrites.empty() || writerError; });
+        }
+        if (writerError) {
+            std::rethrow_exception(writerError);
+        }
+        localMovedSequenceNumber = lastMovedSequenceNumber;
+    }
+
+    // a write is only durable once it has been moved on every rank
+    PetscInt movedSequenceNumber;
+    MPI_Allreduce(&localMovedSequenceNumber, &movedSequenceNumber, 1, MPIU_INT, MPI_MIN, comm) >> utilities::MpiUtilities::checkError;
+    if (movedSequenceNumber <= lastRecordedSequenceNumber) {
+        return;
+    }
+
+    // every rank has the metadata for this write
+    std::lock_guard<std::mutex> lock(writeMutex);
+    while (!completedWrites.empty() && completedWrites.front().sequenceNumber <= movedSequenceNumber) {
+        if (completedWrites.front().sequenceNumber == movedSequenceNumber) {
+            SaveMetadata(comm, completedWrites.front());
+        }
+        completedWrites.pop_front();
+    }
+    lastRecordedSequenceNumber = movedSequenceNumber;
+}
+
+void ablate::io::Hdf5MultiFileSerializer::Flush() {
+    if (!stagingDirectory.empty()) {
+        UpdateRestartFromCompletedWrites(PETSC_COMM_WORLD, true);
+    }
+}
+
+void ablate::io::Hdf5MultiFileSerializer::SaveMetadata(MPI_Comm comm, const Metadata& metadata) const {
     PetscFunctionBeginUser;
     YAML::Emitter out;
     out << YAML::BeginMap;
     out << YAML::Key << "time";
-    out << YAML::Value << time;
+    out << YAML::Value << metadata.time;
     out << YAML::Key << "dt";
-    out << YAML::Value << dt;
+    out << YAML::Value << metadata.dt;
     out << YAML::Key << "timeStep";
-    out << YAML::Value << timeStep;
+    out << YAML::Value << metadata.timeStep;
     out << YAML::Key << "sequenceNumber";
-    out << YAML::Value << sequenceNumber;
+    out << YAML::Value << metadata.sequenceNumber;
     out << YAML::Key << "version";
     out << YAML::Value << std::string(environment::RunEnvironment::GetVersion());
     out << YAML::EndMap;
 
     int rank;
-    MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank) >> utilities::PetscUtilities::checkError;
+    MPI_Comm_rank(comm, &rank) >> utilities::PetscUtilities::checkError;
     if (rank == 0) {
         auto restartFilePath = rootOutputDirectory / "restart.rst";
         // keep a back of the restart file incase writing fails
@@ -245,4 +429,8 @@ std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputFilePath(con
 #include "registrar.hpp"
 REGISTER(ablate::io::Serializer, ablate::io::Hdf5MultiFileSerializer, "serializer for IO that writes each time to a separate hdf5 file",
          ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."),
-         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"));
+         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"),
+         OPT(std::string, "stagingDirectory",
+             "optional directory for staged moves. Each file is written here during the time step and moved to the output directory by a background thread, the hdf5 write itself is not "
+             "asynchronous. The directory must be a single path shared by all ranks (not node-local) when using collective serializables."),
+         OPT(int, "maxPendingWrites", "the maximum number of staged files waiting to be moved before time stepping waits (default is 2)"));
@@ -2,9 +2,14 @@
 #define ABLATELIBRARY_HDF5MULTIFILESERIALIZER_HPP
 
 #include <petscviewer.h>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <io/interval/interval.hpp>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include "parameters/parameters.hpp"
 #include "serializable.hpp"
@@ -40,11 +45,73 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     // an optional petscOptions that is used for this solver
     PetscOptions petscOptions = nullptr;
 
+    /**
+     * The ts metadata written to the restart file
+     */
+    struct Metadata {
+        PetscReal time;
+        PetscReal dt;
+        PetscInt timeStep;
+        PetscInt sequenceNumber;
+    };
+
+    /**
+     * A set of files written to the staging directory that must be moved to the output directory
+     */
+    struct StagedWrite {
+        //! the metadata for this write
+        Metadata metadata;
+        //! the staged and final path for each file written by this rank
+        std::vector<std::pair<std::filesystem::path, std::filesystem::path>> files;
+    };
+
+    //! when set, the files are written to this directory in the post step and a background thread moves them into the output directory
+    const std::filesystem::path stagingDirectory;
+
+    //! true once the staging directory has been checked to be the same directory on every rank
+    bool stagingDirectoryShared = false;
+
+    //! the maximum number of staged writes waiting to be moved before the time stepping is blocked
+    const std::size_t maxPendingWrites;
+
+    //! the staged writes waiting to be (or being) moved by the writer thread
+    std::deque<StagedWrite> pendingWrites;
+
+    //! staged writes that have been moved on this rank but are not yet recorded in the restart file
+    std::deque<Metadata> completedWrites;
+
+    //! protect the pendingWrites, completedWrites, and writerError
+    std::mutex writeMutex;
+    std::condition_variable writeCondition;
+
+    //! the background thread used to move the staged files
+    std::thread writerThread;
+    bool stopWriter = false;
+
+    //! the newest sequence number moved on this rank and the newest recorded in the restart file
+    PetscInt lastMovedSequenceNumber = -1;
+    PetscInt lastRecordedSequenceNumber = -1;
+
+    //! any error from the writer thread, rethrown on the main thread
+    std::exception_ptr writerError;
+
     //! Petsc function used to save the system state
     static PetscErrorCode Hdf5MultiFileSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
 
     //! Private functions to load and save the ts metadata data
-    void SaveMetadata(TS ts) const;
+    void SaveMetadata(MPI_Comm comm, const Metadata& metadata) const;
+
+    //! Private function to write each serializable to the (staging) output path
+    PetscErrorCode SaveSerializables(MPI_Comm comm, PetscReal time, StagedWrite* stagedWrite);
+
+    //! Private function used by the writer thread to move staged files into the output directory
+    void MoveStagedWrites();
+
+    //! Private function to check that every rank sees the same staging directory, required for collective files
+    void CheckStagingDirectoryShared(MPI_Comm comm);
+
+    //! Private function to record the staged writes that are complete on every rank in the restart file
+    void UpdateRestartFromCompletedWrites(MPI_Comm comm, bool wait);
 
     //! Private functions to determine the path name when using collective
     [[nodiscard]] std::filesystem::path GetOutputFilePath(const std::string& objectId) const;
@@ -55,14 +122,29 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     //! private function to get the output directory
     std::filesystem::path GetOutputDirectoryPath(const std::string& objectId) const;
 
+   protected:
+    /**
+     * Move a single staged file into the output directory.  This is called from the writer thread.
+     * @param stagedFilePath
+     * @param filePath
+     */
+    virtual void MoveStagedFile(const std::filesystem::path& stagedFilePath, const std::filesystem::path& filePath);
+
    public:
     /**
      * Separates into multiple files to solve some io issues
+     * @param interval
+     * @param options
+     * @param stagingDirectory optional directory that each file is written to before it is moved to the output directory in the background (a staged move).  The hdf5 write itself
+     * is not asynchronous.  Collective files are written by all ranks and moved by the first rank, so the directory must be a single path shared by all ranks when using collective
+     * serializables.  A node-local directory can only be used with serial serializables.
+     * @param maxPendingWrites the maximum number of staged moves before time stepping waits
      */
-    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, const std::shared_ptr<parameters::Parameters>& options = nullptr);
+    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, const std::shared_ptr<parameters::Parameters>& options = nullptr,
+                                     const std::string& stagingDirectory = {}, int maxPendingWrites = 2);
 
     /**
-     * Allow file cleanup
+     * Allow file cleanup.  Any staged files are still moved, but the restart file is only updated by Flush.
      */
     ~Hdf5MultiFileSerializer() override;
 
@@ -83,6 +165,11 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     PetscSerializeFunction GetSerializeFunction() override { return Hdf5MultiFileSerializerSaveStateFunction; }
 
     void RestoreTS(TS ts) override;
+
+    /**
+     * Collective call to wait for all staged writes to be moved to the output directory and update the restart file.  Any error from moving the files is rethrown.
+     */
+    void Flush() override;
 };
 
 }  // namespace ablate::io
@@ -1,22 +1,18 @@
 #include "equationInterval.hpp"
+#include <utility>
 
-ablate::io::interval::EquationInterval::EquationInterval(std::string functionString) : ablate::mathFunctions::FormulaBase(functionString, {}) {
-    // Remove the x, y, z for this implmentation
-    parser.ClearVar();
-
-    // add back the two required vars
-    parser.DefineVar("step", &step);
-    parser.DefineVar("time", &time);
-
-    // set the expression
-    parser.SetExpr(functionString);
+ablate::io::interval::EquationInterval::EquationInterval(std::string functionString) : ablate::mathFunctions::FormulaBase(std::move(functionString), {}) {
+    // add the two required vars
+    stepIndex = DefineVariable("step");
+    timeIndex = DefineVariable("time");
 }
 bool ablate::io::interval::EquationInterval::Check(MPI_Comm comm, PetscInt stepIn, PetscReal timeIn) {
     // updated the linked variables
-    step = stepIn;
-    time = timeIn;
+    auto& state = GetParserState();
+    state.variables[stepIndex] = stepIn;
+    state.variables[timeIndex] = timeIn;
 
-    auto value = parser.Eval();
+    auto value = state.parser.Eval();
     return value > 0;
 }
 
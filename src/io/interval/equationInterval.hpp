@@ -15,8 +15,11 @@ namespace ablate::io::interval {
  */
 class EquationInterval : public Interval, private ablate::mathFunctions::FormulaBase {
    private:
-    //! the steps linked to the parser
-    mu::value_type step;
+    //! the index of the step variable in the parser state variables
+    std::size_t stepIndex;
+
+    //! the index of the time variable in the parser state variables
+    std::size_t timeIndex;
 
    public:
     /**
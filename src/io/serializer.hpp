@@ -41,6 +41,11 @@ class Serializer {
      */
     virtual void RestoreTS(TS ts) = 0;
 
+    /**
+     * Collective call to complete any outstanding writes and update the restart information.  This is called by the TimeStepper at the end of the solve.
+     */
+    virtual void Flush() {}
+
     /**
      * Manually call the save for this seralizer
      */
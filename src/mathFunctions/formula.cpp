@@ -11,69 +11,69 @@ ablate::mathFunctions::Formula::Formula(std::string functionString, const std::m
         // store the function
         nestedFunctions.push_back(nestedFunction.second);
 
-        // store the pointer
-        nestedValues.push_back(std::make_unique<double>(0.0));
-
         // register this with the parser
-        parser.DefineVar(nestedFunction.first, nestedValues.back().get());
+        nestedValues.push_back(DefineVariable(nestedFunction.first));
     }
 
     // Test the function
     try {
-        parser.Eval();
+        GetParserState().parser.Eval();
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::SimpleFormula::ConvertToException(exception);
     }
 }
 
 double ablate::mathFunctions::Formula::Eval(const double& x, const double& y, const double& z, const double& t) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
+    auto& state = GetParserState();
+    state.coordinate[0] = x;
+    state.coordinate[1] = y;
+    state.coordinate[2] = z;
+    state.time = t;
 
     // updated the nested functions
     for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(x, y, z, t);
+        state.variables[nestedValues[i]] = nestedFunctions[i]->Eval(x, y, z, t);
     }
 
-    return parser.Eval();
+    return state.parser.Eval();
 }
 
 double ablate::mathFunctions::Formula::Eval(const double* xyz, const int& ndims, const double& t) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetParserState();
+    state.coordinate[0] = 0;
+    state.coordinate[1] = 0;
+    state.coordinate[2] = 0;
 
     for (auto d = 0; d < std::min(ndims, 3); d++) {
-        coordinate[d] = xyz[d];
+        state.coordinate[d] = xyz[d];
     }
-    time = t;
+    state.time = t;
 
     // updated the nested functions
     for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(xyz, ndims, t);
+        state.variables[nestedValues[i]] = nestedFunctions[i]->Eval(xyz, ndims, t);
     }
 
-    return parser.Eval();
+    return state.parser.Eval();
 }
 
 void ablate::mathFunctions::Formula::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
+    auto& state = GetParserState();
+    state.coordinate[0] = x;
+    state.coordinate[1] = y;
+    state.coordinate[2] = z;
+    state.time = t;
 
     // updated the nested functions
     for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(x, y, z, t);
+        state.variables[nestedValues[i]] = nestedFunctions[i]->Eval(x, y, z, t);
     }
 
     int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
+    auto rawResult = state.parser.Eval(functionSize);
 
     if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+        throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
     }
 
     // copy over
@@ -83,25 +83,26 @@ void ablate::mathFunctions::Formula::Eval(const double& x, const double& y, cons
 }
 
 void ablate::mathFunctions::Formula::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetParserState();
+    state.coordinate[0] = 0;
+    state.coordinate[1] = 0;
+    state.coordinate[2] = 0;
 
     // updated the nested functions
     for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(xyz, ndims, t);
+        state.variables[nestedValues[i]] = nestedFunctions[i]->Eval(xyz, ndims, t);
     }
 
     for (auto i = 0; i < std::min(ndims, 3); i++) {
-        coordinate[i] = xyz[i];
+        state.coordinate[i] = xyz[i];
     }
-    time = t;
+    state.time = t;
 
     int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
+    auto rawResult = state.parser.Eval(functionSize);
 
     if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+        throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
     }
 
     // copy over
@@ -114,29 +115,30 @@ PetscErrorCode ablate::mathFunctions::Formula::ParsedPetscNested(PetscInt dim, P
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
     try {
-        auto parser = (Formula*)ctx;
+        auto parsedFormula = (Formula*)ctx;
+        auto& state = parsedFormula->GetParserState();
 
         // update the coordinates
-        parser->coordinate[0] = 0;
-        parser->coordinate[1] = 0;
-        parser->coordinate[2] = 0;
+        state.coordinate[0] = 0;
+        state.coordinate[1] = 0;
+        state.coordinate[2] = 0;
 
         for (PetscInt i = 0; i < PetscMin(dim, 3); i++) {
-            parser->coordinate[i] = x[i];
+            state.coordinate[i] = x[i];
         }
-        parser->time = time;
+        state.time = time;
 
         // updated the nested functions
-        for (std::size_t i = 0; i < parser->nestedValues.size(); i++) {
-            parser->nestedFunctions[i]->GetPetscFunction()(dim, time, x, 1, parser->nestedValues[i].get(), parser->nestedFunctions[i]->GetContext());
+        for (std::size_t i = 0; i < parsedFormula->nestedValues.size(); i++) {
+            parsedFormula->nestedFunctions[i]->GetPetscFunction()(dim, time, x, 1, &state.variables[parsedFormula->nestedValues[i]], parsedFormula->nestedFunctions[i]->GetContext());
         }
 
         // Evaluate
         int functionSize = 0;
-        auto rawResult = parser->parser.Eval(functionSize);
+        auto rawResult = state.parser.Eval(functionSize);
 
         if (nf < functionSize) {
-            throw std::invalid_argument("The result vector is not sized to hold the function " + parser->parser.GetExpr());
+            throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
         }
 
         // copy over
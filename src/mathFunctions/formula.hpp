@@ -9,8 +9,8 @@
 namespace ablate::mathFunctions {
 class Formula : public FormulaBase {
    private:
-    // store the scratch variables
-    std::vector<std::unique_ptr<double>> nestedValues;
+    // store the index of each nested value in the parser state variables
+    std::vector<std::size_t> nestedValues;
     std::vector<std::shared_ptr<MathFunction>> nestedFunctions;
 
    private:
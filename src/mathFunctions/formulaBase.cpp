@@ -2,14 +2,29 @@
 
 #include <cmath>
 #include <utility>
+#include "utilities/kokkosUtilities.hpp"
 #include "utilities/stringUtilities.hpp"
 
-ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, const std::shared_ptr<ablate::parameters::Parameters>& constants) : formula(std::move(functionString)) {
+ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, const std::shared_ptr<ablate::parameters::Parameters>& constants)
+    : formula(std::move(functionString)), constants(constants), parserStates(utilities::KokkosUtilities::GetMaxHostThreads()) {
+    // build the state for the constructing thread
+    GetParserState();
+}
+
+std::unique_ptr<ablate::mathFunctions::FormulaBase::ParserState> ablate::mathFunctions::FormulaBase::CreateParserState() const {
+    auto state = std::make_unique<ParserState>();
+    auto& parser = state->parser;
+
     // define the x,y,z and t variables
-    parser.DefineVar("x", &coordinate[0]);
-    parser.DefineVar("y", &coordinate[1]);
-    parser.DefineVar("z", &coordinate[2]);
-    parser.DefineVar("t", &time);
+    parser.DefineVar("x", &state->coordinate[0]);
+    parser.DefineVar("y", &state->coordinate[1]);
+    parser.DefineVar("z", &state->coordinate[2]);
+    parser.DefineVar("t", &state->time);
+
+    // define any additional variables
+    for (const auto& variableName : variableNames) {
+        parser.DefineVar(variableName, &state->variables.emplace_back(0.0));
+    }
 
     // Add in any provided constants
     if (constants) {
@@ -24,12 +39,12 @@ ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, cons
     }
     // check for random number
     if (ablate::utilities::StringUtilities::Contains(formula, "pRand")) {
-        parser.DefineFunUserData("pRand", PseudoRandomFunction, reinterpret_cast<void*>(&pseudoRandomEngine), false);
+        parser.DefineFunUserData("pRand", PseudoRandomFunction, reinterpret_cast<void*>(&state->pseudoRandomEngine), false);
     }
     if (ablate::utilities::StringUtilities::Contains(formula, "rand")) {
         std::random_device rd;
-        randomEngine = std::default_random_engine(rd());
-        parser.DefineFunUserData("rand", RandomFunction, reinterpret_cast<void*>(&randomEngine), false);
+        state->randomEngine = std::default_random_engine(rd());
+        parser.DefineFunUserData("rand", RandomFunction, reinterpret_cast<void*>(&state->randomEngine), false);
     }
     if (ablate::utilities::StringUtilities::Contains(formula, "%")) {
         parser.DefineOprt("%", ModulusOperator, mu::prADD_SUB, mu::oaLEFT, true);
@@ -37,6 +52,26 @@ ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, cons
 
     // set the expression
     parser.SetExpr(formula);
+    return state;
+}
+
+ablate::mathFunctions::FormulaBase::ParserState& ablate::mathFunctions::FormulaBase::GetParserState() const {
+    // each state is only used by its own host thread, so it can be built without a lock
+    auto& state = parserStates[parserStates.size() > 1 ? utilities::KokkosUtilities::GetHostThreadId() : 0];
+    if (!state) {
+        state = CreateParserState();
+    }
+    return *state;
+}
+
+std::size_t ablate::mathFunctions::FormulaBase::DefineVariable(const std::string& name) {
+    variableNames.push_back(name);
+    for (auto& state : parserStates) {
+        if (state) {
+            state->parser.DefineVar(name, &state->variables.emplace_back(0.0));
+        }
+    }
+    return variableNames.size() - 1;
 }
 
 std::invalid_argument ablate::mathFunctions::FormulaBase::ConvertToException(mu::Parser::exception_type& exception) {
@@ -2,7 +2,10 @@
 #define ABLATELIBRARY_FORMULABASE_HPP
 
 #include <muParser.h>
+#include <deque>
+#include <memory>
 #include <random>
+#include <vector>
 #include "mathFunction.hpp"
 #include "parameters/parameters.hpp"
 
@@ -12,22 +15,30 @@ namespace ablate::mathFunctions {
  * Formula base is the base abstract class shared by other formulas
  */
 class FormulaBase : public MathFunction {
-   private:
-    //! Hold a random number engine always using the same seed
-    std::minstd_rand0 pseudoRandomEngine{0};
+   protected:
+    /**
+     * The parser and the variables linked to it.  Each host thread evaluating the formula uses its own state so that the formula can be evaluated
+     * concurrently inside a Kokkos host parallel loop.
+     */
+    struct ParserState {
+        //! The parser object library for this formula
+        mu::Parser parser;
 
-    //! Hold a "real" random number engine
-    std::default_random_engine randomEngine{0};
+        //! The coordinate linked to the parser
+        double coordinate[3] = {0, 0, 0};
 
-   protected:
-    //! The coordinate linked to the parser
-    mutable double coordinate[3] = {0, 0, 0};
+        //! the time linked to the parser
+        double time = 0.0;
 
-    //! the time linked to the parser
-    mutable double time = 0.0;
+        //! any additional variables linked to the parser in the order they were defined with DefineVariable
+        std::deque<double> variables;
 
-    //! The parser object library for this formula
-    mu::Parser parser;
+        //! Hold a random number engine always using the same seed
+        std::minstd_rand0 pseudoRandomEngine{0};
+
+        //! Hold a "real" random number engine
+        std::default_random_engine randomEngine{0};
+    };
 
     //! the formula output for debugging
     const std::string formula;
@@ -39,6 +50,19 @@ class FormulaBase : public MathFunction {
      */
     explicit FormulaBase(std::string functionString, const std::shared_ptr<ablate::parameters::Parameters>& constants);
 
+    /**
+     * Get the parser state for the calling host thread.  The state is built the first time each thread evaluates this formula.
+     * @return
+     */
+    ParserState& GetParserState() const;
+
+    /**
+     * Link an additional variable to the parser for every thread.  This must be called while building the formula, before it is evaluated concurrently.
+     * @param name
+     * @return the index of the variable in ParserState::variables
+     */
+    std::size_t DefineVariable(const std::string& name);
+
     /**
      * helper function to convert to a invalid_exception
      * @param exception
@@ -53,6 +77,21 @@ class FormulaBase : public MathFunction {
     void operator=(const FormulaBase&) = delete;
 
    private:
+    //! the constants passed to each parser
+    const std::shared_ptr<ablate::parameters::Parameters> constants;
+
+    //! the names of the additional variables defined with DefineVariable
+    std::vector<std::string> variableNames;
+
+    //! the parser state for each host thread, indexed by KokkosUtilities::GetHostThreadId and sized when the formula is built
+    mutable std::vector<std::unique_ptr<ParserState>> parserStates;
+
+    /**
+     * Build a new parser state for this formula with all variables, constants, and functions linked
+     * @return
+     */
+    [[nodiscard]] std::unique_ptr<ParserState> CreateParserState() const;
+
     /**
      * mu parser function to compute power given a^2
      * @param a
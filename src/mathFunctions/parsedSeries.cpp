@@ -7,54 +7,60 @@
 
 ablate::mathFunctions::ParsedSeries::ParsedSeries(std::string functionString, int lowerBound, int upperBound, const std::shared_ptr<ablate::parameters::Parameters>& constants)
     : FormulaBase(std::move(functionString), constants), lowerBound(lowerBound), upperBound(upperBound) {
-    // define the x,y,z and t variables
-    parser.DefineVar("i", &i);
+    // define the series count variable
+    seriesIndex = DefineVariable("i");
 
     // Test the function
     try {
-        parser.Eval();
+        GetParserState().parser.Eval();
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::SimpleFormula::ConvertToException(exception);
     }
 }
 
 double ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y, const double& z, const double& t) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
+    auto& state = GetParserState();
+    auto& i = state.variables[seriesIndex];
+    state.coordinate[0] = x;
+    state.coordinate[1] = y;
+    state.coordinate[2] = z;
+    state.time = t;
     double sum = 0.0;
 
     for (i = lowerBound; i <= upperBound; i++) {
-        sum += parser.Eval();
+        sum += state.parser.Eval();
     }
 
     return sum;
 }
 
 double ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, const double& t) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetParserState();
+    auto& i = state.variables[seriesIndex];
+    state.coordinate[0] = 0;
+    state.coordinate[1] = 0;
+    state.coordinate[2] = 0;
 
     for (auto d = 0; d < std::min(ndims, 3); d++) {
-        coordinate[d] = xyz[d];
+        state.coordinate[d] = xyz[d];
     }
-    time = t;
+    state.time = t;
 
     double sum = 0.0;
 
     for (i = lowerBound; i <= upperBound; i++) {
-        sum += parser.Eval();
+        sum += state.parser.Eval();
     }
 
     return sum;
 }
 void ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
+    auto& state = GetParserState();
+    auto& i = state.variables[seriesIndex];
+    state.coordinate[0] = x;
+    state.coordinate[1] = y;
+    state.coordinate[2] = z;
+    state.time = t;
 
     // zero out the result
     std::fill(result.begin(), result.end(), 0.0);
@@ -62,10 +68,10 @@ void ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y,
     // perform multiple evals
     for (i = lowerBound; i <= upperBound; i++) {
         int functionSize = 0;
-        auto rawResult = parser.Eval(functionSize);
+        auto rawResult = state.parser.Eval(functionSize);
 
         if ((int)result.size() < functionSize) {
-            throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+            throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
         }
 
         // copy over
@@ -76,14 +82,16 @@ void ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y,
 }
 
 void ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetParserState();
+    auto& i = state.variables[seriesIndex];
+    state.coordinate[0] = 0;
+    state.coordinate[1] = 0;
+    state.coordinate[2] = 0;
 
     for (auto d = 0; d < std::min(ndims, 3); d++) {
-        coordinate[d] = xyz[d];
+        state.coordinate[d] = xyz[d];
     }
-    time = t;
+    state.time = t;
 
     // zero out the result
     std::fill(result.begin(), result.end(), 0.0);
@@ -91,10 +99,10 @@ void ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndi
     // perform multiple evals
     for (i = lowerBound; i <= upperBound; i++) {
         int functionSize = 0;
-        auto rawResult = parser.Eval(functionSize);
+        auto rawResult = state.parser.Eval(functionSize);
 
         if ((int)result.size() < functionSize) {
-            throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+            throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
         }
 
         // copy over
@@ -108,17 +116,19 @@ PetscErrorCode ablate::mathFunctions::ParsedSeries::ParsedPetscSeries(PetscInt d
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
     try {
-        auto parser = (ParsedSeries*)ctx;
+        auto series = (ParsedSeries*)ctx;
+        auto& state = series->GetParserState();
+        auto& i = state.variables[series->seriesIndex];
 
         // update the coordinates
-        parser->coordinate[0] = 0;
-        parser->coordinate[1] = 0;
-        parser->coordinate[2] = 0;
+        state.coordinate[0] = 0;
+        state.coordinate[1] = 0;
+        state.coordinate[2] = 0;
 
         for (PetscInt d = 0; d < PetscMin(dim, 3); d++) {
-            parser->coordinate[d] = x[d];
+            state.coordinate[d] = x[d];
         }
-        parser->time = time;
+        state.time = time;
 
         // zero out the u vector
         for (PetscInt f = 0; f < nf; f++) {
@@ -126,12 +136,12 @@ PetscErrorCode ablate::mathFunctions::ParsedSeries::ParsedPetscSeries(PetscInt d
         }
 
         // perform multiple evals
-        for (parser->i = parser->lowerBound; parser->i <= parser->upperBound; parser->i++) {
+        for (i = series->lowerBound; i <= series->upperBound; i++) {
             int functionSize = 0;
-            auto rawResult = parser->parser.Eval(functionSize);
+            auto rawResult = state.parser.Eval(functionSize);
 
             if (nf < functionSize) {
-                throw std::invalid_argument("The result vector is not sized to hold the function " + parser->parser.GetExpr());
+                throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
             }
 
             // copy over
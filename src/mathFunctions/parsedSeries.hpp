@@ -12,8 +12,8 @@ namespace ablate::mathFunctions {
 
 class ParsedSeries : public FormulaBase {
    private:
-    // The local count for the series
-    mutable double i = 0;
+    //! the index of the series count (i) in the parser state variables
+    std::size_t seriesIndex;
 
     //! the lower bound for the series
     const int lowerBound;
@@ -6,42 +6,45 @@
 ablate::mathFunctions::SimpleFormula::SimpleFormula(std::string functionString) : FormulaBase(functionString, {}) {
     // Test the function
     try {
-        parser.Eval();
+        GetParserState().parser.Eval();
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::FormulaBase::ConvertToException(exception);
     }
 }
 double ablate::mathFunctions::SimpleFormula::Eval(const double& x, const double& y, const double& z, const double& t) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
-    return parser.Eval();
+    auto& state = GetParserState();
+    state.coordinate[0] = x;
+    state.coordinate[1] = y;
+    state.coordinate[2] = z;
+    state.time = t;
+    return state.parser.Eval();
 }
 
 double ablate::mathFunctions::SimpleFormula::Eval(const double* xyz, const int& ndims, const double& t) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetParserState();
+    state.coordinate[0] = 0;
+    state.coordinate[1] = 0;
+    state.coordinate[2] = 0;
 
     for (auto i = 0; i < std::min(ndims, 3); i++) {
-        coordinate[i] = xyz[i];
+        state.coordinate[i] = xyz[i];
     }
-    time = t;
-    return parser.Eval();
+    state.time = t;
+    return state.parser.Eval();
 }
 
 void ablate::mathFunctions::SimpleFormula::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
+    auto& state = GetParserState();
+    state.coordinate[0] = x;
+    state.coordinate[1] = y;
+    state.coordinate[2] = z;
+    state.time = t;
 
     int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
+    auto rawResult = state.parser.Eval(functionSize);
 
     if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+        throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
     }
 
     // copy over
@@ -51,20 +54,21 @@ void ablate::mathFunctions::SimpleFormula::Eval(const double& x, const double& y
 }
 
 void ablate::mathFunctions::SimpleFormula::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetParserState();
+    state.coordinate[0] = 0;
+    state.coordinate[1] = 0;
+    state.coordinate[2] = 0;
 
     for (auto i = 0; i < std::min(ndims, 3); i++) {
-        coordinate[i] = xyz[i];
+        state.coordinate[i] = xyz[i];
     }
-    time = t;
+    state.time = t;
 
     int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
+    auto rawResult = state.parser.Eval(functionSize);
 
     if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+        throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
     }
 
     // copy over
@@ -77,24 +81,24 @@ PetscErrorCode ablate::mathFunctions::SimpleFormula::ParsedPetscFunction(PetscIn
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
     try {
-        auto parser = (SimpleFormula*)ctx;
+        auto& state = ((SimpleFormula*)ctx)->GetParserState();
 
         // update the coordinates
-        parser->coordinate[0] = 0;
-        parser->coordinate[1] = 0;
-        parser->coordinate[2] = 0;
+        state.coordinate[0] = 0;
+        state.coordinate[1] = 0;
+        state.coordinate[2] = 0;
 
         for (PetscInt i = 0; i < PetscMin(dim, (PetscInt)3); i++) {
-            parser->coordinate[i] = x[i];
+            state.coordinate[i] = x[i];
         }
-        parser->time = time;
+        state.time = time;
 
         // Evaluate
         int functionSize = 0;
-        auto rawResult = parser->parser.Eval(functionSize);
+        auto rawResult = state.parser.Eval(functionSize);
 
         if (nf != functionSize) {
-            throw std::invalid_argument("The field array is not sized to hold the specified function " + parser->parser.GetExpr());
+            throw std::invalid_argument("The field array is not sized to hold the specified function " + state.parser.GetExpr());
         }
 
         // copy over
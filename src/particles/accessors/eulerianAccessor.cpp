@@ -1,5 +1,7 @@
 #include "eulerianAccessor.hpp"
 
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include "particles/particleSolver.hpp"
 
@@ -11,6 +13,54 @@ ablate::particles::accessors::EulerianAccessor::EulerianAccessor(bool cachePoint
     // Size up and copy the coordinates
     coordinates.resize(np * coordinatesField.numberComponents);
     coordinatesField.CopyAll(coordinates.data(), np);
+
+    // Use the cell from the last migration as the initial guess for the particle location
+    cells.resize(np);
+    swarm.CopyCellIds(cells.data());
+}
+
+void ablate::particles::accessors::EulerianAccessor::LocateCells() {
+    if (cellsLocated) {
+        return;
+    }
+    const PetscInt dim = subDomain->GetDimensions();
+
+    // Provide the swarm cell ids as guesses, each is checked before searching
+    PetscSF cellSF;
+    PetscSFCreate(PETSC_COMM_SELF, &cellSF) >> utilities::PetscUtilities::checkError;
+    PetscSFNode* guesses;
+    PetscMalloc1(np, &guesses) >> utilities::PetscUtilities::checkError;
+    for (PetscInt p = 0; p < np; ++p) {
+        guesses[p].rank = cells[p] < 0 ? -1 : 0;
+        guesses[p].index = cells[p];
+    }
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(subDomain->GetDM(), 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    PetscSFSetGraph(cellSF, cEnd, np, nullptr, PETSC_OWN_POINTER, guesses, PETSC_OWN_POINTER) >> utilities::PetscUtilities::checkError;
+
+    // Locate every particle once for all fields
+    Vec coordinatesVec;
+    VecCreateSeqWithArray(PETSC_COMM_SELF, dim, np * dim, coordinates.data(), &coordinatesVec) >> utilities::PetscUtilities::checkError;
+    DMLocatePoints(subDomain->GetDM(), coordinatesVec, DM_POINTLOCATION_NONE, &cellSF) >> utilities::PetscUtilities::checkError;
+
+    const PetscSFNode* foundCells;
+    PetscSFGetGraph(cellSF, nullptr, nullptr, nullptr, &foundCells) >> utilities::PetscUtilities::checkError;
+    PetscInt numberNotFound = 0;
+    for (PetscInt p = 0; p < np; ++p) {
+        cells[p] = foundCells[p].index;
+        if (cells[p] < 0) {
+            ++numberNotFound;
+        }
+    }
+
+    VecDestroy(&coordinatesVec) >> utilities::PetscUtilities::checkError;
+    PetscSFDestroy(&cellSF) >> utilities::PetscUtilities::checkError;
+
+    // Particles should be migrated or removed before the eulerian fields are needed, so any particle outside the local domain is an error
+    if (numberNotFound) {
+        throw std::runtime_error("Unable to locate " + std::to_string(numberNotFound) + " of " + std::to_string(np) + " particle(s) in the local domain at time " + std::to_string(currentTime));
+    }
+    cellsLocated = true;
 }
 
 ablate::particles::accessors::ConstPointData ablate::particles::accessors::EulerianAccessor::CreateData(const std::string& fieldName) {
@@ -23,6 +73,35 @@ ablate::particles::accessors::ConstPointData ablate::particles::accessors::Euler
     const auto& eulerianField = subDomain->GetField(fieldName);
     subDomain->GetFieldLocalVector(eulerianField, currentTime, &eulerianFieldIs, &locEulerianField, &eulerianFieldDm) >> utilities::PetscUtilities::checkError;
 
+    // Finite volume fields are constant over the cell, so copy the value directly from the located cell
+    auto pointData = eulerianField.type == domain::FieldType::FVM ? CreateCellCenteredData(eulerianField, locEulerianField, eulerianFieldDm)
+                                                                   : CreateInterpolatedData(eulerianField, locEulerianField, eulerianFieldDm);
+
+    subDomain->RestoreFieldLocalVector(eulerianField, &eulerianFieldIs, &locEulerianField, &eulerianFieldDm) >> utilities::PetscUtilities::checkError;
+    return pointData;
+}
+
+ablate::particles::accessors::ConstPointData ablate::particles::accessors::EulerianAccessor::CreateCellCenteredData(const domain::Field& eulerianField, Vec locEulerianField, DM eulerianFieldDm) {
+    LocateCells();
+
+    // Size up the values for this field
+    auto& values = cellValues.emplace_back(np * eulerianField.numberComponents, 0.0);
+
+    const PetscScalar* locEulerianFieldArray;
+    VecGetArrayRead(locEulerianField, &locEulerianFieldArray) >> utilities::PetscUtilities::checkError;
+    for (PetscInt p = 0; p < np; ++p) {
+        const PetscScalar* cellValue = nullptr;
+        DMPlexPointLocalRead(eulerianFieldDm, cells[p], locEulerianFieldArray, &cellValue) >> utilities::PetscUtilities::checkError;
+        if (cellValue) {
+            PetscArraycpy(values.data() + p * eulerianField.numberComponents, cellValue, eulerianField.numberComponents) >> utilities::PetscUtilities::checkError;
+        }
+    }
+    VecRestoreArrayRead(locEulerianField, &locEulerianFieldArray) >> utilities::PetscUtilities::checkError;
+
+    return {values.data(), eulerianField.numberComponents};
+}
+
+ablate::particles::accessors::ConstPointData ablate::particles::accessors::EulerianAccessor::CreateInterpolatedData(const domain::Field& eulerianField, Vec locEulerianField, DM eulerianFieldDm) {
     // Set up the interpolation
     DMInterpolationInfo interpolant;
     DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> utilities::PetscUtilities::checkError;
@@ -45,7 +124,6 @@ ablate::particles::accessors::ConstPointData ablate::particles::accessors::Euler
 
     // Now cleanup
     DMInterpolationDestroy(&interpolant) >> utilities::PetscUtilities::checkError;
-    subDomain->RestoreFieldLocalVector(eulerianField, &eulerianFieldIs, &locEulerianField, &eulerianFieldDm) >> utilities::PetscUtilities::checkError;
 
     // Get the raw array from the vec
     const PetscScalar* valueArray = nullptr;
@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_EULERIANDATA_HPP
 
 #include <petsc.h>
+#include <list>
 #include <map>
 #include "accessor.hpp"
 #include "domain/subDomain.hpp"
@@ -26,6 +27,40 @@ class EulerianAccessor : public Accessor<const PetscReal> {
     //! the number of particles in this domain
     const PetscInt np;
 
+    //! the cell containing each particle, seeded with the swarm cell ids and located once for all fields
+    std::vector<PetscInt> cells;
+
+    //! true once the cells have been located at the current coordinates
+    bool cellsLocated = false;
+
+    //! the values interpolated with the cell-centered path
+    std::list<std::vector<PetscReal>> cellValues;
+
+    /**
+     * Locate the cell for each particle at the current coordinates.  The swarm cell id from the last migration is used as the initial guess.  Throws if any
+     * particle is outside the local domain.
+     */
+    void LocateCells();
+
+    /**
+     * Interpolate a finite volume field by copying the value from the cell containing each particle.  This is the same as the DMInterpolation result for
+     * finite volume fields but uses the shared cell location.
+     * @param eulerianField
+     * @param locEulerianField
+     * @param eulerianFieldDm
+     * @return
+     */
+    ConstPointData CreateCellCenteredData(const domain::Field& eulerianField, Vec locEulerianField, DM eulerianFieldDm);
+
+    /**
+     * Interpolate the field using a DMInterpolation, required for non finite volume fields
+     * @param eulerianField
+     * @param locEulerianField
+     * @param eulerianFieldDm
+     * @return
+     */
+    ConstPointData CreateInterpolatedData(const domain::Field& eulerianField, Vec locEulerianField, DM eulerianFieldDm);
+
    public:
     EulerianAccessor(bool cachePointData, std::shared_ptr<ablate::domain::SubDomain> subDomain, SwarmAccessor&, PetscReal currentTime);
 
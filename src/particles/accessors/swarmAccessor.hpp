@@ -44,6 +44,17 @@ class SwarmAccessor : public Accessor<const PetscReal> {
         return size;
     }
 
+    /**
+     * Copy the cell id of each particle from the last swarm migration
+     * @param cellIds the destination, sized for the number of particles
+     */
+    inline void CopyCellIds(PetscInt* cellIds) const {
+        PetscInt* swarmCellIds;
+        DMSwarmGetField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&swarmCellIds) >> utilities::PetscUtilities::checkError;
+        PetscArraycpy(cellIds, swarmCellIds, GetNumberParticles()) >> utilities::PetscUtilities::checkError;
+        DMSwarmRestoreField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&swarmCellIds) >> utilities::PetscUtilities::checkError;
+    }
+
     /**
      * prevent copy of this class
      */
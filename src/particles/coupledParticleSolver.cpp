@@ -26,8 +26,15 @@ ablate::particles::CoupledParticleSolver::~CoupledParticleSolver() {
     if (localEulerianSourceVec) {
         VecDestroy(&localEulerianSourceVec) >> utilities::PetscUtilities::checkError;
     }
-    if (localEulerianVolumeFactor) {
-        VecDestroy(&localEulerianVolumeFactor) >> utilities::PetscUtilities::checkError;
+    for (auto& coupledFieldSubDM : coupledFieldSubDMs) {
+        if (coupledFieldSubDM) {
+            DMDestroy(&coupledFieldSubDM) >> utilities::PetscUtilities::checkError;
+        }
+    }
+    for (auto& coupledFieldSubIS : coupledFieldSubISs) {
+        if (coupledFieldSubIS) {
+            ISDestroy(&coupledFieldSubIS) >> utilities::PetscUtilities::checkError;
+        }
     }
 }
 
@@ -41,42 +48,86 @@ PetscErrorCode ablate::particles::CoupledParticleSolver::PreRHSFunction(TS ts, P
     PetscFunctionBeginUser;
     PetscCall(RHSFunction::PreRHSFunction(ts, time, initialStage, locX));
 
-    // march over every coupled field
-    for (std::size_t f = 0; f < coupledFields.size(); ++f) {
-        const auto& coupledField = coupledFields[f];
+    // the finite volume source terms are summed into the vector so reset it
+    PetscCall(VecZeroEntries(localEulerianSourceVec));
+    PetscCall(DepositEulerianSource());
 
-        // Create the subDM for only this field
-        DM coupledFieldDM;
-        IS coupledFieldIS;
-        PetscInt fieldId[1] = {coupledField.id};
-        PetscCall(DMCreateSubDM(subDomain->GetDM(), 1, fieldId, &coupledFieldIS, &coupledFieldDM));
+    // project any other coupled field using the cached subDM
+    for (std::size_t f = 0; f < coupledFields.size(); ++f) {
+        if (!coupledFieldSubDMs[f]) {
+            continue;
+        }
 
         // Create a global vector for this subDM to interpolate/push into from the particles
         Vec eulerianFieldSourceVec;
-        PetscCall(DMGetGlobalVector(coupledFieldDM, &eulerianFieldSourceVec));
+        PetscCall(DMGetGlobalVector(coupledFieldSubDMs[f], &eulerianFieldSourceVec));
 
         // project from the particle to the subDM vec
         // project the source terms to the global array
         const char* fieldnames[1] = {coupledParticleFieldsNames[f].c_str()};
         Vec fields[1] = {eulerianFieldSourceVec};
-        PetscCall(DMSwarmProjectFields(swarmDm, coupledFieldDM, 1, fieldnames, fields, SCATTER_FORWARD));
+        PetscCall(DMSwarmProjectFields(swarmDm, coupledFieldSubDMs[f], 1, fieldnames, fields, SCATTER_FORWARD));
 
         // Bring back to the global source vector
-        PetscCall(VecISCopy(localEulerianSourceVec, coupledFieldIS, SCATTER_FORWARD, eulerianFieldSourceVec));
+        PetscCall(VecISCopy(localEulerianSourceVec, coupledFieldSubISs[f], SCATTER_FORWARD, eulerianFieldSourceVec));
 
-        PetscCall(DMRestoreGlobalVector(coupledFieldDM, &eulerianFieldSourceVec));
-        PetscCall(DMDestroy(&coupledFieldDM));
-        PetscCall(ISDestroy(&coupledFieldIS));
+        PetscCall(DMRestoreGlobalVector(coupledFieldSubDMs[f], &eulerianFieldSourceVec));
     }
 
     // Scale the source vector by the current dt so that when integrated the total is the same
     PetscReal flowTimeStep;
     PetscCall(TSGetTimeStep(ts, &flowTimeStep));
     PetscCall(VecScale(localEulerianSourceVec, 1.0 / flowTimeStep));
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
 
-    // Scale each source term by the volume of the cell because the project is
-    //   M_f u_f = M_p u_p and the M_f includes the volume of the cell
-    PetscCall(VecPointwiseMult(localEulerianSourceVec, localEulerianSourceVec, localEulerianVolumeFactor));
+PetscErrorCode ablate::particles::CoupledParticleSolver::DepositEulerianSource() {
+    PetscFunctionBeginUser;
+    // Get the particle source term arrays for each finite volume field
+    std::vector<const PetscScalar*> particleSources(coupledFields.size(), nullptr);
+    for (std::size_t f = 0; f < coupledFields.size(); ++f) {
+        if (!coupledFieldSubDMs[f]) {
+            PetscCall(DMSwarmGetField(swarmDm, coupledParticleFieldsNames[f].c_str(), nullptr, nullptr, (void**)&particleSources[f]));
+        }
+    }
+
+    PetscInt numberParticles;
+    PetscCall(DMSwarmGetLocalSize(swarmDm, &numberParticles));
+    PetscInt* cellIds;
+    PetscCall(DMSwarmGetField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&cellIds));
+
+    PetscScalar* sourceArray;
+    PetscCall(VecGetArray(localEulerianSourceVec, &sourceArray));
+
+    // March over each particle once, summing each field into the cell.  The total source is the sum of the particle sources so the deposition is conservative
+    for (PetscInt p = 0; p < numberParticles; ++p) {
+        if (cellIds[p] < 0) {
+            continue;
+        }
+        for (std::size_t f = 0; f < coupledFields.size(); ++f) {
+            if (!particleSources[f]) {
+                continue;
+            }
+            const auto& field = coupledFields[f];
+            PetscScalar* cellSource;
+            PetscCall(DMPlexPointLocalFieldRef(subDomain->GetDM(), cellIds[p], field.id, sourceArray, &cellSource));
+            if (cellSource) {
+                const PetscScalar* particleSource = particleSources[f] + p * field.numberComponents;
+                for (PetscInt c = 0; c < field.numberComponents; ++c) {
+                    cellSource[c] += particleSource[c];
+                }
+            }
+        }
+    }
+
+    // cleanup
+    PetscCall(VecRestoreArray(localEulerianSourceVec, &sourceArray));
+    PetscCall(DMSwarmRestoreField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&cellIds));
+    for (std::size_t f = 0; f < coupledFields.size(); ++f) {
+        if (particleSources[f]) {
+            PetscCall(DMSwarmRestoreField(swarmDm, coupledParticleFieldsNames[f].c_str(), nullptr, nullptr, (void**)&particleSources[f]));
+        }
+    }
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -141,44 +192,17 @@ void ablate::particles::CoupledParticleSolver::Initialize() {
     DMCreateLocalVector(subDomain->GetDM(), &localEulerianSourceVec) >> utilities::PetscUtilities::checkError;
     VecZeroEntries(localEulerianSourceVec) >> utilities::PetscUtilities::checkError;
 
-    // duplicate the vec for localEulerianVolumeFactor
-    VecDuplicate(localEulerianSourceVec, &localEulerianVolumeFactor) >> utilities::PetscUtilities::checkError;
-    VecSet(localEulerianVolumeFactor, 1.0);
-
-    // for FVM fields/meshes march over each cell
-    ablate::domain::Range cellRange;
-    GetCellRange(cellRange);
-
-    // Get the Array from the localEulerianVolumeFactor
-    PetscScalar* localEulerianVolumeFactorArray;
-    VecGetArray(localEulerianVolumeFactor, &localEulerianVolumeFactorArray) >> utilities::PetscUtilities::checkError;
-
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        auto cell = cellRange.GetPoint(c);
-
-        // Compute the volume
-        PetscReal vol;
-        DMPlexComputeCellGeometryFVM(subDomain->GetDM(), c, &vol, nullptr, nullptr) >> utilities::PetscUtilities::checkError;
-
-        // march over each source field
-        for (const auto& field : subDomain->GetFields()) {
-            if (field.type == domain::FieldType::FVM) {
-                // Get each of the stencil pts
-                PetscScalar* localEVF;
-                DMPlexPointLocalFieldRef(subDomain->GetDM(), cell, field.id, localEulerianVolumeFactorArray, &localEVF) >> utilities::PetscUtilities::checkError;
-
-                if (localEVF) {
-                    for (PetscInt n = 0; n < field.numberComponents; ++n) {
-                        localEVF[n] = vol;
-                    }
-                }
-            }
+    // Finite volume fields are deposited directly into the cell containing each particle.  Create the subDM/IS once for any other field that must be projected
+    for (const auto& coupledField : coupledFields) {
+        DM coupledFieldDM = nullptr;
+        IS coupledFieldIS = nullptr;
+        if (coupledField.type != domain::FieldType::FVM) {
+            PetscInt fieldId[1] = {coupledField.id};
+            DMCreateSubDM(subDomain->GetDM(), 1, fieldId, &coupledFieldIS, &coupledFieldDM) >> utilities::PetscUtilities::checkError;
         }
+        coupledFieldSubDMs.push_back(coupledFieldDM);
+        coupledFieldSubISs.push_back(coupledFieldIS);
     }
-
-    // Cleanup
-    VecRestoreArray(localEulerianVolumeFactor, &localEulerianVolumeFactorArray);
-    RestoreRange(cellRange);
 }
 
 void ablate::particles::CoupledParticleSolver::MacroStepParticles(TS macroTS, bool swarmMigrate) {
@@ -96,11 +96,20 @@ class CoupledParticleSolver : public ParticleSolver, public ablate::solver::RHSF
     //! store the local vector for the cellDM source terms.  This is constant during a time step
     Vec localEulerianSourceVec{};
 
-    //! store a local vector the same size as the localEulerianSourceVec so we can include volume/mass scaling
-    Vec localEulerianVolumeFactor{};
+    //! the cached subDM for each coupled field projected from the particles, nullptr for finite volume fields that are deposited directly
+    std::vector<DM> coupledFieldSubDMs;
+
+    //! the cached IS mapping each projected subDM back into the localEulerianSourceVec, nullptr for finite volume fields
+    std::vector<IS> coupledFieldSubISs;
 
     //! private function to compute/update the source terms used by the flowfield
     void ComputeEulerianSource(PetscReal startTime, PetscReal endTime);
+
+    /**
+     * Sum the particle source terms for every finite volume coupled field into the cell containing each particle in a single pass over the particles
+     * @return
+     */
+    PetscErrorCode DepositEulerianSource();
 };
 
 }  // namespace ablate::particles
@@ -1,5 +1,10 @@
 #include "radiation.hpp"
 
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include "utilities/kokkosUtilities.hpp"
+#include "utilities/petscSupport.hpp"
+
 ablate::radiation::Radiation::Radiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber,
                                         std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log)
     : nTheta(raynumber), nPhi(2 * raynumber), solverId(solverId), region(region), radiationModel(std::move(radiationModelIn)), log(std::move(log)) {}
@@ -176,14 +181,14 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
     VecGetDM(faceGeomVec, &faceDM) >> utilities::PetscUtilities::checkError;
     VecGetArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
 
-    /** Exact some information associated with the field declarations from the swarm*/
-    PetscReal* coord;  //!< Pointer to the coordinate field information
-    PetscInt* index;
-    struct Virtualcoord* virtualcoord;  //!< Pointer to the primary (virtual) coordinate field information
-    struct Identifier* identifier;      //!< Pointer to the ray identifier information
+    /** Build the local cell adjacency once so that the search particles can be marched from cell to cell without being located in the mesh.
+     * After the initial placement the particles only move between ranks when they leave the partition, so the swarm is migrated by the rank field.
+     * */
+    BuildCellAdjacency(subDomain);
+    DMSwarmSetMigrateType(radSearch, DMSWARM_MIGRATE_BASIC) >> utilities::PetscUtilities::checkError;
 
     /** ***********************************************************************************************************************************************
-     * Now that the particles have been created, they can be iterated over and each marched one step in space. The global indices of the local
+     * Now that the particles have been created, they can be iterated over and each marched through the local cells. The global indices of the local
      * ray segment storage can be easily accessed and appended. This forms a local collection of globally index ray segments.
      * */
 
@@ -191,87 +196,29 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
     PetscInt npoints = 0;
     DMSwarmGetLocalSize(radSearch, &npoints) >> utilities::PetscUtilities::checkError;  //!< Recalculate the number of particles that are in the domain
     DMSwarmGetSize(radSearch, &nglobalpoints) >> utilities::PetscUtilities::checkError;
-    PetscInt stepcount = 0;       //!< Count the number of steps that the particles have taken
+    PetscInt stepcount = 0;       //!< Count the number of partition crossings that the particles have taken
     while (nglobalpoints != 0) {  //!< WHILE THERE ARE PARTICLES IN ANY DOMAIN
         // If this local rank has never seen this search particle before, then it needs to add a new ray segment to local memory and record its index
         IdentifyNewRaysOnRank(subDomain, radReturn, npoints);
 
-        /** Use the ParticleStep function to calculate the path lengths of the rays through each cell so that they can be stored.
-         * This function also sets up the solve particle infrastructure.
+        /** Use the ParticleStep function to calculate the path lengths of the rays through each local cell so that they can be stored.
+         * The particles that finish on this rank are removed and the particles that leave the partition are labeled with the rank they enter.
          * */
-        ParticleStep(subDomain, faceDM, faceGeomArray, radReturn, npoints, nglobalpoints);
-
-        /** Get all of the ray information from the particle
-         * Get the ntheta and nphi from the particle that is currently being looked at. This will be used to identify its ray and calculate its direction. */
-        DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-        DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-        DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-        DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-
-        for (PetscInt ipart = 0; ipart < npoints; ipart++) {  //!< Iterate over the particles present in the domain. How to isolate the particles in this domain and iterate over them? If there are no
-
-            /** IF THE CELL NUMBER IS RETURNED NEGATIVE, THEN WE HAVE REACHED THE BOUNDARY OF THE DOMAIN >> This exits the loop
-             * This function returns multiple values if multiple points are input to it
-             * Make sure that whatever cell is returned is in the radiation domain
-             * Assemble a vector of vectors etc associated with each cell index, angular coordinate, and space step?
-             * The boundary has been reached if any of these conditions don't hold
-             * */
-
-            /** Step 3.5: The cells need to be removed if they are inside a boundary cell.
-             * Therefore, after each step (where the particle location is fed in) check for whether the cell is still within the interior region.
-             * If it is not (if it's in a boundary cell) then it should be deleted here.
-             * Condition for one dimensional domains to avoid infinite rays perpendicular to the x-axis
-             * If the domain is 1D and the x-direction of the particle is zero then delete the particle here
-             * */
-            if ((!(domain::Region::InRegion(region, subDomain.GetDM(), index[ipart]))) || ((dim == 1) && (abs(virtualcoord[ipart].xdir) < 0.0000001))) {
-                //! If the boundary has been reached by this ray, then add a boundary condition segment to the ray.
-                auto& ray = raySegments[identifier[ipart].remoteRayId];
-                auto& raySegment = ray.emplace_back();
-                SetBoundary(raySegment, index[ipart], identifier[ipart]);
-
-                //! Delete the search particle associated with the ray
-                DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-                DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-                DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-                DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-
-                DMSwarmRemovePointAtIndex(radSearch, ipart);  //!< Delete the particle!
-                DMSwarmGetLocalSize(radSearch, &npoints);
-
-                DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-                DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-                DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-                DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-                ipart--;  //!< Check the point replacing the one that was deleted
-            } else {
-                /** Step 4: Push the particle virtual coordinates to the intersection that was found in the previous step.
-                 * This ensures that the next calculated path length will start from the boundary of the adjacent cell.
-                 * */
-                virtualcoord[ipart].x += virtualcoord[ipart].xdir * virtualcoord[ipart].hhere;
-                virtualcoord[ipart].y += virtualcoord[ipart].ydir * virtualcoord[ipart].hhere;
-                virtualcoord[ipart].z += virtualcoord[ipart].zdir * virtualcoord[ipart].hhere;  //!< Only use the literal intersection coordinate if it exists. This will be decided above.
-
-                /** Step 5: Instead of using the cell face to step into the opposite cell, step the physical coordinates just beyond the intersection.
-                 * This avoids issues with hitting corners and potential ghost cell weirdness.
-                 * It will be slower than the face flipping but it will be more reliable.
-                 * Update the coordinates of the particle.
-                 * It doesn't matter which method is used,
-                 * this will be the same procedure.
-                 * */
-                UpdateCoordinates(ipart, virtualcoord, coord, 0.1);  //!< Update the coordinates of the particle to move it beyond the face of the adjacent cell.
-                virtualcoord[ipart].hhere = 0;                       //!< Reset the path length to zero
-            }
-        }
-        /** Restore the fields associated with the particles after all of the particles have been stepped */
-        DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-        DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-        DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-        DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+        PetscInt relocatedParticles = ParticleStep(subDomain, faceDM, faceGeomArray, radReturn, npoints, nglobalpoints);
+        MPI_Allreduce(MPI_IN_PLACE, &relocatedParticles, 1, MPIU_INT, MPI_SUM, subDomain.GetComm()) >> utilities::MpiUtilities::checkError;
 
         if (log) log->Printf("Migrate ...");
 
-        /** DMSwarm Migrate to move the ray search particle into the next domain if it has crossed. If it no longer appears in this domain then end the ray segment. */
-        DMSwarmMigrate(radSearch, PETSC_TRUE) >> utilities::PetscUtilities::checkError;  //!< Migrate the search particles and remove the particles that have left the domain space.
+        /** DMSwarm Migrate to hand the ray search particles to the neighboring rank that they have entered. If any particle could not be located in the local cells
+         * all of the particles are located in the mesh by their coordinates, removing the particles that have left the domain.
+         * */
+        if (relocatedParticles) {
+            DMSwarmSetMigrateType(radSearch, DMSWARM_MIGRATE_DMCELLNSCATTER) >> utilities::PetscUtilities::checkError;
+            DMSwarmMigrate(radSearch, PETSC_TRUE) >> utilities::PetscUtilities::checkError;
+            DMSwarmSetMigrateType(radSearch, DMSWARM_MIGRATE_BASIC) >> utilities::PetscUtilities::checkError;
+        } else {
+            DMSwarmMigrate(radSearch, PETSC_TRUE) >> utilities::PetscUtilities::checkError;
+        }
 
         DMSwarmGetSize(radSearch, &nglobalpoints) >> utilities::PetscUtilities::checkError;  //!< Update the loop condition. Recalculate the number of particles that are in the domain.
         DMSwarmGetLocalSize(radSearch, &npoints) >> utilities::PetscUtilities::checkError;   //!< Update the loop condition. Recalculate the number of particles that are in the domain.
@@ -280,6 +227,7 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
         stepcount++;
     }
     // Cleanup
+    cellAdjacency = {};
     DMDestroy(&radSearch) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
 
@@ -303,7 +251,8 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
     }
 
     // Keep track of the offset for each originRay assuming the memory is in order
-    std::vector<PetscInt> rayOffset(numberOriginRays);
+    auto& rayOffset = originRaySegmentOffsets;
+    rayOffset.resize(numberOriginRays);
     PetscInt uniqueRaySegments = 0;
     for (std::size_t r = 0; r < raySegmentsPerOriginRay.size(); r++) {
         rayOffset[r] = uniqueRaySegments;
@@ -350,9 +299,45 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
     PetscInt count = 2 * absorptivityFunction.propertySize;  //! = 2 * (the number of independant wavelengths that are being considered). Should be read from absorption model.
     MPI_Type_contiguous(count, MPIU_REAL, &carrierMpiType) >> utilities::MpiUtilities::checkError;
     MPI_Type_commit(&carrierMpiType) >> utilities::MpiUtilities::checkError;
+
+    // Store the local ray segments in a compact form for the gains evaluation
+    FlattenRaySegments();
     EndEvent();
 }
 
+void ablate::radiation::Radiation::FlattenRaySegments() {
+    // determine the unique cells crossed by any local ray segment
+    segmentCells.clear();
+    std::size_t numberCellSegments = 0;
+    for (const auto& raySegment : raySegments) {
+        numberCellSegments += raySegment.size();
+        for (const auto& cellSegment : raySegment) {
+            segmentCells.push_back(cellSegment.cell);
+        }
+    }
+    std::sort(segmentCells.begin(), segmentCells.end());
+    segmentCells.erase(std::unique(segmentCells.begin(), segmentCells.end()), segmentCells.end());
+
+    // copy each ray segment into the csr arrays
+    raySegmentOffsets.resize(raySegments.size() + 1);
+    raySegmentCellIndices.resize(numberCellSegments);
+    raySegmentPathLengths.resize(numberCellSegments);
+    PetscInt offset = 0;
+    for (std::size_t raySegmentIndex = 0; raySegmentIndex < raySegments.size(); ++raySegmentIndex) {
+        raySegmentOffsets[raySegmentIndex] = offset;
+        for (const auto& cellSegment : raySegments[raySegmentIndex]) {
+            raySegmentCellIndices[offset] = (PetscInt)std::distance(segmentCells.begin(), std::lower_bound(segmentCells.begin(), segmentCells.end(), cellSegment.cell));
+            raySegmentPathLengths[offset] = cellSegment.pathLength;
+            offset++;
+        }
+    }
+    raySegmentOffsets[raySegments.size()] = offset;
+
+    // size up the per cell properties
+    segmentCellAbsorptivity.resize(segmentCells.size() * absorptivityFunction.propertySize);
+    segmentCellEmission.resize(segmentCells.size() * absorptivityFunction.propertySize);
+}
+
 void ablate::radiation::Radiation::UpdateCoordinates(PetscInt ipart, Virtualcoord* virtualcoord, PetscReal* coord, PetscReal adv) const {
     switch (dim) {
         case 1:
@@ -450,16 +435,190 @@ void ablate::radiation::Radiation::IdentifyNewRaysOnRank(ablate::domain::SubDoma
     DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
 }
 
-void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray, DM radReturn, PetscInt npoints,
-                                                PetscInt nglobalpoints) { /** Check that the particle is in a valid region */
+void ablate::radiation::Radiation::BuildCellAdjacency(ablate::domain::SubDomain& subDomain) {
+    DM dm = subDomain.GetDM();
+    MPI_Comm_rank(subDomain.GetComm(), &cellAdjacency.rank) >> utilities::MpiUtilities::checkError;
+
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    cellAdjacency.cStart = cStart;
+    cellAdjacency.faceOffsets.assign(cEnd - cStart + 1, 0);
+    cellAdjacency.faces.clear();
+    cellAdjacency.neighbors.clear();
+    cellAdjacency.outwardSigns.clear();
+
+    DM cellDM, faceDM;
+    const PetscScalar *cellGeomArray, *faceGeomArray;
+    VecGetDM(cellGeomVec, &cellDM) >> utilities::PetscUtilities::checkError;
+    VecGetDM(faceGeomVec, &faceDM) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
 
+    /** Record the faces of each cell and the cell on the other side of each face from the cones and supports */
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        cellAdjacency.faceOffsets[c - cStart] = (PetscInt)cellAdjacency.faces.size();
+
+        PetscFVCellGeom* cellGeom;
+        DMPlexPointLocalRead(cellDM, c, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
+
+        PetscInt numberFaces;
+        const PetscInt* cellFaces;
+        DMPlexGetConeSize(dm, c, &numberFaces) >> utilities::PetscUtilities::checkError;
+        DMPlexGetCone(dm, c, &cellFaces) >> utilities::PetscUtilities::checkError;
+        for (PetscInt f = 0; f < numberFaces; ++f) {
+            PetscInt supportSize;
+            const PetscInt* support;
+            DMPlexGetSupportSize(dm, cellFaces[f], &supportSize) >> utilities::PetscUtilities::checkError;
+            DMPlexGetSupport(dm, cellFaces[f], &support) >> utilities::PetscUtilities::checkError;
+
+            PetscInt neighbor = -1;
+            for (PetscInt s = 0; s < supportSize; ++s) {
+                if (support[s] != c) {
+                    neighbor = support[s];
+                }
+            }
+
+            /** The face normal points out of the cell if it points away from the cell centroid */
+            PetscFVFaceGeom* faceGeom;
+            DMPlexPointLocalRead(faceDM, cellFaces[f], faceGeomArray, &faceGeom) >> utilities::PetscUtilities::checkError;
+            PetscReal outward = 0.0;
+            for (PetscInt d = 0; d < dim; ++d) {
+                outward += (faceGeom->centroid[d] - cellGeom->centroid[d]) * faceGeom->normal[d];
+            }
+
+            cellAdjacency.faces.push_back(cellFaces[f]);
+            cellAdjacency.neighbors.push_back(neighbor);
+            cellAdjacency.outwardSigns.push_back(outward < 0 ? -1.0 : 1.0);
+        }
+    }
+    cellAdjacency.faceOffsets[cEnd - cStart] = (PetscInt)cellAdjacency.faces.size();
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
+
+    /** Every cell is owned by this rank unless it is a leaf of the point sf */
+    cellAdjacency.ownerRanks.assign(cEnd - cStart, cellAdjacency.rank);
+    cellAdjacency.ownerCells.resize(cEnd - cStart);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        cellAdjacency.ownerCells[c - cStart] = c;
+    }
+
+    PetscSF pointSF;
+    PetscInt numberRoots, numberLeaves;
+    const PetscInt* leaves;
+    const PetscSFNode* remotePoints;
+    DMGetPointSF(dm, &pointSF) >> utilities::PetscUtilities::checkError;
+    PetscSFGetGraph(pointSF, &numberRoots, &numberLeaves, &leaves, &remotePoints) >> utilities::PetscUtilities::checkError;
+    if (numberRoots >= 0) {
+        for (PetscInt l = 0; l < numberLeaves; ++l) {
+            const PetscInt point = leaves ? leaves[l] : l;
+            if (point >= cStart && point < cEnd) {
+                cellAdjacency.ownerRanks[point - cStart] = (PetscMPIInt)remotePoints[l].rank;
+                cellAdjacency.ownerCells[point - cStart] = remotePoints[l].index;
+            }
+        }
+    }
+}
+
+bool ablate::radiation::Radiation::CellContains(PetscInt cell, const PetscReal point[], DM faceDM, const PetscScalar* faceGeomArray) const {
+    PetscFVFaceGeom* faceGeom;
+    for (PetscInt f = cellAdjacency.faceOffsets[cell - cellAdjacency.cStart]; f < cellAdjacency.faceOffsets[cell - cellAdjacency.cStart + 1]; f++) {
+        DMPlexPointLocalRead(faceDM, cellAdjacency.faces[f], faceGeomArray, &faceGeom) >> utilities::PetscUtilities::checkError;
+
+        /** The point is outside of the cell if it is beyond any face, the distance is scaled by the normal because the face normal is scaled by the area */
+        PetscReal distance = 0.0;
+        PetscReal normalMagnitude = 0.0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            distance += (point[d] - faceGeom->centroid[d]) * faceGeom->normal[d];
+            normalMagnitude += PetscSqr(faceGeom->normal[d]);
+        }
+        if (cellAdjacency.outwardSigns[f] * distance > minCellRadius * 1E-5 * PetscSqrtReal(normalMagnitude)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+ablate::radiation::Radiation::MarchResult ablate::radiation::Radiation::MarchParticle(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray,
+                                                                                        Virtualcoord& virtualcoord, PetscInt& cell, std::vector<CellSegment>& ray, const Identifier& identifier) {
     PetscFVFaceGeom* faceGeom;
 
+    while (true) {
+        /** ********************************************
+         * The face stepping routine will give the precise path length of the mesh without any error. It will also allow the faces of the cells to be accounted for so that the
+         * boundary conditions and the conditions at reflection can be accounted for. This will make the entire initialization much faster by only requiring a single step through each
+         * cell. Additionally, the option for reflection is opened because the faces and their normals are now more easily accessed during the initialization. In the future, the carrier
+         * particles may want to be given some information that the boundary label carries when the search particle happens upon it so that imperfect reflection can be implemented.
+         * */
+
+        /** Step 1: Acquire the intersection of the particle search line with each face of the cell. In the case if a two dimensional mesh, the virtual coordinate in the z direction will
+         * need to be solved for because the three dimensional line will not have a literal intersection with the segment of the cell. The third coordinate can be solved for in this case.
+         * The face with the shortest path length for intersection will be the one that physically intercepts with the ray and not with the nonphysical plane beyond the face.
+         * */
+        PetscInt exitFace = -1;
+        virtualcoord.hhere = 0;
+        for (PetscInt f = cellAdjacency.faceOffsets[cell - cellAdjacency.cStart]; f < cellAdjacency.faceOffsets[cell - cellAdjacency.cStart + 1]; f++) {
+            DMPlexPointLocalRead(faceDM, cellAdjacency.faces[f], faceGeomArray, &faceGeom) >> utilities::PetscUtilities::checkError;
+
+            PetscReal path = FaceIntersect(0, &virtualcoord, faceGeom);  //!< Use plane intersection equation by getting the centroid and normal vector of the face
+            if (path > 0 && (exitFace < 0 || path < virtualcoord.hhere)) {
+                virtualcoord.hhere = path;
+                exitFace = f;
+            }
+        }
+        virtualcoord.hhere = (exitFace < 0) ? minCellRadius : virtualcoord.hhere;
+
+        /** Step 2: Register the current cell index in the rays vector. Because the ray comes from the origin, all of the cell indexes are naturally ordered from the center out */
+        if (subDomain.InRegion(cell)) {
+            AddCellSegment(ray, cell, virtualcoord.hhere, identifier);
+        }
+
+        /** Step 3: The search ends if the particle is inside a boundary cell.
+         * Condition for one dimensional domains to avoid infinite rays perpendicular to the x-axis
+         * */
+        if ((!(domain::Region::InRegion(region, subDomain.GetDM(), cell))) || ((dim == 1) && (abs(virtualcoord.xdir) < 0.0000001))) {
+            //! If the boundary has been reached by this ray, then add a boundary condition segment to the ray.
+            auto& raySegment = ray.emplace_back();
+            SetBoundary(raySegment, cell, identifier);
+            return MarchResult::Finished;
+        }
+
+        /** Step 4: Push the particle virtual coordinates to the intersection so that the next path length starts from the face of the adjacent cell */
+        virtualcoord.x += virtualcoord.xdir * virtualcoord.hhere;
+        virtualcoord.y += virtualcoord.ydir * virtualcoord.hhere;
+        virtualcoord.z += virtualcoord.zdir * virtualcoord.hhere;
+        virtualcoord.hhere = 0;
+
+        /** Step 5: Step through the exit face into the adjacent cell if it contains the point just beyond the face. When the ray crosses at or near a vertex or edge the
+         * shortest intersection may not belong to the face that the ray passes through, and when no face was intersected there is no adjacent cell, so the point just beyond
+         * the face is located in the local cells instead.
+         * */
+        PetscReal stepCoord[3];
+        UpdateCoordinates(0, &virtualcoord, stepCoord, 0.1);
+        PetscInt next = (exitFace < 0) ? -1 : cellAdjacency.neighbors[exitFace];
+        if (next < 0 || !CellContains(next, stepCoord, faceDM, faceGeomArray)) {
+            DMPlexGetContainingCell(subDomain.GetDM(), stepCoord, &next) >> utilities::PetscUtilities::checkError;
+            if (next < 0) {
+                return MarchResult::Relocate;
+            }
+        }
+
+        /** Step 6: The particle is handed to the owning rank if the cell belongs to another partition */
+        cell = next;
+        if (cellAdjacency.ownerRanks[cell - cellAdjacency.cStart] != cellAdjacency.rank) {
+            return MarchResult::Remote;
+        }
+    }
+}
+
+PetscInt ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray, DM radReturn, PetscInt npoints,
+                                                    PetscInt nglobalpoints) {
     PetscMPIInt rank = 0;
     MPI_Comm_rank(subDomain.GetComm(), &rank);
 
     /** Declare some information associated with the field declarations */
+    PetscReal* coord;  //!< Pointer to the coordinate field information
     PetscInt* index;
+    PetscInt* particleRank;
     struct Virtualcoord* virtualcoords;  //!< Pointer to the primary (virtual) coordinate field information
     struct Identifier* identifiers;      //!< Pointer to the ray identifier information
 
@@ -467,70 +626,51 @@ void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDo
      * Get the ntheta and nphi from the particle that is currently being looked at. This will be used to identify its ray and calculate its direction. */
     DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifiers) >> utilities::PetscUtilities::checkError;
     DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoords) >> utilities::PetscUtilities::checkError;
+    DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
     DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+    DMSwarmGetField(radSearch, DMSwarmField_rank, nullptr, nullptr, (void**)&particleRank) >> utilities::PetscUtilities::checkError;
+
+    //! the particles that have finished their search are removed together after the march
+    std::vector<PetscInt> finishedParticles;
+    PetscInt relocatedParticles = 0;
 
     for (PetscInt ipart = 0; ipart < npoints; ipart++) {
-        /** Check that the particle is in a valid region */
-        if (index[ipart] >= 0 && subDomain.InRegion(index[ipart])) {
-            auto& identifier = identifiers[ipart];
-            // Exact the ray to reduce lookup
-            auto& ray = raySegments[identifier.remoteRayId];
-
-            /** ********************************************
-             * The face stepping routine will give the precise path length of the mesh without any error. It will also allow the faces of the cells to be accounted for so that the
-             * boundary conditions and the conditions at reflection can be accounted for. This will make the entire initialization much faster by only requiring a single step through each
-             * cell. Additionally, the option for reflection is opened because the faces and their normals are now more easily accessed during the initialization. In the future, the carrier
-             * particles may want to be given some information that the boundary label carries when the search particle happens upon it so that imperfect reflection can be implemented.
-             * */
-
-            /** Step 1: Register the current cell index in the rays vector. The physical coordinates that have been set in the previous step / loop will be immediately registered.
-             * Because the ray comes from the origin, all of the cell indexes are naturally ordered from the center out
-             * */
-            auto& raySegment = ray.emplace_back();
-            raySegment.cell = index[ipart];
-
-            /** Step 2: Acquire the intersection of the particle search line with the segment or face. In the case if a two dimensional mesh, the virtual coordinate in the z direction will
-             * need to be solved for because the three dimensional line will not have a literal intersection with the segment of the cell. The third coordinate can be solved for in this case.
-             * Here we are figuring out what distance the ray spends inside the cell that it has just registered.
-             * */
-            /** March over each face on this cell in order to check them for the one which intersects this ray next */
-            PetscInt numberFaces;
-            const PetscInt* cellFaces;
-            DMPlexGetConeSize(subDomain.GetDM(), index[ipart], &numberFaces) >> utilities::PetscUtilities::checkError;
-            DMPlexGetCone(subDomain.GetDM(), index[ipart], &cellFaces) >> utilities::PetscUtilities::checkError;  //!< Get the face geometry associated with the current cell
-
-            /** Check every face for intersection with the segment.
-             * The segment with the shortest path length for intersection will be the one that physically intercepts with the cell face and not with the nonphysical plane beyond the face.
-             * */
-            for (PetscInt f = 0; f < numberFaces; f++) {
-                PetscInt face = cellFaces[f];
-                DMPlexPointLocalRead(faceDM, face, faceGeomArray, &faceGeom) >> utilities::PetscUtilities::checkError;  //!< Reads the cell location from the current cell
-
-                /** Get the intersection of the direction vector with the cell face
-                 * Use the plane equation and ray segment equation in order to get the face intersection with the shortest path length
-                 * This will be the next position of the search particle
-                 * */
-                PetscReal path = FaceIntersect(ipart, virtualcoords, faceGeom);  //!< Use plane intersection equation by getting the centroid and normal vector of the face
-
-                /** Step 3: Take this path if it is shorter than the previous one, getting the shortest path.
-                 * The path should never be zero if the forwardIntersect check is functioning properly.
-                 * */
-                if (path > 0) {
-                    virtualcoords[ipart].hhere = (virtualcoords[ipart].hhere == 0) ? (path * 1.1) : virtualcoords[ipart].hhere;  //!< Dumb check to ensure that the path length is always updated
-                    if (virtualcoords[ipart].hhere > path) {
-                        virtualcoords[ipart].hhere = path;  //!> Get the shortest path length of all of the faces. The point must be in the direction that the ray is travelling in order to be valid.
-                    }
-                }
-            }
-            virtualcoords[ipart].hhere = (virtualcoords[ipart].hhere == 0) ? minCellRadius : virtualcoords[ipart].hhere;
-            raySegment.pathLength = virtualcoords[ipart].hhere;
-        } else {
-            virtualcoords[ipart].hhere = (virtualcoords[ipart].hhere == 0) ? minCellRadius : virtualcoords[ipart].hhere;
+        auto& identifier = identifiers[ipart];
+        particleRank[ipart] = rank;
+
+        /** March the particle through the local cells until it reaches the boundary of the region or the partition */
+        PetscInt cell = index[ipart];
+        switch (MarchParticle(subDomain, faceDM, faceGeomArray, virtualcoords[ipart], cell, raySegments[identifier.remoteRayId], identifier)) {
+            case MarchResult::Finished:
+                finishedParticles.push_back(ipart);
+                break;
+            case MarchResult::Remote:
+                particleRank[ipart] = cellAdjacency.ownerRanks[cell - cellAdjacency.cStart];
+                index[ipart] = cellAdjacency.ownerCells[cell - cellAdjacency.cStart];
+                break;
+            case MarchResult::Relocate:
+                relocatedParticles++;
+                break;
         }
+
+        /** Keep the physical coordinates just beyond the face so that the particle can be located in the mesh if needed */
+        UpdateCoordinates(ipart, virtualcoords, coord, 0.1);
     }
     DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifiers) >> utilities::PetscUtilities::checkError;
     DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoords) >> utilities::PetscUtilities::checkError;
+    DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
     DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+    DMSwarmRestoreField(radSearch, DMSwarmField_rank, nullptr, nullptr, (void**)&particleRank) >> utilities::PetscUtilities::checkError;
+
+    RemoveParticles(finishedParticles);
+    return relocatedParticles;
+}
+
+void ablate::radiation::Radiation::RemoveParticles(const std::vector<PetscInt>& particles) {
+    /** Removing a point moves the last point into its place, so removing in descending order leaves the remaining indices valid */
+    for (auto particle = particles.rbegin(); particle != particles.rend(); ++particle) {
+        DMSwarmRemovePointAtIndex(radSearch, *particle) >> utilities::PetscUtilities::checkError;
+    }
 }
 
 void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) {
@@ -554,53 +694,61 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
     auto absorptivityFunctionContext = absorptivityFunction.context.get();
     auto emissivityFunctionContext = emissivityFunction.context.get();
 
-    // Start by marching over all rays in this rank
-    for (std::size_t raySegmentIndex = 0; raySegmentIndex < raySegments.size(); ++raySegmentIndex) {
+    /* Evaluate the properties once for each cell crossed by a local ray segment.  Cells without a solution or temperature are given zero absorptivity
+     * and emission so that they do not change the ray segment. */
+    for (std::size_t cellIndex = 0; cellIndex < segmentCells.size(); ++cellIndex) {
+        PetscReal* kappa = segmentCellAbsorptivity.data() + propertySize * cellIndex;  //!< Absorptivity coefficient, property of each cell. This is an array that we will iterate through for every evaluation
+        PetscReal* emission = segmentCellEmission.data() + propertySize * cellIndex;
+
+        const PetscReal* sol = nullptr;          //!< The solution value at any given location
+        const PetscReal* temperature = nullptr;  //!< The temperature at any given location
+        DMPlexPointLocalRead(solDm, segmentCells[cellIndex], solArray, &sol);
+        if (sol) {
+            DMPlexPointLocalFieldRead(auxDm, segmentCells[cellIndex], temperatureField.id, auxArray, &temperature);
+        }
+        if (temperature) { /** Input absorptivity (kappa) values from model here. */
+            absorptivityFunction.function(sol, *temperature, kappa, absorptivityFunctionContext);  //! Get the absorption and emission information from the provided properties models.
+            emissivityFunction.function(sol, *temperature, emission, emissivityFunctionContext);
+        } else {
+            std::fill_n(kappa, propertySize, 0.0);
+            std::fill_n(emission, propertySize, 0.0);
+        }
+    }
+
+    // Start by marching over all rays in this rank, each ray segment is independent so they are computed over the host threads
+    utilities::KokkosUtilities::Initialize();
+    Kokkos::parallel_for("Radiation::EvaluateRaySegments", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, raySegments.size()), [&](const std::size_t raySegmentIndex) {
         //! Zero this ray segment for all wavelengths
-        for (unsigned short int wavelengthIndex = 0; wavelengthIndex < static_cast<unsigned short int>(absorptivityFunction.propertySize);
-             wavelengthIndex++) {  //! Iterate through every wavelength entry in this ray segment
-            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Ij = 0.0;
-            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad = 1.0;
+        Carrier* segmentCalculation = raySegmentsCalculations.data() + propertySize * raySegmentIndex;
+        for (unsigned short int wavelengthIndex = 0; wavelengthIndex < propertySize; wavelengthIndex++) {  //! Iterate through every wavelength entry in this ray segment
+            segmentCalculation[wavelengthIndex].Ij = 0.0;
+            segmentCalculation[wavelengthIndex].Krad = 1.0;
         }
 
         // compute the Ij and Krad for this segment starting at the point closest to the ray origin
-        const auto& raySegment =
-            raySegments[raySegmentIndex];  //! This is allowed to be cast to auto and indexed raySegmentIndex because there is only one physical ray segment that we are reading from.
+        for (PetscInt s = raySegmentOffsets[raySegmentIndex]; s < raySegmentOffsets[raySegmentIndex + 1]; ++s) {
+            const PetscReal* kappa = segmentCellAbsorptivity.data() + propertySize * raySegmentCellIndices[s];
+            const PetscReal* emission = segmentCellEmission.data() + propertySize * raySegmentCellIndices[s];
+            const PetscReal pathLength = raySegmentPathLengths[s];
+
+            if (pathLength < 0) {
+                // This is a boundary cell
+                for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
+                    segmentCalculation[wavelengthIndex].Ij += emission[wavelengthIndex] * segmentCalculation[wavelengthIndex].Krad;
+                    //! In the future we may want to set this intensity with a boundary condition class.
+                }
+            } else {
+                // This is not a boundary cell
+                for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
+                    PetscReal absorbed_portion = exp(-kappa[wavelengthIndex] * pathLength);
+                    segmentCalculation[wavelengthIndex].Ij += emission[wavelengthIndex] * (1 - absorbed_portion) * segmentCalculation[wavelengthIndex].Krad;
 
-        for (const auto& cellSegment : raySegment) {
-            const PetscReal* sol = nullptr;          //!< The solution value at any given location
-            const PetscReal* temperature = nullptr;  //!< The temperature at any given location
-            DMPlexPointLocalRead(solDm, cellSegment.cell, solArray, &sol);
-            if (sol) {
-                DMPlexPointLocalFieldRead(auxDm, cellSegment.cell, temperatureField.id, auxArray, &temperature);
-                if (temperature) {                                       /** Input absorptivity (kappa) values from model here. */
-                    PetscReal kappa[absorptivityFunction.propertySize];  //!< Absorptivity coefficient, property of each cell. This is an array that we will iterate through for every evaluation
-                    PetscReal emission[absorptivityFunction.propertySize];
-                    absorptivityFunction.function(sol, *temperature, kappa, absorptivityFunctionContext);  //! Get the absorption and emission information from the provided properties models.
-                    emissivityFunction.function(sol, *temperature, emission, emissivityFunctionContext);
-                    //! Get the pointer to the returned array of absorption values. Iterate through every wavelength for the evaluation.
-                    if (cellSegment.pathLength < 0) {
-                        // This is a boundary cell
-                        for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
-                            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Ij +=
-                                emission[wavelengthIndex] * raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad;
-                            //! In the future we may want to set this intensity with a boundary condition class.
-                        }
-                    } else {
-                        // This is not a boundary cell
-                        for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
-                            PetscReal absorbed_portion = exp(-kappa[wavelengthIndex] * cellSegment.pathLength);
-                            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Ij +=
-                                emission[wavelengthIndex] * (1 - absorbed_portion) * raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad;
-
-                            // Compute the total absorption for this domain
-                            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad *= absorbed_portion;
-                        }
-                    }
+                    // Compute the total absorption for this domain
+                    segmentCalculation[wavelengthIndex].Krad *= absorbed_portion;
                 }
             }
         }
-    }
+    });
 
     // Now that all the ray information is computed, transfer it back to rank that originated each ray using a pull
     PetscSFBcastBegin(remoteAccess, carrierMpiType, (const void*)raySegmentsCalculations.data(), (void*)raySegmentSummary.data(), MPI_REPLACE) >> utilities::PetscUtilities::checkError;
@@ -614,12 +762,13 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
      *  Therefore, the indexing is [rayOffset], where the ray refers to the wavelength independent ray count.
      * raySegmentSummary: This will store a value for every ray segment and wavelength. Each ray will integrate its ray segments together for every wavelength.
      * */
-    std::size_t segmentOffset = 0;
-    std::size_t rayOffset = 0;
-    for (PetscInt cellIndex = 0; cellIndex < numberOriginCells; ++cellIndex) {
+    Kokkos::parallel_for("Radiation::EvaluateGains", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, numberOriginCells), [&](const PetscInt cellIndex) {
         for (unsigned short int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex)
             evaluatedGains[absorptivityFunction.propertySize * cellIndex + wavelengthIndex] = 0.0;  //! Zero the evaluated gains for this ray specifically. Do this for all wavelengths.
         for (PetscInt rayIndex = 0; rayIndex < raysPerCell; ++rayIndex) {
+            const std::size_t rayOffset = cellIndex * raysPerCell + rayIndex;
+            std::size_t segmentOffset = originRaySegmentOffsets[rayOffset];
+
             // Add the black body radiation transmitted through the domain to the source term
             PetscReal iSource[absorptivityFunction.propertySize];
             PetscReal kRadd[absorptivityFunction.propertySize];
@@ -643,9 +792,8 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
 
             for (unsigned short int wavelengthIndex = 0; wavelengthIndex < propertySize; wavelengthIndex++)
                 evaluatedGains[absorptivityFunction.propertySize * cellIndex + wavelengthIndex] += iSource[wavelengthIndex] * gainsFactor[rayOffset];
-            rayOffset++;
         }
-    }
+    });
 
     /** Cleanup */
     VecRestoreArrayRead(solVec, &solArray);
@@ -654,47 +802,22 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
 }
 
 void ablate::radiation::Radiation::DeleteOutOfBounds(ablate::domain::SubDomain& subDomain) {
-    PetscReal* coord;
-    PetscInt* index;                    //!< Pointer to the coordinate field information
-    struct Virtualcoord* virtualcoord;  //!< Pointer to the primary (virtual) coordinate field information
-    struct Identifier* identifier;      //!< Pointer to the ray identifier information
-
-    /** Get the fields associated with the particle swarm so that they can be modified */
-    DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
+    PetscInt* index;  //!< Pointer to the cell index information
     DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-    DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-    DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
 
     PetscInt npoints = 0;
     DMSwarmGetLocalSize(radSearch, &npoints) >> utilities::PetscUtilities::checkError;  //!< Recalculate the number of particles that are in the domain
-    PetscMPIInt rank = 0;
-    MPI_Comm_rank(subDomain.GetComm(), &rank);
 
-    /**  */
+    //!< If the particles that were just created are sitting in the boundary cell of the face that they belong to, delete them
+    std::vector<PetscInt> outOfBoundsParticles;
     for (PetscInt ipart = 0; ipart < npoints; ipart++) {
-        //!< If the particles that were just created are sitting in the boundary cell of the face that they belong to, delete them
-        if (!(region->InRegion(region, subDomain.GetDM(), index[ipart]))) {  //!< If the particle location index and boundary cell index are the same, then they should be deleted
-            DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-            DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-            DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-            DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-
-            DMSwarmRemovePointAtIndex(radSearch, ipart);  //!< Delete the particle!
-            DMSwarmGetLocalSize(radSearch, &npoints);
-
-            DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-            DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-            DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-            DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-            ipart--;  //!< Check the point replacing the one that was deleted
+        if (!(region->InRegion(region, subDomain.GetDM(), index[ipart]))) {
+            outOfBoundsParticles.push_back(ipart);
         }
     }
-
-    /** Restore the fields associated with the particles */
-    DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
     DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-    DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-    DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+
+    RemoveParticles(outOfBoundsParticles);
 }
 
 std::ostream& ablate::radiation::operator<<(std::ostream& os, const ablate::radiation::Radiation::Identifier& id) {
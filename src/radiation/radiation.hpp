@@ -141,10 +141,13 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
      * */
     void EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec);
 
-    /** Determines the next location of the search particles during the initialization
+    /** Marches the search particles through the local cells during the initialization, recording the ray segments as they go.
+     * Particles that reach a boundary are removed and particles that leave the partition are labeled with the rank that owns the next cell.
+     * Particles that could not be located in the local cells are left to be located in the mesh by the next migrate.
+     * @return the number of local particles that must be located in the mesh
      * */
-    virtual void ParticleStep(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray, DM radReturn, PetscInt nlocalpoints,
-                              PetscInt nglobalpoints);  //!< Routine to move the particle one step
+    virtual PetscInt ParticleStep(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray, DM radReturn, PetscInt nlocalpoints,
+                                  PetscInt nglobalpoints);  //!< Routine to move the particle through the local partition
 
     //! If this local rank has never seen this search particle before, then it needs to add a new ray segment to local memory and record its index
     virtual void IdentifyNewRaysOnRank(domain::SubDomain& subDomain, DM radReturn, PetscInt nlocalpoints);
@@ -187,6 +190,34 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
         PetscReal hhere;
     };
 
+    /** The local cell adjacency used to march the search particles from cell to cell without locating them in the mesh */
+    struct CellAdjacency {
+        //! the rank of this process, cells owned by any other rank are remote
+        PetscMPIInt rank = 0;
+        //! the first cell in the dm
+        PetscInt cStart = 0;
+        //! the faces of cell c are [faceOffsets[c - cStart], faceOffsets[c - cStart + 1])
+        std::vector<PetscInt> faceOffsets;
+        std::vector<PetscInt> faces;
+        //! the cell on the other side of each face, or -1 if the face is on the boundary of the domain
+        std::vector<PetscInt> neighbors;
+        //! the sign that orients each face normal out of the cell
+        std::vector<PetscReal> outwardSigns;
+        //! the rank that owns each cell and the index of the cell on that rank
+        std::vector<PetscMPIInt> ownerRanks;
+        std::vector<PetscInt> ownerCells;
+    };
+
+    /** The result of marching a search particle through the local cells */
+    enum class MarchResult {
+        //! the particle reached a boundary cell and the boundary segment was added
+        Finished,
+        //! the particle entered a cell owned by another rank
+        Remote,
+        //! the next cell could not be found from the adjacency or the local cells, the particle must be located in the mesh
+        Relocate
+    };
+
     /// Class Methods
     /** Returns the forward path length of a travelling particle with any face.
      * The function will return zero if the intersection is not in the direction of travel.
@@ -213,6 +244,57 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
      */
     void DeleteOutOfBounds(ablate::domain::SubDomain& subDomain);
 
+    /**
+     * Remove a batch of particles from the search swarm
+     * @param particles the ascending local indices of the particles to remove
+     */
+    void RemoveParticles(const std::vector<PetscInt>& particles);
+
+    /**
+     * Build the cell adjacency from the cones and supports of the dm and the cell owners from the point sf.  The cell and face geometry must be computed first.
+     * @param subDomain
+     */
+    void BuildCellAdjacency(ablate::domain::SubDomain& subDomain);
+
+    /**
+     * Check if a point is inside a cell using the faces of the cell in the adjacency.  Points on a face are inside both cells.
+     * @param cell
+     * @param point the point to check (dim values)
+     * @param faceDM
+     * @param faceGeomArray
+     */
+    bool CellContains(PetscInt cell, const PetscReal point[], DM faceDM, const PetscScalar* faceGeomArray) const;
+
+    /**
+     * March a single search particle from cell to cell through the local adjacency, recording the ray segments until the particle reaches a boundary cell or leaves the partition.
+     * The next cell is taken from the exit face of each cell when it contains the point just beyond the face.  Otherwise, such as when the ray crosses near a vertex or edge, the point
+     * just beyond the face is located in the local cells.
+     * @param subDomain
+     * @param faceDM
+     * @param faceGeomArray
+     * @param virtualcoord the particle position and direction, this is updated as the particle marches
+     * @param cell the cell the particle starts in, on return the local index of the remote cell or the last cell the particle was in
+     * @param ray the local ray segment being marched
+     * @param identifier the identifier of the search particle
+     * @return
+     */
+    MarchResult MarchParticle(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray, Virtualcoord& virtualcoord, PetscInt& cell, std::vector<CellSegment>& ray,
+                              const Identifier& identifier);
+
+    /**
+     * Record the path length of a ray through a cell
+     * @param ray the local ray segment being marched
+     * @param cell the cell being crossed
+     * @param pathLength the path length of the ray in the cell
+     * @param identifier the identifier of the search particle
+     */
+    virtual void AddCellSegment(std::vector<CellSegment>& ray, PetscInt cell, PetscReal pathLength, const Identifier& identifier) { ray.push_back({cell, pathLength}); }
+
+    /**
+     * Flatten the raySegments into the compressed sparse row arrays and determine the unique cells crossed by the local rays
+     */
+    void FlattenRaySegments();
+
     virtual void SetBoundary(CellSegment& raySegment, PetscInt index, Identifier identifier) {
         raySegment.cell = index;
         raySegment.pathLength = -1;
@@ -224,9 +306,28 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     PetscInt nPhi;     //!< The number of angles to solve with, given by user input (x2)
     PetscReal minCellRadius{};
 
+    //! the local cell adjacency, only held during the initialization
+    CellAdjacency cellAdjacency;
+
     //! store the local rays identified on this rank.  This includes rays that do and do not originate on this rank
     std::vector<std::vector<CellSegment>> raySegments;
 
+    //! the raySegments flattened into compressed sparse row storage, the segments for ray r are [raySegmentOffsets[r], raySegmentOffsets[r+1])
+    std::vector<PetscInt> raySegmentOffsets;
+
+    //! the index into segmentCells for each flattened cell segment
+    std::vector<PetscInt> raySegmentCellIndices;
+
+    //! the path length for each flattened cell segment (negative for boundary segments)
+    std::vector<PetscReal> raySegmentPathLengths;
+
+    //! the unique cells crossed by the local ray segments
+    std::vector<PetscInt> segmentCells;
+
+    //! the absorptivity and emission evaluated once per segment cell, indexed [propertySize * cellIndex + wavelengthIndex]
+    std::vector<PetscReal> segmentCellAbsorptivity;
+    std::vector<PetscReal> segmentCellEmission;
+
     //! the calculation over each of the remoteRays. indexed over remote ray
     std::vector<Carrier> raySegmentsCalculations;
 
@@ -242,6 +343,9 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     //! store the number of ray segments for each originating on this rank.  This may be zero
     std::vector<unsigned short int> raySegmentsPerOriginRay;
 
+    //! the offset of the first segment of each origin ray in the raySegmentSummary, so that each origin cell can be evaluated independently
+    std::vector<PetscInt> originRaySegmentOffsets;
+
     //! a vector of raySegment information for every local/remote ray segment ordered as ray, segment
     std::vector<Carrier> raySegmentSummary;
 
@@ -28,23 +28,26 @@ class RaySharingRadiation : public ablate::radiation::Radiation {
     void IdentifyNewRaysOnRank(ablate::domain::SubDomain& subDomain, DM radReturn, PetscInt npoints) override;
 
     /**
-     * This particle step will only write new cell indexes to a ray segment if the particle writing the segment is the first segment in the ray.
+     * This version will only write new cell indexes to a ray segment if the particle writing the segment is the first segment in the ray.
      * Being the first segment implies that the particle is native to the process. This way, no redundant cells are written.
-     * @param subDomain
-     * @param faceDM
-     * @param faceGeomArray
-     * @param radReturn
-     * @param nlocalpoints
-     * @param nglobalpoints
+     * @param ray
+     * @param cell
+     * @param pathLength
+     * @param identifier
      */
-    void ParticleStep(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray, DM radReturn, PetscInt nlocalpoints,
-                      PetscInt nglobalpoints) override;  //!< Routine to move the particle one step
+    void AddCellSegment(std::vector<CellSegment>& ray, PetscInt cell, PetscReal pathLength, const Identifier& identifier) override {
+        PetscMPIInt rank;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+        if (identifier.originRank == rank) {
+            ray.push_back({cell, pathLength});
+        }
+    }
 
     static inline std::string GetClassType() { return "RaySharingRadiation"; }
 
     /**
      * The version of the boundary condition will only set the boundary condition if the particle is native to the rank.
-     * This functions the same as the particle step function to prevent overwriting of the segment information by alien particles.
+     * This functions the same as the add cell segment function to prevent overwriting of the segment information by alien particles.
      * @param raySegment
      * @param index
      * @param identifier
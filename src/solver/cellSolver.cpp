@@ -1,5 +1,8 @@
 #include "cellSolver.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
 #include <utility>
+#include "utilities/kokkosUtilities.hpp"
 
 ablate::solver::CellSolver::CellSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options)
     : Solver(std::move(solverId), std::move(region), std::move(options)) {}
@@ -15,8 +18,16 @@ ablate::solver::CellSolver::~CellSolver() {
 
 void ablate::solver::CellSolver::RegisterAuxFieldUpdate(ablate::solver::CellSolver::AuxFieldUpdateFunction function, void* context, const std::vector<std::string>& auxFields,
                                                         const std::vector<std::string>& inputFields) {
-    AuxFieldUpdateFunctionDescription functionDescription{.function = function, .context = context, .inputFields = {}, .auxFields = {}};
+    AddAuxFieldUpdate(AuxFieldUpdateFunctionDescription{.function = function, .batchFunction = nullptr, .context = context, .inputFields = {}, .auxFields = {}}, auxFields, inputFields);
+}
+
+void ablate::solver::CellSolver::RegisterAuxFieldUpdate(ablate::solver::CellSolver::AuxFieldUpdateBatchFunction function, void* context, const std::vector<std::string>& auxFields,
+                                                        const std::vector<std::string>& inputFields) {
+    AddAuxFieldUpdate(AuxFieldUpdateFunctionDescription{.function = nullptr, .batchFunction = function, .context = context, .inputFields = {}, .auxFields = {}}, auxFields, inputFields);
+}
 
+void ablate::solver::CellSolver::AddAuxFieldUpdate(ablate::solver::CellSolver::AuxFieldUpdateFunctionDescription functionDescription, const std::vector<std::string>& auxFields,
+                                                   const std::vector<std::string>& inputFields) {
     for (const auto& auxField : auxFields) {
         auto fieldId = subDomain->GetField(auxField);
         functionDescription.auxFields.push_back(fieldId.id);
@@ -40,8 +51,14 @@ void ablate::solver::CellSolver::RegisterAuxFieldUpdate(ablate::solver::CellSolv
 }
 
 void ablate::solver::CellSolver::RegisterSolutionFieldUpdate(ablate::solver::CellSolver::SolutionFieldUpdateFunction function, void* context, const std::vector<std::string>& inputFields) {
-    SolutionFieldUpdateFunctionDescription functionDescription{.function = function, .context = context, .inputFieldsOffsets = {}};
+    AddSolutionFieldUpdate(SolutionFieldUpdateFunctionDescription{.function = function, .batchFunction = nullptr, .context = context, .inputFieldsOffsets = {}}, inputFields);
+}
+
+void ablate::solver::CellSolver::RegisterSolutionFieldUpdate(ablate::solver::CellSolver::SolutionFieldUpdateBatchFunction function, void* context, const std::vector<std::string>& inputFields) {
+    AddSolutionFieldUpdate(SolutionFieldUpdateFunctionDescription{.function = nullptr, .batchFunction = function, .context = context, .inputFieldsOffsets = {}}, inputFields);
+}
 
+void ablate::solver::CellSolver::AddSolutionFieldUpdate(ablate::solver::CellSolver::SolutionFieldUpdateFunctionDescription functionDescription, const std::vector<std::string>& inputFields) {
     for (const auto& inputField : inputFields) {
         auto fieldId = subDomain->GetField(inputField);
         functionDescription.inputFieldsOffsets.push_back(fieldId.offset);
@@ -108,25 +125,94 @@ void ablate::solver::CellSolver::UpdateAuxFields(PetscReal time, Vec locXVec, Ve
         }
     }
 
-    // March over each cell volume
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        PetscFVCellGeom* cellGeom;
-        const PetscReal* fieldValues;
-        PetscReal* auxValues;
+    // determine if there are point and/or batch update functions
+    bool pointFunctions = false;
+    bool batchFunctions = false;
+    for (const auto& auxFieldUpdateFunctionDescription : auxFieldUpdateFunctionDescriptions) {
+        pointFunctions = pointFunctions || auxFieldUpdateFunctionDescription.function;
+        batchFunctions = batchFunctions || auxFieldUpdateFunctionDescription.batchFunction;
+    }
+
+    // March over each cell volume for the point functions
+    if (pointFunctions) {
+        for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+            PetscFVCellGeom* cellGeom;
+            const PetscReal* fieldValues;
+            PetscReal* auxValues;
 
-        // Get the cell location
-        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+            // Get the cell location
+            const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
 
-        DMPlexPointLocalRead(dmCell, cell, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(plex, cell, locFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(auxDM, cell, localAuxFlowFieldArray, &auxValues) >> utilities::PetscUtilities::checkError;
+            DMPlexPointLocalRead(dmCell, cell, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
+            DMPlexPointLocalRead(plex, cell, locFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
+            DMPlexPointLocalRead(auxDM, cell, localAuxFlowFieldArray, &auxValues) >> utilities::PetscUtilities::checkError;
+
+            // for each function description
+            for (std::size_t uf = 0; uf < auxFieldUpdateFunctionDescriptions.size(); uf++) {
+                // If an update function was passed
+                if (auxFieldUpdateFunctionDescriptions[uf].function) {
+                    auxFieldUpdateFunctionDescriptions[uf].function(time, dim, cellGeom, uOff[uf].data(), fieldValues, aOff[uf].data(), auxValues, auxFieldUpdateFunctionDescriptions[uf].context) >>
+                        utilities::PetscUtilities::checkError;
+                }
+            }
+        }
+    }
+
+    // Pack the solution and aux values so that each batch function is called once over all cells
+    if (batchFunctions) {
+        PetscInt uStride, aStride;
+        PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &uStride) >> utilities::PetscUtilities::checkError;
+        PetscDSGetTotalDimension(subDomain->GetAuxDiscreteSystem(), &aStride) >> utilities::PetscUtilities::checkError;
+
+        const PetscInt numberCells = cellRange.end - cellRange.start;
+        packedSolution.resize(numberCells * uStride);
+        packedAux.resize(numberCells * aStride);
+
+        // the cells are packed/unpacked over the host threads, any error is reduced so that it can be thrown outside the parallel region
+        utilities::KokkosUtilities::Initialize();
+        const auto cellPolicy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(cellRange.start, cellRange.end);
+        int packError = 0;
+        Kokkos::parallel_reduce(
+            "CellSolver::PackAuxFields",
+            cellPolicy,
+            [&](const PetscInt c, int& error) {
+                const PetscReal* fieldValues = nullptr;
+                const PetscReal* auxValues = nullptr;
+                const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+
+                error = PetscMax(error, (int)DMPlexPointLocalRead(plex, cell, locFlowFieldArray, &fieldValues));
+                error = PetscMax(error, (int)DMPlexPointLocalRead(auxDM, cell, localAuxFlowFieldArray, &auxValues));
+                if (fieldValues && auxValues) {
+                    std::copy_n(fieldValues, uStride, packedSolution.data() + (c - cellRange.start) * uStride);
+                    std::copy_n(auxValues, aStride, packedAux.data() + (c - cellRange.start) * aStride);
+                }
+            },
+            Kokkos::Max<int>(packError));
+        ((PetscErrorCode)packError) >> utilities::PetscUtilities::checkError;
 
-        // for each function description
         for (std::size_t uf = 0; uf < auxFieldUpdateFunctionDescriptions.size(); uf++) {
-            // If an update function was passed
-            auxFieldUpdateFunctionDescriptions[uf].function(time, dim, cellGeom, uOff[uf].data(), fieldValues, aOff[uf].data(), auxValues, auxFieldUpdateFunctionDescriptions[uf].context) >>
-                utilities::PetscUtilities::checkError;
+            if (auxFieldUpdateFunctionDescriptions[uf].batchFunction) {
+                auxFieldUpdateFunctionDescriptions[uf].batchFunction(
+                    time, dim, numberCells, uOff[uf].data(), uStride, packedSolution.data(), aOff[uf].data(), aStride, packedAux.data(), auxFieldUpdateFunctionDescriptions[uf].context) >>
+                    utilities::PetscUtilities::checkError;
+            }
         }
+
+        // copy back the updated aux values
+        int unpackError = 0;
+        Kokkos::parallel_reduce(
+            "CellSolver::UnpackAuxFields",
+            cellPolicy,
+            [&](const PetscInt c, int& error) {
+                PetscReal* auxValues = nullptr;
+                const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+                error = PetscMax(error, (int)DMPlexPointLocalRef(auxDM, cell, localAuxFlowFieldArray, &auxValues));
+                if (auxValues) {
+                    std::copy_n(packedAux.data() + (c - cellRange.start) * aStride, aStride, auxValues);
+                }
+            },
+            Kokkos::Max<int>(unpackError));
+        ((PetscErrorCode)unpackError) >> utilities::PetscUtilities::checkError;
     }
 
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
@@ -162,26 +248,63 @@ void ablate::solver::CellSolver::UpdateSolutionFields(PetscReal time, Vec globXV
     // Get the cell dim
     PetscInt dim = subDomain->GetDimensions();
 
-    // March over each cell volume
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        PetscFVCellGeom* cellGeom;
-        PetscReal* fieldValues;
-
-        // Get the cell location
-        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
-
-        DMPlexPointLocalRead(dmCell, cell, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
-        DMPlexPointGlobalRef(dm, cell, globalFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
+    // Apply the updates in the order they were registered.  Consecutive point functions share a single march over the cells and consecutive batch
+    // functions share a single pack of the owned cells.
+    auto groupStart = solutionFieldUpdateFunctionDescriptions.begin();
+    while (groupStart != solutionFieldUpdateFunctionDescriptions.end()) {
+        const bool pointGroup = groupStart->function != nullptr;
+        auto groupEnd = std::find_if(
+            groupStart, solutionFieldUpdateFunctionDescriptions.end(), [pointGroup](const auto& description) { return (description.function != nullptr) != pointGroup; });
+
+        // March over each cell volume
+        if (pointGroup) {
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                PetscFVCellGeom* cellGeom;
+                PetscReal* fieldValues;
+
+                // Get the cell location
+                const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+
+                DMPlexPointLocalRead(dmCell, cell, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
+                DMPlexPointGlobalRef(dm, cell, globalFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
+
+                // for each function description
+                if (fieldValues) {
+                    for (auto description = groupStart; description != groupEnd; ++description) {
+                        description->function(time, dim, cellGeom, description->inputFieldsOffsets.data(), fieldValues, description->context) >> utilities::PetscUtilities::checkError;
+                    }
+                }
+            }
+        } else {
+            // Pack the owned cells so that each batch function is called once over all cells
+            PetscInt uStride;
+            PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &uStride) >> utilities::PetscUtilities::checkError;
+
+            packedCells.clear();
+            packedSolution.resize((cellRange.end - cellRange.start) * uStride);
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                PetscReal* fieldValues;
+                const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+                DMPlexPointGlobalRef(dm, cell, globalFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
+                if (fieldValues) {
+                    std::copy_n(fieldValues, uStride, packedSolution.data() + packedCells.size() * uStride);
+                    packedCells.push_back(cell);
+                }
+            }
 
-        // for each function description
-        if (fieldValues) {
-            for (auto& solutionFieldUpdateFunctionDescription : solutionFieldUpdateFunctionDescriptions) {
-                // If an update function was passed
-                solutionFieldUpdateFunctionDescription.function(
-                    time, dim, cellGeom, solutionFieldUpdateFunctionDescription.inputFieldsOffsets.data(), fieldValues, solutionFieldUpdateFunctionDescription.context) >>
+            for (auto description = groupStart; description != groupEnd; ++description) {
+                description->batchFunction(time, dim, (PetscInt)packedCells.size(), description->inputFieldsOffsets.data(), uStride, packedSolution.data(), description->context) >>
                     utilities::PetscUtilities::checkError;
             }
+
+            // copy back the updated solution values
+            for (std::size_t c = 0; c < packedCells.size(); ++c) {
+                PetscReal* fieldValues;
+                DMPlexPointGlobalRef(dm, packedCells[c], globalFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
+                std::copy_n(packedSolution.data() + c * uStride, uStride, fieldValues);
+            }
         }
+        groupStart = groupEnd;
     }
 
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
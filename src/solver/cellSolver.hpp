@@ -14,15 +14,23 @@ class CellSolver : public solver::Solver {
     using AuxFieldUpdateFunction = PetscErrorCode (*)(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* u, const PetscInt aOff[],
                                                       PetscScalar* auxField, void* ctx);
 
+    //! function template for updating the aux field over a batch of cells.  The solution (u) and aux values for each cell are packed contiguously with a stride of uStride/aStride
+    using AuxFieldUpdateBatchFunction = PetscErrorCode (*)(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, const PetscScalar* u, const PetscInt aOff[],
+                                                           PetscInt aStride, PetscScalar* auxField, void* ctx);
+
     //! function template for updating the solution field
     using SolutionFieldUpdateFunction = PetscErrorCode (*)(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], PetscScalar* u, void* ctx);
 
+    //! function template for updating the solution field over a batch of cells.  The solution (u) for each cell is packed contiguously with a stride of uStride
+    using SolutionFieldUpdateBatchFunction = PetscErrorCode (*)(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, PetscScalar* u, void* ctx);
+
    private:
     /**
      * struct to describe how to compute the aux variable update
      */
     struct AuxFieldUpdateFunctionDescription {
         AuxFieldUpdateFunction function;
+        AuxFieldUpdateBatchFunction batchFunction;
         void* context;
         std::vector<PetscInt> inputFields;
         std::vector<PetscInt> auxFields;
@@ -31,11 +39,27 @@ class CellSolver : public solver::Solver {
     //! list of auxField update functions
     std::vector<AuxFieldUpdateFunctionDescription> auxFieldUpdateFunctionDescriptions;
 
+    //! the packed solution and aux values used for the batch aux/solution field updates
+    std::vector<PetscScalar> packedSolution;
+    std::vector<PetscScalar> packedAux;
+
+    //! the owned cells packed for the batch solution field updates
+    std::vector<PetscInt> packedCells;
+
+    /**
+     * Add the aux field update function description, replacing any existing update for the same aux fields
+     * @param functionDescription
+     * @param auxFields
+     * @param inputFields
+     */
+    void AddAuxFieldUpdate(AuxFieldUpdateFunctionDescription functionDescription, const std::vector<std::string>& auxFields, const std::vector<std::string>& inputFields);
+
     /**
      * struct to describe how to compute the solution variable update
      */
     struct SolutionFieldUpdateFunctionDescription {
         SolutionFieldUpdateFunction function;
+        SolutionFieldUpdateBatchFunction batchFunction;
         void* context;
         std::vector<PetscInt> inputFieldsOffsets;
     };
@@ -43,6 +67,13 @@ class CellSolver : public solver::Solver {
     //! list of auxField update functions
     std::vector<SolutionFieldUpdateFunctionDescription> solutionFieldUpdateFunctionDescriptions;
 
+    /**
+     * Add the solution field update function description, replacing any existing update with the same input fields
+     * @param functionDescription
+     * @param inputFields
+     */
+    void AddSolutionFieldUpdate(SolutionFieldUpdateFunctionDescription functionDescription, const std::vector<std::string>& inputFields);
+
    protected:
     //! Vector used to describe the entire cell geom of the dm.  This is constant and does not depend upon region.
     Vec cellGeomVec = nullptr;
@@ -69,6 +100,15 @@ class CellSolver : public solver::Solver {
      */
     void RegisterAuxFieldUpdate(AuxFieldUpdateFunction function, void* context, const std::vector<std::string>& auxField, const std::vector<std::string>& inputFields);
 
+    /**
+     * Register a auxFieldUpdate that is computed over every cell in a single call
+     * @param function
+     * @param context
+     * @param auxFields
+     * @param inputFields
+     */
+    void RegisterAuxFieldUpdate(AuxFieldUpdateBatchFunction function, void* context, const std::vector<std::string>& auxField, const std::vector<std::string>& inputFields);
+
     /**
      * Register a auxFieldUpdate
      * @param function
@@ -79,6 +119,14 @@ class CellSolver : public solver::Solver {
      */
     void RegisterSolutionFieldUpdate(SolutionFieldUpdateFunction function, void* context, const std::vector<std::string>& inputFields);
 
+    /**
+     * Register a solutionFieldUpdate that is computed over every cell in a single call.  Point and batch updates are applied in the order they are registered.
+     * @param function
+     * @param context
+     * @param inputFields
+     */
+    void RegisterSolutionFieldUpdate(SolutionFieldUpdateBatchFunction function, void* context, const std::vector<std::string>& inputFields);
+
     /**
      * Helper function to march over each cell and update the aux Fields
      * @param time
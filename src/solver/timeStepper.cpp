@@ -144,6 +144,7 @@ void ablate::solver::TimeStepper::Solve() {
 
             serializer->Serialize(ts, step, time, domain->GetSolutionVector()) >> utilities::PetscUtilities::checkError;
             serializer->Serialize(ts, step + 1, time, domain->GetSolutionVector()) >> utilities::PetscUtilities::checkError;
+            serializer->Flush();
         }
         // exit before ts solver
         return;
@@ -187,6 +188,11 @@ void ablate::solver::TimeStepper::Solve() {
     PetscLogEventBegin(logEvent, 0, 0, 0, 0);
     TSSolve(ts, solutionVec) >> utilities::PetscUtilities::checkError;
     PetscLogEventEnd(logEvent, 0, 0, 0, 0);
+
+    // complete any outstanding writes while every rank is still here
+    if (serializer) {
+        serializer->Flush();
+    }
 }
 
 double ablate::solver::TimeStepper::GetTime() const {
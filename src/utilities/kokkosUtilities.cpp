@@ -1,6 +1,10 @@
 #include "kokkosUtilities.hpp"
 #include <Kokkos_Core.hpp>
+#include <type_traits>
 #include "environment/runEnvironment.hpp"
+#if defined(KOKKOS_ENABLE_OPENMP)
+#include <omp.h>
+#endif
 
 void ablate::utilities::KokkosUtilities::Initialize() {
     if (!Kokkos::is_initialized()) {
@@ -9,3 +13,29 @@ void ablate::utilities::KokkosUtilities::Initialize() {
         ablate::environment::RunEnvironment::RegisterCleanUpFunction("ablate::utilities::KokkosUtilities::Initialize", []() { Kokkos::finalize(); });
     }
 }
+
+// Only the OpenMP host execution space has a public way to get the id of the calling thread (omp_get_thread_num inside the Kokkos parallel region).
+// For any other host execution space a single host thread context is reported so that callers fall back to their serial loops.
+#if defined(KOKKOS_ENABLE_OPENMP)
+static constexpr bool hostThreadIdAvailable = std::is_same_v<Kokkos::DefaultHostExecutionSpace, Kokkos::OpenMP>;
+#else
+static constexpr bool hostThreadIdAvailable = false;
+#endif
+
+int ablate::utilities::KokkosUtilities::GetMaxHostThreads() {
+    if constexpr (hostThreadIdAvailable) {
+        Initialize();
+        return Kokkos::DefaultHostExecutionSpace().concurrency();
+    } else {
+        return 1;
+    }
+}
+
+int ablate::utilities::KokkosUtilities::GetHostThreadId() {
+#if defined(KOKKOS_ENABLE_OPENMP)
+    if constexpr (hostThreadIdAvailable) {
+        return omp_get_thread_num();
+    }
+#endif
+    return 0;
+}
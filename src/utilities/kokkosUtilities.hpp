@@ -10,6 +10,21 @@ class KokkosUtilities {
      */
     static void Initialize();
 
+    /**
+     * The number of threads available in the default host execution space.  Kokkos is initialized if needed.  This is the number of per-thread
+     * contexts a class needs so that it can be used inside a host parallel loop.  This is one unless the host execution space is OpenMP, the only space
+     * that provides the calling thread id.
+     * @return
+     */
+    static int GetMaxHostThreads();
+
+    /**
+     * The id [0, GetMaxHostThreads()) of the calling thread in the default host execution space (omp_get_thread_num).  This is used to select the
+     * per-thread context.
+     * @return
+     */
+    static int GetHostThreadId();
+
    private:
     KokkosUtilities() = delete;
 };
@@ -318,11 +318,11 @@ TEST_P(BoundarySolverFluxTestFixture, ShouldComputeCorrectGradientsOnBoundary) {
                     const PetscInt* neighborCells;
                     DMPlexGetSupportSize(subDomain->GetDM(), faceId, &numberNeighborCells) >> utilities::PetscUtilities::checkError;
                     DMPlexGetSupport(subDomain->GetDM(), faceId, &neighborCells) >> utilities::PetscUtilities::checkError;
-                    if (neighborCells[0] == cell && neighborCells[1] == stencil.stencil.front()) {
+                    if (neighborCells[0] == cell && neighborCells[1] == boundarySolver->GetStencil(stencil)[0]) {
                         neighborCellFound = true;
                         neighborCell = neighborCells[1];
                     }
-                    if (neighborCells[1] == cell && neighborCells[0] == stencil.stencil.front()) {
+                    if (neighborCells[1] == cell && neighborCells[0] == boundarySolver->GetStencil(stencil)[0]) {
                         neighborCellFound = true;
                         neighborCell = neighborCells[0];
                     }
@@ -0,0 +1,221 @@
+#include <functional>
+#include <vector>
+#include "boundarySolver/physics/subModels/batchedOneDimensionHeatTransfer.hpp"
+#include "convergenceTester.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "petscTestFixture.hpp"
+
+struct BatchedOneDimensionHeatTransferTestParameters {
+    // Creation options
+    const std::shared_ptr<ablate::parameters::MapParameters> properties;
+    const std::shared_ptr<ablate::parameters::MapParameters> options;
+    std::optional<double> maximumSurfaceTemperature;
+
+    // exact solution also used for init
+    std::function<std::shared_ptr<ablate::mathFunctions::MathFunction>()> exactSolutionFactory;
+
+    // ts options
+    PetscReal timeEnd;
+    PetscInt numberSolves;
+
+    // comparisons
+    PetscReal expectedConvergenceRate;
+};
+
+class BatchedOneDimensionHeatTransferTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<BatchedOneDimensionHeatTransferTestParameters> {};
+
+TEST_P(BatchedOneDimensionHeatTransferTestFixture, ShouldConverge) {
+    // get the required variables
+    const auto& params = GetParam();
+
+    // Set the initial number of faces and profiles
+    PetscInt initialNx = 20;
+    const PetscInt numberProfiles = 3;
+
+    testingResources::ConvergenceTester l2History("l2");
+
+    // Get the exact solution
+    auto exactSolution = params.exactSolutionFactory();
+
+    // March over each level
+    for (PetscInt l = 0; l < 3; l++) {
+        // Create a mesh
+        PetscInt nx1D = initialNx * PetscPowInt(2, l);
+        PetscPrintf(PETSC_COMM_WORLD, "Running Calculation at Level %" PetscInt_FMT " (%" PetscInt_FMT ")\n", l, nx1D);
+
+        // Set the nx in the solver options
+        params.options->Insert("dm_plex_box_faces", nx1D);
+
+        // Create the batch of 1D solvers
+        auto solidHeatTransfer = std::make_shared<ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer>(
+            numberProfiles, params.properties, exactSolution, params.options, params.maximumSurfaceTemperature.value_or(PETSC_DEFAULT));
+
+        // Advance each profile, pass in a surface heat flux and update the internal properties
+        for (PetscInt s = 0; s < params.numberSolves; ++s) {
+            for (PetscInt p = 0; p < numberProfiles; ++p) {
+                PetscReal surfaceTemperature;
+                PetscReal heatFlux;
+                solidHeatTransfer->Solve(p, 0.0, params.timeEnd / params.numberSolves, surfaceTemperature, heatFlux) >> ablate::utilities::PetscUtilities::checkError;
+            }
+        }
+
+        // every profile should be identical
+        for (PetscInt p = 1; p < numberProfiles; ++p) {
+            for (PetscInt n = 0; n < solidHeatTransfer->GetNumberNodes(); ++n) {
+                ASSERT_DOUBLE_EQ(solidHeatTransfer->GetProfile(0)[n], solidHeatTransfer->GetProfile(p)[n]);
+            }
+            ASSERT_DOUBLE_EQ(solidHeatTransfer->GetTime(0), solidHeatTransfer->GetTime(p));
+        }
+
+        // Compute the nodal l2 error
+        const auto time = solidHeatTransfer->GetTime(0);
+        const auto domainLength = params.options->GetExpect<double>("dm_plex_box_upper");
+        const PetscReal h = domainLength / nx1D;
+        PetscReal error = 0.0;
+        for (PetscInt n = 0; n < solidHeatTransfer->GetNumberNodes(); ++n) {
+            const PetscReal x[3] = {solidHeatTransfer->GetNodeLocation(n), 0.0, 0.0};
+            error += h * PetscSqr(solidHeatTransfer->GetProfile(0)[n] - exactSolution->Eval(x, 1, time));
+        }
+
+        // record the error
+        l2History.Record(h, {PetscSqrtReal(error)});
+    }
+    // ASSERt
+    std::string l2Message;
+    if (!l2History.CompareConvergenceRate({GetParam().expectedConvergenceRate}, l2Message, false)) {
+        FAIL() << l2Message;
+    }
+}
+
+// helper function to create a result function
+static std::shared_ptr<ablate::mathFunctions::MathFunction> CreateHeatEquationDirichletExactSolution(PetscReal length, PetscReal specificHeat, PetscReal conductivity, PetscReal density,
+                                                                                                     PetscReal temperatureInit, PetscReal temperatureBoundary, PetscReal timeOffset = 0.0) {
+    auto function = [conductivity, density, specificHeat, temperatureInit, temperatureBoundary, length, timeOffset](int dim, double time, const double x[], int nf, double* u, void* ctx) {
+        // compute the alpha in the equation
+        time += timeOffset;
+        PetscReal alpha = conductivity / (density * specificHeat);
+        PetscReal effectiveTemperatureInit = (temperatureInit - temperatureBoundary);
+        PetscReal T = 0.0;
+        for (PetscInt n = 1; n < 2000; ++n) {
+            PetscReal Bn = -effectiveTemperatureInit * 2.0 * (-1.0 + PetscPowReal(-1.0, n)) / (n * PETSC_PI);
+            T += Bn * PetscSinReal(n * PETSC_PI * x[0] / length) * PetscExpReal(-n * n * PETSC_PI * PETSC_PI * alpha * time / (PetscSqr(length)));
+        }
+
+        u[0] = PetscMax(temperatureBoundary, T + temperatureBoundary);
+        return PETSC_SUCCESS;
+    };
+
+    return ablate::mathFunctions::Create(function);
+}
+
+INSTANTIATE_TEST_SUITE_P(SolidHeatTransfer, BatchedOneDimensionHeatTransferTestFixture,
+                         testing::Values(
+                             // no boundary temperature
+                             (BatchedOneDimensionHeatTransferTestParameters){.properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}}),
+                                                                             .options = ablate::parameters::MapParameters::Create({{"ts_dt", "1E-4"}, {"dm_plex_box_upper", .1}}),
+                                                                             .maximumSurfaceTemperature = 0.0,
+                                                                             .exactSolutionFactory = []() { return CreateHeatEquationDirichletExactSolution(.1, 1000.0, 1.0, 1.0, 1000.0, 000.0, 1E-5); },
+                                                                             .timeEnd = .01,
+                                                                             .numberSolves = 1,
+                                                                             .expectedConvergenceRate = 2.0},
+                             // fixed boundary temperature advanced over many solves
+                             (BatchedOneDimensionHeatTransferTestParameters){.properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", .25}, {"density", 0.7}}),
+                                                                             .options = ablate::parameters::MapParameters::Create({{"ts_dt", "0.001"}, {"dm_plex_box_upper", .25}}),
+                                                                             .maximumSurfaceTemperature = 400.0,
+                                                                             .exactSolutionFactory = []() { return CreateHeatEquationDirichletExactSolution(.25, 1000.0, 0.25, 0.7, 1500.0, 400.0, .01); },
+                                                                             .timeEnd = .5,
+                                                                             .numberSolves = 10,
+                                                                             .expectedConvergenceRate = 2.0}
+
+                             ),
+                         [](const testing::TestParamInfo<BatchedOneDimensionHeatTransferTestParameters>& info) { return std::to_string(info.index); });
+
+struct BatchedOneDimensionHeatTransferFluxTestParameters {
+    // Creation options
+    const std::shared_ptr<ablate::parameters::MapParameters> properties;
+    const std::shared_ptr<ablate::parameters::MapParameters> options;
+    std::optional<double> maximumSurfaceTemperature;
+    PetscReal initialTemperature;
+
+    // the heat flux to the surface for each profile
+    std::vector<PetscReal> heatFluxesToSurface;
+
+    // ts options
+    PetscReal timeEnd;
+    PetscInt numberSolves;
+
+    // the relative tolerance used to compare against the semi-infinite solid solution
+    PetscReal relativeTolerance;
+};
+
+class BatchedOneDimensionHeatTransferFluxTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<BatchedOneDimensionHeatTransferFluxTestParameters> {};
+
+TEST_P(BatchedOneDimensionHeatTransferFluxTestFixture, ShouldMatchSemiInfiniteSolidWithSurfaceHeatFlux) {
+    // get the required variables
+    const auto& params = GetParam();
+    const auto numberProfiles = (PetscInt)params.heatFluxesToSurface.size();
+    const auto conductivity = params.properties->GetExpect<PetscReal>("conductivity");
+    const auto alpha = conductivity / (params.properties->GetExpect<PetscReal>("density") * params.properties->GetExpect<PetscReal>("specificHeat"));
+
+    // Create the batch of 1D solvers
+    auto solidHeatTransfer = std::make_shared<ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer>(
+        numberProfiles, params.properties, ablate::mathFunctions::Create(params.initialTemperature), params.options, params.maximumSurfaceTemperature.value_or(PETSC_DEFAULT));
+
+    // Advance each profile with its own surface heat flux
+    std::vector<PetscReal> surfaceTemperatures(numberProfiles), heatFluxes(numberProfiles);
+    for (PetscInt s = 0; s < params.numberSolves; ++s) {
+        for (PetscInt p = 0; p < numberProfiles; ++p) {
+            solidHeatTransfer->Solve(p, params.heatFluxesToSurface[p], params.timeEnd / params.numberSolves, surfaceTemperatures[p], heatFluxes[p]) >>
+                ablate::utilities::PetscUtilities::checkError;
+
+            // the surface should never go above the maximum surface temperature
+            if (params.maximumSurfaceTemperature) {
+                ASSERT_LE(surfaceTemperatures[p], params.maximumSurfaceTemperature.value() * (1.0 + PETSC_SMALL)) << "profile " << p << " at solve " << s;
+            }
+        }
+    }
+
+    // compare against the semi-infinite solid solution
+    const auto time = solidHeatTransfer->GetTime(0);
+    for (PetscInt p = 0; p < numberProfiles; ++p) {
+        // constant heat flux, T(0, t) = T0 + 2 q sqrt(alpha t / pi) / k
+        const PetscReal fluxSurfaceTemperature = params.initialTemperature + 2.0 * params.heatFluxesToSurface[p] * PetscSqrtReal(alpha * time / PETSC_PI) / conductivity;
+
+        if (params.maximumSurfaceTemperature && fluxSurfaceTemperature > params.maximumSurfaceTemperature.value()) {
+            // held at the maximum temperature, q(t) = k (Tmax - T0) / sqrt(pi alpha t), assuming the surface was clamped almost immediately
+            const PetscReal temperatureRise = params.maximumSurfaceTemperature.value() - params.initialTemperature;
+            const PetscReal expectedHeatFlux = conductivity * temperatureRise / PetscSqrtReal(PETSC_PI * alpha * time);
+            ASSERT_NEAR(surfaceTemperatures[p], params.maximumSurfaceTemperature.value(), PETSC_SMALL * params.maximumSurfaceTemperature.value()) << "profile " << p;
+            ASSERT_NEAR(heatFluxes[p], expectedHeatFlux, params.relativeTolerance * expectedHeatFlux) << "profile " << p;
+        } else {
+            const PetscReal temperatureRise = fluxSurfaceTemperature - params.initialTemperature;
+            ASSERT_NEAR(surfaceTemperatures[p], fluxSurfaceTemperature, params.relativeTolerance * temperatureRise + PETSC_SMALL) << "profile " << p;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SolidHeatTransfer, BatchedOneDimensionHeatTransferFluxTestFixture,
+                         testing::Values(
+                             // free surface heated by different fluxes
+                             (BatchedOneDimensionHeatTransferFluxTestParameters){
+                                 .properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}}),
+                                 .options = ablate::parameters::MapParameters::Create({{"ts_dt", "1E-4"}, {"dm_plex_box_upper", .2}, {"dm_plex_box_faces", 400}}),
+                                 .maximumSurfaceTemperature = {},
+                                 .initialTemperature = 300.0,
+                                 .heatFluxesToSurface = {0.0, 1E3, 1E4},
+                                 .timeEnd = 1.0,
+                                 .numberSolves = 10,
+                                 .relativeTolerance = 1E-2},
+                             // heated until the surface reaches the maximum temperature and switches to a fixed temperature
+                             (BatchedOneDimensionHeatTransferFluxTestParameters){
+                                 .properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}}),
+                                 .options = ablate::parameters::MapParameters::Create({{"ts_dt", "1E-4"}, {"dm_plex_box_upper", .2}, {"dm_plex_box_faces", 400}}),
+                                 .maximumSurfaceTemperature = 400.0,
+                                 .initialTemperature = 300.0,
+                                 .heatFluxesToSurface = {1E3, 1E5},
+                                 .timeEnd = 1.0,
+                                 .numberSolves = 100,
+                                 .relativeTolerance = 5E-2}),
+                         [](const testing::TestParamInfo<BatchedOneDimensionHeatTransferFluxTestParameters>& info) { return std::to_string(info.index); });
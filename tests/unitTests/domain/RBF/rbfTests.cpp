@@ -409,6 +409,160 @@ TEST_P(RBFTestFixture_Derivative, CheckDerivativeFunctions) {
     EndWithMPI
 }
 
+// This tests that the assembled derivative operators match the single-cell derivative functions.
+TEST_P(RBFTestFixture_Derivative, CheckDerivativeOperators) {
+    StartWithMPI
+        // initialize petsc and mpi
+        environment::RunEnvironment::Initialize(argc, argv);
+        utilities::PetscUtilities::Initialize();
+        auto testingParam = GetParam();
+        std::vector<std::shared_ptr<domain::rbf::RBF>> rbfList = testingParam.rbfList;
+
+        //             Make the field
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptor = {
+            std::make_shared<ablate::domain::FieldDescription>("fieldA", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::AUX, ablate::domain::FieldType::FVM)};
+
+        //             Create the mesh
+        auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                      fieldDescriptor,
+                                                      std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(3)},
+                                                      testingParam.meshFaces,
+                                                      testingParam.meshStart,
+                                                      testingParam.meshEnd,
+                                                      std::vector<std::string>{},
+                                                      testingParam.meshSimplex);
+
+        mesh->InitializeSubDomains();
+
+        std::shared_ptr<ablate::domain::SubDomain> subDomain = mesh->GetSubDomain(domain::Region::ENTIREDOMAIN);
+
+        // The field containing the data
+        const ablate::domain::Field *field = &(subDomain->GetField("fieldA"));
+
+        ablate::domain::Range cellRange;
+        subDomain->GetCellRange(nullptr, cellRange);
+        for (std::size_t j = 0; j < rbfList.size(); ++j) {
+            rbfList[j]->Setup(subDomain);
+            rbfList[j]->Initialize();
+        }
+
+        RBFTestFixture_SetData(cellRange, field, subDomain);
+
+        // 3D results take too long to run, so only the smaller meshes assemble the full operator
+        if (testingParam.cell < 0) {
+            std::vector<PetscInt> dx = testingParam.dx, dy = testingParam.dy, dz = testingParam.dz;
+            Vec der;
+            VecCreateSeq(PETSC_COMM_SELF, cellRange.end - cellRange.start, &der) >> ablate::utilities::PetscUtilities::checkError;
+
+            for (std::size_t i = 0; i < dx.size(); ++i) {          // Iterate over each of the requested derivatives
+                for (std::size_t j = 0; j < rbfList.size(); ++j) {  // Check each RBF
+                    rbfList[j]->EvalDer(field, der, dx[i], dy[i], dz[i]);
+
+                    const PetscScalar *derArray;
+                    PetscReal err = 0.0;
+                    VecGetArrayRead(der, &derArray) >> ablate::utilities::PetscUtilities::checkError;
+                    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                        err = PetscMax(err, PetscAbsReal(derArray[c - cellRange.start] - rbfList[j]->EvalDer(field, c, dx[i], dy[i], dz[i])));
+                    }
+                    VecRestoreArrayRead(der, &derArray) >> ablate::utilities::PetscUtilities::checkError;
+
+                    EXPECT_LT(err, 1.0E-10) << "RBF: " << rbfList[j]->type() << ", dx: " << dx[i] << ", dy:" << dy[i] << ", dz: " << dz[i] << " Error: " << err;
+                }
+            }
+            VecDestroy(&der) >> ablate::utilities::PetscUtilities::checkError;
+        }
+
+        subDomain->RestoreRange(cellRange);
+
+    EndWithMPI
+}
+
+// This tests that the assembled derivative operators give the same result on a SOL field (stored in a global vector) as on an AUX field
+TEST_P(RBFTestFixture_Derivative, CheckSolFieldDerivativeOperators) {
+    StartWithMPI
+        // initialize petsc and mpi
+        environment::RunEnvironment::Initialize(argc, argv);
+        utilities::PetscUtilities::Initialize();
+        auto testingParam = GetParam();
+        std::vector<std::shared_ptr<domain::rbf::RBF>> rbfList = testingParam.rbfList;
+
+        //             Make the same field as both an AUX and a SOL field
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptor = {
+            std::make_shared<ablate::domain::FieldDescription>("fieldA", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::AUX, ablate::domain::FieldType::FVM),
+            std::make_shared<ablate::domain::FieldDescription>("fieldB", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::SOL, ablate::domain::FieldType::FVM)};
+
+        //             Create the mesh
+        auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                      fieldDescriptor,
+                                                      std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(3)},
+                                                      testingParam.meshFaces,
+                                                      testingParam.meshStart,
+                                                      testingParam.meshEnd,
+                                                      std::vector<std::string>{},
+                                                      testingParam.meshSimplex);
+
+        mesh->InitializeSubDomains();
+
+        std::shared_ptr<ablate::domain::SubDomain> subDomain = mesh->GetSubDomain(domain::Region::ENTIREDOMAIN);
+
+        const ablate::domain::Field *auxField = &(subDomain->GetField("fieldA"));
+        const ablate::domain::Field *solField = &(subDomain->GetField("fieldB"));
+
+        ablate::domain::Range cellRange;
+        subDomain->GetCellRange(nullptr, cellRange);
+        for (std::size_t j = 0; j < rbfList.size(); ++j) {
+            rbfList[j]->Setup(subDomain);
+            rbfList[j]->Initialize();
+        }
+
+        RBFTestFixture_SetData(cellRange, auxField, subDomain);
+
+        // The SOL field is only set at the cells owned by this rank
+        {
+            PetscReal *array, *val, x[3] = {0.0, 0.0, 0.0};
+            Vec vec = subDomain->GetVec(*solField);
+            DM dm = subDomain->GetFieldDM(*solField);
+
+            VecGetArray(vec, &array) >> utilities::PetscUtilities::checkError;
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+                DMPlexPointGlobalFieldRef(dm, cell, solField->id, array, &val) >> utilities::PetscUtilities::checkError;
+                if (val) {
+                    DMPlexComputeCellGeometryFVM(dm, cell, NULL, x, NULL) >> utilities::PetscUtilities::checkError;
+                    *val = RBFTestFixture_Function(x, 0, 0, 0);
+                }
+            }
+            VecRestoreArray(vec, &array) >> utilities::PetscUtilities::checkError;
+        }
+
+        // 3D results take too long to run, so only the smaller meshes assemble the full operator
+        if (testingParam.cell < 0) {
+            std::vector<PetscInt> dx = testingParam.dx, dy = testingParam.dy, dz = testingParam.dz;
+            Vec auxDer, solDer;
+            VecCreateSeq(PETSC_COMM_SELF, cellRange.end - cellRange.start, &auxDer) >> ablate::utilities::PetscUtilities::checkError;
+            VecDuplicate(auxDer, &solDer) >> ablate::utilities::PetscUtilities::checkError;
+
+            for (std::size_t i = 0; i < dx.size(); ++i) {          // Iterate over each of the requested derivatives
+                for (std::size_t j = 0; j < rbfList.size(); ++j) {  // Check each RBF
+                    rbfList[j]->EvalDer(auxField, auxDer, dx[i], dy[i], dz[i]);
+                    rbfList[j]->EvalDer(solField, solDer, dx[i], dy[i], dz[i]);
+
+                    PetscReal err;
+                    VecAXPY(solDer, -1.0, auxDer) >> ablate::utilities::PetscUtilities::checkError;
+                    VecNorm(solDer, NORM_INFINITY, &err) >> ablate::utilities::PetscUtilities::checkError;
+
+                    EXPECT_LT(err, 1.0E-10) << "RBF: " << rbfList[j]->type() << ", dx: " << dx[i] << ", dy:" << dy[i] << ", dz: " << dz[i] << " Error: " << err;
+                }
+            }
+            VecDestroy(&solDer) >> ablate::utilities::PetscUtilities::checkError;
+            VecDestroy(&auxDer) >> ablate::utilities::PetscUtilities::checkError;
+        }
+
+        subDomain->RestoreRange(cellRange);
+
+    EndWithMPI
+}
+
 // This tests both the absolute error and the convergence for two data points
 INSTANTIATE_TEST_SUITE_P(
     MeshTests, RBFTestFixture_Derivative,
@@ -764,6 +918,70 @@ TEST_P(RBFTestFixture_Interpolation, CheckInterpolationFunctions) {
     EndWithMPI
 }
 
+// This tests that the batched interpolation matches the single location interpolation.
+TEST_P(RBFTestFixture_Interpolation, CheckBatchedInterpolation) {
+    StartWithMPI
+
+        // initialize petsc and mpi
+        environment::RunEnvironment::Initialize(argc, argv);
+        utilities::PetscUtilities::Initialize();
+        auto testingParam = GetParam();
+        std::vector<std::shared_ptr<domain::rbf::RBF>> rbfList = testingParam.rbfList;
+        std::vector<std::vector<PetscReal>> x = testingParam.x;
+
+        //             Make the field
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptor = {
+            std::make_shared<ablate::domain::FieldDescription>("fieldA", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::AUX, ablate::domain::FieldType::FVM)};
+
+        //             Create the mesh
+        auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                      fieldDescriptor,
+                                                      std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(3)},
+                                                      testingParam.meshFaces,
+                                                      testingParam.meshStart,
+                                                      testingParam.meshEnd,
+                                                      std::vector<std::string>{},
+                                                      testingParam.meshSimplex);
+
+        mesh->InitializeSubDomains();
+
+        std::shared_ptr<ablate::domain::SubDomain> subDomain = mesh->GetSubDomain(domain::Region::ENTIREDOMAIN);
+
+        // The field containing the data
+        const ablate::domain::Field *field = &(subDomain->GetField("fieldA"));
+
+        ablate::domain::Range cellRange;
+        subDomain->GetCellRange(nullptr, cellRange);
+        for (std::size_t j = 0; j < rbfList.size(); ++j) {
+            rbfList[j]->Setup(subDomain);
+            rbfList[j]->Initialize();
+        }
+
+        RBFTestFixture_SetData(cellRange, field, subDomain);
+
+        // Interpolate all of the locations at once, including a repeated location so that the weights are shared
+        std::vector<PetscReal> xEval;
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            xEval.insert(xEval.end(), x[i].begin(), x[i].end());
+        }
+        xEval.insert(xEval.end(), x[0].begin(), x[0].end());
+        const PetscInt nPoints = (PetscInt)x.size() + 1;
+
+        for (std::size_t j = 0; j < rbfList.size(); ++j) {  // Check each RBF
+            std::vector<PetscReal> vals(nPoints);
+            rbfList[j]->Interpolate(field, subDomain->GetVec(*field), nPoints, xEval.data(), vals.data());
+
+            for (PetscInt p = 0; p < nPoints; ++p) {
+                PetscReal truth = rbfList[j]->Interpolate(field, &xEval[p * 3]);
+                EXPECT_NEAR(vals[p], truth, 1.0E-12) << "RBF: " << rbfList[j]->type() << " Point: " << p;
+            }
+        }
+
+        subDomain->RestoreRange(cellRange);
+
+    EndWithMPI
+}
+
 // This tests both the absolute error and the convergene for two data points
 INSTANTIATE_TEST_SUITE_P(
     MeshTests, RBFTestFixture_Interpolation,
@@ -0,0 +1,88 @@
+#include <petsc.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "domain/modifiers/reorderMesh.hpp"
+#include "gtest/gtest.h"
+#include "petscTestFixture.hpp"
+
+namespace ablateTesting::domain::modifier {
+
+struct ReorderMeshTestParameters {
+    ablate::domain::modifiers::ReorderMesh::Ordering ordering;
+    PetscInt dim;
+    bool simplex;
+};
+
+class ReorderMeshTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<ReorderMeshTestParameters> {};
+
+/**
+ * Returns the sorted centroid of every cell so that meshes can be compared independent of their ordering
+ */
+static std::vector<std::vector<PetscReal>> GetSortedCentroids(DM dm, PetscInt dim) {
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> testingResources::PetscTestErrorChecker();
+    std::vector<std::vector<PetscReal>> centroids;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> testingResources::PetscTestErrorChecker();
+        centroids.emplace_back(centroid, centroid + dim);
+    }
+    std::sort(centroids.begin(), centroids.end());
+    return centroids;
+}
+
+TEST_P(ReorderMeshTestFixture, ShouldPermuteMeshAndSortFacesByLeftCell) {
+    // arrange
+    const auto& params = GetParam();
+    PetscInt faces[3] = {6, 5, 4};
+    PetscReal lower[3] = {0.0, 0.0, 0.0};
+    PetscReal upper[3] = {1.0, 2.0, 1.5};
+    DM dm;
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, params.dim, params.simplex ? PETSC_TRUE : PETSC_FALSE, faces, lower, upper, nullptr, PETSC_TRUE, &dm) >> errorChecker;
+
+    PetscInt pStart, pEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> errorChecker;
+    auto centroids = GetSortedCentroids(dm, params.dim);
+
+    auto reorderMesh = std::make_shared<ablate::domain::modifiers::ReorderMesh>(params.ordering);
+
+    // act
+    reorderMesh->Modify(dm);
+
+    // assert
+    PetscInt pStartNew, pEndNew;
+    DMPlexGetChart(dm, &pStartNew, &pEndNew) >> errorChecker;
+    ASSERT_EQ(pStart, pStartNew) << "the chart should be unchanged";
+    ASSERT_EQ(pEnd, pEndNew) << "the chart should be unchanged";
+
+    auto newCentroids = GetSortedCentroids(dm, params.dim);
+    ASSERT_EQ(centroids.size(), newCentroids.size()) << "the number of cells should be unchanged";
+    for (std::size_t c = 0; c < centroids.size(); ++c) {
+        for (PetscInt d = 0; d < params.dim; ++d) {
+            ASSERT_NEAR(centroids[c][d], newCentroids[c][d], 1E-12) << "the same cells should be in the reordered mesh";
+        }
+    }
+
+    PetscInt fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> errorChecker;
+    PetscInt lastLeftCell = -1;
+    for (PetscInt f = fStart; f < fEnd; ++f) {
+        const PetscInt* support;
+        DMPlexGetSupport(dm, f, &support) >> errorChecker;
+        ASSERT_GE(support[0], lastLeftCell) << "the faces should be sorted by their left cell";
+        lastLeftCell = support[0];
+    }
+
+    DMDestroy(&dm) >> errorChecker;
+}
+
+INSTANTIATE_TEST_SUITE_P(ReorderMeshTests, ReorderMeshTestFixture,
+                         testing::Values((ReorderMeshTestParameters){.ordering = ablate::domain::modifiers::ReorderMesh::Ordering::RCM, .dim = 2, .simplex = false},
+                                         (ReorderMeshTestParameters){.ordering = ablate::domain::modifiers::ReorderMesh::Ordering::Hilbert, .dim = 2, .simplex = false},
+                                         (ReorderMeshTestParameters){.ordering = ablate::domain::modifiers::ReorderMesh::Ordering::Morton, .dim = 2, .simplex = true},
+                                         (ReorderMeshTestParameters){.ordering = ablate::domain::modifiers::ReorderMesh::Ordering::RCM, .dim = 3, .simplex = true},
+                                         (ReorderMeshTestParameters){.ordering = ablate::domain::modifiers::ReorderMesh::Ordering::Hilbert, .dim = 3, .simplex = false}),
+                         [](const testing::TestParamInfo<ReorderMeshTestParameters>& info) { return std::to_string(info.index); });
+
+}  // namespace ablateTesting::domain::modifier
@@ -226,6 +226,59 @@ TEST_P(ChemTabTestFixture, ShouldComputeCorrectThermalProperties) {
     }
 }
 
+TEST_P(ChemTabTestFixture, ShouldComputeSameMassFractionsForBatchAndPointUpdates) {
+    ONLY_WITH_TENSORFLOW_CHECK;
+
+    // iterate over each test
+    for (const auto& testTarget : testTargets) {
+        // ARRANGE
+        // use a small batch size so that the cells are split into full batches and a partial batch
+        auto chemTab = std::make_shared<ablate::eos::ChemTab>(GetParam().modelPath, 2);
+        auto inputProgressVariables = testTarget["input_cpvs"].as<std::vector<double>>();
+        const auto numberSpecies = testTarget["output_mass_fractions"].as<std::vector<double>>().size();
+
+        // lay out each cell as euler (offset 1), density progress, and density yi decode
+        const PetscInt numberCells = 5;
+        const PetscInt densityProgressOffset = 4;
+        const PetscInt densityYiOffset = densityProgressOffset + (PetscInt)inputProgressVariables.size();
+        const PetscInt uStride = densityYiOffset + (PetscInt)numberSpecies;
+        PetscInt solutionOffsets[3] = {1, densityProgressOffset, densityYiOffset};
+
+        // vary the density in each cell
+        std::vector<PetscReal> pointSolution(numberCells * uStride, 0.0);
+        for (PetscInt c = 0; c < numberCells; ++c) {
+            const double density = 1.2 + 0.1 * c;
+            PetscReal* uAtCell = pointSolution.data() + c * uStride;
+            uAtCell[1] = density;
+            uAtCell[2] = density * 1.0E+05;
+            uAtCell[3] = density * 10;
+            for (std::size_t p = 0; p < inputProgressVariables.size(); ++p) {
+                uAtCell[densityProgressOffset + p] = inputProgressVariables[p] * density;
+            }
+        }
+        std::vector<PetscReal> batchSolution = pointSolution;
+
+        // ACT
+        auto pointUpdate = chemTab->GetSolutionFieldUpdates().front();
+        for (PetscInt c = 0; c < numberCells; ++c) {
+            ASSERT_EQ(std::get<0>(pointUpdate)(NAN, -1, nullptr, solutionOffsets, pointSolution.data() + c * uStride, std::get<1>(pointUpdate)), 0);
+        }
+
+        auto batchUpdate = chemTab->GetSolutionFieldBatchUpdates().front();
+        ASSERT_EQ(std::get<0>(batchUpdate)(NAN, -1, numberCells, solutionOffsets, uStride, batchSolution.data(), std::get<1>(batchUpdate)), 0);
+
+        // ASSERT
+        for (PetscInt c = 0; c < numberCells; ++c) {
+            for (std::size_t s = 0; s < numberSpecies; ++s) {
+                const auto i = c * uStride + densityYiOffset + s;
+                // the model is evaluated in single precision, so allow for a different reduction order between batch sizes
+                ASSERT_NEAR(pointSolution[i], batchSolution[i], 1.0E-5 * PetscAbs(pointSolution[i]) + 1.0E-12)
+                    << "the batched density mass fraction should match the point update for cell " << c << " species " << s << " for model " << testTarget["testName"].as<std::string>();
+            }
+        }
+    }
+}
+
 /*******************************************************************************************************
  * Tests for getting the Progress Variables
  */
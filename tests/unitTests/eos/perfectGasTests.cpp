@@ -86,6 +86,27 @@ TEST_P(PGThermodynamicPropertyTestFixture, ShouldComputeProperty) {
     for (std::size_t c = 0; c < params.expectedValue.size(); c++) {
         ASSERT_NEAR(computedProperty[c], params.expectedValue[c], 1E-6) << " for temperature function ";
     }
+
+    // act/assert check for the batch function over several copies of the conserved values
+    const PetscInt numberPoints = 3;
+    const auto stride = (PetscInt)params.conservedValues.size();
+    std::vector<PetscReal> batchConserved;
+    for (PetscInt p = 0; p < numberPoints; p++) {
+        batchConserved.insert(batchConserved.end(), params.conservedValues.begin(), params.conservedValues.end());
+    }
+    std::vector<PetscReal> batchTemperature(numberPoints, computedTemperature);
+    auto batchFunction = eos->GetThermodynamicBatchFunction(params.thermodynamicProperty, params.fields);
+    ASSERT_EQ(params.expectedValue.size(), batchFunction.propertySize) << "The " << params.thermodynamicProperty << " batch property size should be " << params.expectedValue.size();
+
+    for (const PetscReal* temperature : {(const PetscReal*)nullptr, (const PetscReal*)batchTemperature.data()}) {
+        std::vector<PetscReal> batchProperty(numberPoints * params.expectedValue.size(), NAN);
+        ASSERT_EQ(0, batchFunction.function(numberPoints, batchConserved.data(), stride, temperature, batchProperty.data(), batchFunction.context.get()));
+        for (PetscInt p = 0; p < numberPoints; p++) {
+            for (std::size_t c = 0; c < params.expectedValue.size(); c++) {
+                ASSERT_NEAR(batchProperty[p * params.expectedValue.size() + c], params.expectedValue[c], 1E-6) << " for batch function ";
+            }
+        }
+    }
 }
 
 INSTANTIATE_TEST_SUITE_P(PerfectGasEOSTests, PGThermodynamicPropertyTestFixture,
@@ -3,8 +3,10 @@
 #include "domain/dynamicRange.hpp"
 #include "domain/mockField.hpp"
 #include "eos/tChem.hpp"
+#include "eos/tChem/sourceCalculator.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
 #include "petscTestFixture.hpp"
 
 /*
@@ -257,6 +259,46 @@ TEST_P(TCThermodynamicPropertyTestFixture, ShouldComputePropertyUsingMassFractio
     }
 }
 
+TEST_P(TCThermodynamicPropertyTestFixture, ShouldUseFewerIterationsWhenWarmStarted) {
+    // arrange
+    std::shared_ptr<ablate::eos::TChem> eos = std::make_shared<ablate::eos::TChem>(GetParam().mechFile);
+
+    // get the test params
+    const auto& params = GetParam();
+
+    // combine and build the total conserved values
+    auto conservedValuesSize = std::accumulate(params.fields.begin(), params.fields.end(), 0, [](int a, const ablate::domain::Field& field) { return a + field.numberComponents; });
+    std::vector<PetscReal> conservedValues(conservedValuesSize + 10, 0.0); /* 10 provides some extra buffer for placement testing*/
+    std::copy(params.conservedEulerValues.begin(), params.conservedEulerValues.end(), conservedValues.begin() + std::find_if(params.fields.begin(), params.fields.end(), [](const auto& field) {
+                                                                                                                    return field.name == "euler";
+                                                                                                                })->offset);
+    FillDensityMassFraction(*std::find_if(params.fields.begin(), params.fields.end(), [](const auto& field) { return field.name == "densityYi"; }),
+                            eos->GetSpeciesVariables(),
+                            params.yiMap,
+                            params.conservedEulerValues[0],
+                            conservedValues);
+    auto temperatureFunction = eos->GetThermodynamicTemperatureFunction(ablate::eos::ThermodynamicProperty::Temperature, params.fields);
+
+    // compute the temperature from the default guess
+    PetscReal coldTemperature;
+    ASSERT_EQ(0, temperatureFunction.function(conservedValues.data(), 300.0, &coldTemperature, temperatureFunction.context.get()));
+    const auto coldStatistics = eos->GetTemperatureSolveStatistics();
+    eos->ResetTemperatureSolveStatistics();
+
+    // act
+    // compute the temperature again starting from the last temperature
+    PetscReal warmTemperature;
+    ASSERT_EQ(0, temperatureFunction.function(conservedValues.data(), coldTemperature, &warmTemperature, temperatureFunction.context.get()));
+    const auto warmStatistics = eos->GetTemperatureSolveStatistics();
+
+    // assert
+    ASSERT_EQ(1, coldStatistics.solves);
+    ASSERT_EQ(1, warmStatistics.solves);
+    ASSERT_LT(warmStatistics.iterations, coldStatistics.iterations) << "The warm started temperature solve should use fewer iterations";
+    ASSERT_EQ(0, warmStatistics.iterations) << "The temperature solve should not iterate when started from the solution";
+    ASSERT_LT(PetscAbs(warmTemperature - coldTemperature) / coldTemperature, 1E-6) << "The warm started temperature (" << warmTemperature << " vs " << coldTemperature << ") should match";
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TChemTests, TCThermodynamicPropertyTestFixture,
     testing::Values(
@@ -750,3 +792,131 @@ INSTANTIATE_TEST_SUITE_P(TChemTests, TCComputeSourceTestFixture,
                                                          7.71297e-06, 8.76474e-09, 0.0042147,   3.01428e-06,  0.0143082,   8.95778e-10, 0.000171936, 2.11932e-09, 3.98707e-17, 2.93971e-15, 3.98326e-16,
                                                          2.19774e-15, 4.30824e-12, 3.73653e-12, 4.39779e-12,  5.44988e-08, 5.9704e-15,  1.24544e-21, 9.80878e-14, 1.50217e-18, 1.15244e-16, 7.52342e-17,
                                                          7.10193e-18, 4.27329e-15, 2.96867e-16, -6.83549e-25, 2.57715e-09, 3.0537e-05,  5.93473e-08, 9.20704e-07, -3.46948e-08}}));
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///// Isat tests
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct TCComputeSourceIsatTestParameters {
+    std::filesystem::path mechFile;
+    PetscReal dt;
+    std::vector<PetscReal> inputEulerValues;
+    std::vector<PetscReal> inputDensityYiValues;
+
+    // the relative perturbation applied to the densityYi in each cell
+    std::vector<PetscReal> cellPerturbations;
+
+    std::string isatTolerance;
+    PetscReal errorTolerance = 1E-3;
+};
+
+class TCComputeSourceIsatTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<TCComputeSourceIsatTestParameters> {};
+
+TEST_P(TCComputeSourceIsatTestFixture, ShouldComputeSameSourceWithIsat) {
+    // ARRANGE
+    const auto& params = GetParam();
+    const auto numberCells = (PetscInt)params.cellPerturbations.size();
+    auto eos = std::make_shared<ablate::eos::TChem>(params.mechFile);
+    auto isatEos = std::make_shared<ablate::eos::TChem>(
+        params.mechFile, nullptr, std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"isatTolerance", params.isatTolerance}}));
+
+    // create a oneD domain with a cell for each perturbation
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("oneD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{(int)numberCells},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+
+    // copy over the initial values to each cell
+    PetscScalar* solution;
+    VecGetArray(domain->GetSolutionVector(), &solution) >> ablate::utilities::PetscUtilities::checkError;
+    for (PetscInt c = 0; c < numberCells; c++) {
+        PetscScalar* eulerField = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("euler").id, solution, &eulerField) >> ablate::utilities::PetscUtilities::checkError;
+        for (std::size_t i = 0; i < params.inputEulerValues.size(); i++) {
+            eulerField[i] = params.inputEulerValues[i];
+        }
+
+        PetscScalar* densityYiField = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("densityYi").id, solution, &densityYiField) >> ablate::utilities::PetscUtilities::checkError;
+        for (std::size_t i = 0; i < params.inputDensityYiValues.size(); i++) {
+            densityYiField[i] = params.inputDensityYiValues[i] * (1.0 + params.cellPerturbations[c]);
+        }
+    }
+    VecRestoreArray(domain->GetSolutionVector(), &solution) >> ablate::utilities::PetscUtilities::checkError;
+
+    // create vectors to store the direct and isat sources
+    Vec directF, isatF;
+    DMGetLocalVector(domain->GetDM(), &directF) >> ablate::utilities::PetscUtilities::checkError;
+    VecZeroEntries(directF) >> ablate::utilities::PetscUtilities::checkError;
+    DMGetLocalVector(domain->GetDM(), &isatF) >> ablate::utilities::PetscUtilities::checkError;
+    VecZeroEntries(isatF) >> ablate::utilities::PetscUtilities::checkError;
+
+    ablate::domain::DynamicRange range;
+    for (PetscInt c = 0; c < numberCells; c++) {
+        range.Add(c);
+    }
+    auto directSourceCalculator = eos->CreateSourceCalculator(domain->GetFields(), range.GetRange());
+    auto isatSourceCalculator = std::dynamic_pointer_cast<ablate::eos::tChem::SourceCalculator>(isatEos->CreateSourceCalculator(domain->GetFields(), range.GetRange()));
+    ASSERT_TRUE(isatSourceCalculator != nullptr);
+    ASSERT_TRUE(isatSourceCalculator->GetIsatCache() != nullptr);
+
+    // ACT
+    directSourceCalculator->ComputeSource(range.GetRange(), 0.0, params.dt, domain->GetSolutionVector());
+    directSourceCalculator->AddSource(range.GetRange(), domain->GetSolutionVector(), directF);
+
+    // the first call fills the table and the second should retrieve every cell
+    isatSourceCalculator->ComputeSource(range.GetRange(), 0.0, params.dt, domain->GetSolutionVector());
+    isatSourceCalculator->ComputeSource(range.GetRange(), 0.0, params.dt, domain->GetSolutionVector());
+    isatSourceCalculator->AddSource(range.GetRange(), domain->GetSolutionVector(), isatF);
+
+    // ASSERT
+    const auto& statistics = isatSourceCalculator->GetIsatCache()->GetStatistics();
+    ASSERT_EQ(statistics.Misses(), (std::size_t)numberCells) << "Each cell should only be integrated directly on the first call";
+    ASSERT_EQ(statistics.retrieves, (std::size_t)numberCells) << "Each cell should be retrieved on the second call";
+    ASSERT_LT(isatSourceCalculator->GetIsatCache()->Size(), (std::size_t)numberCells) << "The nearby states should grow existing entries";
+
+    const PetscScalar* directArray;
+    VecGetArrayRead(directF, &directArray) >> ablate::utilities::PetscUtilities::checkError;
+    const PetscScalar* isatArray;
+    VecGetArrayRead(isatF, &isatArray) >> ablate::utilities::PetscUtilities::checkError;
+    for (PetscInt c = 0; c < numberCells; c++) {
+        for (const auto& fieldName : {"euler", "densityYi"}) {
+            const auto& field = domain->GetField(fieldName);
+            const PetscScalar* directSource = nullptr;
+            DMPlexPointLocalFieldRead(domain->GetDM(), c, field.id, directArray, &directSource) >> ablate::utilities::PetscUtilities::checkError;
+            const PetscScalar* isatSource = nullptr;
+            DMPlexPointLocalFieldRead(domain->GetDM(), c, field.id, isatArray, &isatSource) >> ablate::utilities::PetscUtilities::checkError;
+
+            // compare each component relative to the largest source in this field
+            PetscReal sourceScale = 1E-30;
+            for (PetscInt i = 0; i < field.numberComponents; i++) {
+                sourceScale = PetscMax(sourceScale, PetscAbs(directSource[i]));
+            }
+            for (PetscInt i = 0; i < field.numberComponents; i++) {
+                ASSERT_LT(PetscAbs(directSource[i] - isatSource[i]) / sourceScale, params.errorTolerance)
+                    << "The isat source (" << isatSource[i] << ") should match the direct source (" << directSource[i] << ") for " << fieldName << "[" << i << "] in cell " << c;
+            }
+        }
+    }
+    VecRestoreArrayRead(directF, &directArray) >> ablate::utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(isatF, &isatArray) >> ablate::utilities::PetscUtilities::checkError;
+
+    DMRestoreLocalVector(domain->GetDM(), &directF) >> ablate::utilities::PetscUtilities::checkError;
+    DMRestoreLocalVector(domain->GetDM(), &isatF) >> ablate::utilities::PetscUtilities::checkError;
+}
+
+INSTANTIATE_TEST_SUITE_P(TChemTests, TCComputeSourceIsatTestFixture,
+                         testing::Values((TCComputeSourceIsatTestParameters){
+                             .mechFile = "inputs/eos/gri30.yaml",
+                             .dt = 0.017418748136926492,
+                             .inputEulerValues = {0.280629, 214342., 0.},
+                             .inputDensityYiValues = {2.70155e-06, 2.42588e-10, 1.75298e-09, 0.0615735,    5.91967e-09, 0.00013291,  1.42223e-06, 2.69273e-07, 1.17659e-25, 2.62694e-19, 1.04261e-12,
+                                                      1.55473e-13, 3.29875e-06, 0.0153352,   3.5785e-05,   2.61125e-07, 2.32785e-10, 0.000118819, 2.02248e-12, 3.19032e-09, 1.6112e-06,  3.70467e-18,
+                                                      1.90909e-09, 1.00394e-12, 3.84067e-06, 1.46041e-09,  5.52161e-05, 1.51027e-14, 3.77118e-08, 8.45969e-14, 1.76002e-20, 3.66826e-19, 2.92689e-20,
+                                                      3.18488e-20, 4.77626e-15, 1.73259e-15, 1.22235e-15,  1.81966e-10, 7.66494e-19, 1.00758e-26, 1.13374e-17, 2.26247e-22, 3.89214e-21, 2.08805e-21,
+                                                      1.82355e-22, 2.25953e-19, 1.26537e-19, -4.31761e-27, 6.78129e-13, 1.13467e-08, 8.23985e-12, 1.12011e-10, 0.203364},
+                             .cellPerturbations = {0.0, 1E-7, -1E-7, 2E-7},
+                             .isatTolerance = "1E-4",
+                             .errorTolerance = 1E-3}));
@@ -0,0 +1,126 @@
+#include <petsc.h>
+#include <memory>
+#include <petscTestFixture.hpp>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "eos/perfectGas.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/finiteVolumeSolver.hpp"
+#include "finiteVolume/fluxCalculator/ausm.hpp"
+#include "finiteVolume/processes/navierStokesTransport.hpp"
+#include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
+#include "utilities/kokkosUtilities.hpp"
+
+/**
+ * Registers a discontinuous flux function that is not thread safe so that the CellInterpolant must use the serial face loop.  The flux is zero.
+ */
+class SerialFaceLoopProcess : public ablate::finiteVolume::processes::Process {
+   private:
+    static PetscErrorCode ZeroFlux(PetscInt dim, const PetscFVFaceGeom*, const PetscInt[], const PetscScalar[], const PetscScalar[], const PetscInt[], const PetscScalar[], const PetscScalar[],
+                                   PetscScalar flux[], void*) {
+        PetscFunctionBeginUser;
+        for (PetscInt d = 0; d < dim + 2; ++d) {
+            flux[d] = 0.0;
+        }
+        PetscFunctionReturn(0);
+    }
+
+   public:
+    void Setup(ablate::finiteVolume::FiniteVolumeSolver& fv) override {
+        fv.RegisterRHSFunction(ZeroFlux, nullptr, ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD, {ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD}, {}, false);
+    }
+};
+
+class CellInterpolantTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    /**
+     * Compute the rhs of the euler advection (with the shared advection face state) over a box mesh.  Each cell, including the boundary ghost cells, is
+     * set to a different state so every face has a nontrivial flux.
+     */
+    std::vector<PetscScalar> ComputeAdvectionRHS(bool serialFaceLoop) {
+        auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>());
+        auto fluxCalculator = std::make_shared<ablate::finiteVolume::fluxCalculator::Ausm>();
+
+        auto domain = std::make_shared<ablate::domain::BoxMesh>("testMesh",
+                                                                std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                                std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{std::make_shared<ablate::domain::modifiers::GhostBoundaryCells>()},
+                                                                std::vector<int>{12, 9},
+                                                                std::vector<double>{0.0, 0.0},
+                                                                std::vector<double>{1.0, 0.75});
+
+        std::vector<std::shared_ptr<ablate::finiteVolume::processes::Process>> processes = {
+            std::make_shared<ablate::finiteVolume::processes::NavierStokesTransport>(std::make_shared<ablate::parameters::MapParameters>(), eos, fluxCalculator)};
+        if (serialFaceLoop) {
+            processes.push_back(std::make_shared<SerialFaceLoopProcess>());
+        }
+        auto fvObject = std::make_shared<ablate::finiteVolume::FiniteVolumeSolver>(
+            "testFV", ablate::domain::Region::ENTIREDOMAIN, nullptr /*options*/, processes, std::vector<std::shared_ptr<ablate::finiteVolume::boundaryConditions::BoundaryCondition>>{});
+        domain->InitializeSubDomains({fvObject});
+
+        // set every cell to a different state
+        DM dm = domain->GetDM();
+        const auto& eulerField = fvObject->GetSubDomain().GetField(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD);
+        Vec locX, locF;
+        DMGetLocalVector(dm, &locX) >> errorChecker;
+        DMGetLocalVector(dm, &locF) >> errorChecker;
+        VecZeroEntries(locX) >> errorChecker;
+        VecZeroEntries(locF) >> errorChecker;
+
+        PetscInt cStart, cEnd;
+        DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+        PetscScalar* locXArray;
+        VecGetArray(locX, &locXArray) >> errorChecker;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            PetscScalar* euler;
+            DMPlexPointLocalFieldRef(dm, c, eulerField.id, locXArray, &euler) >> errorChecker;
+            const PetscReal density = 1.0 + 0.05 * (c % 7);
+            const PetscReal velocity[2] = {10.0 * (c % 5) - 20.0, 15.0 * (c % 3) - 15.0};
+            const PetscReal pressure = 101325.0 * (1.0 + 0.1 * (c % 4));
+            const PetscReal internalEnergy = pressure / (density * (eos->GetSpecificHeatRatio() - 1.0));
+            euler[ablate::finiteVolume::CompressibleFlowFields::RHO] = density;
+            euler[ablate::finiteVolume::CompressibleFlowFields::RHOE] = density * (internalEnergy + 0.5 * (velocity[0] * velocity[0] + velocity[1] * velocity[1]));
+            euler[ablate::finiteVolume::CompressibleFlowFields::RHOU] = density * velocity[0];
+            euler[ablate::finiteVolume::CompressibleFlowFields::RHOV] = density * velocity[1];
+        }
+        VecRestoreArray(locX, &locXArray) >> errorChecker;
+
+        // act
+        fvObject->ComputeRHSFunction(0.0, locX, locF) >> errorChecker;
+
+        // copy the result
+        PetscInt size;
+        VecGetLocalSize(locF, &size) >> errorChecker;
+        const PetscScalar* locFArray;
+        VecGetArrayRead(locF, &locFArray) >> errorChecker;
+        std::vector<PetscScalar> rhs(locFArray, locFArray + size);
+        VecRestoreArrayRead(locF, &locFArray) >> errorChecker;
+
+        DMRestoreLocalVector(dm, &locX) >> errorChecker;
+        DMRestoreLocalVector(dm, &locF) >> errorChecker;
+        return rhs;
+    }
+};
+
+TEST_F(CellInterpolantTestFixture, ShouldComputeTheSameFluxConcurrentlyAsInSerial) {
+    // arrange
+    // the concurrent face loop is only used when there is more than one Kokkos host thread (e.g. --kokkos-num-threads)
+    if (ablate::utilities::KokkosUtilities::GetMaxHostThreads() < 2) {
+        std::cout << "Only one Kokkos host thread is available, both rhs computations use the serial face loop" << std::endl;
+    }
+
+    // act
+    auto concurrentRHS = ComputeAdvectionRHS(false);
+    auto serialRHS = ComputeAdvectionRHS(true);
+
+    // assert
+    ASSERT_EQ(concurrentRHS.size(), serialRHS.size());
+    PetscReal maxMagnitude = 0.0;
+    for (std::size_t i = 0; i < serialRHS.size(); ++i) {
+        // the fluxes are added to the cells in face order in both loops, so the result should be identical
+        ASSERT_DOUBLE_EQ(concurrentRHS[i], serialRHS[i]) << "the rhs differs at " << i;
+        maxMagnitude = PetscMax(maxMagnitude, PetscAbsReal(serialRHS[i]));
+    }
+    ASSERT_GT(maxMagnitude, 0.0) << "the advection rhs should not be zero";
+}
@@ -0,0 +1,240 @@
+#include <petsc.h>
+#include <functional>
+#include <limits>
+#include <petscTestFixture.hpp>
+#include <vector>
+#include "finiteVolume/processes/batchedStiffIntegrator.hpp"
+#include "gtest/gtest.h"
+#include "utilities/petscUtilities.hpp"
+
+struct BatchedStiffIntegratorTestParameters {
+    // the single point ode
+    PetscInt size;
+    std::function<void(const PetscReal y[], PetscReal f[])> rhs;
+    std::function<void(const PetscReal y[], PetscReal jacobian[])> jacobian;
+
+    // the initial condition for each point
+    std::vector<std::vector<PetscReal>> initialConditions;
+
+    // the integration options
+    PetscReal endTime;
+    ablate::finiteVolume::processes::BatchedStiffIntegrator::Options options;
+
+    // comparison tolerance relative to the reference solution
+    PetscReal relativeTolerance;
+    PetscReal absoluteTolerance;
+};
+
+class BatchedStiffIntegratorTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<BatchedStiffIntegratorTestParameters> {
+   public:
+    static PetscErrorCode ReferenceRHS(TS, PetscReal, Vec xVec, Vec fVec, void* ctx) {
+        PetscFunctionBeginUser;
+        auto params = (const BatchedStiffIntegratorTestParameters*)ctx;
+        const PetscScalar* xArray;
+        PetscScalar* fArray;
+        PetscCall(VecGetArrayRead(xVec, &xArray));
+        PetscCall(VecGetArray(fVec, &fArray));
+        params->rhs(xArray, fArray);
+        PetscCall(VecRestoreArrayRead(xVec, &xArray));
+        PetscCall(VecRestoreArray(fVec, &fArray));
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    static PetscErrorCode ReferenceJacobian(TS, PetscReal, Vec xVec, Mat amat, Mat pmat, void* ctx) {
+        PetscFunctionBeginUser;
+        auto params = (const BatchedStiffIntegratorTestParameters*)ctx;
+        const PetscScalar* xArray;
+        PetscCall(VecGetArrayRead(xVec, &xArray));
+        std::vector<PetscReal> values(params->size * params->size);
+        params->jacobian(xArray, values.data());
+        PetscCall(VecRestoreArrayRead(xVec, &xArray));
+
+        std::vector<PetscInt> indices(params->size);
+        for (PetscInt i = 0; i < params->size; ++i) {
+            indices[i] = i;
+        }
+        PetscCall(MatSetValues(pmat, params->size, indices.data(), params->size, indices.data(), values.data(), INSERT_VALUES));
+        PetscCall(MatAssemblyBegin(pmat, MAT_FINAL_ASSEMBLY));
+        PetscCall(MatAssemblyEnd(pmat, MAT_FINAL_ASSEMBLY));
+        if (amat != pmat) {
+            PetscCall(MatAssemblyBegin(amat, MAT_FINAL_ASSEMBLY));
+            PetscCall(MatAssemblyEnd(amat, MAT_FINAL_ASSEMBLY));
+        }
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+};
+
+TEST_P(BatchedStiffIntegratorTestFixture, ShouldMatchPointTs) {
+    // arrange
+    const auto& params = GetParam();
+    const auto numberPoints = params.initialConditions.size();
+
+    // Compute the reference solution for each point with the same TS used in the soot pointTs
+    std::vector<PetscReal> reference;
+    {
+        Vec pointData;
+        Mat pointJacobian;
+        TS pointTs;
+        VecCreateSeq(PETSC_COMM_SELF, params.size, &pointData) >> ablate::utilities::PetscUtilities::checkError;
+        MatCreateSeqDense(PETSC_COMM_SELF, params.size, params.size, nullptr, &pointJacobian) >> ablate::utilities::PetscUtilities::checkError;
+        TSCreate(PETSC_COMM_SELF, &pointTs) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetType(pointTs, TSARKIMEX) >> ablate::utilities::PetscUtilities::checkError;
+        TSARKIMEXSetFullyImplicit(pointTs, PETSC_TRUE) >> ablate::utilities::PetscUtilities::checkError;
+        TSARKIMEXSetType(pointTs, TSARKIMEX4) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetRHSFunction(pointTs, nullptr, ReferenceRHS, (void*)&params) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetRHSJacobian(pointTs, pointJacobian, pointJacobian, ReferenceJacobian, (void*)&params) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetExactFinalTime(pointTs, TS_EXACTFINALTIME_MATCHSTEP) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetTolerances(pointTs, params.options.absoluteTolerance, nullptr, params.options.relativeTolerance, nullptr) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetSolution(pointTs, pointData) >> ablate::utilities::PetscUtilities::checkError;
+        TSAdapt adapt;
+        TSGetAdapt(pointTs, &adapt) >> ablate::utilities::PetscUtilities::checkError;
+        TSAdaptSetStepLimits(adapt, params.options.dtMin, params.options.dtMax) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetMaxSNESFailures(pointTs, -1) >> ablate::utilities::PetscUtilities::checkError;
+
+        for (const auto& initialCondition : params.initialConditions) {
+            PetscScalar* pointArray;
+            VecGetArray(pointData, &pointArray) >> ablate::utilities::PetscUtilities::checkError;
+            std::copy(initialCondition.begin(), initialCondition.end(), pointArray);
+            VecRestoreArray(pointData, &pointArray) >> ablate::utilities::PetscUtilities::checkError;
+
+            TSSetTime(pointTs, 0.0) >> ablate::utilities::PetscUtilities::checkError;
+            TSSetMaxTime(pointTs, params.endTime) >> ablate::utilities::PetscUtilities::checkError;
+            TSSetTimeStep(pointTs, params.options.dtInit) >> ablate::utilities::PetscUtilities::checkError;
+            TSSetStepNumber(pointTs, 0) >> ablate::utilities::PetscUtilities::checkError;
+            TSSolve(pointTs, pointData) >> ablate::utilities::PetscUtilities::checkError;
+
+            const PetscScalar* resultArray;
+            VecGetArrayRead(pointData, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+            reference.insert(reference.end(), resultArray, resultArray + params.size);
+            VecRestoreArrayRead(pointData, &resultArray) >> ablate::utilities::PetscUtilities::checkError;
+        }
+
+        TSDestroy(&pointTs) >> ablate::utilities::PetscUtilities::checkError;
+        MatDestroy(&pointJacobian) >> ablate::utilities::PetscUtilities::checkError;
+        VecDestroy(&pointData) >> ablate::utilities::PetscUtilities::checkError;
+    }
+
+    // create the batched integrator
+    ablate::finiteVolume::processes::BatchedStiffIntegrator integrator(
+        params.size,
+        [&params](std::size_t batchSize, const PetscInt[], const PetscReal y[], PetscReal f[]) {
+            for (std::size_t p = 0; p < batchSize; ++p) {
+                params.rhs(y + p * params.size, f + p * params.size);
+            }
+        },
+        params.options);
+
+    std::vector<PetscReal> batched;
+    for (const auto& initialCondition : params.initialConditions) {
+        batched.insert(batched.end(), initialCondition.begin(), initialCondition.end());
+    }
+
+    // act
+    integrator.Solve(numberPoints, batched.data(), 0.0, params.endTime) >> ablate::utilities::PetscUtilities::checkError;
+
+    // assert
+    for (std::size_t p = 0; p < numberPoints; ++p) {
+        // each point should be independent of the rest of the batch
+        std::vector<PetscReal> single(params.initialConditions[p]);
+        integrator.Solve(1, single.data(), 0.0, params.endTime) >> ablate::utilities::PetscUtilities::checkError;
+
+        for (PetscInt i = 0; i < params.size; ++i) {
+            const auto index = p * params.size + i;
+            ASSERT_DOUBLE_EQ(single[i], batched[index]) << "point " << p << " component " << i;
+            ASSERT_NEAR(batched[index], reference[index], params.absoluteTolerance + params.relativeTolerance * PetscAbsReal(reference[index])) << "point " << p << " component " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BatchedStiffIntegratorTests, BatchedStiffIntegratorTestFixture,
+    testing::Values(
+        // Robertson chemical kinetics
+        (BatchedStiffIntegratorTestParameters){.size = 3,
+                                               .rhs =
+                                                   [](const PetscReal y[], PetscReal f[]) {
+                                                       f[0] = -0.04 * y[0] + 1.0E4 * y[1] * y[2];
+                                                       f[1] = 0.04 * y[0] - 1.0E4 * y[1] * y[2] - 3.0E7 * y[1] * y[1];
+                                                       f[2] = 3.0E7 * y[1] * y[1];
+                                                   },
+                                               .jacobian =
+                                                   [](const PetscReal y[], PetscReal jacobian[]) {
+                                                       const PetscReal values[9] = {
+                                                           -0.04, 1.0E4 * y[2], 1.0E4 * y[1], 0.04, -1.0E4 * y[2] - 6.0E7 * y[1], -1.0E4 * y[1], 0.0, 6.0E7 * y[1], 0.0};
+                                                       std::copy(values, values + 9, jacobian);
+                                                   },
+                                               .initialConditions = {{1.0, 0.0, 0.0}, {0.9, 1.0E-5, 0.1}, {0.5, 0.0, 0.5}, {1.0, 0.0, 0.0}},
+                                               .endTime = 1.0,
+                                               .options = {.dtInit = 1E-6, .dtMin = 1E-12, .dtMax = 1E-2, .relativeTolerance = 1E-6, .absoluteTolerance = 1E-10},
+                                               .relativeTolerance = 1E-3,
+                                               .absoluteTolerance = 1E-8},
+        // a linear system with widely separated time scales, including a point at equilibrium
+        (BatchedStiffIntegratorTestParameters){.size = 2,
+                                               .rhs =
+                                                   [](const PetscReal y[], PetscReal f[]) {
+                                                       f[0] = -1.0E5 * y[0] + 1.0E5 * y[1];
+                                                       f[1] = -y[1];
+                                                   },
+                                               .jacobian =
+                                                   [](const PetscReal y[], PetscReal jacobian[]) {
+                                                       const PetscReal values[4] = {-1.0E5, 1.0E5, 0.0, -1.0};
+                                                       std::copy(values, values + 4, jacobian);
+                                                   },
+                                               .initialConditions = {{0.0, 1.0}, {2.0, 1.0}, {0.0, 0.0}, {-1.0, 3.0}, {5.0, -2.0}},
+                                               .endTime = 1E-2,
+                                               .options = {.dtInit = 1E-6, .dtMin = 1E-12, .dtMax = 1E-4, .relativeTolerance = 1E-6, .absoluteTolerance = 1E-10},
+                                               .relativeTolerance = 1E-3,
+                                               .absoluteTolerance = 1E-8}),
+    [](const testing::TestParamInfo<BatchedStiffIntegratorTestParameters>& info) { return std::to_string(info.index); });
+
+TEST(BatchedStiffIntegratorTests, ShouldReportPointsThatFailAtTheMinimumTimeStep) {
+    // arrange
+    // the rhs for the second point can never be evaluated, so its Newton iteration will not converge at any time step
+    ablate::finiteVolume::processes::BatchedStiffIntegrator integrator(
+        1,
+        [](std::size_t batchSize, const PetscInt points[], const PetscReal y[], PetscReal f[]) {
+            for (std::size_t p = 0; p < batchSize; ++p) {
+                f[p] = points[p] == 1 ? std::numeric_limits<PetscReal>::quiet_NaN() : -y[p];
+            }
+        },
+        {.dtInit = 1E-3, .dtMin = 1E-6, .dtMax = 1E-2, .relativeTolerance = 1E-6, .absoluteTolerance = 1E-10});
+    std::vector<PetscReal> y = {1.0, 2.0, 3.0};
+
+    // act
+    integrator.Solve(y.size(), y.data(), 0.0, 1.0) >> ablate::utilities::PetscUtilities::checkError;
+
+    // assert
+    ASSERT_EQ(integrator.GetFailedPoints(), std::vector<PetscInt>{1});
+    ASSERT_EQ(integrator.GetStatistics().failedPoints, (std::size_t)1);
+    ASSERT_DOUBLE_EQ(integrator.GetPointTime(1), 0.0);
+    ASSERT_DOUBLE_EQ(y[1], 2.0) << "the failed point should be left at the last accepted step";
+    ASSERT_NEAR(y[0], 1.0 * PetscExpReal(-1.0), 1E-4);
+    ASSERT_NEAR(y[2], 3.0 * PetscExpReal(-1.0), 3E-4);
+    ASSERT_NEAR(integrator.GetPointTime(2), 1.0, 1E-12);
+}
+
+TEST(BatchedStiffIntegratorTests, ShouldReportPointsThatFailTheErrorTestAtTheMinimumTimeStep) {
+    // arrange
+    // the second point grows so quickly that the error test cannot be met at the minimum time step, even though Newton converges for the linear rhs
+    ablate::finiteVolume::processes::BatchedStiffIntegrator integrator(
+        1,
+        [](std::size_t batchSize, const PetscInt points[], const PetscReal y[], PetscReal f[]) {
+            for (std::size_t p = 0; p < batchSize; ++p) {
+                f[p] = points[p] == 1 ? 1E6 * y[p] : -y[p];
+            }
+        },
+        {.dtInit = 1E-6, .dtMin = 1E-6, .dtMax = 1E-2, .relativeTolerance = 1E-6, .absoluteTolerance = 1E-10});
+    std::vector<PetscReal> y = {1.0, 2.0, 3.0};
+
+    // act
+    integrator.Solve(y.size(), y.data(), 0.0, 1.0) >> ablate::utilities::PetscUtilities::checkError;
+
+    // assert
+    ASSERT_EQ(integrator.GetFailedPoints(), std::vector<PetscInt>{1});
+    ASSERT_EQ(integrator.GetStatistics().failedPoints, (std::size_t)1);
+    ASSERT_EQ(integrator.GetStatistics().newtonFailures, (std::size_t)0);
+    ASSERT_DOUBLE_EQ(integrator.GetPointTime(1), 0.0);
+    ASSERT_DOUBLE_EQ(y[1], 2.0) << "the failed point should be left at the last accepted step";
+    ASSERT_NEAR(y[0], 1.0 * PetscExpReal(-1.0), 1E-4);
+    ASSERT_NEAR(y[2], 3.0 * PetscExpReal(-1.0), 3E-4);
+}
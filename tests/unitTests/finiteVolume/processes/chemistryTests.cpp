@@ -0,0 +1,244 @@
+#include <petsc.h>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/chemistryModel.hpp"
+#include "finiteVolume/finiteVolumeSolver.hpp"
+#include "finiteVolume/processes/chemistry.hpp"
+#include "gtest/gtest.h"
+#include "mpiTestFixture.hpp"
+#include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
+
+/**
+ * Simple chemistry model where the source in each cell only depends upon the solution in that cell.  Cells with a solution above one are slow to integrate so that
+ * the rank that owns them is more expensive than the others.
+ */
+class TestChemistryModel : public ablate::eos::ChemistryModel {
+   public:
+    inline const static std::string SOLUTION_FIELD = "solution";
+
+    class TestSourceCalculator : public SourceCalculator {
+       private:
+        TestChemistryModel& model;
+        const ablate::domain::Field solutionField;
+        const PetscInt rangeStart;
+        std::vector<PetscReal> sources;
+
+       public:
+        TestSourceCalculator(TestChemistryModel& model, const ablate::domain::Field& solutionField, const ablate::domain::Range& cellRange)
+            : model(model), solutionField(solutionField), rangeStart(cellRange.start), sources((cellRange.end - cellRange.start) * solutionField.numberComponents, 0.0) {}
+
+        void ComputeSource(const ablate::domain::Range& cellRange, PetscReal time, PetscReal dt, Vec solution) override {
+            DM dm;
+            VecGetDM(solution, &dm) >> ablate::utilities::PetscUtilities::checkError;
+            const PetscScalar* solutionArray;
+            VecGetArrayRead(solution, &solutionArray) >> ablate::utilities::PetscUtilities::checkError;
+            for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+                const PetscScalar* cellSolution;
+                DMPlexPointLocalFieldRead(dm, cellRange.GetPoint(i), solutionField.id, solutionArray, &cellSolution) >> ablate::utilities::PetscUtilities::checkError;
+                if (cellSolution[0] > 1.0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(500));
+                }
+                for (PetscInt d = 0; d < solutionField.numberComponents; ++d) {
+                    sources[(i - rangeStart) * solutionField.numberComponents + d] = dt * (time + (PetscReal)(d + 1) * PetscSinReal(cellSolution[d]));
+                }
+                model.integratedCells++;
+            }
+            VecRestoreArrayRead(solution, &solutionArray) >> ablate::utilities::PetscUtilities::checkError;
+        }
+
+        void AddSource(const ablate::domain::Range& cellRange, Vec, Vec source) override {
+            DM dm;
+            VecGetDM(source, &dm) >> ablate::utilities::PetscUtilities::checkError;
+            PetscScalar* sourceArray;
+            VecGetArray(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+            for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+                PetscScalar* cellSource;
+                DMPlexPointLocalFieldRef(dm, cellRange.GetPoint(i), solutionField.id, sourceArray, &cellSource) >> ablate::utilities::PetscUtilities::checkError;
+                for (PetscInt d = 0; d < solutionField.numberComponents; ++d) {
+                    cellSource[d] += sources[(i - rangeStart) * solutionField.numberComponents + d];
+                }
+            }
+            VecRestoreArray(source, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+        }
+    };
+
+    // the number of cells integrated on this rank, including the cells shipped from other ranks
+    PetscInt integratedCells = 0;
+
+    TestChemistryModel() : ablate::eos::ChemistryModel("TestChemistryModel") {}
+
+    void View(std::ostream& stream) const override { stream << "TestChemistryModel" << std::endl; }
+
+    [[nodiscard]] ablate::eos::ThermodynamicFunction GetThermodynamicFunction(ablate::eos::ThermodynamicProperty, const std::vector<ablate::domain::Field>&) const override {
+        throw std::invalid_argument("the TestChemistryModel does not support thermodynamic functions");
+    }
+
+    [[nodiscard]] ablate::eos::ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ablate::eos::ThermodynamicProperty, const std::vector<ablate::domain::Field>&) const override {
+        throw std::invalid_argument("the TestChemistryModel does not support thermodynamic functions");
+    }
+
+    [[nodiscard]] ablate::eos::EOSFunction GetFieldFunctionFunction(const std::string&, ablate::eos::ThermodynamicProperty, ablate::eos::ThermodynamicProperty,
+                                                                    std::vector<std::string>) const override {
+        throw std::invalid_argument("the TestChemistryModel does not support field functions");
+    }
+
+    [[nodiscard]] const std::vector<std::string>& GetSpeciesVariables() const override { return noVariables; }
+
+    [[nodiscard]] const std::vector<std::string>& GetProgressVariables() const override { return noVariables; }
+
+    std::shared_ptr<SourceCalculator> CreateSourceCalculator(const std::vector<ablate::domain::Field>& fields, const ablate::domain::Range& cellRange) override {
+        for (const auto& field : fields) {
+            if (field.name == SOLUTION_FIELD) {
+                return std::make_shared<TestSourceCalculator>(*this, field, cellRange);
+            }
+        }
+        throw std::invalid_argument("the TestChemistryModel requires the " + SOLUTION_FIELD + " field");
+    }
+
+   private:
+    const std::vector<std::string> noVariables;
+};
+
+struct ChemistryLoadBalanceTestParameters {
+    testingResources::MpiTestParameter mpiTestParameter;
+    std::vector<int> meshFaces;
+};
+
+class ChemistryLoadBalanceTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<ChemistryLoadBalanceTestParameters> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+
+   protected:
+    /**
+     * Compute the chemistry rhs for every local dof.  The cells owned by the first rank are slow to integrate.  The pre-stage is called twice so the cost of each rank is known
+     * when the second source is computed.
+     * @param numberOwnedCells the number of cells owned by this rank
+     */
+    static std::vector<PetscScalar> ComputeChemistryRHS(const std::vector<int>& meshFaces, const std::shared_ptr<TestChemistryModel>& model, bool loadBalance, PetscInt& numberOwnedCells) {
+        auto domain = std::make_shared<ablate::domain::BoxMesh>(
+            "chemistryMesh",
+            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::domain::FieldDescription>(
+                TestChemistryModel::SOLUTION_FIELD, "", std::vector<std::string>{"u0", "u1"}, ablate::domain::FieldLocation::SOL, ablate::domain::FieldType::FVM)},
+            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{std::make_shared<ablate::domain::modifiers::DistributeWithGhostCells>(1)},
+            meshFaces,
+            std::vector<double>(meshFaces.size(), 0.0),
+            std::vector<double>(meshFaces.size(), 1.0));
+
+        auto fvSolver = std::make_shared<ablate::finiteVolume::FiniteVolumeSolver>(
+            "chemistrySolver",
+            ablate::domain::Region::ENTIREDOMAIN,
+            nullptr /*options*/,
+            std::vector<std::shared_ptr<ablate::finiteVolume::processes::Process>>{std::make_shared<ablate::finiteVolume::processes::Chemistry>(model, loadBalance)},
+            std::vector<std::shared_ptr<ablate::finiteVolume::boundaryConditions::BoundaryCondition>>{});
+        domain->InitializeSubDomains({fvSolver});
+
+        PetscMPIInt rank;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> ablate::utilities::MpiUtilities::checkError;
+
+        // set a different state in each owned cell, the cells on the first rank are expensive
+        DM dm = domain->GetDM();
+        const auto& solutionField = fvSolver->GetSubDomain().GetField(TestChemistryModel::SOLUTION_FIELD);
+        Vec locX, locF;
+        DMGetLocalVector(dm, &locX) >> ablate::utilities::PetscUtilities::checkError;
+        DMGetLocalVector(dm, &locF) >> ablate::utilities::PetscUtilities::checkError;
+        VecZeroEntries(locX) >> ablate::utilities::PetscUtilities::checkError;
+        VecZeroEntries(locF) >> ablate::utilities::PetscUtilities::checkError;
+
+        ablate::domain::Range cellRange;
+        fvSolver->GetCellRangeWithoutGhost(cellRange);
+        numberOwnedCells = cellRange.end - cellRange.start;
+        PetscScalar* locXArray;
+        VecGetArray(locX, &locXArray) >> ablate::utilities::PetscUtilities::checkError;
+        for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+            const PetscInt cell = cellRange.GetPoint(i);
+            PetscScalar* solution;
+            DMPlexPointLocalFieldRef(dm, cell, solutionField.id, locXArray, &solution) >> ablate::utilities::PetscUtilities::checkError;
+            solution[0] = (rank == 0 ? 2.0 : 0.0) + 0.01 * (PetscReal)(cell % 13);
+            solution[1] = 0.5 + 0.02 * (PetscReal)(cell % 7);
+        }
+        VecRestoreArray(locX, &locXArray) >> ablate::utilities::PetscUtilities::checkError;
+        fvSolver->RestoreRange(cellRange);
+        DMLocalToGlobal(dm, locX, INSERT_VALUES, domain->GetSolutionVector()) >> ablate::utilities::PetscUtilities::checkError;
+        DMGlobalToLocal(dm, domain->GetSolutionVector(), INSERT_VALUES, locX) >> ablate::utilities::PetscUtilities::checkError;
+
+        // act
+        TS ts;
+        TSCreate(PETSC_COMM_WORLD, &ts) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetSolution(ts, domain->GetSolutionVector()) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetTime(ts, 0.5) >> ablate::utilities::PetscUtilities::checkError;
+        TSSetTimeStep(ts, 1.0E-3) >> ablate::utilities::PetscUtilities::checkError;
+        fvSolver->PreStage(ts, 0.5);
+        model->integratedCells = 0;
+        fvSolver->PreStage(ts, 0.5);
+        fvSolver->ComputeRHSFunction(0.5, locX, locF) >> ablate::utilities::PetscUtilities::checkError;
+        TSDestroy(&ts) >> ablate::utilities::PetscUtilities::checkError;
+
+        // copy the result
+        PetscInt size;
+        VecGetLocalSize(locF, &size) >> ablate::utilities::PetscUtilities::checkError;
+        const PetscScalar* locFArray;
+        VecGetArrayRead(locF, &locFArray) >> ablate::utilities::PetscUtilities::checkError;
+        std::vector<PetscScalar> rhs(locFArray, locFArray + size);
+        VecRestoreArrayRead(locF, &locFArray) >> ablate::utilities::PetscUtilities::checkError;
+
+        DMRestoreLocalVector(dm, &locX) >> ablate::utilities::PetscUtilities::checkError;
+        DMRestoreLocalVector(dm, &locF) >> ablate::utilities::PetscUtilities::checkError;
+        return rhs;
+    }
+};
+
+TEST_P(ChemistryLoadBalanceTestFixture, ShouldComputeTheSameSourceWhenLoadBalanced) {
+    StartWithMPI
+        {
+            // initialize petsc and mpi
+            ablate::environment::RunEnvironment::Initialize(argc, argv);
+            ablate::utilities::PetscUtilities::Initialize();
+
+            // arrange
+            auto unbalancedModel = std::make_shared<TestChemistryModel>();
+            auto balancedModel = std::make_shared<TestChemistryModel>();
+            PetscInt numberOwnedCells;
+
+            // act
+            auto unbalancedRHS = ComputeChemistryRHS(GetParam().meshFaces, unbalancedModel, false, numberOwnedCells);
+            auto balancedRHS = ComputeChemistryRHS(GetParam().meshFaces, balancedModel, true, numberOwnedCells);
+
+            // assert
+            ASSERT_EQ(unbalancedRHS.size(), balancedRHS.size());
+            PetscReal maxMagnitude = 0.0;
+            for (std::size_t i = 0; i < unbalancedRHS.size(); ++i) {
+                // each cell is integrated with the same function on whichever rank it is shipped to, so the result should be identical
+                ASSERT_DOUBLE_EQ(balancedRHS[i], unbalancedRHS[i]) << "the rhs differs at " << i;
+                maxMagnitude = PetscMax(maxMagnitude, PetscAbsReal(unbalancedRHS[i]));
+            }
+            ASSERT_GT(maxMagnitude, 0.0) << "the chemistry rhs should not be zero";
+
+            // without balancing each rank only integrates its own cells
+            ASSERT_EQ(unbalancedModel->integratedCells, numberOwnedCells);
+
+            // every cell is integrated exactly once, and some of the expensive cells must have been integrated on another rank
+            PetscInt cellCounts[2] = {balancedModel->integratedCells, numberOwnedCells};
+            MPI_Allreduce(MPI_IN_PLACE, cellCounts, 2, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD) >> ablate::utilities::MpiUtilities::checkError;
+            ASSERT_EQ(cellCounts[0], cellCounts[1]);
+            PetscInt maxExtraCells = balancedModel->integratedCells - numberOwnedCells;
+            MPI_Allreduce(MPI_IN_PLACE, &maxExtraCells, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD) >> ablate::utilities::MpiUtilities::checkError;
+            ASSERT_GT(maxExtraCells, 0) << "the expensive cells should be shipped to the other rank";
+        }
+        ablate::environment::RunEnvironment::Finalize();
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(Chemistry, ChemistryLoadBalanceTestFixture,
+                         testing::Values((ChemistryLoadBalanceTestParameters){.mpiTestParameter = testingResources::MpiTestParameter("2DQuadMPI", 2), .meshFaces = {10, 10}},
+                                         (ChemistryLoadBalanceTestParameters){.mpiTestParameter = testingResources::MpiTestParameter("2DQuad3RankMPI", 3), .meshFaces = {12, 12}}),
+                         [](const testing::TestParamInfo<ChemistryLoadBalanceTestParameters>& info) { return info.param.mpiTestParameter.getTestName(); });
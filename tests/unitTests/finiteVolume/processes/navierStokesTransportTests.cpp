@@ -1,12 +1,19 @@
 #include <petsc.h>
 #include <petscTestFixture.hpp>
 #include <vector>
+#include "domain/boxMesh.hpp"
 #include "domain/mockField.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
 #include "eos/perfectGas.hpp"
+#include "eos/transport/constant.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/finiteVolumeSolver.hpp"
 #include "finiteVolume/fluxCalculator/ausm.hpp"
 #include "finiteVolume/processes/navierStokesTransport.hpp"
 #include "gtest/gtest.h"
+#include "mathFunctions/simpleFormula.hpp"
 #include "parameters/mapParameters.hpp"
+#include "utilities/constants.hpp"
 
 struct NavierStokesTransportFluxTestParameters {
     std::shared_ptr<ablate::finiteVolume::fluxCalculator::FluxCalculator> fluxCalculator;
@@ -115,4 +122,113 @@ INSTANTIATE_TEST_SUITE_P(EulerTransportTests, StressTensorTestFixture,
                                              .dim = 3, .mu = 1.5, .gradVel = {-1, -2, -3, -4, -5, -6, -7, -8, -9}, .expectedStressTensor = {12, -9, -15, -9, 0, -21, -15, -21, -12}},
                                          (StressTensorTestParameters){.dim = 3, .mu = 0.0, .gradVel = {1, 2, 3, 4, 5, 6, 7, 8, 9}, .expectedStressTensor = {0, 0, 0, 0, 0, 0, 0, 0, 0}},
                                          (StressTensorTestParameters){.dim = 3, .mu = 0.7, .gradVel = {0, 0, 0, 0, 0, 0, 0, 0, 0}, .expectedStressTensor = {0, 0, 0, 0, 0, 0, 0, 0, 0}}),
-                         [](const testing::TestParamInfo<StressTensorTestParameters> &info) { return "InputParameters_" + std::to_string(info.index); });
\ No newline at end of file
+                         [](const testing::TestParamInfo<StressTensorTestParameters> &info) { return "InputParameters_" + std::to_string(info.index); });
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class NavierStokesTransportTimeStepTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(NavierStokesTransportTimeStepTestFixture, ShouldMatchThePerFunctionTimeSteps) {
+    // arrange
+    auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287.0"}}));
+    auto transportModel = std::make_shared<ablate::eos::transport::Constant>(0.5 /*k*/, 0.3 /*mu*/);
+
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("testMesh",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{std::make_shared<ablate::domain::modifiers::GhostBoundaryCells>()},
+                                                            std::vector<int>{4, 3},
+                                                            std::vector<double>{.0, .0},
+                                                            std::vector<double>{1, .5});
+
+    // compute every time step with the fused function
+    auto parameters = std::make_shared<ablate::parameters::MapParameters>(
+        std::map<std::string, std::string>{{"cfl", "0.4"}, {"conductionStabilityFactor", "0.3"}, {"viscousStabilityFactor", "0.2"}});
+    auto fvObject = std::make_shared<ablate::finiteVolume::FiniteVolumeSolver>(
+        "testFV",
+        ablate::domain::Region::ENTIREDOMAIN,
+        nullptr /*options*/,
+        std::vector<std::shared_ptr<ablate::finiteVolume::processes::Process>>{
+            std::make_shared<ablate::finiteVolume::processes::NavierStokesTransport>(parameters, eos, std::make_shared<ablate::finiteVolume::fluxCalculator::Ausm>(), transportModel)},
+        std::vector<std::shared_ptr<ablate::finiteVolume::boundaryConditions::BoundaryCondition>>{});
+
+    // vary the density, energy, and velocity in each cell so that the minimum of each time step comes from a different cell
+    auto initialEuler = std::make_shared<ablate::mathFunctions::FieldFunction>(
+        "euler", std::make_shared<ablate::mathFunctions::SimpleFormula>("1.0 + 0.5*x, (1.0 + 0.5*x)*(2.5E5 + 1.0E5*y), (1.0 + 0.5*x)*(10 + 50*y), (1.0 + 0.5*x)*(-20*x)"));
+    domain->InitializeSubDomains({fvObject}, std::make_shared<ablate::domain::Initializer>(initialEuler));
+
+    TS ts;
+    TSCreate(PETSC_COMM_SELF, &ts) >> errorChecker;
+    TSSetDM(ts, domain->GetDM()) >> errorChecker;
+    TSSetSolution(ts, domain->GetSolutionVector()) >> errorChecker;
+
+    // act
+    auto timeSteps = fvObject->ComputePhysicsTimeSteps(ts);
+
+    // assert
+    // compute each time step in its own pass over the cells, decoding the temperature from the conserved values at each cell
+    const auto& fields = fvObject->GetSubDomain().GetFields();
+    auto temperatureFunction = eos->GetThermodynamicFunction(ablate::eos::ThermodynamicProperty::Temperature, fields);
+    auto speedOfSoundFunction = eos->GetThermodynamicTemperatureFunction(ablate::eos::ThermodynamicProperty::SpeedOfSound, fields);
+    auto specificHeatFunction = eos->GetThermodynamicTemperatureFunction(ablate::eos::ThermodynamicProperty::SpecificHeatConstantVolume, fields);
+    auto densityFunction = eos->GetThermodynamicTemperatureFunction(ablate::eos::ThermodynamicProperty::Density, fields);
+    auto kFunction = transportModel->GetTransportTemperatureFunction(ablate::eos::transport::TransportProperty::Conductivity, fields);
+    auto muFunction = transportModel->GetTransportTemperatureFunction(ablate::eos::transport::TransportProperty::Viscosity, fields);
+
+    DM characteristicsDm;
+    Vec characteristicsVec;
+    fvObject->GetMeshCharacteristics(characteristicsDm, characteristicsVec);
+    const PetscScalar* characteristicsArray;
+    VecGetArrayRead(characteristicsVec, &characteristicsArray) >> errorChecker;
+    const PetscScalar* x;
+    VecGetArrayRead(domain->GetSolutionVector(), &x) >> errorChecker;
+
+    PetscReal expectedCfl = ablate::utilities::Constants::large;
+    PetscReal expectedConduction = ablate::utilities::Constants::large;
+    PetscReal expectedViscous = ablate::utilities::Constants::large;
+    PetscInt numberCells = 0;
+    ablate::domain::Range cellRange;
+    fvObject->GetCellRangeWithoutGhost(cellRange);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.GetPoint(c);
+        const PetscReal* conserved = nullptr;
+        const PetscReal* cellCharacteristics = nullptr;
+        DMPlexPointGlobalRead(domain->GetDM(), cell, x, &conserved) >> errorChecker;
+        DMPlexPointLocalRead(characteristicsDm, cell, characteristicsArray, &cellCharacteristics) >> errorChecker;
+        if (!conserved) {
+            continue;
+        }
+        numberCells++;
+
+        const PetscReal* euler = conserved + fvObject->GetSubDomain().GetField(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD).offset;
+        const PetscReal dx = 2.0 * cellCharacteristics[ablate::finiteVolume::FiniteVolumeSolver::MIN_CELL_RADIUS];
+
+        PetscReal temperature, speedOfSound, cv, rho, k, mu;
+        temperatureFunction.function(conserved, &temperature, temperatureFunction.context.get()) >> errorChecker;
+        speedOfSoundFunction.function(conserved, temperature, &speedOfSound, speedOfSoundFunction.context.get()) >> errorChecker;
+        specificHeatFunction.function(conserved, temperature, &cv, specificHeatFunction.context.get()) >> errorChecker;
+        densityFunction.function(conserved, temperature, &rho, densityFunction.context.get()) >> errorChecker;
+        kFunction.function(conserved, temperature, &k, kFunction.context.get()) >> errorChecker;
+        muFunction.function(conserved, temperature, &mu, muFunction.context.get()) >> errorChecker;
+
+        PetscReal velocitySum = 0.0;
+        for (PetscInt d = 0; d < domain->GetDimensions(); d++) {
+            velocitySum += PetscAbsReal(euler[ablate::finiteVolume::CompressibleFlowFields::RHOU + d]) / euler[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        }
+        expectedCfl = PetscMin(expectedCfl, 0.4 * dx / (speedOfSound + velocitySum));
+        expectedConduction = PetscMin(expectedConduction, PetscAbs(0.3 * PetscSqr(dx) / (k / (rho * cv))));
+        expectedViscous = PetscMin(expectedViscous, PetscAbs(0.2 * PetscSqr(dx) / (mu / rho)));
+    }
+    fvObject->RestoreRange(cellRange);
+    VecRestoreArrayRead(domain->GetSolutionVector(), &x) >> errorChecker;
+    VecRestoreArrayRead(characteristicsVec, &characteristicsArray) >> errorChecker;
+
+    ASSERT_EQ(numberCells, 12);
+    ASSERT_EQ(timeSteps.size(), (std::size_t)3);
+    ASSERT_NEAR(timeSteps.at("cfl"), expectedCfl, 1E-10 * expectedCfl);
+    ASSERT_NEAR(timeSteps.at("cond"), expectedConduction, 1E-10 * expectedConduction);
+    ASSERT_NEAR(timeSteps.at("visc"), expectedViscous, 1E-10 * expectedViscous);
+
+    // the physics time step is the smallest of the three
+    ASSERT_NEAR(fvObject->ComputePhysicsTimeStep(ts), PetscMin(expectedCfl, PetscMin(expectedConduction, expectedViscous)), 1E-10 * expectedCfl);
+
+    TSDestroy(&ts) >> errorChecker;
+}
@@ -0,0 +1,202 @@
+#include <petsc.h>
+#include <map>
+#include <memory>
+#include <petscTestFixture.hpp>
+#include <string>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "eos/tChem.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/extraVariable.hpp"
+#include "finiteVolume/finiteVolumeSolver.hpp"
+#include "finiteVolume/processes/soot.hpp"
+#include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
+
+/**
+ * The state used to set up each cell.  Only the density, yi, ndd, and temperature are used by the soot process.
+ */
+struct SootCellState {
+    PetscReal density;
+    PetscReal temperature;
+    std::map<std::string, PetscReal> yi;
+    PetscReal ndd;
+};
+
+class SootTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    /**
+     * Compute the soot source (densityYi..., rhoE, densityProgress) for each cell on a one dimensional mesh with one cell per state
+     */
+    std::vector<std::vector<PetscReal>> ComputeSootSource(const std::vector<SootCellState>& cellStates, PetscReal dt, const std::shared_ptr<ablate::parameters::Parameters>& options = {}) {
+        auto eos = std::make_shared<ablate::eos::TChem>("inputs/eos/MMAReduced.soot.yml");
+
+        auto domain = std::make_shared<ablate::domain::BoxMesh>(
+            "sootMesh",
+            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos),
+                                                                          std::make_shared<ablate::finiteVolume::ExtraVariable>("Progress", std::vector<std::string>{"NDD"})},
+            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{std::make_shared<ablate::domain::modifiers::GhostBoundaryCells>()},
+            std::vector<int>{(int)cellStates.size()},
+            std::vector<double>{0.0},
+            std::vector<double>{1.0});
+
+        auto fvObject = std::make_shared<ablate::finiteVolume::FiniteVolumeSolver>("sootSolver",
+                                                                                   ablate::domain::Region::ENTIREDOMAIN,
+                                                                                   nullptr /*options*/,
+                                                                                   std::vector<std::shared_ptr<ablate::finiteVolume::processes::Process>>{
+                                                                                       std::make_shared<ablate::finiteVolume::processes::Soot>(eos, options)},
+                                                                                   std::vector<std::shared_ptr<ablate::finiteVolume::boundaryConditions::BoundaryCondition>>{});
+        domain->InitializeSubDomains({fvObject});
+        auto& subDomain = fvObject->GetSubDomain();
+
+        const auto& eulerField = subDomain.GetField(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD);
+        const auto& densityYiField = subDomain.GetField(ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD);
+        const auto& densityProgressField = subDomain.GetField(ablate::finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD);
+        const auto& temperatureField = subDomain.GetField(ablate::finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD);
+
+        // set the state in each cell, the boundary ghost cells are not integrated
+        DM dm = domain->GetDM();
+        Vec locX, locF;
+        DMGetLocalVector(dm, &locX) >> errorChecker;
+        DMGetLocalVector(dm, &locF) >> errorChecker;
+        VecZeroEntries(locX) >> errorChecker;
+        VecZeroEntries(locF) >> errorChecker;
+
+        PetscScalar* locXArray;
+        PetscScalar* auxArray;
+        VecGetArray(locX, &locXArray) >> errorChecker;
+        VecGetArray(subDomain.GetAuxVector(), &auxArray) >> errorChecker;
+        for (PetscInt c = 0; c < (PetscInt)cellStates.size(); ++c) {
+            const auto& state = cellStates[c];
+            PetscScalar *euler, *densityYi, *densityProgress, *temperature;
+            DMPlexPointLocalFieldRef(dm, c, eulerField.id, locXArray, &euler) >> errorChecker;
+            DMPlexPointLocalFieldRef(dm, c, densityYiField.id, locXArray, &densityYi) >> errorChecker;
+            DMPlexPointLocalFieldRef(dm, c, densityProgressField.id, locXArray, &densityProgress) >> errorChecker;
+            DMPlexPointLocalFieldRef(subDomain.GetAuxDM(), c, temperatureField.id, auxArray, &temperature) >> errorChecker;
+
+            euler[ablate::finiteVolume::CompressibleFlowFields::RHO] = state.density;
+            for (const auto& [species, yi] : state.yi) {
+                densityYi[densityYiField.ComponentIndex(species)] = state.density * yi;
+            }
+            densityProgress[0] = state.density * state.ndd;
+            *temperature = state.temperature;
+        }
+        VecRestoreArray(subDomain.GetAuxVector(), &auxArray) >> errorChecker;
+        VecRestoreArray(locX, &locXArray) >> errorChecker;
+
+        // act
+        TS ts;
+        TSCreate(PETSC_COMM_SELF, &ts) >> errorChecker;
+        TSSetTimeStep(ts, dt) >> errorChecker;
+        fvObject->PreRHSFunction(ts, 0.0, true, locX) >> errorChecker;
+        fvObject->ComputeRHSFunction(0.0, locX, locF) >> errorChecker;
+        TSDestroy(&ts) >> errorChecker;
+
+        // copy the source for each cell
+        std::vector<std::vector<PetscReal>> sources;
+        const PetscScalar* locFArray;
+        VecGetArrayRead(locF, &locFArray) >> errorChecker;
+        for (PetscInt c = 0; c < (PetscInt)cellStates.size(); ++c) {
+            const PetscScalar *euler, *densityYi, *densityProgress;
+            DMPlexPointLocalFieldRead(dm, c, eulerField.id, locFArray, &euler) >> errorChecker;
+            DMPlexPointLocalFieldRead(dm, c, densityYiField.id, locFArray, &densityYi) >> errorChecker;
+            DMPlexPointLocalFieldRead(dm, c, densityProgressField.id, locFArray, &densityProgress) >> errorChecker;
+
+            std::vector<PetscReal> source(densityYi, densityYi + densityYiField.numberComponents);
+            source.push_back(euler[ablate::finiteVolume::CompressibleFlowFields::RHOE]);
+            source.push_back(densityProgress[0]);
+            sources.push_back(source);
+        }
+        VecRestoreArrayRead(locF, &locFArray) >> errorChecker;
+
+        DMRestoreLocalVector(dm, &locX) >> errorChecker;
+        DMRestoreLocalVector(dm, &locF) >> errorChecker;
+        return sources;
+    }
+};
+
+/**
+ * each cell has a different density/yi so that any mix up in the active cell indexing changes the result.  The third cell has nothing to react and is skipped.
+ */
+static const std::vector<SootCellState> sootCellStates = {
+    {.density = 0.20, .temperature = 1800.0, .yi = {{"C2H2", 0.05}, {"O2", 0.10}, {"H2", 0.01}, {"N2", 0.84}}, .ndd = 0.0},
+    {.density = 0.18,
+     .temperature = 2000.0,
+     .yi = {{"C2H2", 0.02}, {"O2", 0.05}, {"OH", 0.001}, {"O", 0.001}, {"H", 0.0005}, {"H2", 0.01}, {"CO", 0.05}, {"C(S)", 0.001}, {"N2", 0.8665}},
+     .ndd = 1.0E15},
+    {.density = 0.23, .temperature = 1500.0, .yi = {{"O2", 0.23}, {"N2", 0.77}}, .ndd = 0.0},
+    {.density = 0.16, .temperature = 2200.0, .yi = {{"C(S)", 0.005}, {"O2", 0.10}, {"OH", 0.002}, {"N2", 0.893}}, .ndd = 1.0E16}};
+
+TEST_F(SootTestFixture, ShouldComputeTheSameSourceInABatchAsForEachCell) {
+    // arrange
+    const auto& cellStates = sootCellStates;
+    const PetscReal dt = 1.0E-5;
+
+    // act
+    auto batchedSources = ComputeSootSource(cellStates, dt);
+    std::vector<std::vector<PetscReal>> perCellSources;
+    for (const auto& cellState : cellStates) {
+        perCellSources.push_back(ComputeSootSource({cellState}, dt).front());
+    }
+
+    // assert
+    ASSERT_EQ(batchedSources.size(), perCellSources.size());
+    for (std::size_t c = 0; c < cellStates.size(); ++c) {
+        ASSERT_EQ(batchedSources[c].size(), perCellSources[c].size());
+        for (std::size_t i = 0; i < perCellSources[c].size(); ++i) {
+            // each cell is integrated with its own time step, so the result should not depend on the rest of the batch
+            ASSERT_DOUBLE_EQ(batchedSources[c][i], perCellSources[c][i]) << "the source differs for cell " << c << " component " << i;
+        }
+    }
+
+    // the cells with something to react should have a source, the inert cell should not
+    for (std::size_t c = 0; c < cellStates.size(); ++c) {
+        PetscReal maxMagnitude = 0.0;
+        for (const auto& value : batchedSources[c]) {
+            maxMagnitude = PetscMax(maxMagnitude, PetscAbsReal(value));
+        }
+        if (c == 2) {
+            ASSERT_EQ(maxMagnitude, 0.0) << "the inert cell should not have a source";
+        } else {
+            ASSERT_GT(maxMagnitude, 0.0) << "the soot source should not be zero for cell " << c;
+        }
+    }
+}
+
+TEST_F(SootTestFixture, ShouldMatchTheSourceFromThePointTs) {
+    // arrange
+    // use tight tolerances so that the difference between the batched SDIRK and ARKIMEX4 point TS is well below the size of the source
+    const PetscReal dt = 1.0E-4;
+    auto batchedOptions = ablate::parameters::MapParameters::Create({{"ts_rtol", "1E-10"}, {"ts_atol", "1E-12"}});
+    auto pointTsOptions = ablate::parameters::MapParameters::Create({{"ts_type", "arkimex"}, {"ts_rtol", "1E-10"}, {"ts_atol", "1E-12"}});
+
+    // act
+    auto batchedSources = ComputeSootSource(sootCellStates, dt, batchedOptions);
+    auto pointTsSources = ComputeSootSource(sootCellStates, dt, pointTsOptions);
+
+    // assert
+    ASSERT_EQ(batchedSources.size(), pointTsSources.size());
+    for (std::size_t c = 0; c < sootCellStates.size(); ++c) {
+        ASSERT_EQ(batchedSources[c].size(), pointTsSources[c].size());
+        PetscReal maxMagnitude = 0.0;
+        for (const auto& value : pointTsSources[c]) {
+            maxMagnitude = PetscMax(maxMagnitude, PetscAbsReal(value));
+        }
+        for (std::size_t i = 0; i < pointTsSources[c].size(); ++i) {
+            ASSERT_NEAR(batchedSources[c][i], pointTsSources[c][i], 1E-3 * PetscAbsReal(pointTsSources[c][i]) + 1E-6 * maxMagnitude)
+                << "the source differs from the point TS for cell " << c << " component " << i;
+        }
+    }
+}
+
+TEST_F(SootTestFixture, ShouldThrowForUnsupportedOptions) {
+    // arrange
+    auto eos = std::make_shared<ablate::eos::TChem>("inputs/eos/MMAReduced.soot.yml");
+
+    // act
+    // assert
+    ASSERT_THROW(ablate::finiteVolume::processes::Soot(eos, ablate::parameters::MapParameters::Create({{"ts_max_snes_failures", "-1"}})), std::invalid_argument);
+    ASSERT_THROW(ablate::finiteVolume::processes::Soot(eos, ablate::parameters::MapParameters::Create({{"ts_type", "rosw"}})), std::invalid_argument);
+    ASSERT_NO_THROW(ablate::finiteVolume::processes::Soot(eos, ablate::parameters::MapParameters::Create({{"ts_type", "arkimex"}, {"ts_dt", "1E-7"}})));
+}
@@ -107,6 +107,67 @@ TEST_P(TwoPhaseEulerAdvectionTestDecodeStateFixture, ShouldDecodeState) {
     ASSERT_NEAR(alpha, params.expectedAlpha, 1E-6);
 }
 
+TEST_P(TwoPhaseEulerAdvectionTestDecodeStateFixture, ShouldDecodeStateWhenWarmStarted) {
+    // arrange
+    const auto& params = GetParam();
+    PetscInt uOff[3] = {3 + params.dim /*alpha*/, 2 + params.dim /*rho1alpha1*/, 0 /*euler*/};
+    auto decoder = finiteVolume::processes::TwoPhaseEulerAdvection::CreateTwoPhaseDecoder(params.dim, params.eosGas, params.eosLiquid);
+
+    // Prepare outputs
+    PetscReal density, densityG, densityL, normalVelocity, internalEnergy, internalEnergyG, internalEnergyL, soundSpeedG, soundSpeedL, MG, ML, pressure, temperature, alpha;
+    std::vector<PetscReal> velocity(3);
+    auto decode = [&]() {
+        decoder->DecodeTwoPhaseEulerState(params.dim,
+                                          uOff,
+                                          params.conservedValuesIn.data(),
+                                          &params.normalIn[0],
+                                          &density,
+                                          &densityG,
+                                          &densityL,
+                                          &normalVelocity,
+                                          &velocity[0],
+                                          &internalEnergy,
+                                          &internalEnergyG,
+                                          &internalEnergyL,
+                                          &soundSpeedG,
+                                          &soundSpeedL,
+                                          &MG,
+                                          &ML,
+                                          &pressure,
+                                          &temperature,
+                                          &alpha);
+    };
+
+    // act
+    // decode without a guess
+    decode();
+    const PetscReal coldDensityG = densityG, coldDensityL = densityL, coldInternalEnergyG = internalEnergyG, coldInternalEnergyL = internalEnergyL, coldPressure = pressure,
+                    coldAlpha = alpha;
+
+    // decode again from a perturbed guess
+    densityG = densityL = internalEnergyG = internalEnergyL = pressure = alpha = NAN;
+    PetscReal guess[4] = {1.1 * params.expectedDensityG, 0.9 * params.expectedDensityL, 0.9 * params.expectedInternalEnergyG, 1.1 * params.expectedInternalEnergyL};
+    decoder->SetInitialGuess(guess);
+    decode();
+
+    // assert
+    // the warm started decode should find the expected state
+    ASSERT_NEAR(densityG, params.expectedDensityG, 1E-6);
+    ASSERT_NEAR(densityL, params.expectedDensityL, 1E-6);
+    ASSERT_NEAR(internalEnergyG, params.expectedInternalEnergyG, params.expectedInternalEnergyG * 1E-6);
+    ASSERT_NEAR(internalEnergyL, params.expectedInternalEnergyL, params.expectedInternalEnergyL * 1E-6);
+    ASSERT_NEAR(pressure, params.expectedPressure, 1E-2);
+    ASSERT_NEAR(alpha, params.expectedAlpha, 1E-6);
+
+    // and match the decode without a guess
+    ASSERT_NEAR(densityG, coldDensityG, 1E-6);
+    ASSERT_NEAR(densityL, coldDensityL, 1E-6);
+    ASSERT_NEAR(internalEnergyG, coldInternalEnergyG, PetscAbsReal(coldInternalEnergyG) * 1E-6);
+    ASSERT_NEAR(internalEnergyL, coldInternalEnergyL, PetscAbsReal(coldInternalEnergyL) * 1E-6);
+    ASSERT_NEAR(pressure, coldPressure, 1E-2);
+    ASSERT_NEAR(alpha, coldAlpha, 1E-6);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TwoPhaseEulerAdvectionTests, TwoPhaseEulerAdvectionTestDecodeStateFixture,
     testing::Values(
@@ -0,0 +1,133 @@
+#include <petsc.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include "finiteVolume/slopeLimiters.hpp"
+#include "gtest/gtest.h"
+#include "petscTestFixture.hpp"
+
+using namespace ablate::finiteVolume;
+
+struct SymmetricLimiterTestParameters {
+    std::string petscType;
+    slopeLimiters::LimiterType expectedType;
+    std::function<PetscReal(PetscReal)> function;
+};
+
+class SymmetricLimiterTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<SymmetricLimiterTestParameters> {};
+
+TEST_P(SymmetricLimiterTestFixture, ShouldMatchPetscLimiter) {
+    // arrange
+    const auto& params = GetParam();
+    PetscLimiter limiter;
+    PetscLimiterCreate(PETSC_COMM_SELF, &limiter) >> errorChecker;
+    PetscLimiterSetType(limiter, params.petscType.c_str()) >> errorChecker;
+
+    // act
+    auto type = slopeLimiters::GetLimiterType(limiter);
+
+    // assert
+    ASSERT_EQ(params.expectedType, type);
+    for (PetscReal f = -1.0; f <= 2.0; f += 0.01) {
+        PetscReal expectedPhi;
+        PetscLimiterLimit(limiter, f, &expectedPhi) >> errorChecker;
+        ASSERT_DOUBLE_EQ(expectedPhi, params.function(f)) << "for f " << f;
+    }
+
+    // cleanup
+    PetscLimiterDestroy(&limiter) >> errorChecker;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SlopeLimiterTests, SymmetricLimiterTestFixture,
+    testing::Values((SymmetricLimiterTestParameters){.petscType = PETSCLIMITERNONE, .expectedType = slopeLimiters::LimiterType::None, .function = slopeLimiters::None{}},
+                    (SymmetricLimiterTestParameters){.petscType = PETSCLIMITERZERO, .expectedType = slopeLimiters::LimiterType::Zero, .function = slopeLimiters::Zero{}},
+                    (SymmetricLimiterTestParameters){.petscType = PETSCLIMITERSIN, .expectedType = slopeLimiters::LimiterType::Sin, .function = slopeLimiters::Sin{}},
+                    (SymmetricLimiterTestParameters){.petscType = PETSCLIMITERMINMOD, .expectedType = slopeLimiters::LimiterType::Minmod, .function = slopeLimiters::Minmod{}},
+                    (SymmetricLimiterTestParameters){.petscType = PETSCLIMITERVANLEER, .expectedType = slopeLimiters::LimiterType::VanLeer, .function = slopeLimiters::VanLeer{}},
+                    (SymmetricLimiterTestParameters){.petscType = PETSCLIMITERVANALBADA, .expectedType = slopeLimiters::LimiterType::VanAlbada, .function = slopeLimiters::VanAlbada{}},
+                    (SymmetricLimiterTestParameters){.petscType = PETSCLIMITERSUPERBEE, .expectedType = slopeLimiters::LimiterType::Superbee, .function = slopeLimiters::Superbee{}},
+                    (SymmetricLimiterTestParameters){.petscType = PETSCLIMITERMC, .expectedType = slopeLimiters::LimiterType::MC, .function = slopeLimiters::MC{}}),
+    [](const testing::TestParamInfo<SymmetricLimiterTestParameters>& info) { return info.param.petscType; });
+
+class BoundedLimiterTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    // a one dimensional cell (u = 1) between a left (u = 0) and right (u = 3) neighbor
+    const std::vector<PetscScalar> x = {0.0, 1.0, 3.0};
+    const std::vector<PetscInt> neighborOffsets = {0, 2};
+    const std::vector<PetscReal> neighborDx = {-1.0, 1.0};
+
+    slopeLimiters::CellStencil GetStencil() const {
+        slopeLimiters::CellStencil stencil{};
+        stencil.dim = 1;
+        stencil.dof = 1;
+        stencil.u = x.data() + 1;
+        stencil.xArray = x.data();
+        stencil.numberNeighbors = (PetscInt)neighborOffsets.size();
+        stencil.neighborOffsets = neighborOffsets.data();
+        stencil.neighborDx = neighborDx.data();
+        stencil.cellLength = 1.0;
+        return stencil;
+    }
+};
+
+TEST_F(BoundedLimiterTestFixture, ShouldBoundReconstructionWithBarthJespersen) {
+    // arrange
+    PetscScalar grad = 5.0;
+    PetscReal work[3];
+
+    // act
+    slopeLimiters::ComputeBounded(slopeLimiters::BarthJespersen{}, GetStencil(), &grad, work);
+
+    // assert
+    // the left midpoint reconstruction (1 - 2.5) must be limited to the neighborhood minimum (0)
+    ASSERT_DOUBLE_EQ(0.4, work[0]);
+}
+
+TEST_F(BoundedLimiterTestFixture, ShouldNotLimitSmoothReconstructionWithBarthJespersen) {
+    // arrange
+    PetscScalar grad = 1.0;
+    PetscReal work[3];
+
+    // act
+    slopeLimiters::ComputeBounded(slopeLimiters::BarthJespersen{}, GetStencil(), &grad, work);
+
+    // assert
+    ASSERT_DOUBLE_EQ(1.0, work[0]);
+}
+
+TEST_F(BoundedLimiterTestFixture, ShouldComputeVenkatakrishnanLimiter) {
+    // arrange
+    PetscScalar grad = 5.0;
+    PetscReal work[3];
+
+    // act
+    slopeLimiters::ComputeBounded(slopeLimiters::Venkatakrishnan{.k = 0.0}, GetStencil(), &grad, work);
+
+    // assert
+    ASSERT_DOUBLE_EQ(0.375, work[0]);
+}
+
+TEST_F(BoundedLimiterTestFixture, ShouldCreateRegisteredLimitersFromOptions) {
+    // arrange
+    slopeLimiters::Register();
+    PetscOptions options;
+    PetscOptionsCreate(&options) >> errorChecker;
+    PetscOptionsSetValue(options, "-petsclimiter_type", slopeLimiters::venkatakrishnanName) >> errorChecker;
+    PetscOptionsSetValue(options, "-petsclimiter_venkatakrishnan_k", "2.5") >> errorChecker;
+
+    PetscLimiter limiter;
+    PetscLimiterCreate(PETSC_COMM_SELF, &limiter) >> errorChecker;
+    PetscObjectSetOptions((PetscObject)limiter, options) >> errorChecker;
+
+    // act
+    PetscLimiterSetFromOptions(limiter) >> errorChecker;
+
+    // assert
+    ASSERT_EQ(slopeLimiters::LimiterType::Venkatakrishnan, slopeLimiters::GetLimiterType(limiter));
+    ASSERT_DOUBLE_EQ(2.5, slopeLimiters::GetVenkatakrishnanK(limiter));
+
+    // cleanup
+    PetscLimiterDestroy(&limiter) >> errorChecker;
+    PetscOptionsDestroy(&options) >> errorChecker;
+}
@@ -0,0 +1,179 @@
+#include <petsc.h>
+#include <yaml-cpp/yaml.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include "gtest/gtest.h"
+#include "io/interval/mockInterval.hpp"
+#include "io/hdf5MultiFileSerializer.hpp"
+#include "petscTestFixture.hpp"
+#include "temporaryPath.hpp"
+#include "testRunEnvironment.hpp"
+
+namespace ablateTesting::io {
+
+/**
+ * Simple serializable that saves the time to each file
+ */
+class TestSerializable : public ablate::io::Serializable {
+   private:
+    const std::string id;
+
+   public:
+    explicit TestSerializable(std::string id) : id(std::move(id)) {}
+
+    [[nodiscard]] const std::string& GetId() const override { return id; }
+
+    PetscErrorCode Save(PetscViewer viewer, PetscInt, PetscReal time) override {
+        PetscFunctionBeginUser;
+        PetscCall(SaveKeyValue(viewer, "time", time));
+        PetscFunctionReturn(0);
+    }
+
+    PetscErrorCode Restore(PetscViewer, PetscInt, PetscReal) override { return 0; }
+};
+
+/**
+ * Serializer that runs the provided function before each staged file is moved
+ */
+class TestHdf5MultiFileSerializer : public ablate::io::Hdf5MultiFileSerializer {
+   private:
+    const std::function<void()> beforeMove;
+
+   protected:
+    void MoveStagedFile(const std::filesystem::path& stagedFilePath, const std::filesystem::path& filePath) override {
+        beforeMove();
+        Hdf5MultiFileSerializer::MoveStagedFile(stagedFilePath, filePath);
+    }
+
+   public:
+    TestHdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, const std::string& stagingDirectory, int maxPendingWrites, std::function<void()> beforeMove)
+        : Hdf5MultiFileSerializer(std::move(interval), nullptr, stagingDirectory, maxPendingWrites), beforeMove(std::move(beforeMove)) {}
+};
+
+class Hdf5MultiFileSerializerTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    std::shared_ptr<ablateTesting::io::interval::MockInterval> interval;
+    std::shared_ptr<TestSerializable> serializable;
+    TS ts = nullptr;
+
+    void SetUp() override {
+        PetscTestFixture::SetUp();
+        interval = std::make_shared<ablateTesting::io::interval::MockInterval>();
+        EXPECT_CALL(*interval, Check(testing::_, testing::_, testing::_)).WillRepeatedly(testing::Return(true));
+        serializable = std::make_shared<TestSerializable>("testSerializable");
+        TSCreate(PETSC_COMM_WORLD, &ts) >> errorChecker;
+        TSSetTimeStep(ts, 0.1) >> errorChecker;
+    }
+
+    void TearDown() override { TSDestroy(&ts) >> errorChecker; }
+
+    static std::filesystem::path OutputFile(const std::filesystem::path& directory, int sequenceNumber) {
+        std::stringstream fileName;
+        fileName << "testSerializable." << std::setw(5) << std::setfill('0') << sequenceNumber << ".hdf5";
+        return directory / "testSerializable" / fileName.str();
+    }
+};
+
+TEST_F(Hdf5MultiFileSerializerTestFixture, ShouldWaitWhenThePendingWriteQueueIsFull) {
+    // arrange
+    testingResources::TemporaryPath rootPath;
+    testingResources::TestRunEnvironment testRunEnvironment(rootPath.GetPath() / "output");
+    std::atomic<int> movedFiles = 0;
+    auto serializer = std::make_shared<TestHdf5MultiFileSerializer>(interval, rootPath.GetPath() / "staging", 1, [&movedFiles]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        movedFiles++;
+    });
+    serializer->Register(serializable);
+
+    // act
+    serializer->Serialize(ts, 1, 0.1, nullptr) >> errorChecker;
+    serializer->Serialize(ts, 2, 0.2, nullptr) >> errorChecker;
+
+    // assert - the second save can only start once the first has been moved
+    ASSERT_GE(movedFiles, 1);
+    serializer->Flush();
+    ASSERT_EQ(movedFiles, 2);
+}
+
+TEST_F(Hdf5MultiFileSerializerTestFixture, ShouldOnlyRecordMovedWritesInTheRestartFile) {
+    // arrange
+    testingResources::TemporaryPath rootPath;
+    testingResources::TestRunEnvironment testRunEnvironment(rootPath.GetPath() / "output");
+    std::atomic<bool> releaseMove = false;
+    auto serializer = std::make_shared<TestHdf5MultiFileSerializer>(interval, rootPath.GetPath() / "staging", 2, [&releaseMove]() {
+        while (!releaseMove) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    });
+    serializer->Register(serializable);
+    auto restartFilePath = rootPath.GetPath() / "output" / "restart.rst";
+
+    // act
+    serializer->Serialize(ts, 1, 0.1, nullptr) >> errorChecker;
+    serializer->Serialize(ts, 2, 0.2, nullptr) >> errorChecker;
+
+    // assert - nothing has been moved so nothing can be restarted from
+    ASSERT_FALSE(std::filesystem::exists(restartFilePath));
+    ASSERT_FALSE(std::filesystem::exists(OutputFile(rootPath.GetPath() / "output", 0)));
+
+    // act
+    releaseMove = true;
+    serializer->Flush();
+
+    // assert
+    ASSERT_TRUE(std::filesystem::exists(restartFilePath));
+    auto restart = YAML::LoadFile(restartFilePath);
+    ASSERT_EQ(restart["sequenceNumber"].as<PetscInt>(), 1);
+    ASSERT_EQ(restart["timeStep"].as<PetscInt>(), 2);
+    ASSERT_TRUE(std::filesystem::exists(OutputFile(rootPath.GetPath() / "output", 0)));
+    ASSERT_TRUE(std::filesystem::exists(OutputFile(rootPath.GetPath() / "output", 1)));
+}
+
+TEST_F(Hdf5MultiFileSerializerTestFixture, ShouldMoveStagedWritesWhenDestroyedWithoutUpdatingTheRestartFile) {
+    // arrange
+    testingResources::TemporaryPath rootPath;
+    testingResources::TestRunEnvironment testRunEnvironment(rootPath.GetPath() / "output");
+    auto serializer = std::make_shared<ablate::io::Hdf5MultiFileSerializer>(interval, nullptr, rootPath.GetPath() / "staging", 2);
+    serializer->Register(serializable);
+    serializer->Serialize(ts, 1, 0.1, nullptr) >> errorChecker;
+
+    // act
+    serializer.reset();
+
+    // assert - the restart file is only updated by the collective Flush
+    ASSERT_FALSE(std::filesystem::exists(rootPath.GetPath() / "output" / "restart.rst"));
+    ASSERT_TRUE(std::filesystem::exists(OutputFile(rootPath.GetPath() / "output", 0)));
+    ASSERT_FALSE(std::filesystem::exists(OutputFile(rootPath.GetPath() / "staging", 0)));
+}
+
+TEST_F(Hdf5MultiFileSerializerTestFixture, ShouldRethrowWriterErrors) {
+    // arrange
+    testingResources::TemporaryPath rootPath;
+    testingResources::TestRunEnvironment testRunEnvironment(rootPath.GetPath() / "output");
+    int moveCount = 0;
+    auto serializer = std::make_shared<TestHdf5MultiFileSerializer>(interval, rootPath.GetPath() / "staging", 2, [&moveCount]() {
+        if (moveCount++ > 0) {
+            throw std::runtime_error("unable to move the staged file");
+        }
+    });
+    serializer->Register(serializable);
+    serializer->Serialize(ts, 1, 0.1, nullptr) >> errorChecker;
+    serializer->Flush();
+
+    // act
+    serializer->Serialize(ts, 2, 0.2, nullptr) >> errorChecker;
+
+    // assert
+    ASSERT_THROW(serializer->Flush(), std::runtime_error);
+    ASSERT_THROW(serializer->Serialize(ts, 3, 0.3, nullptr), std::runtime_error);
+    ASSERT_EQ(YAML::LoadFile(rootPath.GetPath() / "output" / "restart.rst")["sequenceNumber"].as<PetscInt>(), 0);
+}
+
+}  // namespace ablateTesting::io
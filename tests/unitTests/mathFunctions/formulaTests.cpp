@@ -1,3 +1,5 @@
+#include <Kokkos_Core.hpp>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <set>
@@ -7,6 +9,7 @@
 #include "mockFactory.hpp"
 #include "parameters/mapParameters.hpp"
 #include "registrar.hpp"
+#include "utilities/kokkosUtilities.hpp"
 
 namespace ablateTesting::mathFunctions {
 
@@ -77,6 +80,30 @@ TEST_P(FormulaScalarFixture, ShouldComputeCorrectAnswerFromCoord) {
     ASSERT_DOUBLE_EQ(param.expectedResult, function.Eval(array1, 3, 4.0));
 }
 
+TEST_P(FormulaScalarFixture, ShouldComputeCorrectAnswerConcurrently) {
+    // arrange
+    const auto& param = GetParam();
+    ablate::utilities::KokkosUtilities::Initialize();
+    auto function = ablate::mathFunctions::Formula(param.formula, ToFunctionMap(param.nested), param.constants);
+    const std::size_t numberEvaluations = 4000;
+
+    // act
+    // evaluate over the host threads, each thread uses the parser state for its host thread id
+    std::size_t incorrectResults = 0;
+    Kokkos::parallel_reduce(
+        "FormulaScalarFixture::ShouldComputeCorrectAnswerConcurrently",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, numberEvaluations),
+        [&](const std::size_t, std::size_t& incorrect) {
+            if (std::abs(function.Eval(1.0, 2.0, 3.0, 4.0) - param.expectedResult) > 1E-12) {
+                incorrect++;
+            }
+        },
+        incorrectResults);
+
+    // assert
+    ASSERT_EQ(0, incorrectResults) << "the formula computed an incorrect result on " << incorrectResults << " evaluations";
+}
+
 INSTANTIATE_TEST_SUITE_P(FormulaTests, FormulaScalarFixture,
                          testing::Values((FormulaScalarParameters){.formula = "v*x", .nested = {{"v", "2.0"}}, .constants = {}, .expectedResult = 2.0},
                                          (FormulaScalarParameters){.formula = "v*x + z", .nested = {{"v", "3.0*y"}}, .constants = {}, .expectedResult = 9.0},
@@ -0,0 +1,127 @@
+#include <petsc.h>
+#include <memory>
+#include <petscTestFixture.hpp>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "particles/accessors/eulerianSourceAccessor.hpp"
+#include "particles/coupledParticleSolver.hpp"
+#include "particles/initializers/cellInitializer.hpp"
+
+class CoupledParticleSolverTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(CoupledParticleSolverTestFixture, ShouldDepositParticleSourcesIntoTheirCells) {
+    // arrange
+    // a one and two component finite volume field to couple to the particles
+    std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {
+        std::make_shared<ablate::domain::FieldDescription>("alpha", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::SOL, ablate::domain::FieldType::FVM),
+        std::make_shared<ablate::domain::FieldDescription>("beta", "", std::vector<std::string>{"beta0", "beta1"}, ablate::domain::FieldLocation::SOL, ablate::domain::FieldType::FVM)};
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("testMesh",
+                                                            fieldDescriptors,
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{3, 3},
+                                                            std::vector<double>{0.0, 0.0},
+                                                            std::vector<double>{1.0, 1.0},
+                                                            std::vector<std::string>{"NONE", "NONE"},
+                                                            false /*simplex*/);
+
+    // put two particles in every cell
+    auto particleSolver = std::make_shared<ablate::particles::CoupledParticleSolver>(
+        "particles",
+        ablate::domain::Region::ENTIREDOMAIN,
+        nullptr /*options*/,
+        std::vector<ablate::particles::FieldDescription>{{ablate::particles::ParticleSolver::ParticleVelocity, ablate::domain::FieldLocation::SOL, {"u", "v"}}},
+        std::vector<std::shared_ptr<ablate::particles::processes::Process>>{},
+        std::make_shared<ablate::particles::initializers::CellInitializer>(2),
+        std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>>{
+            std::make_shared<ablate::mathFunctions::FieldFunction>(ablate::particles::ParticleSolver::ParticleVelocity, ablate::mathFunctions::Create("0.0, 0.0"))},
+        std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>>{},
+        std::vector<std::string>{"alpha", "beta"});
+    domain->InitializeSubDomains({particleSolver});
+    DM dm = domain->GetDM();
+    const auto& alphaField = domain->GetField("alpha");
+    const auto& betaField = domain->GetField("beta");
+
+    // set a known source on every particle and sum the expected source in each cell
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+    std::vector<PetscReal> expectedAlpha(cEnd - cStart, 0.0);
+    std::vector<PetscReal> expectedBeta(2 * (cEnd - cStart), 0.0);
+    PetscReal totalAlpha = 0.0;
+    PetscReal totalBeta[2] = {0.0, 0.0};
+
+    DM swarmDm = particleSolver->GetParticleDM();
+    PetscInt numberParticles;
+    DMSwarmGetLocalSize(swarmDm, &numberParticles) >> errorChecker;
+    ASSERT_EQ(numberParticles, 2 * (cEnd - cStart));
+    PetscInt* cellIds;
+    PetscReal *alphaSource, *betaSource;
+    const auto alphaSourceName = std::string("alpha") + ablate::particles::accessors::EulerianSourceAccessor::CoupledSourceTermPostfix;
+    const auto betaSourceName = std::string("beta") + ablate::particles::accessors::EulerianSourceAccessor::CoupledSourceTermPostfix;
+    DMSwarmGetField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&cellIds) >> errorChecker;
+    DMSwarmGetField(swarmDm, alphaSourceName.c_str(), nullptr, nullptr, (void**)&alphaSource) >> errorChecker;
+    DMSwarmGetField(swarmDm, betaSourceName.c_str(), nullptr, nullptr, (void**)&betaSource) >> errorChecker;
+    for (PetscInt p = 0; p < numberParticles; ++p) {
+        alphaSource[p] = 1.0 + p;
+        betaSource[2 * p] = 2.0 * p;
+        betaSource[2 * p + 1] = -0.5 * p - 3.0;
+
+        const auto c = cellIds[p] - cStart;
+        expectedAlpha[c] += alphaSource[p];
+        expectedBeta[2 * c] += betaSource[2 * p];
+        expectedBeta[2 * c + 1] += betaSource[2 * p + 1];
+        totalAlpha += alphaSource[p];
+        totalBeta[0] += betaSource[2 * p];
+        totalBeta[1] += betaSource[2 * p + 1];
+    }
+    DMSwarmRestoreField(swarmDm, betaSourceName.c_str(), nullptr, nullptr, (void**)&betaSource) >> errorChecker;
+    DMSwarmRestoreField(swarmDm, alphaSourceName.c_str(), nullptr, nullptr, (void**)&alphaSource) >> errorChecker;
+    DMSwarmRestoreField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&cellIds) >> errorChecker;
+
+    // the source is spread over the flow dt
+    const PetscReal dt = 0.25;
+    TS ts;
+    TSCreate(PETSC_COMM_SELF, &ts) >> errorChecker;
+    TSSetTimeStep(ts, dt) >> errorChecker;
+    Vec locX, locF;
+    DMGetLocalVector(dm, &locX) >> errorChecker;
+    DMGetLocalVector(dm, &locF) >> errorChecker;
+    VecZeroEntries(locX) >> errorChecker;
+    VecZeroEntries(locF) >> errorChecker;
+
+    // act
+    particleSolver->PreRHSFunction(ts, 0.0, true, locX) >> errorChecker;
+    particleSolver->ComputeRHSFunction(0.0, locX, locF) >> errorChecker;
+
+    // assert
+    const PetscScalar* locFArray;
+    VecGetArrayRead(locF, &locFArray) >> errorChecker;
+    PetscReal depositedAlpha = 0.0;
+    PetscReal depositedBeta[2] = {0.0, 0.0};
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        const PetscScalar *alpha, *beta;
+        DMPlexPointLocalFieldRead(dm, c, alphaField.id, locFArray, &alpha) >> errorChecker;
+        DMPlexPointLocalFieldRead(dm, c, betaField.id, locFArray, &beta) >> errorChecker;
+
+        // each cell gets the sum of the particle sources in that cell
+        ASSERT_NEAR(alpha[0], expectedAlpha[c - cStart] / dt, 1E-12) << "alpha source for cell " << c;
+        ASSERT_NEAR(beta[0], expectedBeta[2 * (c - cStart)] / dt, 1E-12) << "beta0 source for cell " << c;
+        ASSERT_NEAR(beta[1], expectedBeta[2 * (c - cStart) + 1] / dt, 1E-12) << "beta1 source for cell " << c;
+
+        depositedAlpha += alpha[0] * dt;
+        depositedBeta[0] += beta[0] * dt;
+        depositedBeta[1] += beta[1] * dt;
+    }
+    VecRestoreArrayRead(locF, &locFArray) >> errorChecker;
+
+    // the deposition is conservative, the total cell source equals the total particle source
+    ASSERT_NEAR(depositedAlpha, totalAlpha, 1E-10);
+    ASSERT_NEAR(depositedBeta[0], totalBeta[0], 1E-10);
+    ASSERT_NEAR(depositedBeta[1], totalBeta[1], 1E-10);
+
+    DMRestoreLocalVector(dm, &locX) >> errorChecker;
+    DMRestoreLocalVector(dm, &locF) >> errorChecker;
+    TSDestroy(&ts) >> errorChecker;
+}
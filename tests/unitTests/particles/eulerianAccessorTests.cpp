@@ -0,0 +1,159 @@
+#include <petsc.h>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "domain/boxMesh.hpp"
+#include "domain/fieldDescription.hpp"
+#include "domain/initializer.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/fieldFunction.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "particles/accessors/eulerianAccessor.hpp"
+#include "particles/accessors/swarmAccessor.hpp"
+#include "particles/initializers/cellInitializer.hpp"
+#include "particles/particleSolver.hpp"
+#include "petscTestFixture.hpp"
+
+/**
+ * Expose the particle fields so that the accessors can be created outside of the particle rhs
+ */
+class EulerianAccessorTestSolver : public ablate::particles::ParticleSolver {
+   public:
+    using ParticleSolver::ParticleSolver;
+
+    [[nodiscard]] const std::map<std::string, ablate::particles::Field>& GetFieldsMap() const { return fieldsMap; }
+};
+
+class EulerianAccessorTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    std::shared_ptr<ablate::domain::BoxMesh> domain;
+    std::shared_ptr<EulerianAccessorTestSolver> particleSolver;
+
+    /**
+     * Create a 3x3 mesh with a two component alpha field of the given type and three randomly placed particles in every cell
+     */
+    void CreateDomain(ablate::domain::FieldType fieldType) {
+        auto fieldOptions = fieldType == ablate::domain::FieldType::FEM ? ablate::parameters::MapParameters::Create(std::map<std::string, std::string>{{"petscspace_degree", "1"}}) : nullptr;
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {std::make_shared<ablate::domain::FieldDescription>(
+            "alpha", "", std::vector<std::string>{"alpha0", "alpha1"}, ablate::domain::FieldLocation::SOL, fieldType, ablate::domain::Region::ENTIREDOMAIN, fieldOptions)};
+        domain = std::make_shared<ablate::domain::BoxMesh>("testMesh",
+                                                           fieldDescriptors,
+                                                           std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                           std::vector<int>{3, 3},
+                                                           std::vector<double>{0.0, 0.0},
+                                                           std::vector<double>{1.0, 1.0},
+                                                           std::vector<std::string>{"NONE", "NONE"},
+                                                           false /*simplex*/);
+
+        particleSolver = std::make_shared<EulerianAccessorTestSolver>("particles",
+                                                                      ablate::domain::Region::ENTIREDOMAIN,
+                                                                      nullptr /*options*/,
+                                                                      std::vector<ablate::particles::FieldDescription>{},
+                                                                      std::vector<std::shared_ptr<ablate::particles::processes::Process>>{},
+                                                                      std::make_shared<ablate::particles::initializers::CellInitializer>(3),
+                                                                      std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>>{});
+
+        // use a field that varies in both directions so that each cell has a different value
+        auto alphaFunction = std::make_shared<ablate::mathFunctions::FieldFunction>("alpha", ablate::mathFunctions::Create("x + 2*y, 3*x*y + 1"));
+        domain->InitializeSubDomains({particleSolver}, std::make_shared<ablate::domain::Initializer>(alphaFunction));
+    }
+
+    /**
+     * Compare the EulerianAccessor values at every particle to a DMInterpolation of the same field at the same locations
+     */
+    void AssertAccessorMatchesDMInterpolation() {
+        auto subDomain = domain->GetSubDomain(ablate::domain::Region::ENTIREDOMAIN);
+        const auto& alphaField = subDomain->GetField("alpha");
+        DM swarmDm = particleSolver->GetParticleDM();
+
+        Vec solutionVec;
+        DMSwarmCreateGlobalVectorFromField(swarmDm, ablate::particles::ParticleSolver::PackedSolution, &solutionVec) >> errorChecker;
+        {
+            ablate::particles::accessors::SwarmAccessor swarmAccessor(false, swarmDm, particleSolver->GetFieldsMap(), solutionVec);
+            ablate::particles::accessors::EulerianAccessor eulerianAccessor(false, subDomain, swarmAccessor, 0.0);
+            const PetscInt np = swarmAccessor.GetNumberParticles();
+            ASSERT_EQ(np, 27);
+
+            // act
+            auto alphaData = eulerianAccessor["alpha"];
+
+            // compute the expected values with a DMInterpolation over all the particles
+            std::vector<PetscReal> coordinates(np * subDomain->GetDimensions());
+            swarmAccessor[ablate::particles::ParticleSolver::ParticleCoordinates].CopyAll(coordinates.data(), np);
+
+            Vec locAlphaVec;
+            IS alphaIs;
+            DM alphaDm;
+            subDomain->GetFieldLocalVector(alphaField, 0.0, &alphaIs, &locAlphaVec, &alphaDm) >> errorChecker;
+
+            DMInterpolationInfo interpolant;
+            DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> errorChecker;
+            DMInterpolationSetDim(interpolant, subDomain->GetDimensions()) >> errorChecker;
+            DMInterpolationSetDof(interpolant, alphaField.numberComponents) >> errorChecker;
+            DMInterpolationAddPoints(interpolant, np, coordinates.data()) >> errorChecker;
+            DMInterpolationSetUp(interpolant, alphaDm, PETSC_FALSE, PETSC_TRUE) >> errorChecker;
+            Vec expectedAlphaVec;
+            VecCreateSeq(PETSC_COMM_SELF, np * alphaField.numberComponents, &expectedAlphaVec) >> errorChecker;
+            DMInterpolationEvaluate(interpolant, alphaDm, locAlphaVec, expectedAlphaVec) >> errorChecker;
+            DMInterpolationDestroy(&interpolant) >> errorChecker;
+            subDomain->RestoreFieldLocalVector(alphaField, &alphaIs, &locAlphaVec, &alphaDm) >> errorChecker;
+
+            // assert
+            const PetscScalar* expectedAlpha;
+            VecGetArrayRead(expectedAlphaVec, &expectedAlpha) >> errorChecker;
+            for (PetscInt p = 0; p < np; ++p) {
+                for (PetscInt d = 0; d < alphaField.numberComponents; ++d) {
+                    ASSERT_NEAR(alphaData(p, d), expectedAlpha[p * alphaField.numberComponents + d], 1E-12) << "alpha" << d << " for particle " << p;
+                }
+            }
+            VecRestoreArrayRead(expectedAlphaVec, &expectedAlpha) >> errorChecker;
+            VecDestroy(&expectedAlphaVec) >> errorChecker;
+        }
+        DMSwarmDestroyGlobalVectorFromField(swarmDm, ablate::particles::ParticleSolver::PackedSolution, &solutionVec) >> errorChecker;
+    }
+};
+
+TEST_F(EulerianAccessorTestFixture, ShouldMatchDMInterpolationForFiniteVolumeFields) {
+    // arrange
+    CreateDomain(ablate::domain::FieldType::FVM);
+
+    // act/assert
+    AssertAccessorMatchesDMInterpolation();
+}
+
+TEST_F(EulerianAccessorTestFixture, ShouldMatchDMInterpolationForFiniteElementFields) {
+    // arrange
+    CreateDomain(ablate::domain::FieldType::FEM);
+
+    // act/assert
+    AssertAccessorMatchesDMInterpolation();
+}
+
+TEST_F(EulerianAccessorTestFixture, ShouldThrowForParticlesOutsideTheDomain) {
+    // arrange
+    CreateDomain(ablate::domain::FieldType::FVM);
+    auto subDomain = domain->GetSubDomain(ablate::domain::Region::ENTIREDOMAIN);
+    DM swarmDm = particleSolver->GetParticleDM();
+
+    // move the first particle outside the domain without migrating the swarm
+    const auto& coordinatesField = particleSolver->GetFieldsMap().at(ablate::particles::ParticleSolver::ParticleCoordinates);
+    Vec solutionVec;
+    DMSwarmCreateGlobalVectorFromField(swarmDm, ablate::particles::ParticleSolver::PackedSolution, &solutionVec) >> errorChecker;
+    PetscScalar* solution;
+    VecGetArray(solutionVec, &solution) >> errorChecker;
+    for (PetscInt d = 0; d < coordinatesField.numberComponents; ++d) {
+        solution[coordinatesField[0] + d] = 2.0;
+    }
+    VecRestoreArray(solutionVec, &solution) >> errorChecker;
+
+    // act/assert
+    {
+        ablate::particles::accessors::SwarmAccessor swarmAccessor(false, swarmDm, particleSolver->GetFieldsMap(), solutionVec);
+        ablate::particles::accessors::EulerianAccessor eulerianAccessor(false, subDomain, swarmAccessor, 0.0);
+        ASSERT_THROW(eulerianAccessor["alpha"], std::runtime_error);
+    }
+    DMSwarmDestroyGlobalVectorFromField(swarmDm, ablate::particles::ParticleSolver::PackedSolution, &solutionVec) >> errorChecker;
+}
@@ -1,6 +1,9 @@
 #include <petsc.h>
+#include <array>
 #include <mathFunctions/functionFactory.hpp>
 #include <memory>
+#include <utility>
+#include <vector>
 #include "builder.hpp"
 #include "convergenceTester.hpp"
 #include "domain/boxMesh.hpp"
@@ -18,6 +21,7 @@
 #include "radiation/radiation.hpp"
 #include "radiation/raySharingRadiation.hpp"
 #include "radiation/volumeRadiation.hpp"
+#include "utilities/petscSupport.hpp"
 #include "utilities/petscUtilities.hpp"
 
 struct RadiationTestParameters {
@@ -417,3 +421,164 @@ INSTANTIATE_TEST_SUITE_P(
                                           return std::make_shared<ablate::radiation::RaySharingRadiation>("radiationBase", interiorLabel, 20, radiationModelIn, nullptr);
                                       }}),
     [](const testing::TestParamInfo<RadiationTestParameters>& info) { return info.param.mpiTestParameter.getTestName(); });
+
+struct RadiationMarchTestParameters {
+    testingResources::MpiTestParameter mpiTestParameter;
+    std::vector<PetscReal> start;
+    std::vector<PetscReal> direction;
+};
+
+class RadiationMarchTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<RadiationMarchTestParameters> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
+/**
+ * Expose the search particle march so that the adjacency march can be compared against the analytic path lengths through a structured mesh
+ */
+class MarchTestRadiation : public ablate::radiation::Radiation {
+   public:
+    using ablate::radiation::Radiation::CellSegment;
+    using ablate::radiation::Radiation::Radiation;
+
+    //! march a ray through the local cell adjacency
+    std::vector<CellSegment> AdjacencyMarch(ablate::domain::SubDomain& subDomain, const std::vector<PetscReal>& start, const std::vector<PetscReal>& direction) {
+        BuildCellAdjacency(subDomain);
+
+        DM faceDM;
+        const PetscScalar* faceGeomArray;
+        VecGetDM(faceGeomVec, &faceDM) >> ablate::utilities::PetscUtilities::checkError;
+        VecGetArrayRead(faceGeomVec, &faceGeomArray) >> ablate::utilities::PetscUtilities::checkError;
+
+        auto virtualcoord = CreateVirtualcoord(start, direction);
+        PetscInt cell;
+        DMPlexGetContainingCell(subDomain.GetDM(), start.data(), &cell) >> ablate::utilities::PetscUtilities::checkError;
+
+        std::vector<CellSegment> ray;
+        MarchParticle(subDomain, faceDM, faceGeomArray, virtualcoord, cell, ray, Identifier{});
+
+        VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> ablate::utilities::PetscUtilities::checkError;
+        return ray;
+    }
+
+   private:
+    static Virtualcoord CreateVirtualcoord(const std::vector<PetscReal>& start, const std::vector<PetscReal>& direction) {
+        PetscReal magnitude = PetscSqrtReal(PetscSqr(direction[0]) + PetscSqr(direction[1]));
+        return Virtualcoord{.x = start[0], .y = start[1], .z = 0.0, .xdir = direction[0] / magnitude, .ydir = direction[1] / magnitude, .zdir = 0.0, .hhere = 0.0};
+    }
+};
+
+/**
+ * March a 2D ray through a uniform grid of square cells by stepping to the nearest grid line.  The ray ends with the first cell outside of the interior [0, 1]x[0, 1], which
+ * is followed by a boundary segment (path length of -1), the same as the radiation march.
+ * @param start the start of the ray
+ * @param direction the direction of the ray
+ * @param lower the lower corner of the grid including the boundary cells
+ * @param dx the size of each cell
+ * @return the center of each crossed cell and the path length through that cell
+ */
+static std::vector<std::pair<std::array<PetscReal, 2>, PetscReal>> StructuredMarch(const std::vector<PetscReal>& start, const std::vector<PetscReal>& direction, PetscReal lower, PetscReal dx) {
+    const PetscReal magnitude = PetscSqrtReal(PetscSqr(direction[0]) + PetscSqr(direction[1]));
+    const PetscReal dir[2] = {direction[0] / magnitude, direction[1] / magnitude};
+    PetscReal x[2] = {start[0], start[1]};
+    PetscInt index[2] = {(PetscInt)PetscFloorReal((x[0] - lower) / dx), (PetscInt)PetscFloorReal((x[1] - lower) / dx)};
+
+    std::vector<std::pair<std::array<PetscReal, 2>, PetscReal>> segments;
+    while (true) {
+        // the distance to the next grid line in each direction
+        PetscReal distance[2];
+        for (PetscInt d = 0; d < 2; ++d) {
+            if (PetscAbsReal(dir[d]) < 1E-12) {
+                distance[d] = PETSC_MAX_REAL;
+            } else {
+                const PetscReal gridLine = lower + (PetscReal)(index[d] + (dir[d] > 0 ? 1 : 0)) * dx;
+                distance[d] = (gridLine - x[d]) / dir[d];
+            }
+        }
+        const PetscReal pathLength = PetscMin(distance[0], distance[1]);
+
+        const std::array<PetscReal, 2> center = {lower + ((PetscReal)index[0] + 0.5) * dx, lower + ((PetscReal)index[1] + 0.5) * dx};
+        segments.emplace_back(center, pathLength);
+        if (center[0] < 0.0 || center[0] > 1.0 || center[1] < 0.0 || center[1] > 1.0) {
+            segments.emplace_back(center, -1.0);
+            return segments;
+        }
+
+        // step into the next cell, through the vertex into the diagonal cell if both grid lines are crossed together
+        for (PetscInt d = 0; d < 2; ++d) {
+            if (distance[d] - pathLength < 1E-10) {
+                index[d] += dir[d] > 0 ? 1 : -1;
+            }
+            x[d] += dir[d] * pathLength;
+        }
+    }
+}
+
+TEST_P(RadiationMarchTestFixture, ShouldMatchStructuredMeshPathLengths) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+            auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {
+                std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos, std::make_shared<ablate::domain::Region>("domain"))};
+
+            // a small box mesh so that rays at 45 degrees cross through the mesh vertices
+            auto domain = std::make_shared<ablate::domain::BoxMeshBoundaryCells>("simpleMesh",
+                                                                                 fieldDescriptors,
+                                                                                 std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                                                 std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                                                 std::vector<int>{4, 4},
+                                                                                 std::vector<double>{0.0, 0.0},
+                                                                                 std::vector<double>{1.0, 1.0},
+                                                                                 ablate::parameters::MapParameters::Create({{"dm_plex_hash_location", "true"}}));
+
+            auto initialConditionEuler = std::make_shared<ablate::mathFunctions::FieldFunction>("euler", std::make_shared<ablate::mathFunctions::ConstantValue>(0.0));
+            auto timeStepper = ablate::solver::TimeStepper(
+                "timeStepper", domain, ablate::parameters::MapParameters::Create({{"ts_max_steps", 0}}), {}, std::make_shared<ablate::domain::Initializer>(initialConditionEuler));
+
+            // Create an instance of radiation
+            auto radiationPropertiesModel = std::make_shared<ablate::eos::radiationProperties::Constant>(1.0, 1.0);
+            auto interiorLabel = std::make_shared<ablate::domain::Region>("interiorCells");
+            auto radiationModel = std::make_shared<MarchTestRadiation>("radiationBase", interiorLabel, 4, radiationPropertiesModel, nullptr);
+            auto radiation = std::make_shared<ablate::radiation::VolumeRadiation>("radiation", nullptr, radiationModel, nullptr, nullptr);
+            timeStepper.Register(radiation);
+            timeStepper.Solve();
+
+            // act
+            auto adjacencyRay = radiationModel->AdjacencyMarch(radiation->GetSubDomain(), GetParam().start, GetParam().direction);
+
+            // assert
+            // the 4x4 interior cells are surrounded by a layer of boundary cells, so the grid starts at -0.25 with cells of 0.25
+            auto expectedRay = StructuredMarch(GetParam().start, GetParam().direction, -0.25, 0.25);
+            ASSERT_EQ(expectedRay.size(), adjacencyRay.size());
+            for (std::size_t s = 0; s < expectedRay.size(); ++s) {
+                PetscReal centroid[3];
+                DMPlexComputeCellGeometryFVM(radiation->GetSubDomain().GetDM(), adjacencyRay[s].cell, nullptr, centroid, nullptr) >> ablate::utilities::PetscUtilities::checkError;
+                ASSERT_NEAR(expectedRay[s].first[0], centroid[0], 1E-12) << "for segment " << s;
+                ASSERT_NEAR(expectedRay[s].first[1], centroid[1], 1E-12) << "for segment " << s;
+                ASSERT_NEAR(expectedRay[s].second, adjacencyRay[s].pathLength, 1E-10) << "for segment " << s;
+            }
+            ASSERT_FALSE(adjacencyRay.empty());
+            ASSERT_EQ(-1, adjacencyRay.back().pathLength) << "the ray should end with a boundary segment";
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(RadiationTests, RadiationMarchTestFixture,
+                         testing::Values((RadiationMarchTestParameters){.mpiTestParameter = testingResources::MpiTestParameter("diagonal march through vertices"),
+                                                                        .start = {0.125, 0.125},
+                                                                        .direction = {1.0, 1.0}},
+                                         (RadiationMarchTestParameters){.mpiTestParameter = testingResources::MpiTestParameter("reverse diagonal march through vertices"),
+                                                                        .start = {0.875, 0.125},
+                                                                        .direction = {-1.0, 1.0}},
+                                         (RadiationMarchTestParameters){.mpiTestParameter = testingResources::MpiTestParameter("shallow march"),
+                                                                        .start = {0.125, 0.375},
+                                                                        .direction = {1.0, 0.3}},
+                                         (RadiationMarchTestParameters){.mpiTestParameter = testingResources::MpiTestParameter("axis march"),
+                                                                        .start = {0.625, 0.625},
+                                                                        .direction = {0.0, -1.0}}),
+                         [](const testing::TestParamInfo<RadiationMarchTestParameters>& info) { return info.param.mpiTestParameter.getTestName(); });